@@ -136,6 +136,20 @@ namespace IRacingTools::App::Commands {
       }
     }
 
+    auto logMetrics = [](std::string_view name, const auto& metrics) {
+      L->info(
+          "{} tasks >> completed={},cancelled={},deduplicated={},wait(max={}ms),run(total={}ms,max={}ms)",
+          name,
+          metrics.completed,
+          metrics.cancelled,
+          metrics.deduplicated,
+          metrics.maxWait.count() / 1000,
+          metrics.totalRun.count() / 1000,
+          metrics.maxRun.count() / 1000);
+    };
+    logMetrics("Telemetry data", tdService->taskMetrics());
+    logMetrics("Track map", tmService->taskMetrics());
+
     L->info("Destroying services");
     manager->destroy();
 
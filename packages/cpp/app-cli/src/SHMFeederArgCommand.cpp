@@ -137,10 +137,10 @@ namespace IRacingTools::App::Commands {
         return nullptr;
       }
 
-      virtual void onOverlayFrameData(OnFrameData fn) override {
+      virtual void onOverlayFrameData(OnFrameData fn, Graphics::FramePacer::TimePoint wakeAt) override {
         {
           std::unique_lock lock(notifyMutex_);
-          notifyCondition_.wait(lock);
+          notifyCondition_.wait_until(lock, wakeAt);
         }
 
         fn();
@@ -79,6 +79,13 @@ namespace IRacingTools::App::Commands {
         manager->init();
         L->info("Starting");
         manager->start();
+
+        auto timing = manager->timing();
+        L->info(
+            "Services ready in {}ms (init {}ms, start {}ms)",
+            std::chrono::duration_cast<std::chrono::milliseconds>(timing.init + timing.start).count(),
+            std::chrono::duration_cast<std::chrono::milliseconds>(timing.init).count(),
+            std::chrono::duration_cast<std::chrono::milliseconds>(timing.start).count());
         L->info("Waiting");
         manager->wait();
 
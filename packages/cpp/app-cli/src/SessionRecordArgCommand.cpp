@@ -11,6 +11,7 @@
 #include <windows.h>
 
 #include <IRacingTools/SDK/SessionInfo/ModelParser.h>
+#include <IRacingTools/SDK/SessionInfo/SessionInfoFastParser.h>
 #include <IRacingTools/SDK/LiveConnection.h>
 #include <IRacingTools/SDK/Utils/YamlParser.h>
 #include <IRacingTools/SDK/DiskClient.h>
@@ -313,11 +314,10 @@ namespace IRacingTools::App::Commands {
       auto sessionInfoData = LiveConnection::GetInstance().getSessionInfoStr();
       std::shared_ptr<SessionInfo::SessionInfoMessage> sessionInfo{nullptr};
       if (sessionInfoData) {
-        auto rootNode = YAML::Load(sessionInfoData);
         sessionInfo = std::make_shared<SessionInfo::SessionInfoMessage>();
         if (sessionInfo) {
           SessionInfo::SessionInfoMessage * sessionInfoMessage = sessionInfo.get();
-          *sessionInfoMessage = rootNode.as<SessionInfo::SessionInfoMessage>();
+          SessionInfo::DecodeSessionInfoMessage(sessionInfoData, *sessionInfoMessage);
         }
       }
 
@@ -17,11 +17,12 @@
 #include <conio.h>
 #include <csignal>
 #include <cstdio>
+#include <span>
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/spdlog.h>
 
 #include <IRacingTools/SDK/Types.h>
-#include <IRacingTools/SDK/Utils/YamlParser.h>
+#include <IRacingTools/SDK/Utils/YamlPathIndex.h>
 
 #include "console.h"
 #include <IRacingTools/SDK/LiveClient.h>
@@ -142,15 +143,15 @@ if(hDataValidEvent)
 
   //---------------------------
 
-  bool parceYamlInt(const char *yamlStr, const char *path, int *dest) {
+  bool parceYamlInt(const YamlPathIndex &yamlIndex, const char *path, int *dest) {
     if (dest) {
       (*dest) = 0;
 
-      if (yamlStr && path) {
+      if (path) {
         int count;
         const char *strPtr;
 
-        if (ParseYaml(yamlStr, path, &strPtr, &count)) {
+        if (yamlIndex.find(path, &strPtr, &count)) {
           (*dest) = atoi(strPtr);
           return true;
         }
@@ -160,15 +161,15 @@ if(hDataValidEvent)
     return false;
   }
 
-  bool parseYamlStr(const char *yamlStr, const char *path, char *dest, int maxCount) {
+  bool parseYamlStr(const YamlPathIndex &yamlIndex, const char *path, char *dest, int maxCount) {
     if (dest && maxCount > 0) {
       dest[0] = '\0';
 
-      if (yamlStr && path) {
+      if (path) {
         int count;
         const char *strPtr;
 
-        if (ParseYaml(yamlStr, path, &strPtr, &count)) {
+        if (yamlIndex.find(path, &strPtr, &count)) {
           // strip leading quotes
           if (*strPtr == '"') {
             strPtr++;
@@ -230,8 +231,12 @@ if(hDataValidEvent)
     if (g_lastTime > curTime)
       resetState(false);
 
+    // one bulk read for all cars
+    float curDistPcts[g_maxCars] = {};
+    g_CarIdxLapDistPct.getArray(std::span{curDistPcts});
+
     for (int i = 0; i < g_maxCars; i++) {
-      const float curDistPct = g_CarIdxLapDistPct.getFloat(i);
+      const float curDistPct = curDistPcts[i];
       // reject if the car blinked out of the world
       if (curDistPct != -1) {
         // did we cross the lap?
@@ -438,22 +443,24 @@ if(hDataValidEvent)
 
       // Pull some driver info into a local array
 
+      // index once, every lookup below is a few binary searches
+      YamlPathIndex yamlIndex(yamlStr);
       char tstr[256];
       for (int i = 0; i < g_maxCars; i++) {
         // skip the rest if carIdx not found
         sprintf(tstr, "DriverInfo:Drivers:CarIdx:{%d}", i);
-        if (parceYamlInt(yamlStr, tstr, &(g_driverTableTable[i].carIdx))) {
+        if (parceYamlInt(yamlIndex, tstr, &(g_driverTableTable[i].carIdx))) {
           sprintf(tstr, "DriverInfo:Drivers:CarIdx:{%d}CarClassID:", i);
-          parceYamlInt(yamlStr, tstr, &(g_driverTableTable[i].carClassId));
+          parceYamlInt(yamlIndex, tstr, &(g_driverTableTable[i].carClassId));
 
           sprintf(tstr, "DriverInfo:Drivers:CarIdx:{%d}UserName:", i);
-          parseYamlStr(yamlStr, tstr, g_driverTableTable[i].driverName, sizeof(g_driverTableTable[i].driverName) - 1);
+          parseYamlStr(yamlIndex, tstr, g_driverTableTable[i].driverName, sizeof(g_driverTableTable[i].driverName) - 1);
 
           sprintf(tstr, "DriverInfo:Drivers:CarIdx:{%d}TeamName:", i);
-          parseYamlStr(yamlStr, tstr, g_driverTableTable[i].teamName, sizeof(g_driverTableTable[i].teamName) - 1);
+          parseYamlStr(yamlIndex, tstr, g_driverTableTable[i].teamName, sizeof(g_driverTableTable[i].teamName) - 1);
 
           sprintf(tstr, "DriverInfo:Drivers:CarIdx:{%d}CarNumber:", i);
-          parseYamlStr(yamlStr, tstr, g_driverTableTable[i].carNumStr, sizeof(g_driverTableTable[i].carNumStr) - 1);
+          parseYamlStr(yamlIndex, tstr, g_driverTableTable[i].carNumStr, sizeof(g_driverTableTable[i].carNumStr) - 1);
 
           // TeamID
         }
@@ -21,7 +21,7 @@
 #include <IRacingTools/SDK/Types.h>
 #include <IRacingTools/SDK/VarHolder.h>
 
-#include <IRacingTools/SDK/Utils/YamlParser.h>
+#include <IRacingTools/SDK/Utils/YamlPathIndex.h>
 
 // for timeBeginPeriod
 #pragma comment(lib, "Winmm")
@@ -133,18 +133,18 @@ if(hDataValidEvent)
 
 //---------------------------
 
-bool parceYamlInt(const char* yamlStr, const char* path, int* dest)
+bool parceYamlInt(const Utils::YamlPathIndex& yamlIndex, const char* path, int* dest)
 {
     if (dest)
     {
         (*dest) = 0;
 
-        if (yamlStr && path)
+        if (path)
         {
             int count;
             const char* strPtr;
 
-            if (Utils::ParseYaml(yamlStr, path, &strPtr, &count))
+            if (yamlIndex.find(path, &strPtr, &count))
             {
                 (*dest) = atoi(strPtr);
                 return true;
@@ -155,18 +155,18 @@ bool parceYamlInt(const char* yamlStr, const char* path, int* dest)
     return false;
 }
 
-bool parseYamlStr(const char* yamlStr, const char* path, char* dest, int maxCount)
+bool parseYamlStr(const Utils::YamlPathIndex& yamlIndex, const char* path, char* dest, int maxCount)
 {
     if (dest && maxCount > 0)
     {
         dest[0] = '\0';
 
-        if (yamlStr && path)
+        if (path)
         {
             int count;
             const char* strPtr;
 
-            if (Utils::ParseYaml(yamlStr, path, &strPtr, &count))
+            if (yamlIndex.find(path, &strPtr, &count))
             {
                 // strip leading quotes
                 if (*strPtr == '"')
@@ -454,26 +454,28 @@ void processYAMLSessionString(const char* yamlStr)
 
         // Pull some driver info into a local array
 
+        // index once, every lookup below is a few binary searches
+        Utils::YamlPathIndex yamlIndex(yamlStr);
         char tstr[256];
         for (int i = 0; i < g_maxCars; i++)
         {
             // skip the rest if carIdx not found
             sprintf(tstr, "DriverInfo:Drivers:CarIdx:{%d}", i);
-            if (parceYamlInt(yamlStr, tstr, &(g_driverTableTable[i].carIdx)))
+            if (parceYamlInt(yamlIndex, tstr, &(g_driverTableTable[i].carIdx)))
             {
                 sprintf(tstr, "DriverInfo:Drivers:CarIdx:{%d}CarClassID:", i);
-                parceYamlInt(yamlStr, tstr, &(g_driverTableTable[i].carClassId));
+                parceYamlInt(yamlIndex, tstr, &(g_driverTableTable[i].carClassId));
 
                 sprintf(tstr, "DriverInfo:Drivers:CarIdx:{%d}UserName:", i);
                 parseYamlStr(
-                    yamlStr, tstr, g_driverTableTable[i].driverName, sizeof(g_driverTableTable[i].driverName) - 1
+                    yamlIndex, tstr, g_driverTableTable[i].driverName, sizeof(g_driverTableTable[i].driverName) - 1
                 );
 
                 sprintf(tstr, "DriverInfo:Drivers:CarIdx:{%d}TeamName:", i);
-                parseYamlStr(yamlStr, tstr, g_driverTableTable[i].teamName, sizeof(g_driverTableTable[i].teamName) - 1);
+                parseYamlStr(yamlIndex, tstr, g_driverTableTable[i].teamName, sizeof(g_driverTableTable[i].teamName) - 1);
 
                 sprintf(tstr, "DriverInfo:Drivers:CarIdx:{%d}CarNumber:", i);
-                parseYamlStr(yamlStr, tstr, g_driverTableTable[i].carNumStr, sizeof(g_driverTableTable[i].carNumStr) - 1);
+                parseYamlStr(yamlIndex, tstr, g_driverTableTable[i].carNumStr, sizeof(g_driverTableTable[i].carNumStr) - 1);
 
                 // TeamID
             }
@@ -151,7 +151,8 @@ void writeSessionItem(FILE *file, const char *path, const char *desc) {
     int valstrlen;
 
     fprintf(file, desc);
-    if (Utils::ParseYaml(LiveConnection::GetInstance().getSessionInfoStr(), path, &valstr, &valstrlen))
+    auto &conn = LiveConnection::GetInstance();
+    if (Utils::ParseYaml(conn.getSessionInfoStr(), static_cast<std::int32_t>(conn.getSessionUpdateCount()), path, &valstr, &valstrlen))
         fwrite(valstr, 1, valstrlen, file);
     fprintf(file, "\n");
 }
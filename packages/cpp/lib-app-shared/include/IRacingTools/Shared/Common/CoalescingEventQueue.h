@@ -0,0 +1,187 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace IRacingTools::Shared::Common {
+
+  /**
+   * @brief How a queued event is treated when a newer event with the same
+   *   key arrives or the queue is full
+   */
+  enum class EventDelivery : std::uint8_t {
+    /**
+     * @brief Only the latest pending event per key is delivered, may be
+     *   dropped when the queue is full
+     */
+    Latest,
+
+    /**
+     * @brief Always delivered, in order
+     */
+    Every
+  };
+
+  /**
+   * @brief Bounded, coalescing event queue between a producer thread and a
+   *   consumer that drains events in batches (i.e. a JS thread).
+   *
+   * `push` reports when the consumer has to be scheduled, so at most one
+   * drain is outstanding no matter how fast events are produced.
+   *
+   * @tparam Key event kind used for coalescing
+   * @tparam Event event value
+   */
+  template<typename Key, typename Event>
+  class CoalescingEventQueue {
+  public:
+    struct Options {
+      /**
+       * @brief Max queued events, `EventDelivery::Every` events are queued
+       *   even past capacity
+       */
+      std::size_t capacity{64};
+
+      /**
+       * @brief Max events returned by a single `drain`
+       */
+      std::size_t maxBatchSize{16};
+    };
+
+    struct Metrics {
+      std::uint64_t pushed{0};
+      std::uint64_t delivered{0};
+
+      /**
+       * @brief Replaced by a newer event with the same key
+       */
+      std::uint64_t coalesced{0};
+
+      /**
+       * @brief Discarded because the queue was full
+       */
+      std::uint64_t dropped{0};
+
+      std::uint64_t batches{0};
+      std::size_t queued{0};
+    };
+
+    CoalescingEventQueue() : CoalescingEventQueue(Options{}) {
+    }
+
+    explicit CoalescingEventQueue(const Options &options) : options_(options) {
+    }
+
+    /**
+     * @return `true` if the caller must schedule a `drain`
+     */
+    bool push(const Key &key, Event event, EventDelivery delivery) {
+      std::scoped_lock lock(mutex_);
+      metrics_.pushed++;
+
+      if (delivery == EventDelivery::Latest) {
+        auto it = std::ranges::find_if(events_, [&](auto &entry) {
+          return entry.delivery == EventDelivery::Latest && entry.key == key;
+        });
+
+        // MOVE TO THE BACK, SO IT STAYS ORDERED AFTER EARLIER `Every` EVENTS
+        if (it != events_.end()) {
+          events_.erase(it);
+          metrics_.coalesced++;
+        } else if (events_.size() >= options_.capacity && !evictOldestLatest()) {
+          metrics_.dropped++;
+          return false;
+        }
+      } else if (events_.size() >= options_.capacity) {
+        evictOldestLatest();
+      }
+
+      events_.push_back(Entry{key, std::move(event), delivery});
+      return schedule();
+    }
+
+    /**
+     * @brief Pop up to `maxBatchSize` events in order
+     *
+     * @param hasMore set when events remain, the caller must schedule another
+     *   `drain`
+     */
+    std::vector<Event> drain(bool &hasMore) {
+      std::vector<Event> batch{};
+
+      std::scoped_lock lock(mutex_);
+      auto count = std::min(options_.maxBatchSize, events_.size());
+      batch.reserve(count);
+      for (std::size_t idx = 0; idx < count; idx++) {
+        batch.push_back(std::move(events_.front().event));
+        events_.pop_front();
+      }
+
+      metrics_.delivered += count;
+      if (count)
+        metrics_.batches++;
+
+      hasMore = !events_.empty();
+      scheduled_ = hasMore;
+      return batch;
+    }
+
+    /**
+     * @brief The scheduled `drain` could not be dispatched, the next `push`
+     *   schedules again
+     */
+    void unschedule() {
+      std::scoped_lock lock(mutex_);
+      scheduled_ = false;
+    }
+
+    void clear() {
+      std::scoped_lock lock(mutex_);
+      events_.clear();
+      scheduled_ = false;
+    }
+
+    Metrics metrics() const {
+      std::scoped_lock lock(mutex_);
+      auto metrics = metrics_;
+      metrics.queued = events_.size();
+      return metrics;
+    }
+
+  private:
+    struct Entry {
+      Key key;
+      Event event;
+      EventDelivery delivery;
+    };
+
+    bool evictOldestLatest() {
+      auto it = std::ranges::find_if(events_, [](auto &entry) { return entry.delivery == EventDelivery::Latest; });
+      if (it == events_.end())
+        return false;
+
+      events_.erase(it);
+      metrics_.dropped++;
+      return true;
+    }
+
+    bool schedule() {
+      if (scheduled_)
+        return false;
+
+      scheduled_ = true;
+      return true;
+    }
+
+    Options options_;
+    mutable std::mutex mutex_{};
+    std::deque<Entry> events_{};
+    bool scheduled_{false};
+    Metrics metrics_{};
+  };
+
+} // namespace IRacingTools::Shared::Common
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+
+namespace IRacingTools::Shared::Common {
+
+  /**
+   * @brief Lock free latency histogram with power of two microsecond
+   *   buckets, bucket `n` holds samples in `[2^(n-1), 2^n)`
+   */
+  class LatencyHistogram {
+  public:
+    /**
+     * @brief The last bucket collects everything from ~8.4s up
+     */
+    static constexpr std::size_t BucketCount = 24;
+
+    struct Snapshot {
+      std::uint64_t count{0};
+      std::uint64_t totalMicros{0};
+      std::uint64_t maxMicros{0};
+      std::array<std::uint64_t, BucketCount> buckets{};
+
+      double meanMicros() const {
+        return count ? static_cast<double>(totalMicros) / static_cast<double>(count) : 0.0;
+      }
+
+      /**
+       * @brief Upper bound of the bucket holding the `percentile` (0-1)
+       *   sample, capped at `maxMicros`
+       */
+      std::uint64_t percentileMicros(double percentile) const {
+        if (!count)
+          return 0;
+
+        auto rank = static_cast<std::uint64_t>(std::clamp(percentile, 0.0, 1.0) * static_cast<double>(count - 1)) + 1;
+        std::uint64_t seen = 0;
+        for (std::size_t idx = 0; idx < BucketCount; idx++) {
+          seen += buckets[idx];
+          if (seen >= rank)
+            return std::min(BucketUpperBound(idx), maxMicros);
+        }
+
+        return maxMicros;
+      }
+    };
+
+    void record(std::chrono::microseconds latency) {
+      auto micros = static_cast<std::uint64_t>(std::max<std::int64_t>(latency.count(), 0));
+      buckets_[BucketIndex(micros)].fetch_add(1, std::memory_order_relaxed);
+      count_.fetch_add(1, std::memory_order_relaxed);
+      totalMicros_.fetch_add(micros, std::memory_order_relaxed);
+
+      auto max = maxMicros_.load(std::memory_order_relaxed);
+      while (micros > max && !maxMicros_.compare_exchange_weak(max, micros, std::memory_order_relaxed)) {
+      }
+    }
+
+    Snapshot snapshot() const {
+      Snapshot snapshot{};
+      snapshot.count = count_.load(std::memory_order_relaxed);
+      snapshot.totalMicros = totalMicros_.load(std::memory_order_relaxed);
+      snapshot.maxMicros = maxMicros_.load(std::memory_order_relaxed);
+      for (std::size_t idx = 0; idx < BucketCount; idx++)
+        snapshot.buckets[idx] = buckets_[idx].load(std::memory_order_relaxed);
+
+      return snapshot;
+    }
+
+    static constexpr std::size_t BucketIndex(std::uint64_t micros) {
+      return std::min<std::size_t>(std::bit_width(micros), BucketCount - 1);
+    }
+
+    static constexpr std::uint64_t BucketUpperBound(std::size_t idx) {
+      return idx == 0 ? 0 : (std::uint64_t{1} << idx) - 1;
+    }
+
+  private:
+    std::array<std::atomic_uint64_t, BucketCount> buckets_{};
+    std::atomic_uint64_t count_{0};
+    std::atomic_uint64_t totalMicros_{0};
+    std::atomic_uint64_t maxMicros_{0};
+  };
+
+} // namespace IRacingTools::Shared::Common
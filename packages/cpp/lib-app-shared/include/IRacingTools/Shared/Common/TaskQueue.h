@@ -1,21 +1,121 @@
 #pragma once
 
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <deque>
+#include <functional>
 #include <future>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <string>
 #include <thread>
+#include <tuple>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
+#include <IRacingTools/SDK/ErrorTypes.h>
 #include <IRacingTools/SDK/Utils/ThreadHelpers.h>
 
 namespace IRacingTools::Shared::Common {
 
+  /**
+   * @brief Lanes are drained in declaration order
+   */
+  enum class TaskPriority : std::uint8_t {
+    High,
+    Normal,
+    Low
+  };
+
+  constexpr std::size_t TaskPriorityCount = 3;
+
+  /**
+   * @brief Set on the future of a task that was cancelled (or dropped by
+   *   `destroy()`) before it ran.  Task functions may throw it themselves
+   *   when they observe `CancellationToken::IsCancellationRequested()`.
+   */
+  class TaskCancelledError : public SDK::GeneralError {
+  public:
+    explicit TaskCancelledError(const std::string &msg = "Task cancelled")
+        : GeneralError(SDK::ErrorCode::General, msg) {
+    }
+  };
+
+  /**
+   * @brief Cooperative cancellation flag, copies share the same state
+   */
+  class CancellationToken {
+  public:
+    CancellationToken() : cancelled_(std::make_shared<std::atomic_bool>(false)) {
+    }
+
+    void cancel() const {
+      cancelled_->store(true);
+    }
+
+    bool isCancelled() const {
+      return cancelled_->load();
+    }
+
+    /**
+     * @brief Token of the task running on the calling thread, `nullptr`
+     *   outside of a `TaskQueue` task
+     */
+    static const CancellationToken *Current() {
+      return CurrentRef();
+    }
+
+    /**
+     * @brief `true` if the task running on the calling thread was cancelled
+     */
+    static bool IsCancellationRequested() {
+      auto current = Current();
+      return current && current->isCancelled();
+    }
+
+    /**
+     * @brief Makes `token` the `Current()` token until destroyed
+     */
+    class Scope {
+    public:
+      explicit Scope(const CancellationToken &token) : previous_(CurrentRef()) {
+        CurrentRef() = &token;
+      }
+
+      ~Scope() {
+        CurrentRef() = previous_;
+      }
+
+      Scope(const Scope &) = delete;
+      Scope &operator=(const Scope &) = delete;
+
+    private:
+      const CancellationToken *previous_;
+    };
+
+  private:
+    static const CancellationToken *&CurrentRef() {
+      static thread_local const CancellationToken *current = nullptr;
+      return current;
+    }
+
+    std::shared_ptr<std::atomic_bool> cancelled_;
+  };
+
   /**
    * @brief A task queue with an internal thread pool
    *
+   * Tasks are drained from `High` to `Low` priority lanes, FIFO within a
+   * lane.  Tasks enqueued with a `key` are deduplicated: while a task with
+   * the same key is queued, enqueueing again updates its arguments (and
+   * raises its priority) & returns the same future.  Two tasks with the
+   * same key never run concurrently.
+   *
    * @tparam R task return type
    * @tparam Args arguments required to enqueue a task
    */
@@ -24,23 +124,72 @@ namespace IRacingTools::Shared::Common {
   public:
     using ReturnType = R;
     using ArgsType = std::tuple<Args...>;
-    using FutureType = std::future<R>;
 
     /**
-     * @brief Function type definition for the constructor
+     * @brief Shared, as deduplicated enqueues return the same future
      */
-    using FnType = std::function<R(Args...)>;
+    using FutureType = std::shared_future<R>;
 
     /**
-     * @brief Task type definition for each task
+     * @brief Function type definition for the constructor
      */
-    using TaskType = std::packaged_task<R()>;
+    using FnType = std::function<R(Args...)>;
+
+    using Clock = std::chrono::steady_clock;
 
     /**
      * @brief Task Queue Options
      */
     struct Options {
       std::optional<std::size_t> threadCount{1};
+
+      /**
+       * @brief Max queued (not running) tasks, `enqueue` blocks & `tryEnqueue`
+       *   fails while full.  `0` is unbounded.
+       */
+      std::size_t capacity{0};
+    };
+
+    /**
+     * @brief Per task options
+     */
+    struct TaskOptions {
+      TaskPriority priority{TaskPriority::Normal};
+
+      /**
+       * @brief Deduplication key, i.e. a file path
+       */
+      std::optional<std::string> key{};
+
+      /**
+       * @brief Cancel the task from outside the queue, a new token is
+       *   created if not provided
+       */
+      std::optional<CancellationToken> token{};
+    };
+
+    /**
+     * @brief Snapshot of the queue counters, times are in microseconds
+     */
+    struct Metrics {
+      std::array<std::size_t, TaskPriorityCount> queued{};
+      std::size_t running{0};
+      std::size_t completed{0};
+      std::size_t cancelled{0};
+      std::size_t deduplicated{0};
+
+      std::chrono::microseconds totalWait{0};
+      std::chrono::microseconds maxWait{0};
+      std::chrono::microseconds totalRun{0};
+      std::chrono::microseconds maxRun{0};
+
+      std::size_t queuedCount() const {
+        std::size_t count = 0;
+        for (auto laneCount : queued)
+          count += laneCount;
+
+        return count;
+      }
     };
 
     /**
@@ -67,6 +216,8 @@ namespace IRacingTools::Shared::Common {
         auto &it = overrideOptions.value();
         if (it.threadCount)
           options.threadCount = it.threadCount;
+
+        options.capacity = it.capacity;
       }
 
       options_ = std::move(options);
@@ -82,22 +233,87 @@ namespace IRacingTools::Shared::Common {
     }
 
     FutureType enqueue(Args ...args) {
-      FutureType future{};
+      return enqueue(TaskOptions{}, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Enqueue a task, blocks while the queue is at capacity
+     *
+     * @return the task future, invalid if the queue was destroyed
+     */
+    FutureType enqueue(const TaskOptions &taskOptions, Args ...args) {
+      std::unique_lock lock(mutex_);
+      spaceCv_.wait(lock, [&] {
+        return !enabled_ || hasCapacity(taskOptions);
+      });
+
+      if (!enabled_)
+        return {};
+
+      return push(lock, taskOptions, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Enqueue a task unless the queue is at capacity or destroyed
+     */
+    std::optional<FutureType> tryEnqueue(const TaskOptions &taskOptions, Args ...args) {
+      std::unique_lock lock(mutex_);
+      if (!enabled_ || !hasCapacity(taskOptions))
+        return std::nullopt;
+
+      return push(lock, taskOptions, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Cancel the task(s) with `key`, a queued task is removed & its
+     *   future resolved with `TaskCancelledError`, a running task has its
+     *   token cancelled.
+     *
+     * @return `true` if a task was found
+     */
+    bool cancel(const std::string &key) {
+      std::shared_ptr<Task> queuedTask{nullptr};
+      bool found = false;
       {
         std::scoped_lock lock(mutex_);
-        if (!enabled_)
-          return future;
+        if (auto it = queuedByKey_.find(key); it != queuedByKey_.end()) {
+          queuedTask = it->second;
+          removeQueued(queuedTask);
+          metrics_.cancelled++;
+          found = true;
+        }
+
+        if (auto it = runningByKey_.find(key); it != runningByKey_.end()) {
+          it->second.cancel();
+          found = true;
+        }
+      }
 
-        auto boundFn = std::bind(fn_, std::forward<Args>(args)...);
-        queue_.emplace_back(boundFn);
-        future = queue_.back().get_future();
+      if (queuedTask) {
+        spaceCv_.notify_all();
+        resolveCancelled(queuedTask);
       }
-      cv_.notify_one();
 
-      return future;
+      return found;
+    }
+
+    /**
+     * @brief Cancel all queued & running tasks
+     */
+    void cancelAll() {
+      auto cancelled = drain();
+      spaceCv_.notify_all();
+      for (auto &task : cancelled) {
+        resolveCancelled(task);
+      }
     }
 
+    /**
+     * @brief Stop the worker threads after their current task, queued
+     *   futures are resolved with `TaskCancelledError`
+     */
     void destroy() {
+      std::vector<std::shared_ptr<Task>> cancelled{};
       {
         std::scoped_lock lock(mutex_);
         if (!enabled_)
@@ -106,7 +322,13 @@ namespace IRacingTools::Shared::Common {
         enabled_ = false;
       }
 
+      cancelled = drain();
       cv_.notify_all();
+      spaceCv_.notify_all();
+
+      for (auto &task : cancelled) {
+        resolveCancelled(task);
+      }
 
       for (auto &t: threads_) {
         if (t.joinable()) {
@@ -119,32 +341,207 @@ namespace IRacingTools::Shared::Common {
       return options_;
     }
 
+    /**
+     * @brief Queued tasks, excluding running tasks
+     */
     std::size_t pendingTaskCount() {
       std::scoped_lock lock(mutex_);
 
-      return queue_.size();
+      return queuedCount_;
     }
 
     bool hasPendingTasks() {
       return pendingTaskCount() > 0;
     }
 
+    Metrics metrics() {
+      std::scoped_lock lock(mutex_);
+      auto metrics = metrics_;
+      for (std::size_t lane = 0; lane < TaskPriorityCount; lane++) {
+        metrics.queued[lane] = lanes_[lane].size();
+      }
+
+      return metrics;
+    }
+
   protected:
+    struct Task {
+      std::optional<std::string> key{};
+      std::tuple<std::decay_t<Args>...> args;
+      std::promise<R> promise{};
+      FutureType future{};
+      CancellationToken token{};
+      TaskPriority priority{TaskPriority::Normal};
+      Clock::time_point enqueuedAt{};
+    };
+
+    using TaskPtr = std::shared_ptr<Task>;
+
+    /**
+     * @brief Must hold `mutex_`
+     */
+    bool hasCapacity(const TaskOptions &taskOptions) {
+      return options_.capacity == 0 || queuedCount_ < options_.capacity ||
+          (taskOptions.key && queuedByKey_.contains(taskOptions.key.value()));
+    }
+
+    /**
+     * @brief Must hold `mutex_` (via `lock`), releases it
+     */
+    FutureType push(std::unique_lock<std::mutex> &lock, const TaskOptions &taskOptions, Args ...args) {
+      if (taskOptions.key) {
+        if (auto it = queuedByKey_.find(taskOptions.key.value()); it != queuedByKey_.end()) {
+          auto &task = it->second;
+          task->args = std::tuple<std::decay_t<Args>...>(std::forward<Args>(args)...);
+          if (taskOptions.priority < task->priority) {
+            auto &lane = lanes_[static_cast<std::size_t>(task->priority)];
+            lane.erase(std::ranges::find(lane, task));
+            task->priority = taskOptions.priority;
+            lanes_[static_cast<std::size_t>(task->priority)].push_back(task);
+          }
+
+          metrics_.deduplicated++;
+          return task->future;
+        }
+      }
+
+      auto task = std::make_shared<Task>(Task{
+          .key = taskOptions.key,
+          .args = std::tuple<std::decay_t<Args>...>(std::forward<Args>(args)...),
+          .token = taskOptions.token.value_or(CancellationToken{}),
+          .priority = taskOptions.priority,
+          .enqueuedAt = Clock::now()});
+      task->future = task->promise.get_future().share();
+
+      lanes_[static_cast<std::size_t>(task->priority)].push_back(task);
+      queuedCount_++;
+      if (task->key)
+        queuedByKey_[task->key.value()] = task;
+
+      auto future = task->future;
+      lock.unlock();
+      cv_.notify_one();
+
+      return future;
+    }
+
+    /**
+     * @brief Must hold `mutex_`
+     */
+    void removeQueued(const TaskPtr &task) {
+      auto &lane = lanes_[static_cast<std::size_t>(task->priority)];
+      lane.erase(std::ranges::find(lane, task));
+      queuedCount_--;
+      if (task->key)
+        queuedByKey_.erase(task->key.value());
+    }
+
+    /**
+     * @brief Remove all queued tasks & cancel the running ones
+     */
+    std::vector<TaskPtr> drain() {
+      std::scoped_lock lock(mutex_);
+      std::vector<TaskPtr> cancelled{};
+      for (auto &lane : lanes_) {
+        cancelled.insert(cancelled.end(), lane.begin(), lane.end());
+        lane.clear();
+      }
+
+      for (auto &[key, token] : runningByKey_) {
+        token.cancel();
+      }
+
+      queuedByKey_.clear();
+      queuedCount_ = 0;
+      metrics_.cancelled += cancelled.size();
+      return cancelled;
+    }
+
+    static void resolveCancelled(const TaskPtr &task) {
+      task->token.cancel();
+      task->promise.set_exception(std::make_exception_ptr(TaskCancelledError()));
+    }
+
+    /**
+     * @brief Next task in priority order whose key is not running, must
+     *   hold `mutex_`
+     */
+    TaskPtr nextRunnable() {
+      for (auto &lane : lanes_) {
+        for (auto &task : lane) {
+          if (!task->key || !runningByKey_.contains(task->key.value())) {
+            auto next = task;
+            removeQueued(next);
+            return next;
+          }
+        }
+      }
+
+      return nullptr;
+    }
+
+    void run(const TaskPtr &task) {
+      CancellationToken::Scope scope(task->token);
+      try {
+        if constexpr (std::is_void_v<R>) {
+          std::apply(fn_, std::move(task->args));
+          task->promise.set_value();
+        } else {
+          task->promise.set_value(std::apply(fn_, std::move(task->args)));
+        }
+      } catch (...) {
+        task->promise.set_exception(std::current_exception());
+      }
+    }
+
     void runnable() {
-      thread_local TaskType task;
-      while (enabled_) {
+      while (true) {
+        TaskPtr task{nullptr};
         {
           std::unique_lock lock(mutex_);
           cv_.wait(lock, [&] {
-            return !enabled_ || !queue_.empty();
+            return !enabled_ || (task = nextRunnable()) != nullptr;
           });
           if (!enabled_)
             return;
 
-          task.swap(queue_.front());
-          queue_.pop_front();
+          auto startedAt = Clock::now();
+          auto wait = std::chrono::duration_cast<std::chrono::microseconds>(startedAt - task->enqueuedAt);
+          metrics_.totalWait += wait;
+          metrics_.maxWait = std::max(metrics_.maxWait, wait);
+
+          if (task->token.isCancelled()) {
+            metrics_.cancelled++;
+            lock.unlock();
+            spaceCv_.notify_one();
+            resolveCancelled(task);
+            continue;
+          }
+
+          metrics_.running++;
+          if (task->key)
+            runningByKey_.emplace(task->key.value(), task->token);
+        }
+
+        spaceCv_.notify_one();
+
+        auto startedAt = Clock::now();
+        run(task);
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - startedAt);
+
+        {
+          std::scoped_lock lock(mutex_);
+          metrics_.running--;
+          metrics_.completed++;
+          metrics_.totalRun += elapsed;
+          metrics_.maxRun = std::max(metrics_.maxRun, elapsed);
+          if (task->key)
+            runningByKey_.erase(task->key.value());
         }
-        task();
+
+        // A QUEUED TASK WITH THE SAME KEY MAY NOW BE RUNNABLE
+        if (task->key)
+          cv_.notify_all();
       }
     }
 
@@ -152,10 +549,15 @@ namespace IRacingTools::Shared::Common {
     FnType fn_;
     Options options_;
     std::vector<std::thread> threads_{};
-    std::deque<TaskType> queue_{};
+    std::array<std::deque<TaskPtr>, TaskPriorityCount> lanes_{};
+    std::size_t queuedCount_{0};
+    std::unordered_map<std::string, TaskPtr> queuedByKey_{};
+    std::unordered_map<std::string, CancellationToken> runningByKey_{};
+    Metrics metrics_{};
     std::mutex mutex_{};
     std::condition_variable cv_{};
+    std::condition_variable spaceCv_{};
 
     std::atomic_bool enabled_{true};
   };
-} // namespace IRacingTools::Shared::Common
\ No newline at end of file
+} // namespace IRacingTools::Shared::Common
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <IRacingTools/Shared/SharedAppLibPCH.h>
+
+#include <chrono>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <IRacingTools/SDK/ErrorTypes.h>
+
+namespace IRacingTools::Shared::FileSystem {
+  namespace fs = std::filesystem;
+
+  /**
+   * @brief Identity of a file's content as far as a directory listing
+   *   can tell, without opening the file
+   */
+  struct FileFingerprint {
+    fs::path path{};
+    std::uint64_t size{0};
+
+    /**
+     * @brief Native last write time (`FILETIME` ticks on Windows,
+     *   nanoseconds since epoch elsewhere)
+     */
+    std::int64_t modifiedAt{0};
+
+    /**
+     * @brief NTFS file id or inode
+     */
+    std::uint64_t fileId{0};
+
+    bool operator==(const FileFingerprint &other) const = default;
+  };
+
+  /**
+   * @brief Options shared by `EnumerateFiles` & `DirectoryScanner`
+   */
+  struct EnumerateOptions {
+    /**
+     * @brief Only files ending with `extension`, empty matches all
+     */
+    std::string extension{};
+
+    bool recursive{true};
+
+    /**
+     * @brief Directories are listed concurrently when `> 1`, worthwhile
+     *   on network shares where every listing is a round trip
+     */
+    std::size_t threadCount{1};
+  };
+
+  /**
+   * @brief Fingerprint all files in `paths` with a single enumeration,
+   *   the attributes come from the directory listing itself so no file
+   *   is opened or stat'ed individually on Windows
+   *
+   * @return fingerprints (absolute paths) or an error when a root in
+   *   `paths` can not be listed
+   */
+  std::expected<std::vector<FileFingerprint>, SDK::GeneralError>
+  EnumerateFiles(const std::vector<fs::path> &paths, const EnumerateOptions &options = {});
+
+  /**
+   * @brief Incremental scanner, diffs each enumeration against the
+   *   fingerprints of processed files (persisted to `cacheFile`) so only
+   *   new & changed files are reported.
+   *
+   *   A reported file is pending until `markProcessed`, every scan reports
+   *   it again until then, so files still queued at shutdown or cancelled
+   *   are never lost.
+   */
+  class DirectoryScanner {
+  public:
+    struct Options {
+      EnumerateOptions enumerate{};
+
+      /**
+       * @brief Where the fingerprint table is persisted, not persisted if
+       *   empty
+       */
+      std::optional<fs::path> cacheFile{};
+    };
+
+    struct ScanResult {
+      /**
+       * @brief New or modified since the previous scan
+       */
+      std::vector<fs::path> changed{};
+
+      std::vector<fs::path> removed{};
+
+      /**
+       * @brief Total files found
+       */
+      std::size_t fileCount{0};
+    };
+
+    explicit DirectoryScanner(const Options &options);
+
+    /**
+     * @brief Enumerate `paths` & diff against the fingerprint table.
+     *
+     * Only fingerprints under `paths` are replaced, so scanning a subset of
+     * the roots does not report the files of other roots as removed.  If a
+     * root can not be listed, the table is left untouched.
+     */
+    std::expected<ScanResult, SDK::GeneralError> scan(const std::vector<fs::path> &paths);
+
+    /**
+     * @brief `file` (reported by `scan`) was processed, keep its fingerprint.
+     *   Persisted at most every `SaveInterval`, `save` flushes
+     */
+    void markProcessed(const fs::path &file);
+
+    /**
+     * @brief Drop `file` from the table so the next scan reports it again,
+     *   i.e. after processing it failed
+     */
+    void forget(const fs::path &file);
+
+    /**
+     * @brief Drop all fingerprints & remove `cacheFile`
+     */
+    void clear();
+
+    std::optional<SDK::GeneralError> load();
+    std::optional<SDK::GeneralError> save();
+
+    std::size_t size();
+
+  private:
+    using FingerprintMap = std::unordered_map<fs::path::string_type, FileFingerprint>;
+
+    static constexpr std::chrono::seconds SaveInterval{1};
+
+    std::optional<SDK::GeneralError> saveUnlocked();
+
+    Options options_;
+    std::mutex mutex_{};
+
+    /**
+     * @brief Fingerprints of processed files, what is persisted
+     */
+    FingerprintMap fingerprints_{};
+
+    /**
+     * @brief Reported by `scan`, not processed yet
+     */
+    FingerprintMap pending_{};
+
+    bool loaded_{false};
+    bool dirty_{false};
+    std::chrono::steady_clock::time_point savedAt_{};
+  };
+
+} // namespace IRacingTools::Shared::FileSystem
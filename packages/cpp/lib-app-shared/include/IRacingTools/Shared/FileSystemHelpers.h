@@ -27,6 +27,8 @@ namespace IRacingTools::Shared {
   constexpr std::string_view TrackMapFileJSONLFilename = "track-map-file.jsonl";
 
   constexpr std::string_view TelemetryDataFileJSONLFilename = "telemetry-data-file.jsonl";
+  constexpr std::string_view TelemetryDataFileFingerprintsFilename = "telemetry-data-file-fingerprints.bin";
+  constexpr std::string_view PipelineCheckpointsPath = "pipeline-checkpoints";
 
   // iRacing Paths
   constexpr std::string_view DocumentsIRacingTelemetryPath = "telemetry";
@@ -224,6 +226,7 @@ namespace IRacingTools::Shared {
 
   namespace Extensions {
     constexpr auto TRACK_MAP = ".trackmap";
+    constexpr auto IBT = ".ibt";
   }
 
   namespace Directories {
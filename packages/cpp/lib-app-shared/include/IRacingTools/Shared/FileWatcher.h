@@ -1,15 +1,28 @@
 #pragma once
+#ifdef _WIN32
 #include <IRacingTools/Shared/SharedAppLibPCH.h>
-#include <IRacingTools/SDK/Utils/FileHelpers.h>
-
+#include <array>
+#include <iostream>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
 #include <functional>
 #include <future>
 #include <magic_enum.hpp>
+#include <map>
 #include <mutex>
 #include <regex>
 #include <string>
+#include <system_error>
 #include <thread>
-#include <IRacingTools/SDK/Utils/UnicodeHelpers.h>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 
 namespace IRacingTools::Shared::FileSystem {
@@ -46,6 +59,9 @@ namespace IRacingTools::Shared::FileSystem {
     *
     * \brief Watches a folder or file, and will notify of changes via function callback.
     *
+    * Backed by `ReadDirectoryChangesW` on Windows & `inotify` elsewhere,
+    * events can be coalesced per file with `Options::debounce`.
+    *
     * \author Thomas Monkman
     *
     */
@@ -59,12 +75,48 @@ namespace IRacingTools::Shared::FileSystem {
             struct WatchEventData {
                 fs::path path;
                 std::wstring pathString;
+
+                /**
+                 * \brief The file was closed after being written (`IN_CLOSE_WRITE`, inotify only)
+                 */
+                bool closedAfterWrite{false};
             };
 
             using Callback = std::function<void(const WatchEventData& file, WatchEvent eventType)>;
 
+            /**
+             * \brief Event coalescing, by default every raw event is delivered
+             */
+            struct Options {
+                /**
+                 * \brief Deliver a file's events once, after it has been quiet
+                 *  for `debounce`, `0` delivers every raw event
+                 */
+                std::chrono::milliseconds debounce{0};
+
+                /**
+                 * \brief When debouncing, deliver as soon as a file is closed
+                 *  after writing instead of waiting out `debounce` (inotify only)
+                 */
+                bool flushOnCloseWrite{true};
+            };
 
-            explicit FileWatcher(std::wstring path, UnderpinningRegex pattern, Callback callback, bool autostart = false);
+            explicit FileWatcher(std::wstring path, UnderpinningRegex pattern, Callback callback, const Options& options, bool autostart = false);
+
+            explicit FileWatcher(std::wstring path, UnderpinningRegex pattern, Callback callback, bool autostart = false) : FileWatcher(
+                path,
+                pattern,
+                callback,
+                Options{},
+                autostart
+            ) {}
+
+            explicit FileWatcher(const fs::path& path, Callback callback, const Options& options) : FileWatcher(
+                path.wstring(),
+                UnderpinningRegex(sRegexAll_),
+                callback,
+                options
+            ) {}
 
             explicit FileWatcher(std::wstring path, Callback callback) : FileWatcher(
                 path,
@@ -120,6 +172,8 @@ namespace IRacingTools::Shared::FileSystem {
 
             Callback callback_;
 
+            Options options_;
+
             std::thread watchThread_;
 
             std::condition_variable cv_{};
@@ -129,16 +183,28 @@ namespace IRacingTools::Shared::FileSystem {
             std::vector<std::pair<WatchEventData, WatchEvent>> callbackInformation_;
             std::thread callbackThread_;
 
+            /**
+             * \brief Set (under `callbackMutex_`) once the watch thread has
+             *  exited, the callback thread then delivers everything & exits
+             */
+            bool stopping_{false};
+
             std::promise<void> runningPromise_{};
             std::atomic_bool running_{false};
             bool watchingSingleFile_{false};
 
+            bool passFilter(const UnderpinningString& filePath) {
+                return std::regex_match(filePath, pattern_);
+            }
+
+#ifdef _WIN32
             HANDLE directory_{nullptr};
             HANDLE closeEvent_{nullptr};
 
+            // NO `FILE_NOTIFY_CHANGE_DIR_NAME`, ONLY FILES ARE REPORTED (LIKE INOTIFY)
             const DWORD listenFilters_ = FILE_NOTIFY_CHANGE_SECURITY | FILE_NOTIFY_CHANGE_CREATION |
                 FILE_NOTIFY_CHANGE_LAST_ACCESS | FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_SIZE |
-                FILE_NOTIFY_CHANGE_ATTRIBUTES | FILE_NOTIFY_CHANGE_DIR_NAME | FILE_NOTIFY_CHANGE_FILE_NAME;
+                FILE_NOTIFY_CHANGE_ATTRIBUTES | FILE_NOTIFY_CHANGE_FILE_NAME;
 
             const std::unordered_map<DWORD, WatchEvent> eventTypeMapping_ = {
                 {FILE_ACTION_ADDED, WatchEvent::Added},
@@ -148,10 +214,6 @@ namespace IRacingTools::Shared::FileSystem {
                 {FILE_ACTION_RENAMED_NEW_NAME, WatchEvent::RenamedNew}
             };
 
-            bool passFilter(const UnderpinningString& filePath) {
-                return std::regex_match(filePath, pattern_);
-            }
-
             template <typename... Args>
             DWORD getFileAttributesX(const char* lpFileName, Args... args) {
                 return GetFileAttributesA(lpFileName, args...);
@@ -251,8 +313,13 @@ namespace IRacingTools::Shared::FileSystem {
                                 fileInfo->FileNameLength / sizeof(fileInfo->FileName[0])
                             };
 
-                            if (passFilter(changedFile)) {
-                                auto changedPath = path_ / changedFile;
+                            // A DIRECTORY'S OWN ATTRIBUTE & WRITE TIME CHANGES ARE STILL REPORTED
+                            auto changedPath = path_ / changedFile;
+                            auto attributes = fileInfo->Action == FILE_ACTION_REMOVED || fileInfo->Action == FILE_ACTION_RENAMED_OLD_NAME
+                                ? INVALID_FILE_ATTRIBUTES
+                                : getFileAttributesX(changedPath.c_str());
+                            auto isDirectory = attributes != INVALID_FILE_ATTRIBUTES && (attributes & FILE_ATTRIBUTE_DIRECTORY);
+                            if (!isDirectory && passFilter(changedFile)) {
                                 parsedInfo.emplace_back(
                                     WatchEventData{
                                         .path = changedPath,
@@ -289,30 +356,112 @@ namespace IRacingTools::Shared::FileSystem {
                     GetOverlappedResult(directory_, &overlappedBuffer, &bytesReturned, TRUE);
                 }
             }
+#else
+            int inotifyFd_{-1};
+            int closeEvent_{-1};
+
+            /**
+             * \brief Watched directory of each inotify watch descriptor
+             */
+            std::unordered_map<int, fs::path> watchPaths_{};
+
+            std::uint32_t watchMask() const;
+
+            /**
+             * \brief Watch `directory` & (unless watching a single file) all of
+             *  its subdirectories, files already inside are reported to `added`
+             */
+            void addWatches(const fs::path& directory, std::vector<std::pair<WatchEventData, WatchEvent>>* added = nullptr);
+
+            void monitorDirectory();
+#endif
+
+            /**
+             * \brief A file's events merged while waiting for it to be quiet
+             */
+            struct PendingEvent {
+                WatchEventData data;
+                WatchEvent eventType;
+                std::chrono::steady_clock::time_point lastEventAt;
+            };
+
+            /**
+             * \brief A file that was added (or renamed into place) & then
+             *  modified is still reported as added
+             */
+            static void coalesceEvent(PendingEvent& pending, const WatchEventData& data, WatchEvent eventType) {
+                auto wasAdded = pending.eventType == WatchEvent::Added || pending.eventType == WatchEvent::RenamedNew;
+                if (!wasAdded || eventType != WatchEvent::Modified) {
+                    pending.eventType = eventType;
+                }
+
+                pending.data.closedAfterWrite = pending.data.closedAfterWrite || data.closedAfterWrite;
+            }
 
+            void dispatch(const WatchEventData& data, WatchEvent eventType) {
+                if (callback_) {
+                    try {
+                        callback_(data, eventType);
+                    } catch (const std::exception&) {}
+                }
+            }
 
             void callbackThread() {
-                while (running_) {
+                using Clock = std::chrono::steady_clock;
+
+                std::map<std::wstring, PendingEvent> pendingEvents{};
+                auto stopping = false;
+                while (!stopping) {
                     std::unique_lock lock(callbackMutex_);
-                    if (callbackInformation_.empty() && running_) {
-                        cv_.wait(
-                            lock,
-                            [this] {
-                                return !callbackInformation_.empty() || !running_;
-                            }
-                        );
+                    auto hasEvents = [this] {
+                        return !callbackInformation_.empty() || stopping_;
+                    };
+
+                    if (pendingEvents.empty()) {
+                        cv_.wait(lock, hasEvents);
+                    } else {
+                        auto lastEventAt = Clock::time_point::max();
+                        for (auto& [pathString, pending] : pendingEvents) {
+                            lastEventAt = std::min(lastEventAt, pending.lastEventAt);
+                        }
+
+                        cv_.wait_until(lock, lastEventAt + options_.debounce, hasEvents);
                     }
+
                     decltype(callbackInformation_) callbackInfo = {};
                     std::swap(callbackInfo, callbackInformation_);
+                    stopping = stopping_;
                     lock.unlock();
 
-                    for (const auto& file : callbackInfo) {
-                        if (callback_) {
-                            try {
-                                callback_(file.first, file.second);
-                            } catch (const std::exception&) {}
+                    if (options_.debounce.count() <= 0) {
+                        for (const auto& [data, eventType] : callbackInfo) {
+                            dispatch(data, eventType);
+                        }
+                        continue;
+                    }
+
+                    // MERGE NEW EVENTS, THEN DELIVER FILES THAT ARE QUIET OR CLOSED
+                    // (ALL OF THEM WHEN STOPPING, SO NO EVENT IS DROPPED)
+                    auto now = Clock::now();
+                    for (const auto& [data, eventType] : callbackInfo) {
+                        auto [it, inserted] = pendingEvents.try_emplace(data.pathString, PendingEvent{data, eventType, now});
+                        if (!inserted) {
+                            coalesceEvent(it->second, data, eventType);
+                            it->second.lastEventAt = now;
                         }
                     }
+
+                    for (auto it = pendingEvents.begin(); it != pendingEvents.end();) {
+                        auto& pending = it->second;
+                        auto closed = options_.flushOnCloseWrite && pending.data.closedAfterWrite;
+                        if (!stopping && !closed && now - pending.lastEventAt < options_.debounce) {
+                            ++it;
+                            continue;
+                        }
+
+                        dispatch(pending.data, pending.eventType);
+                        it = pendingEvents.erase(it);
+                    }
                 }
             }
     };
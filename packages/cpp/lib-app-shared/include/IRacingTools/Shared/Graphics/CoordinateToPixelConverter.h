@@ -2,10 +2,13 @@
 
 
 #include <algorithm>
+#include <cmath>
 #include <filesystem>
 #include <magic_enum.hpp>
 #include <numbers>
+#include <span>
 #include <type_traits>
+#include <utility>
 
 
 /*
@@ -116,6 +119,169 @@ using PixelF = PixelBase<float>;
 using PixelD = PixelBase<double>;
 using PixelI = PixelBase<int>;
 
+/**
+ * \brief How batch conversions project, `Local` replaces the trigonometry
+ *   with polynomials expanded around the center of the batch
+ */
+enum class ProjectionMode {
+    Auto,
+    Exact,
+    Local
+};
+
+/**
+ * \brief Largest latitude/longitude span (degrees) `ProjectionMode::Auto`
+ *   projects locally, sub-pixel at zoom 20 for anything track sized
+ */
+constexpr double kLocalProjectionMaxSpan = 1.0;
+constexpr double kLocalProjectionMaxLatitude = 85.0;
+
+template<typename T = double>
+struct CoordinateBounds {
+    T minLatitude{0};
+    T maxLatitude{0};
+    T minLongitude{0};
+    T maxLongitude{0};
+
+    Coordinate<T> center() const {
+        return {(minLatitude + maxLatitude) / 2, (minLongitude + maxLongitude) / 2};
+    }
+
+    bool isLocal() const {
+        return maxLatitude - minLatitude <= kLocalProjectionMaxSpan &&
+            maxLongitude - minLongitude <= kLocalProjectionMaxSpan &&
+            std::max(std::abs(minLatitude), std::abs(maxLatitude)) <= kLocalProjectionMaxLatitude;
+    }
+};
+
+template<typename T = double>
+CoordinateBounds<T> GetCoordinateBounds(std::span<const Coordinate<T>> coords) {
+    if (coords.empty()) {
+        return {};
+    }
+
+    CoordinateBounds<T> bounds{
+        coords[0].latitude, coords[0].latitude, coords[0].longitude, coords[0].longitude
+    };
+    for (auto &coord : coords) {
+        bounds.minLatitude = std::min(bounds.minLatitude, coord.latitude);
+        bounds.maxLatitude = std::max(bounds.maxLatitude, coord.latitude);
+        bounds.minLongitude = std::min(bounds.minLongitude, coord.longitude);
+        bounds.maxLongitude = std::max(bounds.maxLongitude, coord.longitude);
+    }
+
+    return bounds;
+}
+
+/**
+ * \brief Distances between consecutive coordinates, `out[0] = 0` &
+ *   `out[i]` is from `coords[i - 1]` to `coords[i]` (or from `coords[0]`
+ *   when `cumulative`)
+ *
+ * Locally the segments are measured on the tangent plane, with the
+ * latitude cosine expanded around the batch center, instead of
+ * `CalculateDistance`'s great circle `acos`.
+ *
+ * \return number of distances written
+ */
+inline std::size_t CalculateDistances(
+    std::span<const Coordinate<>> coords,
+    std::span<double> out,
+    MetricUnit unit = MetricUnit::Meter,
+    bool cumulative = false,
+    ProjectionMode mode = ProjectionMode::Auto
+) {
+    auto count = std::min(coords.size(), out.size());
+    if (count == 0) {
+        return 0;
+    }
+
+    coords = coords.first(count);
+    auto bounds = GetCoordinateBounds(coords);
+    out[0] = 0.0;
+    if (mode == ProjectionMode::Exact || (mode == ProjectionMode::Auto && !bounds.isLocal())) {
+        for (std::size_t i = 1; i < count; i++) {
+            out[i] = CalculateDistance(coords[i - 1], coords[i], unit);
+        }
+    } else {
+        auto radius = 6371.0 * static_cast<double>(magic_enum::enum_underlying(unit));
+        auto lat0 = ToRad(bounds.center().latitude);
+        auto cos0 = std::cos(lat0);
+        auto sin0 = std::sin(lat0);
+        auto in = coords.data();
+        auto dst = out.data();
+        for (std::size_t i = 1; i < count; i++) {
+            auto lat1 = ToRad(in[i - 1].latitude);
+            auto lat2 = ToRad(in[i].latitude);
+            auto delta = (lat1 + lat2) * 0.5 - lat0;
+            auto cosMid = cos0 - delta * (sin0 + delta * 0.5 * cos0);
+            auto dx = ToRad(in[i].longitude - in[i - 1].longitude) * cosMid;
+            auto dy = lat2 - lat1;
+            dst[i] = radius * std::sqrt(dx * dx + dy * dy);
+        }
+    }
+
+    if (cumulative) {
+        for (std::size_t i = 1; i < count; i++) {
+            out[i] += out[i - 1];
+        }
+    }
+
+    return count;
+}
+
+/**
+ * \brief Equirectangular projection (meters, north up) around an origin,
+ *   the error over a track's extent is far below GPS noise
+ */
+class LocalProjection {
+public:
+    static constexpr double kEarthRadiusMeters = 6371000.0;
+
+    LocalProjection(double originLatitude, double originLongitude) :
+        originLatitude_(originLatitude), originLongitude_(originLongitude),
+        metersPerDegreeLon_(ToRad(1.0) * kEarthRadiusMeters * std::cos(ToRad(originLatitude))),
+        metersPerDegreeLat_(ToRad(1.0) * kEarthRadiusMeters) {
+    }
+
+    /**
+     * \brief Centered on the middle of `coords`' bounds
+     */
+    static LocalProjection FromCenter(std::span<const Coordinate<>> coords) {
+        auto center = GetCoordinateBounds(coords).center();
+        return LocalProjection(center.latitude, center.longitude);
+    }
+
+    std::pair<double, double> toLocal(double latitude, double longitude) const {
+        return {(longitude - originLongitude_) * metersPerDegreeLon_, (latitude - originLatitude_) * metersPerDegreeLat_};
+    }
+
+    /**
+     * \return number of points written
+     */
+    std::size_t toLocal(std::span<const Coordinate<>> coords, std::span<PixelD> out) const {
+        auto count = std::min(coords.size(), out.size());
+        auto in = coords.data();
+        auto dst = out.data();
+        for (std::size_t i = 0; i < count; i++) {
+            dst[i] = {(in[i].longitude - originLongitude_) * metersPerDegreeLon_, (in[i].latitude - originLatitude_) * metersPerDegreeLat_};
+        }
+
+        return count;
+    }
+
+    Coordinate<> toCoordinate(double x, double y) const {
+        return {originLatitude_ + y / metersPerDegreeLat_, originLongitude_ + x / metersPerDegreeLon_};
+    }
+
+private:
+    double originLatitude_;
+    double originLongitude_;
+    double metersPerDegreeLon_;
+    double metersPerDegreeLat_;
+};
+
+
 template<typename T>
 constexpr bool isPixelTypeInteger() {
     if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) {
@@ -166,6 +332,62 @@ public:
         return Pixel{x, y};
     };
 
+    /**
+     * \brief Project `coords` into `pixels`, `ProjectionMode::Local` replaces
+     *   the per coordinate `sin`/`log` with a 3rd order expansion of the
+     *   Mercator latitude around the batch center (x is linear already)
+     *
+     * \return number of pixels written
+     */
+    std::size_t coordinatesToPixels(
+        std::span<const Coordinate<>> coords,
+        std::span<Pixel> pixels,
+        ProjectionMode mode = ProjectionMode::Auto
+    ) {
+        auto count = std::min(coords.size(), pixels.size());
+        if (count == 0) {
+            return 0;
+        }
+
+        coords = coords.first(count);
+        auto bounds = GetCoordinateBounds(coords);
+        if (mode == ProjectionMode::Exact || (mode == ProjectionMode::Auto && !bounds.isLocal())) {
+            for (std::size_t i = 0; i < count; i++) {
+                pixels[i] = coordinateToPixel(coords[i]);
+            }
+
+            return count;
+        }
+
+        // Mercator y is atanh(sin(lat)), its derivatives are sec(lat),
+        // sec(lat) * tan(lat) & sec(lat) * (tan(lat)^2 + sec(lat)^2)
+        auto lat0 = bounds.center().latitude * kRadiansToDegreesRatio;
+        auto sec0 = 1.0 / std::cos(lat0);
+        auto tan0 = std::tan(lat0);
+        auto c1 = sec0;
+        auto c2 = sec0 * tan0 / 2.0;
+        auto c3 = sec0 * (tan0 * tan0 + sec0 * sec0) / 6.0;
+
+        auto f0 = std::sin(lat0);
+        auto y0 = pixelCenter_.y + 0.5 * std::log((1.0 + f0) / (1.0 - f0)) * -yPixelToRadiansRatio_;
+        auto x0 = static_cast<double>(pixelCenter_.x);
+        auto xRatio = xPixelToDegreesRatio_;
+        auto yRatio = -yPixelToRadiansRatio_;
+
+        auto in = coords.data();
+        auto dst = pixels.data();
+        for (std::size_t i = 0; i < count; i++) {
+            auto delta = in[i].latitude * kRadiansToDegreesRatio - lat0;
+            auto psi = delta * (c1 + delta * (c2 + delta * c3));
+            dst[i] = Pixel{
+                static_cast<PixelType>(std::round(x0 + in[i].longitude * xRatio)),
+                static_cast<PixelType>(std::round(y0 + psi * yRatio))
+            };
+        }
+
+        return count;
+    }
+
     Coordinate<> pixelToCoordinate(const Pixel &pixel) {
         float longitude = (pixel.x - pixelCenter_.x) / xPixelToDegreesRatio_;
         float latitude = (2.0 * std::atan(std::exp((pixel.y - pixelCenter_.y) / -yPixelToRadiansRatio_)) -
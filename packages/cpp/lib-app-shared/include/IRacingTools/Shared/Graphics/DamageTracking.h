@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace IRacingTools::Shared::Graphics {
+
+  /**
+   * @brief Changed region of a frame, in pixels from the top left
+   */
+  struct DamageRect {
+    std::uint32_t x{0};
+    std::uint32_t y{0};
+    std::uint32_t width{0};
+    std::uint32_t height{0};
+
+    constexpr std::uint32_t right() const {
+      return x + width;
+    }
+
+    constexpr std::uint32_t bottom() const {
+      return y + height;
+    }
+
+    constexpr std::uint64_t area() const {
+      return static_cast<std::uint64_t>(width) * height;
+    }
+
+    constexpr bool empty() const {
+      return width == 0 || height == 0;
+    }
+
+    constexpr bool operator==(const DamageRect &) const = default;
+  };
+
+  /**
+   * @brief Dimensions of a packed frame, `stride` in bytes
+   */
+  struct DamageFrameLayout {
+    std::uint32_t width{0};
+    std::uint32_t height{0};
+    std::uint32_t stride{0};
+    std::uint32_t bpp{4};
+
+    constexpr std::size_t size() const {
+      return static_cast<std::size_t>(stride) * height;
+    }
+  };
+
+  constexpr std::uint32_t DefaultDamageTileSize = 32;
+
+  /**
+   * @brief Smallest rect holding both `a` & `b`
+   */
+  DamageRect UnionDamageRect(const DamageRect &a, const DamageRect &b);
+
+  /**
+   * @brief `rect` clipped to `width` x `height`, empty if fully outside
+   */
+  DamageRect ClipDamageRect(const DamageRect &rect, std::uint32_t width, std::uint32_t height);
+
+  /**
+   * @brief Compare two frames tile by tile (SSE2 on x86)
+   *
+   * @return one rect per changed tile, clipped to the frame, in row major
+   *   tile order
+   */
+  std::vector<DamageRect> DiffTiles(
+    const std::uint8_t *previous,
+    const std::uint8_t *current,
+    const DamageFrameLayout &layout,
+    std::uint32_t tileSize = DefaultDamageTileSize
+  );
+
+  /**
+   * @brief Coalesce `rects` into at most `maxRects` rects covering all of
+   *   them.  Adjacent tiles are joined first, then the pair adding the
+   *   least area is merged until under the limit.
+   */
+  std::vector<DamageRect> MergeDamageRects(std::vector<DamageRect> rects, std::size_t maxRects = 16);
+
+  /**
+   * @brief Copy only the `rects` regions of `src` to `dst`, both laid out
+   *   as `layout`
+   */
+  void CopyDamageRects(
+    const std::uint8_t *src,
+    std::uint8_t *dst,
+    const DamageFrameLayout &layout,
+    std::span<const DamageRect> rects
+  );
+
+  /**
+   * @brief Damage of the most recent frames, each relative to the frame
+   *   before it, so the damage between any two recent frames can be found
+   *   (i.e. to bring a stale buffer or texture up to date).
+   *
+   *   Frame indexes start at `1`, `0` means unknown content.
+   */
+  class DamageHistory {
+  public:
+    explicit DamageHistory(std::size_t depth = 8);
+
+    /**
+     * @param damage `std::nullopt` when the whole frame changed
+     */
+    void push(std::uint32_t frameIndex, std::optional<std::vector<DamageRect>> damage);
+
+    /**
+     * @brief Damage of frames `(from, to]`
+     *
+     * @return `std::nullopt` when the whole frame must be treated as
+     *   changed, i.e. `from` is unknown or too old
+     */
+    std::optional<std::vector<DamageRect>> since(std::uint32_t from, std::uint32_t to, std::size_t maxRects = 16) const;
+
+    void reset();
+
+  private:
+    struct Entry {
+      std::uint32_t frameIndex;
+      std::optional<std::vector<DamageRect>> damage;
+    };
+
+    std::size_t depth_;
+    std::deque<Entry> entries_{};
+  };
+
+} // namespace IRacingTools::Shared::Graphics
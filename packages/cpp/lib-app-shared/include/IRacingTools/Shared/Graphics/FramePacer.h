@@ -0,0 +1,164 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace IRacingTools::Shared::Graphics {
+
+  /**
+   * @brief Decides when each overlay is re-rendered & when the canvas is
+   *   submitted, so slow changing overlays (standings) don't cost as much
+   *   as fast ones (tachometer).
+   *
+   *   - an overlay renders only with a new frame, at most at its max FPS
+   *   - the canvas is submitted at most once per consumer frame, and at
+   *     least every `keepAliveInterval` so consumers don't drop overlays
+   *
+   *   Pure logic, every call takes the current time, so it runs against a
+   *   fake clock in tests.
+   */
+  class FramePacer {
+  public:
+    using Clock = std::chrono::steady_clock;
+    using TimePoint = Clock::time_point;
+    using Duration = Clock::duration;
+
+    struct Options {
+      /**
+       * @brief Used for overlays without a max FPS
+       */
+      double defaultMaxFPS{90.0};
+
+      /**
+       * @brief Consumers drop overlays not updated for
+       *   `MaxFrameIntervalMillis`, resubmit well before
+       */
+      Duration keepAliveInterval{std::chrono::milliseconds(500)};
+
+      /**
+       * @brief Window the consumer frame rate is measured over
+       */
+      Duration consumerSampleWindow{std::chrono::milliseconds(250)};
+
+      /**
+       * @brief No consumer frames for this long means no consumer
+       */
+      Duration consumerIdleTimeout{std::chrono::seconds(1)};
+    };
+
+    struct OverlayMetrics {
+      double maxFPS{0};
+      double fps{0};
+      std::uint64_t rendered{0};
+
+      /**
+       * @brief New frames held back by the max FPS (the latest is
+       *   rendered once due)
+       */
+      std::uint64_t skipped{0};
+    };
+
+    struct Metrics {
+      double submitFPS{0};
+      std::uint64_t submitted{0};
+
+      /**
+       * @brief `0` until a consumer is observed
+       */
+      double consumerFPS{0};
+      std::vector<OverlayMetrics> overlays{};
+    };
+
+    FramePacer();
+    explicit FramePacer(const Options& options);
+
+    /**
+     * @brief Forget all overlay state, i.e. when the layout changed
+     */
+    void reset(std::size_t overlayCount);
+
+    /**
+     * @brief Sample the consumer's frame counter, its frame period is
+     *   inferred from how fast it advances
+     */
+    void observeConsumerFrame(std::uint64_t consumerFrameNumber, TimePoint now);
+
+    std::optional<Duration> consumerPeriod() const;
+
+    /**
+     * @param maxFPS `0` for `Options::defaultMaxFPS`
+     * @param hasNewFrame the overlay produced a frame not yet rendered
+     * @return true when the overlay should be rendered now, call
+     *   `markRendered` once it was
+     */
+    bool shouldRender(std::size_t overlayIdx, double maxFPS, bool hasNewFrame, TimePoint now);
+
+    void markRendered(std::size_t overlayIdx, TimePoint now);
+
+    /**
+     * @param changed the canvas changed since the last call
+     * @return true when the canvas should be submitted now, call
+     *   `markSubmitted` once it was
+     */
+    bool shouldSubmit(bool changed, TimePoint now);
+
+    void markSubmitted(TimePoint now);
+
+    /**
+     * @brief When held back frames, a deferred submit or the keep alive
+     *   are next due, the renderer should wait no longer
+     */
+    TimePoint nextWakeAt(TimePoint now) const;
+
+    Metrics metrics(TimePoint now) const;
+
+  private:
+    /**
+     * @brief Events per second over ~1s windows
+     */
+    struct RateCounter {
+      TimePoint windowStart{};
+      std::uint32_t count{0};
+      double rate{0};
+
+      void tick(TimePoint now);
+      double value(TimePoint now) const;
+    };
+
+    struct OverlayState {
+      Duration minInterval{};
+      std::optional<TimePoint> renderedAt{};
+      bool pending{false};
+      std::uint64_t rendered{0};
+      std::uint64_t skipped{0};
+      double maxFPS{0};
+      RateCounter fps{};
+    };
+
+    struct ConsumerSample {
+      std::uint64_t frameNumber;
+      TimePoint at;
+    };
+
+    OverlayState& overlay(std::size_t overlayIdx);
+
+    /**
+     * @brief Slack so a cadence just under the interval is not halved
+     */
+    static Duration Tolerance(Duration interval);
+
+    Options options_;
+    std::vector<OverlayState> overlays_{};
+
+    std::optional<ConsumerSample> consumerSample_{};
+    std::optional<Duration> consumerPeriod_{};
+
+    std::optional<TimePoint> submittedAt_{};
+    bool pendingSubmit_{false};
+    std::uint64_t submitted_{0};
+    RateCounter submitFPS_{};
+  };
+
+} // namespace IRacingTools::Shared::Graphics
@@ -11,6 +11,7 @@
 
 
 #include <IRacingTools/Shared/Graphics/DXResources.h>
+#include <IRacingTools/Shared/Graphics/FramePacer.h>
 #include <IRacingTools/Shared/Graphics/ImageDataBufferContainer.h>
 #include <IRacingTools/Shared/Graphics/RenderTarget.h>
 #include <IRacingTools/Shared/Graphics/Spriting.h>
@@ -39,6 +40,8 @@ namespace IRacingTools::Shared::Graphics {
 
     const std::shared_ptr<ImageDataBufferContainer<FormatChannels>> imageData_;
 
+    std::atomic<double> maxFPS_{0};
+
   public:
 
     ScreenRect screenRect() {
@@ -57,6 +60,18 @@ namespace IRacingTools::Shared::Graphics {
       return imageData_;
     };
 
+    /**
+     * @brief Max rate the overlay is rendered at, `0` for the renderer's
+     *   default
+     */
+    double maxFPS() const {
+      return maxFPS_.load(std::memory_order_relaxed);
+    }
+
+    void setMaxFPS(double maxFPS) {
+      maxFPS_.store(std::max(maxFPS, 0.0), std::memory_order_relaxed);
+    }
+
     PixelSize getImageSize() const {
       return imageData_->getImageSize();
     }
@@ -108,7 +123,13 @@ namespace IRacingTools::Shared::Graphics {
 
     virtual std::shared_ptr<IPCOverlayFrameData<FormatChannels>> getOverlayData(std::size_t idx) = 0;
 
-    virtual void onOverlayFrameData(OnFrameData fn) = 0;
+    /**
+     * @brief Wait for new frame data, then call `fn`
+     *
+     * @param wakeAt call `fn` no later than this, even without new data
+     *   (held back frames & keep alive submits are due)
+     */
+    virtual void onOverlayFrameData(OnFrameData fn, FramePacer::TimePoint wakeAt) = 0;
   };
 
 
@@ -145,12 +166,19 @@ namespace IRacingTools::Shared::Graphics {
         return;
       }
 
+      FramePacer::TimePoint wakeAt;
+      {
+        LOCK(pacerMutex_, lock);
+        wakeAt = pacer_.nextWakeAt(FramePacer::Clock::now());
+      }
+
       producer_->onOverlayFrameData(
         [&]() {
           if (isDestroyed_) return;
           render();
           // renderNow(idx, frameData);
-        }
+        },
+        wakeAt
       );
     }
 
@@ -164,6 +192,42 @@ namespace IRacingTools::Shared::Graphics {
     std::shared_ptr<RenderTarget> target_{};
     PixelSize canvasSize_{};
     std::map<uint8_t, BufferPtr> overlayImageDataBuffers_{};
+
+    /**
+     * @brief Overlay image currently on the canvas
+     */
+    struct OverlayUpload {
+      std::weak_ptr<ImageDataBufferContainer<FormatChannels>> imageData{};
+      std::uint32_t frameIndex{0};
+
+      /**
+       * @brief `SHMOverlayFrameConfig::contentVersion` of the upload
+       */
+      std::uint64_t contentVersion{0};
+    };
+
+    /**
+     * @brief Cleared whenever the canvas is cleared or the layout changes
+     */
+    std::map<uint8_t, OverlayUpload> overlayUploadedFrames_{};
+
+    /**
+     * @brief Never reset, so versions stay unique when uploads are cleared
+     */
+    std::uint64_t contentVersion_{0};
+
+    /**
+     * @brief Only locked by `render` & metrics, never by producers
+     */
+    std::mutex pacerMutex_{};
+    FramePacer pacer_{};
+
+    /**
+     * @brief Overlay configs of the last submit, a moved or resized overlay
+     *   is submitted even when none was re-rendered
+     */
+    std::vector<SHM::SHMOverlayFrameConfig> submittedFrameConfigs_{};
+
     std::mutex destroyMutex_{};
     std::atomic_bool isDestroyed_{false};
     std::atomic_flag isRendering_;
@@ -199,6 +263,14 @@ namespace IRacingTools::Shared::Graphics {
 
     IPCOverlayCanvasRenderer(const IPCOverlayCanvasRenderer&) = delete;
 
+    /**
+     * @brief Per overlay & submit rates, held back frames
+     */
+    FramePacer::Metrics pacingMetrics() {
+      LOCK(pacerMutex_, lock);
+      return pacer_.metrics(FramePacer::Clock::now());
+    }
+
     void destroy() {
       LOCK(destroyMutex_, lock);
       if (isDestroyed_.exchange(true)) {
@@ -274,6 +346,11 @@ namespace IRacingTools::Shared::Graphics {
       target_ = RenderTarget::Create(dxr_, texture); // MaxViewCount
       canvasSize_ = size;
 
+      // OVERLAYS ONLY UPLOAD DAMAGED REGIONS, SO THE CANVAS IS ONLY
+      // CLEARED WHEN IT IS CREATED
+      dxr_->getDXImmediateContext()->ClearRenderTargetView(target_->d3d().rtv(), DirectX::Colors::Transparent);
+      overlayUploadedFrames_.clear();
+
       // Let's force a clean start on the clients, including resetting the session
       // ID
       ipcSwapchain_ = {};
@@ -321,11 +398,18 @@ namespace IRacingTools::Shared::Graphics {
       );
 
       auto renderCount = ++renderCount_;
+      const auto now = FramePacer::Clock::now();
+      LOCK(pacerMutex_, pacerLock);
+      pacer_.observeConsumerFrame(writer_->consumerFrameNumber(), now);
 
       const auto overlayCount = producer_->getOverlayCount();
       if (overlayCount != sPreviousOverlayCount) {
         L->info("IPC SHM Frame Render >> Overlay Count Changed (previous={},current={})", sPreviousOverlayCount, overlayCount);
         sPreviousOverlayCount = overlayCount;
+
+        // SPRITE BOUNDS MOVED, EVERY OVERLAY MUST BE UPLOADED IN FULL
+        overlayUploadedFrames_.clear();
+        pacer_.reset(overlayCount);
       }
 
       const auto canvasSize = Spriting::GetBufferSize(overlayCount);
@@ -335,10 +419,10 @@ namespace IRacingTools::Shared::Graphics {
       // TraceLoggingWriteTagged(activity, "AcquireDXLock/stop");
       initializeCanvas(canvasSize);
       auto ctx = dxr_->getDXImmediateContext();
-      ctx->ClearRenderTargetView(target_->d3d().rtv(), DirectX::Colors::Transparent);
 
       std::vector<SHM::SHMOverlayFrameConfig> shmOverlayFrames;
       shmOverlayFrames.reserve(overlayCount);
+      bool anyRendered = false;
 
       for (uint8_t i = 0; i < overlayCount; ++i) {
         const auto bounds = Spriting::GetRect(i, overlayCount);
@@ -349,7 +433,39 @@ namespace IRacingTools::Shared::Graphics {
         }
         auto vrLayout = overlayData->vrLayout();
         // L->debug("Frame Pose idx={},x={}", i, vrLayout.pose.x);
-        auto imageSize = overlayData->getImageSize();
+
+        // GET A BUFFER TO HOLD THE IMAGE DATA
+        BufferPtr imageDataBuffer = getOrCreateOverlayImageDataBuffer(i, overlayData);
+        if (!imageDataBuffer) {
+          L->error("imageDataBuffer is invalid (idx={})", i);
+          continue;
+        }
+
+        // AN OVERLAY ALREADY ON THE CANVAS IS ONLY RE-RENDERED WITH A NEW
+        // FRAME, AT MOST AT ITS MAX FPS
+        auto& upload = overlayUploadedFrames_[i];
+        auto isUploaded = upload.imageData.lock() == overlayData->imageData();
+        auto shouldRender = !isUploaded ||
+          pacer_.shouldRender(i, overlayData->maxFPS(), overlayData->imageData()->hasNewFrame(), now);
+
+        // CAPTURE/CONSUME AN AVAILABLE FRAME
+        if (!shouldRender) {
+          if (!imageDataBuffer->hasData())
+            continue;
+        } else if (!overlayData->imageData()->consume(imageDataBuffer)) {
+          auto invalidBuffer = !imageDataBuffer;
+          auto hasData = imageDataBuffer && imageDataBuffer->hasData();
+          if (invalidBuffer || !hasData) {
+            L->warn("no frame buffer consumed/populated/filled (idx={},invalidBuffer={},hasData={})", i, invalidBuffer, hasData);
+            continue;
+          }
+
+          L->debug("No new frame data, but using previous (idx={})", i);
+        }
+        overlayImageDataBuffers_[i] = imageDataBuffer;
+
+        // THE FRAME MAY BE OLDER THAN THE LATEST RESIZE, SO USE ITS OWN SIZE
+        PixelSize imageSize{imageDataBuffer->width(), imageDataBuffer->height()};
         SHM::SHMOverlayFrameConfig overlayFrameConfig{
           .overlayIdx = i,
           .locationOnTexture{.offset_ = {bounds.left(), 0}, .size_ = imageSize, .origin_ = PixelRect::Origin::TopLeft},
@@ -362,9 +478,15 @@ namespace IRacingTools::Shared::Graphics {
             .opacity{},
           },
           .screen = {.rect = overlayData->screenRect()},
-          .updatedAt = TimeEpoch().count()
+          .updatedAt = TimeEpoch().count(),
+          .contentVersion = shouldRender ? ++contentVersion_ : upload.contentVersion
         };
 
+        // ADD CONFIG TO THE SHM FRAME DATA
+        shmOverlayFrames.push_back(overlayFrameConfig);
+        if (!shouldRender)
+          continue;
+
         D3D11_BOX destRegion{
           bounds.left(),
           bounds.top(),
@@ -374,49 +496,70 @@ namespace IRacingTools::Shared::Graphics {
           1
         };
 
-        // GET A BUFFER TO HOLD THE IMAGE DATA
-        BufferPtr imageDataBuffer = getOrCreateOverlayImageDataBuffer(i, overlayData);
-        if (!imageDataBuffer) {
-          L->error("imageDataBuffer is invalid (idx={})", i);
-          continue;
-        }
-
-        // CAPTURE/CONSUME AN AVAILABLE FRAME
-        if (!overlayData->imageData()->consume(imageDataBuffer)) {
-          auto invalidBuffer = !imageDataBuffer;
-          auto hasData = imageDataBuffer && imageDataBuffer->hasData();
-          if (invalidBuffer || !hasData) {
-            L->warn("no frame buffer consumed/populated/filled (idx={},invalidBuffer={},hasData={})", i, invalidBuffer, hasData);
-            continue;
-          }
-
-          L->debug("No new frame data, but using previous (idx={})", i);
+        // ONLY THE REGIONS CHANGED SINCE THE UPLOADED FRAME ARE UPLOADED
+        auto frameIndex = imageDataBuffer->frameIndex();
+        std::optional<std::vector<DamageRect>> damage{};
+        if (isUploaded) {
+          damage = overlayData->imageData()->damageSince(upload.frameIndex, frameIndex);
         }
 
         // CONSUME THE DATA & UPDATING DX TEXTURE ON GPU
         imageDataBuffer->consume(
           [&](auto data, auto len, auto) -> std::uint32_t {
-            ctx->UpdateSubresource(
-              target_->d3dTexture().get(),
-              0,
-              &destRegion,
-              data,
-              overlayData->imageData()->getImageDataStride(),
-              0
-            );
+            auto stride = imageDataBuffer->stride();
+            if (!damage) {
+              ctx->UpdateSubresource(target_->d3dTexture().get(), 0, &destRegion, data, stride, 0);
+              return len;
+            }
+
+            for (auto& rect : damage.value()) {
+              auto clipped = ClipDamageRect(rect, imageSize.width(), imageSize.height());
+              if (clipped.empty())
+                continue;
+
+              D3D11_BOX damageRegion{
+                destRegion.left + clipped.x,
+                destRegion.top + clipped.y,
+                0,
+                destRegion.left + clipped.right(),
+                destRegion.top + clipped.bottom(),
+                1
+              };
+
+              ctx->UpdateSubresource(
+                target_->d3dTexture().get(),
+                0,
+                &damageRegion,
+                data + static_cast<std::size_t>(clipped.y) * stride + static_cast<std::size_t>(clipped.x) * Buffer::BPP,
+                stride,
+                0
+              );
+            }
             return len;
           }
         );
-
-        // ADD CONFIG TO THE SHM FRAME DATA
-        shmOverlayFrames.push_back(overlayFrameConfig);
+        upload = {overlayData->imageData(), frameIndex, overlayFrameConfig.contentVersion};
+        pacer_.markRendered(i, now);
+        anyRendered = true;
       }
 
       if (renderCount % 100 == 0) {
         L->debug("Rendering frame ({}) overlay image data (overlayCount={})", renderCount, overlayCount);
       }
 
+      // UNCHANGED CANVASES ARE ONLY RESUBMITTED TO KEEP CONSUMERS FROM
+      // DROPPING THE OVERLAYS, CHANGED ONES AT MOST ONCE PER CONSUMER FRAME
+      auto configChanged = !std::ranges::equal(
+        shmOverlayFrames,
+        submittedFrameConfigs_,
+        [](const auto& frame, const auto& submitted) { return frame.isSameFrame(submitted); }
+      );
+      if (!pacer_.shouldSubmit(anyRendered || configChanged, now))
+        return;
+
       submitFrame(shmOverlayFrames);
+      submittedFrameConfigs_ = std::move(shmOverlayFrames);
+      pacer_.markSubmitted(now);
     }
 
     void submitFrame(
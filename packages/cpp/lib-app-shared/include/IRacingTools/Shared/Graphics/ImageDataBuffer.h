@@ -10,6 +10,9 @@
 #include <IRacingTools/Shared/SharedAppLibPCH.h>
 
 #include <IRacingTools/Shared/Graphics/DXResources.h>
+#include <IRacingTools/Shared/Graphics/DamageTracking.h>
+#include <IRacingTools/Shared/Graphics/ImageDataBufferPool.h>
+#include <IRacingTools/Shared/Graphics/PixelConversion.h>
 #include <IRacingTools/Shared/Graphics/RenderTarget.h>
 #include <IRacingTools/Shared/Logging/LoggingManager.h>
 
@@ -48,6 +51,12 @@ namespace IRacingTools::Shared::Graphics {
   public:
     static constexpr auto BPP = magic_enum::enum_underlying(FormatChannels);
 
+    /**
+     * @brief Capacity is only given back after this many frames of using
+     *   less than half of it, so resizing back & forth does not reallocate
+     */
+    static constexpr std::uint32_t ShrinkAfterFrames = 120;
+
     enum class Status {
       Empty,
       NewData,
@@ -102,13 +111,28 @@ namespace IRacingTools::Shared::Graphics {
       return width_ * bpp;
     }
 
+    DamageFrameLayout layout() const {
+      return {width_, height_, stride(), bpp};
+    }
+
+    /**
+     * @brief Allocated bytes, at least `size()`
+     */
+    std::size_t capacity() const {
+      return ImageDataBufferPool::Capacity(block_);
+    }
+
     /**
      * @brief
      * @param width Width of the image data this will hold in pixels, NOT the stride
      * @param height Height in pixels of the image data
+     * @param pool pool the buffer memory is acquired from
      */
-    ImageDataBuffer(const std::uint32_t& width, const std::uint32_t& height) : width_(width),
-                                                                               height_(height) {
+    ImageDataBuffer(
+      const std::uint32_t& width,
+      const std::uint32_t& height,
+      const std::shared_ptr<ImageDataBufferPool>& pool = ImageDataBufferPool::Default()
+    ) : pool_(pool), width_(width), height_(height) {
       resize(width_, height_);
     }
 
@@ -191,21 +215,12 @@ namespace IRacingTools::Shared::Graphics {
      * @return pointer to buffer memory
      */
     Byte* data() {
-      return buffer_.data();
+      return block_.get();
     }
 
 
     std::expected<std::uint32_t, SDK::GeneralError> produce(ProduceFn fn) {
-      std::scoped_lock lock(*this);
-      if (!isValid()) {
-        return createImageDataBufferError("Cannot write to buffer, it is not valid");
-      }
-
-      setStatus(Status::Empty);
-      auto res = fn(buffer_.data(), buffer_.size(), this);
-      if (res > 0) setStatus(Status::NewData);
-
-      return res;
+      return produce(std::move(fn), true);
     }
 
     std::expected<std::uint32_t, SDK::GeneralError> produce(const Byte* src, std::uint32_t size) {
@@ -222,6 +237,53 @@ namespace IRacingTools::Shared::Graphics {
       );
     }
 
+    /**
+     * @brief Copy only the `damage` regions of `src`, the rest of the buffer
+     *   must already match `src` (i.e. it holds an earlier frame & `damage`
+     *   covers every change since)
+     */
+    std::expected<std::uint32_t, SDK::GeneralError> produce(const Byte* src, std::uint32_t size, std::span<const DamageRect> damage) {
+      return produce(
+        [&](Byte* dst, std::uint32_t dstSize, ImageDataBuffer*) -> std::uint32_t {
+          if (dstSize < size || size < this->size()) {
+            return 0;
+          }
+
+          CopyDamageRects(src, dst, layout(), damage);
+          return size;
+        },
+        false
+      );
+    }
+
+    /**
+     * @brief Convert `src`, laid out as `conversion` describes, while
+     *   copying it.  Only the `damage` regions when provided, as above.
+     */
+    std::expected<std::uint32_t, SDK::GeneralError> produce(
+      const Byte* src,
+      std::uint32_t size,
+      const PixelConversion& conversion,
+      std::optional<std::span<const DamageRect>> damage = std::nullopt
+    ) requires (BPP == 4) {
+      return produce(
+        [&](Byte* dst, std::uint32_t dstSize, ImageDataBuffer*) -> std::uint32_t {
+          auto srcStride = width_ * conversion.srcBPP();
+          if (dstSize < this->size() || size < srcStride * height_) {
+            return 0;
+          }
+
+          if (damage) {
+            ConvertPixelRects(src, srcStride, dst, layout(), damage.value(), conversion);
+          } else {
+            ConvertPixels(src, dst, static_cast<std::size_t>(width_) * height_, conversion);
+          }
+          return size;
+        },
+        !damage
+      );
+    }
+
     std::expected<std::uint32_t, SDK::GeneralError> produce(const Buffer& buf) {
       return produce(buf.data(), buf.size());
     }
@@ -240,7 +302,7 @@ namespace IRacingTools::Shared::Graphics {
         );
       }
 
-      auto res = fn(buffer_.data(), size(), this);
+      auto res = fn(block_.get(), size(), this);
       setStatus(Status::OldData);
 
       return res;
@@ -259,7 +321,11 @@ namespace IRacingTools::Shared::Graphics {
       width_ = width;
       height_ = height;
 
-      buffer_.resize(width * height * BPP);
+      // KEEP THE CURRENT BLOCK WHEN IT IS LARGE ENOUGH
+      if (!block_ || capacity() < size()) {
+        block_ = pool_->acquire(size());
+        underusedFrames_ = 0;
+      }
 
       frameIndex_= 0;
       return true;
@@ -267,8 +333,36 @@ namespace IRacingTools::Shared::Graphics {
 
   private:
 
+    /**
+     * @param fullFrame `fn` writes the whole frame, so the block may be
+     *   swapped for a smaller one first
+     */
+    std::expected<std::uint32_t, SDK::GeneralError> produce(ProduceFn fn, bool fullFrame) {
+      std::scoped_lock lock(*this);
+      if (!isValid()) {
+        return createImageDataBufferError("Cannot write to buffer, it is not valid");
+      }
+
+      setStatus(Status::Empty);
+      if (capacity() / 2 > size()) {
+        if (++underusedFrames_ >= ShrinkAfterFrames && fullFrame) {
+          block_ = pool_->acquire(size());
+          underusedFrames_ = 0;
+        }
+      } else {
+        underusedFrames_ = 0;
+      }
+
+      auto res = fn(block_.get(), size(), this);
+      if (res > 0) setStatus(Status::NewData);
+
+      return res;
+    }
+
     std::recursive_mutex mutex_{};
-    Buffer buffer_{};
+    std::shared_ptr<ImageDataBufferPool> pool_;
+    ImageDataBufferPool::Block block_{};
+    std::uint32_t underusedFrames_{0};
     std::atomic<Status> status_{Status::Empty};
     std::atomic_bool destroyed_{false};
     std::atomic_uint32_t frameIndex_{0};
@@ -11,15 +11,20 @@
 
 #include <IRacingTools/Shared/Graphics/DXResources.h>
 #include <IRacingTools/Shared/Graphics/ImageDataBuffer.h>
+#include <IRacingTools/Shared/Graphics/PixelConversion.h>
 #include <IRacingTools/Shared/Graphics/RenderTarget.h>
 #include <IRacingTools/Shared/Logging/LoggingManager.h>
-#include <IRacingTools/Shared/Utils/RingQueue.h>
 
 namespace IRacingTools::Shared::Graphics {
 
   /**
    * @brief contains both a read & write buffer, that are auto-swapped on fill
    *
+   *   Three buffers are handed off lock free between a single consumer & the
+   *   producers: one being written, one holding the latest frame & one being
+   *   read.  Buffers are only resized when a frame of the new size is
+   *   written to them.
+   *
    * @tparam FormatChannels # of channels in the image buffer that will be produced/consumed
    */
   template <ImageFormatChannels FormatChannels>
@@ -33,13 +38,43 @@ namespace IRacingTools::Shared::Graphics {
 
   private:
 
-    Utils::RingQueue<BufferPtr, 3> availableBuffers_{};
-    BufferPtr readyBuffer_{nullptr};
-    std::mutex queueMutex_{};
+    static constexpr std::uint32_t SlotMask = 0x3;
+
+    /**
+     * @brief Set in `ready_` when the slot holds a frame not yet consumed
+     */
+    static constexpr std::uint32_t NewFrameBit = 0x4;
+
+    std::array<BufferPtr, 3> slots_{};
+
+    /**
+     * @brief Slot holding the latest produced frame, or'ed with `NewFrameBit`
+     */
+    std::atomic_uint32_t ready_{2};
+    std::uint32_t readIndex_{1};
+    std::atomic_bool destroyed_{false};
     std::atomic_uint32_t frameCounter_{0};
 
-    std::uint32_t width_;
-    std::uint32_t height_;
+    /**
+     * @brief Serializes producers, guards `writeIndex_` & `previousFrame_`
+     */
+    std::mutex produceMutex_{};
+    std::uint32_t writeIndex_{0};
+
+    /**
+     * @brief Copy of the last produced frame (as provided, before
+     *   conversion), diffed against the next one when the producer does
+     *   not provide damage
+     */
+    std::vector<typename Buffer::Byte> previousFrame_{};
+    std::uint32_t previousFrameIndex_{0};
+    PixelConversion previousConversion_{};
+
+    mutable std::mutex damageMutex_{};
+    DamageHistory damageHistory_{};
+
+    std::atomic_uint32_t width_;
+    std::atomic_uint32_t height_;
 
   public:
 
@@ -48,7 +83,8 @@ namespace IRacingTools::Shared::Graphics {
     const std::uint32_t bpp = ToBPP(FormatChannels);
 
     ImageDataBufferContainer(const std::uint32_t& width, const std::uint32_t& height) : width_(width), height_(height) {
-      resize(width, height, true);
+      for (auto& slot : slots_)
+        slot = newBuffer();
     }
 
     ImageDataBufferContainer() = delete;
@@ -65,101 +101,188 @@ namespace IRacingTools::Shared::Graphics {
       return std::make_shared<Buffer>(width(), height());
     }
 
+    /**
+     * @brief Change the size of produced frames, buffers are resized as
+     *   frames of the new size are written to them
+     */
     bool resize(const std::uint32_t& width, const std::uint32_t& height, bool force = false) {
-      std::scoped_lock lock(queueMutex_);
       if (!force && width == width_ && height == height_) {
         return true;
       }
 
       if (!IsNonZeroSize<uint32_t>({width, height})) return false;
 
-      availableBuffers_.clear(BufferPtr{nullptr});
       width_ = width;
       height_ = height;
-      for (int i = 0; i < availableBuffers_.capacity(); i++) {
-        if (availableBuffers_.full()) break;
-
-        availableBuffers_.push(newBuffer());
-      }
 
+      std::scoped_lock damageLock(damageMutex_);
+      damageHistory_.reset();
       return true;
     }
 
-    std::expected<std::uint32_t, SDK::GeneralError> produce(const Byte* data, std::uint32_t len) {
+    /**
+     * @brief Produce a frame, only the regions that changed since the
+     *   write buffer's frame are copied
+     *
+     * @param damage regions changed since the previous frame, when not
+     *   provided they are found by diffing against the previous frame
+     * @param conversion format of `data`, converted while copying
+     *   (4 channel buffers only)
+     */
+    std::expected<std::uint32_t, SDK::GeneralError> produce(
+      const Byte* data,
+      std::uint32_t len,
+      std::optional<std::span<const DamageRect>> damage = std::nullopt,
+      const PixelConversion& conversion = {}
+    ) {
       static auto L = Logging::GetCategoryWithName("ImageDataBufferContainer");
-      BufferPtr writeBuffer;
-      {
-        std::scoped_lock lock(queueMutex_);
-        auto writeBufferOpt = availableBuffers_.pop();
-        if (!writeBufferOpt) return createImageDataBufferError("availableBuffers returned no buffer");
-
-        writeBuffer = writeBufferOpt.value();
-      }
+      std::scoped_lock produceLock(produceMutex_);
+      if (destroyed_) return createImageDataBufferError("Container is destroyed");
 
+      auto& writeBuffer = slots_[writeIndex_];
       std::unique_lock writeLock(*writeBuffer);
-      if (len < writeBuffer->size()) {
-        L->warn("Data len ({}) !== buffer len ({}), resizing width={},height={},isDestroyed={}", len, writeBuffer->size(), width(), height(), writeBuffer->isDestroyed());
-        writeBuffer->resize(width(),height());
-        if (len != writeBuffer->size()) {
-          L->error("Data len ({}) !== buffer len ({})", len, writeBuffer->size());
-          std::scoped_lock lock(queueMutex_);
-          availableBuffers_.push(writeBuffer);
-          return createImageDataBufferError("Buffer len mismatch, ignoring frame");
-        }
-        // VRK_LOG_AND_FATAL_IF(, "Data len does == buffer len")
+      if (writeBuffer->width() != width() || writeBuffer->height() != height()) {
+        L->debug("Resizing write buffer ({}x{} -> {}x{})", writeBuffer->width(), writeBuffer->height(), width(), height());
+        writeBuffer->resize(width(), height());
       }
 
-      auto res = writeBuffer->produce(data, len);
+      auto convert = BPP == 4 && !conversion.isCopy();
+      auto srcLayout = writeBuffer->layout();
+      if (convert) {
+        srcLayout.bpp = conversion.srcBPP();
+        srcLayout.stride = srcLayout.width * srcLayout.bpp;
+      }
 
-      std::scoped_lock lock(queueMutex_);
-      if (!res || !res.value()) {
-        availableBuffers_.push(writeBuffer);
+      if (len < srcLayout.size()) {
+        // THE PRODUCER'S NEXT DAMAGE IS RELATIVE TO THIS FRAME, WHICH IS NOT KEPT
+        dropPreviousFrame();
+        return createImageDataBufferError("Data len ({}) < frame len ({}), ignoring frame", len, srcLayout.size());
+      }
 
-        if (!res) return std::unexpected(res.error());
-        if (!res.value()) return createImageDataBufferError("0 returned from frame producer");
+      auto frameIndex = trackDamage(data, len, srcLayout, damage, conversion);
+      std::optional<std::vector<DamageRect>> writeDamage{};
+      {
+        std::scoped_lock damageLock(damageMutex_);
+        writeDamage = damageHistory_.since(writeBuffer->frameIndex(), frameIndex);
       }
 
-      writeBuffer.swap(readyBuffer_);
+      std::expected<std::uint32_t, SDK::GeneralError> res{0};
+      if constexpr (BPP == 4) {
+        if (convert) {
+          res = writeBuffer->produce(data, len, conversion, writeDamage);
+        }
+      }
 
-      // IF THE READY BUFFER IS VALID, THEN PUSH IT TO THE
-      // BACK OF THE AVAILABLE QUEUE
-      if (writeBuffer && !availableBuffers_.full()) {
-        availableBuffers_.push(writeBuffer);
+      if (!convert) {
+        res = writeDamage ? writeBuffer->produce(data, len, writeDamage.value()) : writeBuffer->produce(data, len);
       }
 
+      writeBuffer->setFrameIndex(res && res.value() ? frameIndex : 0);
+      writeLock.unlock();
+
+      if (!res) return std::unexpected(res.error());
+      if (!res.value()) return createImageDataBufferError("0 returned from frame producer");
+
+      // PUBLISH THE FRAME, TAKING THE PREVIOUS READY SLOT TO WRITE NEXT
+      writeIndex_ = ready_.exchange(writeIndex_ | NewFrameBit, std::memory_order_acq_rel) & SlotMask;
       return res.value();
     }
 
     /**
-     * @brief Swap buffer with readyBuffer_ if valid
+     * @brief Damage between two produced frames, see `DamageHistory::since`
+     */
+    std::optional<std::vector<DamageRect>> damageSince(std::uint32_t fromFrameIndex, std::uint32_t toFrameIndex) const {
+      std::scoped_lock damageLock(damageMutex_);
+      return damageHistory_.since(fromFrameIndex, toFrameIndex);
+    }
+
+    /**
+     * @brief A frame was produced that `consume` has not taken yet
+     */
+    bool hasNewFrame() const {
+      return !destroyed_ && (ready_.load(std::memory_order_relaxed) & NewFrameBit);
+    }
+
+    /**
+     * @brief Take the latest frame if one was produced since the last call,
+     *   only one thread may consume.
+     *
+     *   `targetBuffer` is owned by the consumer until the next successful
+     *   `consume`, its size is that of the frame (which may lag `resize`).
      *
-     * @param targetBuffer buffer that should have its raw ptr swapped
-     * @return true if swapped
+     * @param targetBuffer set to the buffer holding the latest frame
+     * @return true if a new frame was taken
      */
     bool consume(BufferPtr& targetBuffer) {
-      std::scoped_lock lock(queueMutex_);
-
-      if (!targetBuffer || !readyBuffer_ || targetBuffer->bpp != readyBuffer_->bpp || targetBuffer->isDestroyed() || readyBuffer_->isDestroyed() || !readyBuffer_->hasData())
+      if (destroyed_ || !(ready_.load(std::memory_order_relaxed) & NewFrameBit))
         return false;
 
-      if (targetBuffer->size() != readyBuffer_->size()) {
-        targetBuffer->resize(readyBuffer_->width(), readyBuffer_->height());
-      }
-      readyBuffer_.swap(targetBuffer);
-      return true;
+      readIndex_ = ready_.exchange(readIndex_, std::memory_order_acq_rel) & SlotMask;
+      targetBuffer = slots_[readIndex_];
+      return targetBuffer->hasData();
     }
 
     void destroy() {
-      std::scoped_lock lock(queueMutex_);
-      availableBuffers_.destroy();
+      if (destroyed_.exchange(true)) return;
 
-      for (auto& b : availableBuffers_) {
-        b.destroy();
+      for (auto& slot : slots_) {
+        if (slot) slot->destroy();
       }
+    }
 
-      if (readyBuffer_) readyBuffer_->destroy();
+  private:
+    /**
+     * @brief Forget the previous frame copy, so the next frame is copied in
+     *   full instead of trusting damage relative to a frame never seen,
+     *   must hold `produceMutex_`
+     */
+    void dropPreviousFrame() {
+      previousFrame_.clear();
+      previousFrameIndex_ = 0;
     }
 
+    /**
+     * @brief Record the damage of a new frame relative to the previous
+     *   one & update the previous frame copy, must hold `produceMutex_`
+     *
+     * @return index of the new frame
+     */
+    std::uint32_t trackDamage(
+      const Byte* data,
+      std::uint32_t len,
+      const DamageFrameLayout& layout,
+      std::optional<std::span<const DamageRect>> damage,
+      const PixelConversion& conversion
+    ) {
+      auto frameIndex = ++frameCounter_;
+      std::optional<std::vector<DamageRect>> frameDamage{};
+
+      // A NEW CONVERSION CHANGES EVERY PIXEL, EVEN WHEN THE SOURCE DID NOT
+      auto sameConversion = std::exchange(previousConversion_, conversion) == conversion;
+      if (sameConversion && previousFrameIndex_ > 0 && previousFrame_.size() == layout.size() && len >= layout.size()) {
+        if (damage) {
+          std::vector<DamageRect> clipped{};
+          for (auto& rect : damage.value())
+            clipped.push_back(ClipDamageRect(rect, layout.width, layout.height));
+
+          frameDamage = MergeDamageRects(std::move(clipped));
+        } else {
+          frameDamage = MergeDamageRects(DiffTiles(previousFrame_.data(), data, layout));
+        }
+
+        CopyDamageRects(data, previousFrame_.data(), layout, frameDamage.value());
+      } else {
+        previousFrame_.assign(data, data + std::min<std::size_t>(len, layout.size()));
+      }
+
+      previousFrameIndex_ = previousFrame_.size() == layout.size() ? frameIndex : 0;
+
+      std::scoped_lock damageLock(damageMutex_);
+      damageHistory_.push(frameIndex, std::move(frameDamage));
+      return frameIndex;
+    }
+
+  public:
     PixelSize getImageSize() const {
       return {width_, height_};
     }
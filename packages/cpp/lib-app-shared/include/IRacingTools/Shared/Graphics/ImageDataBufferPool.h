@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace IRacingTools::Shared::Graphics {
+
+  /**
+   * @brief Size class pool of page aligned image data blocks, so buffers
+   *   resized at frame rate (window resizing, layout edits) reuse memory
+   *   instead of going through the allocator.
+   *
+   *   Blocks return to the pool when released, even after the pool itself
+   *   was released (they are freed then).
+   */
+  class ImageDataBufferPool {
+    struct State;
+
+  public:
+    /**
+     * @brief Page aligned, suits streaming copies & never splits a cache line
+     */
+    static constexpr std::size_t Alignment = 4096;
+
+    struct Options {
+      /**
+       * @brief Released blocks kept per size class
+       */
+      std::size_t maxCachedPerClass{3};
+
+      /**
+       * @brief Released blocks kept overall, in bytes
+       */
+      std::size_t maxCachedBytes{256 * 1024 * 1024};
+    };
+
+    struct Metrics {
+      std::uint64_t allocations{0};
+      std::uint64_t frees{0};
+
+      /**
+       * @brief `acquire` calls served from the cache
+       */
+      std::uint64_t reuses{0};
+      std::uint64_t releases{0};
+      std::size_t liveBytes{0};
+      std::size_t cachedBytes{0};
+      std::size_t cachedBlocks{0};
+    };
+
+    struct BlockDeleter {
+      std::weak_ptr<State> state{};
+      std::size_t capacity{0};
+
+      void operator()(std::uint8_t *data) const;
+    };
+
+    using Block = std::unique_ptr<std::uint8_t[], BlockDeleter>;
+
+    ImageDataBufferPool();
+    explicit ImageDataBufferPool(const Options &options);
+
+    ImageDataBufferPool(const ImageDataBufferPool &) = delete;
+    ImageDataBufferPool &operator=(const ImageDataBufferPool &) = delete;
+
+    /**
+     * @brief Pool shared by all image data buffers
+     */
+    static std::shared_ptr<ImageDataBufferPool> Default();
+
+    /**
+     * @brief Capacity of the block holding `size` bytes, a multiple of
+     *   `Alignment` with at most 25% overhead
+     */
+    static std::size_t SizeClass(std::size_t size);
+
+    static std::size_t Capacity(const Block &block) {
+      return block.get_deleter().capacity;
+    }
+
+    /**
+     * @brief Block of at least `size` bytes, contents are undefined
+     */
+    Block acquire(std::size_t size);
+
+    /**
+     * @brief Free all cached blocks
+     */
+    void trim();
+
+    Metrics metrics() const;
+
+  private:
+    std::shared_ptr<State> state_;
+  };
+
+} // namespace IRacingTools::Shared::Graphics
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace IRacingTools::Shared::Graphics {
+
+  /**
+   * @brief Plain 3D vector, metres, same axes as `DirectX::SimpleMath`
+   *   (right handed, -Z forward)
+   */
+  struct OverlayVector3 {
+    float x{0.0f};
+    float y{0.0f};
+    float z{0.0f};
+
+    constexpr bool operator==(const OverlayVector3 &) const = default;
+  };
+
+  /**
+   * @brief Plain rotation quaternion
+   */
+  struct OverlayQuaternion {
+    float x{0.0f};
+    float y{0.0f};
+    float z{0.0f};
+    float w{1.0f};
+
+    constexpr bool operator==(const OverlayQuaternion &) const = default;
+  };
+
+  /**
+   * @brief An overlay's quad in VR space, facing +Z of `orientation`
+   */
+  struct OverlayQuad {
+    std::uint64_t overlayIdx{0};
+    OverlayVector3 center{};
+    OverlayQuaternion orientation{};
+    float width{0.0f};
+    float height{0.0f};
+
+    constexpr bool operator==(const OverlayQuad &) const = default;
+  };
+
+  /**
+   * @brief A controller or gaze ray, pointing along -Z of `orientation`
+   */
+  struct OverlayRay {
+    OverlayVector3 origin{};
+    OverlayQuaternion orientation{};
+  };
+
+  struct OverlayHit {
+    /**
+     * @brief Index of the quad in the span the index was built from
+     */
+    std::size_t index{0};
+    std::uint64_t overlayIdx{0};
+    float distance{0.0f};
+
+    /**
+     * @brief Where the ray hit the quad, 0..1 from its top left
+     */
+    float u{0.0f};
+    float v{0.0f};
+  };
+
+  /**
+   * @brief Nearest quad hit by `ray`, tested one by one.
+   *
+   *   Same rules as `RayIntersectsRect`: hits behind the ray origin or on
+   *   quads parallel to the ray don't count, edges do. On equal distance
+   *   the lowest index wins.
+   */
+  std::optional<OverlayHit> IntersectOverlayQuads(const OverlayRay &ray, std::span<const OverlayQuad> quads);
+
+  /**
+   * @brief BVH over overlay quads, so input handling does not test every
+   *   quad on every controller event.
+   *
+   *   Rebuilt only when `update` gets a different layout, queries are const
+   *   & may run concurrently.
+   */
+  class OverlaySpatialIndex {
+  public:
+    /**
+     * @brief Rebuild if `quads` differ from the current layout
+     * @return true when rebuilt
+     */
+    bool update(std::span<const OverlayQuad> quads);
+
+    /**
+     * @brief Same result as `IntersectOverlayQuads` over the indexed quads
+     */
+    std::optional<OverlayHit> intersect(const OverlayRay &ray) const;
+
+    /**
+     * @brief Cast several rays (i.e. both controllers) in one traversal,
+     *   `hits` must be as long as `rays`
+     */
+    void intersect(std::span<const OverlayRay> rays, std::span<std::optional<OverlayHit>> hits) const;
+
+    /**
+     * @brief Same result as `intersect`, testing every indexed quad without
+     *   the BVH (the baseline it is measured against)
+     */
+    std::optional<OverlayHit> intersectLinear(const OverlayRay &ray) const;
+
+    std::size_t size() const {
+      return quads_.size();
+    }
+
+  private:
+    friend std::optional<OverlayHit> IntersectOverlayQuads(const OverlayRay &ray, std::span<const OverlayQuad> quads);
+
+    struct Bounds {
+      OverlayVector3 min{};
+      OverlayVector3 max{};
+    };
+
+    /**
+     * @brief A quad with its axes precomputed, so hit tests skip the rotations
+     */
+    struct Prepared {
+      std::size_t index{0};
+      std::uint64_t overlayIdx{0};
+      OverlayVector3 center{};
+      OverlayVector3 axisX{};
+      OverlayVector3 axisY{};
+      OverlayVector3 normal{};
+      float halfWidth{0.0f};
+      float halfHeight{0.0f};
+      Bounds bounds{};
+    };
+
+    /**
+     * @brief Leaves hold `count` prepared quads from `first`, inner nodes
+     *   (`count == 0`) have their children at `first` & `first + 1`
+     */
+    struct Node {
+      Bounds bounds{};
+      std::uint32_t first{0};
+      std::uint32_t count{0};
+    };
+
+    struct PreparedRay {
+      OverlayVector3 origin{};
+      OverlayVector3 direction{};
+      OverlayVector3 inverseDirection{};
+    };
+
+    static PreparedRay PrepareRay(const OverlayRay &ray);
+
+    static Prepared PrepareQuad(const OverlayQuad &quad, std::size_t index);
+
+    /**
+     * @brief Replace `nearest` if `quad` is hit closer
+     */
+    static void IntersectQuad(const PreparedRay &ray, const Prepared &quad, std::optional<OverlayHit> &nearest);
+
+    void build(std::uint32_t node, std::uint32_t first, std::uint32_t count);
+
+    std::vector<OverlayQuad> quads_{};
+    std::vector<Prepared> prepared_{};
+    std::vector<Node> nodes_{};
+  };
+
+} // namespace IRacingTools::Shared::Graphics
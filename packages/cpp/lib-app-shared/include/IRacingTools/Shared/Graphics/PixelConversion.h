@@ -0,0 +1,103 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include <IRacingTools/Shared/Graphics/DamageTracking.h>
+
+namespace IRacingTools::Shared::Graphics {
+
+  /**
+   * @brief Instruction set used by the pixel conversions,
+   *   `Auto` picks the widest one supported by the running CPU
+   */
+  enum class PixelKernel : int {
+    Auto = 0,
+    Scalar,
+    SSSE3,
+    AVX2
+  };
+
+  bool IsPixelKernelSupported(PixelKernel kernel);
+
+  /**
+   * @brief Resolve `Auto` (or a kernel the CPU lacks) to the kernel actually used
+   */
+  PixelKernel GetPixelKernel(PixelKernel kernel = PixelKernel::Auto);
+
+  /**
+   * @brief Byte order of source pixels, `RGB` has no alpha (opaque)
+   */
+  enum class PixelLayout : std::uint32_t {
+    BGRA,
+    RGBA,
+    RGB
+  };
+
+  enum class PixelAlpha : std::uint32_t {
+    Premultiplied,
+    Straight
+  };
+
+  constexpr std::uint32_t PixelLayoutBPP(PixelLayout layout) {
+    return layout == PixelLayout::RGB ? 3 : 4;
+  }
+
+  /**
+   * @brief How source pixels become the shared texture format,
+   *   premultiplied `B8G8R8A8`
+   */
+  struct PixelConversion {
+    PixelLayout layout{PixelLayout::BGRA};
+    PixelAlpha alpha{PixelAlpha::Premultiplied};
+
+    /**
+     * @brief RGBA multiplier, as `SHMConfig::tint`, clamped to `[0, 1]`
+     *   & applied after premultiplying
+     */
+    std::array<float, 4> tint{1, 1, 1, 1};
+
+    std::uint32_t srcBPP() const {
+      return PixelLayoutBPP(layout);
+    }
+
+    /**
+     * @brief Source pixels are already in the shared texture format
+     */
+    bool isCopy() const;
+
+    bool operator==(const PixelConversion &) const = default;
+  };
+
+  /**
+   * @brief Convert `count` pixels from `src` to premultiplied BGRA in `dst`,
+   *   every kernel gives the same result (rounded to nearest)
+   */
+  void ConvertPixels(
+    const std::uint8_t *src,
+    std::uint8_t *dst,
+    std::size_t count,
+    const PixelConversion &conversion,
+    PixelKernel kernel = PixelKernel::Auto
+  );
+
+  /**
+   * @brief `ConvertPixels` limited to the `rects` regions of a frame,
+   *   so a damaged frame is read & written once
+   *
+   * @param srcStride bytes per source row
+   * @param dstLayout layout of `dst`, must be 4 bytes per pixel
+   */
+  void ConvertPixelRects(
+    const std::uint8_t *src,
+    std::uint32_t srcStride,
+    std::uint8_t *dst,
+    const DamageFrameLayout &dstLayout,
+    std::span<const DamageRect> rects,
+    const PixelConversion &conversion,
+    PixelKernel kernel = PixelKernel::Auto
+  );
+
+} // namespace IRacingTools::Shared::Graphics
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include <IRacingTools/Shared/Graphics/CoordinateToPixelConverter.h>
+
+namespace IRacingTools::Shared::Geometry {
+
+  /**
+   * @brief Douglas-Peucker simplification of an open polyline
+   *
+   * @param points polyline vertices (any planar unit)
+   * @param tolerance max distance (same unit as `points`) between the
+   *   polyline & its simplification
+   * @return ascending indexes of the kept vertices, always including
+   *   the first & last
+   */
+  std::vector<std::size_t> SimplifyPolyline(std::span<const PixelD> points, double tolerance);
+
+  /**
+   * @brief Largest distance between any of `points` & the polyline through
+   *   `points[indexes]`, i.e. the actual error of a simplification
+   */
+  double PolylineDeviation(std::span<const PixelD> points, std::span<const std::size_t> indexes);
+
+} // namespace IRacingTools::Shared::Geometry
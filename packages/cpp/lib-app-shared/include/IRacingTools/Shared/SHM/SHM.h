@@ -17,6 +17,7 @@
 #include <IRacingTools/Shared/VRTypes.h>
 #include <IRacingTools/Shared/Macros.h>
 #include <IRacingTools/Shared/ScreenTypes.h>
+#include <IRacingTools/Shared/SHM/SHMSeqLock.h>
 
 namespace IRacingTools::Shared::SHM {
     static constexpr DXGI_FORMAT SHARED_TEXTURE_PIXEL_FORMAT = DXGI_FORMAT_B8G8R8A8_UNORM;
@@ -51,6 +52,23 @@ namespace IRacingTools::Shared::SHM {
         Screen::ScreenOverlayFrameRenderConfig screen{};
 
       std::int64_t updatedAt{0};
+
+        /**
+         * @brief Changes whenever the producer draws new content for the
+         *   overlay, unlike `updatedAt` which also moves on every resubmit
+         */
+        uint64_t contentVersion{0};
+
+        /**
+         * @brief Changes when the overlay must be redrawn by consumers, i.e.
+         *   its content, placement on the texture or opacity changed
+         */
+        std::size_t getRenderCacheKey() const;
+
+        /**
+         * @brief Same content & placement as `other`, `updatedAt` is ignored
+         */
+        bool isSameFrame(const SHMOverlayFrameConfig& other) const;
     };
 
     static_assert(std::is_standard_layout_v<SHMOverlayFrameConfig>);
@@ -162,7 +180,28 @@ namespace IRacingTools::Shared::SHM {
     };
 
     static_assert(std::is_standard_layout_v<FrameMetadata>);
-    static constexpr DWORD SHMSize = sizeof(FrameMetadata);
+    static_assert(std::is_trivially_copyable_v<FrameMetadata>);
+
+    /**
+     * @brief What the SHM mapping holds.
+     *
+     *   The writer works on its own `FrameMetadata` & publishes complete
+     *   copies through `metadata`, readers copy it without ever taking the
+     *   SHM mutex (which only serializes writers).
+     */
+    struct SHMLayout {
+        SHMSeqLock<FrameMetadata> metadata;
+
+        /**
+         * @brief Incremented by VR readers on every frame they fetch, lets the
+         *   writer pace its submits to the consumer's cadence
+         *   (`frameNumber` only counts the writer's own submits)
+         */
+        alignas(sizeof(LONG64)) LONG64 consumerFrameNumber{0};
+    };
+
+    static_assert(std::is_standard_layout_v<SHMLayout>);
+    static constexpr DWORD SHMSize = sizeof(SHMLayout);
 
     struct IPCHandles {
 
@@ -228,7 +267,13 @@ namespace IRacingTools::Shared::SHM {
         NextFrameInfo beginFrame() noexcept;
         void submitFrame(const SHMConfig& config, const std::vector<SHMOverlayFrameConfig>& overlayFrameConfigs, HANDLE texture, HANDLE fence);
 
+        /**
+         * @brief Frames fetched by all readers so far, does not need the lock
+         */
+        uint64_t consumerFrameNumber() const;
+
         // "Lockable" C++ named concept: supports std::unique_lock
+        // Serializes writers only, readers never wait on it
         void lock();
         bool try_lock();
         void unlock();
@@ -270,6 +315,12 @@ namespace IRacingTools::Shared::SHM {
         uint64_t getSessionID() const;
         /// Changes even if the feeder restarts with frame ID 0
         size_t getRenderCacheKey() const;
+
+        /**
+         * @brief Per overlay `getRenderCacheKey`, only changes when that
+         *   overlay (or the session & tint) changed
+         */
+        size_t getOverlayRenderCacheKey(const SHMOverlayFrameConfig& overlayFrameConfig) const;
         SHMConfig getConfig() const;
         uint8_t getOverlayCount() const;
         const SHMOverlayFrameConfig* getOverlayFrameConfig(uint8_t layerIndex) const;
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace IRacingTools::Shared::SHM {
+
+  /**
+   * @brief Tracks the per overlay render cache keys a consumer's render
+   *   target holds, so only overlays whose key changed are redrawn.
+   *
+   *   GPU free, the consumer draws what `diff` returns, then `update`s.
+   */
+  class SHMOverlayRenderCache {
+  public:
+    struct Entry {
+      /**
+       * @brief Where the overlay is drawn on the target (its sprite index)
+       */
+      std::uint32_t slot{0};
+      std::size_t key{0};
+
+      bool operator==(const Entry&) const = default;
+    };
+
+    struct Diff {
+      /**
+       * @brief The drawn slots changed (or nothing was drawn yet), the target
+       *   must be cleared & every entry drawn
+       */
+      bool full{false};
+
+      /**
+       * @brief Indices into the diffed entries to draw, all of them when `full`
+       */
+      std::vector<std::size_t> changed{};
+
+      bool empty() const {
+        return !full && changed.empty();
+      }
+    };
+
+    /**
+     * @brief Mix `value` into `seed`, for building keys from several values
+     */
+    static std::size_t Combine(std::size_t seed, std::size_t value);
+
+    /**
+     * @brief Compare `entries` with what the target holds
+     */
+    Diff diff(std::span<const Entry> entries) const;
+
+    /**
+     * @brief The target now holds `entries`
+     */
+    void update(std::span<const Entry> entries);
+
+    /**
+     * @brief Forget what the target holds, i.e. it was recreated
+     */
+    void reset();
+
+  private:
+    std::optional<std::vector<Entry>> rendered_{};
+  };
+
+} // namespace IRacingTools::Shared::SHM
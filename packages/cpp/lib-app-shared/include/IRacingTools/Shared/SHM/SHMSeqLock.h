@@ -0,0 +1,139 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+
+namespace IRacingTools::Shared::SHM {
+
+  /**
+   * @brief Publishes a trivially copyable value through shared memory,
+   *   readers never block & always get a complete value (the previous or
+   *   the new one, never a mix).
+   *
+   *   Two slots, each guarded by a sequence number: a writer fills the slot
+   *   readers are not pointed at, then publishes it. A reader only retries
+   *   when writers lapped it twice during its copy.
+   *
+   *   Plain words only (accessed through `std::atomic_ref`), so it can live
+   *   in a mapping shared by processes, zero filled memory is an empty
+   *   channel holding a zero filled value.
+   */
+  template <class T>
+    requires std::is_trivially_copyable_v<T>
+  class SHMSeqLock {
+  public:
+    static constexpr std::size_t Words = (sizeof(T) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+
+    using Word = std::uint64_t;
+    using WordRef = std::atomic_ref<Word>;
+
+    static_assert(WordRef::is_always_lock_free, "SHMSeqLock needs lock free 64bit atomics to be shared by processes");
+
+    /**
+     * @brief Publish `value`, writers are serialized (spinning) so the
+     *   critical section is only the copy
+     */
+    void store(const T& value) noexcept {
+      lockWriters();
+      storeLocked(value);
+      unlockWriters();
+    }
+
+    /**
+     * @brief Drop a writer lock left by a crashed writer & publish `value`,
+     *   only when no other writer can be running (i.e. under the SHM mutex)
+     */
+    void reset(const T& value) noexcept {
+      WordRef(writerLock_).store(0, std::memory_order_release);
+      store(value);
+    }
+
+    /**
+     * @brief Single attempt, fails only if writers lapped the reader
+     */
+    bool tryLoad(T& value) const noexcept {
+      auto published = WordRef(published_).load(std::memory_order_acquire);
+      auto& slot = slots_[published & 1];
+      auto before = WordRef(slot.sequence).load(std::memory_order_acquire);
+      if (before & 1)
+        return false;
+
+      std::array<Word, Words> words;
+      for (std::size_t idx = 0; idx < Words; idx++)
+        words[idx] = WordRef(slot.words[idx]).load(std::memory_order_relaxed);
+
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (WordRef(slot.sequence).load(std::memory_order_relaxed) != before)
+        return false;
+
+      std::memcpy(&value, words.data(), sizeof(T));
+      return true;
+    }
+
+    T load() const noexcept {
+      T value;
+      while (!tryLoad(value)) {
+        std::this_thread::yield();
+      }
+
+      return value;
+    }
+
+    /**
+     * @brief Number of values published so far, changes on every `store`
+     */
+    std::uint64_t version() const noexcept {
+      return WordRef(published_).load(std::memory_order_acquire);
+    }
+
+  private:
+    struct Slot {
+      /**
+       * @brief Odd while a writer fills the slot
+       */
+      Word sequence;
+      std::array<Word, Words> words;
+    };
+
+    void lockWriters() noexcept {
+      Word expected = 0;
+      while (!WordRef(writerLock_).compare_exchange_weak(expected, 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+        expected = 0;
+        std::this_thread::yield();
+      }
+    }
+
+    void unlockWriters() noexcept {
+      WordRef(writerLock_).store(0, std::memory_order_release);
+    }
+
+    void storeLocked(const T& value) noexcept {
+      std::array<Word, Words> words{};
+      std::memcpy(words.data(), &value, sizeof(T));
+
+      // FILL THE SLOT READERS ARE NOT POINTED AT
+      auto next = WordRef(published_).load(std::memory_order_relaxed) + 1;
+      auto& slot = slots_[next & 1];
+      WordRef sequence(slot.sequence);
+      auto before = sequence.load(std::memory_order_relaxed);
+      sequence.store(before + 1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+
+      for (std::size_t idx = 0; idx < Words; idx++)
+        WordRef(slot.words[idx]).store(words[idx], std::memory_order_relaxed);
+
+      sequence.store(before + 2, std::memory_order_release);
+      WordRef(published_).store(next, std::memory_order_release);
+    }
+
+    // `std::atomic_ref` NEEDS NON CONST OBJECTS, READERS DON'T WRITE THROUGH
+    alignas(64) Word writerLock_;
+    alignas(64) mutable Word published_;
+    alignas(64) mutable std::array<Slot, 2> slots_;
+  };
+
+} // namespace IRacingTools::Shared::SHM
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include <IRacingTools/SDK/Client.h>
+#include <IRacingTools/SDK/DiskClient.h>
+#include <IRacingTools/SDK/ErrorTypes.h>
+#include <IRacingTools/SDK/Resources.h>
+#include <IRacingTools/SDK/SessionInfo/SplitTimeInfo.h>
+
+namespace IRacingTools::Shared::Services {
+  using namespace IRacingTools::SDK;
+
+  /**
+   * @brief Start/finish & sector split crossing detection for every car,
+   *   fed one tick (`SessionTime` + `CarIdxLapDistPct` of all cars) at a time.
+   *
+   * Per car state is kept as structure-of-arrays, so a tick is one pass
+   * over contiguous `float`s to find the cars that changed sector, and
+   * crossing times are only interpolated for those.
+   */
+  class LapTimingEngine {
+  public:
+    static constexpr std::size_t MaxCars = Resources::MaxCars;
+
+    /**
+     * @brief Largest `LapDistPct` change accepted between two ticks,
+     *   anything above is a teleport (tow, reset) rather than driving
+     */
+    static constexpr float MaxTickAdvance = 0.1f;
+
+    enum class EventType : int {
+      Lap,
+      Sector
+    };
+
+    struct Event {
+      EventType type{EventType::Lap};
+      std::int32_t carIdx{0};
+
+      /**
+       * @brief Start/finish crossings seen for the car (the lap just
+       *   completed, or the lap the sector belongs to)
+       */
+      std::int32_t lap{0};
+
+      /**
+       * @brief Index of the completed sector (`Sector` events only)
+       */
+      std::int32_t sectorNum{0};
+
+      /**
+       * @brief Interpolated crossing time (seconds of session time)
+       */
+      double sessionTime{0.0};
+
+      /**
+       * @brief Lap or sector time in seconds,
+       *   `-1` when its start was not observed
+       */
+      double elapsed{-1.0};
+    };
+
+    LapTimingEngine();
+    explicit LapTimingEngine(const SDK::SessionInfo::SplitTimeInfo& splitTimeInfo);
+
+    /**
+     * @brief Set the sector split points (`SectorStartPct`), start/finish
+     *   (`0`) is always a split. Resets all car state.
+     */
+    void setSplits(std::span<const float> sectorStartPcts);
+    void setSplits(const SDK::SessionInfo::SplitTimeInfo& splitTimeInfo);
+
+    /**
+     * @brief Forget all crossings, i.e. on a new session
+     */
+    void reset();
+
+    /**
+     * @brief Process a tick, time moving backwards resets the engine
+     *
+     * @param lapDistPct `CarIdxLapDistPct` per car, negative when not in world
+     * @param events receives the crossings of this tick (appended, not cleared)
+     * @return number of events appended
+     */
+    std::size_t update(double sessionTime, std::span<const float> lapDistPct, std::vector<Event>& events);
+
+    /**
+     * @brief Process the current sample of `client` (live or disk)
+     */
+    Expected<std::size_t> update(Client& client, std::vector<Event>& events);
+
+    /**
+     * @brief Batch mode, process every remaining sample of `client` as fast
+     *   as possible (splits are taken from the file's session info)
+     *
+     * @return number of samples processed
+     */
+    Expected<std::size_t> run(const std::shared_ptr<DiskClient>& client, std::vector<Event>& events);
+
+    const std::vector<float>& splits() const;
+
+    /**
+     * @return last / best lap time of the car in seconds, `-1` when none
+     */
+    double lastLapTime(std::size_t carIdx) const;
+    double bestLapTime(std::size_t carIdx) const;
+
+    std::int32_t lapCount(std::size_t carIdx) const;
+
+  private:
+    void resetCar(std::size_t carIdx);
+
+    /**
+     * @brief Slow path for a car that changed sector (or moved backwards)
+     */
+    std::size_t processCrossings(std::size_t carIdx, float currentPct, double sessionTime, std::vector<Event>& events);
+
+    /**
+     * @brief Sorted split points, `splits_[0] == 0` (start/finish)
+     */
+    std::vector<float> splits_{0.0f};
+
+    double lastSessionTime_{-1.0};
+
+    // Per car state (structure of arrays)
+    std::array<float, MaxCars> lastPct_{};
+    std::array<std::int32_t, MaxCars> sector_{};
+    std::array<std::int32_t, MaxCars> lapCount_{};
+    std::array<double, MaxCars> lapStartTime_{};
+    std::array<double, MaxCars> sectorStartTime_{};
+    std::array<double, MaxCars> lastLapTime_{};
+    std::array<double, MaxCars> bestLapTime_{};
+
+    /**
+     * @brief Scratch space for the per tick sector pass
+     */
+    std::array<std::int32_t, MaxCars> currentSector_{};
+  };
+} // namespace IRacingTools::Shared::Services
@@ -3,6 +3,7 @@
 #include <IRacingTools/Shared/SharedAppLibPCH.h>
 
 #include <filesystem>
+#include <span>
 
 #include <IRacingTools/Models/LapTrajectory.pb.h>
 
@@ -12,6 +13,7 @@
 #include <IRacingTools/SDK/VarHolder.h>
 
 #include <IRacingTools/Shared/Services/TelemetryFileHandler.h>
+#include <IRacingTools/Shared/Services/TrackPositionLUT.h>
 #include <IRacingTools/Shared/ProtoHelpers.h>
 
 namespace IRacingTools::Shared::Services {
@@ -20,16 +22,113 @@ namespace IRacingTools::Shared::Services {
 
   class LapTrajectoryTool {  
   public:    
+    /**
+     * @brief Default number of `LapDistPct` grid points in a fused path
+     */
+    static constexpr std::size_t DefaultResolution = 2048;
+
     struct CreateOptions {
       std::optional<std::filesystem::path> outputDir {std::nullopt};
       bool includeInvalidLaps{false};
+
+      /**
+       * @brief Fuse all valid laps onto a fixed `LapDistPct` grid,
+       *   `false` keeps the raw samples of the fastest lap
+       */
+      bool fuseLaps{true};
+
+      std::size_t resolution{DefaultResolution};
+
+      /**
+       * @brief Lap samples further from the per grid point median than
+       *   `outlierThreshold` (scaled) median absolute deviations are dropped
+       */
+      double outlierThreshold{3.0};
+
+      /**
+       * @brief Threads used to resample laps, defaults to one per lap
+       *   (capped at the hardware concurrency)
+       */
+      std::optional<std::size_t> threadCount{std::nullopt};
+
+      /**
+       * @brief Overlay sizes (longest side, pixels) to create simplified
+       *   `levels_of_detail` for, empty disables them
+       */
+      std::vector<std::uint32_t> lodSizes{2048, 1024, 512, 256, 128};
+
+      /**
+       * @brief Max deviation of a level of detail from the full path,
+       *   in pixels at the level's size
+       */
+      float lodPixelTolerance{0.5f};
+
+      /**
+       * @brief Bins of the persisted `position_lookup_table`, `0` disables it
+       */
+      std::uint32_t lutBinCount{TrackPositionLUT::DefaultBinCount};
+    };
+
+    /**
+     * @brief A fused path point, `distance` is the cumulative path length
+     *   in meters from the first point
+     */
+    struct FusedPoint {
+      float lapPercentComplete{0.0f};
+      double lapTime{0.0};
+      float lapDistance{0.0f};
+      double latitude{0.0};
+      double longitude{0.0};
+      float altitude{0.0f};
+      double distance{0.0};
+
+      /**
+       * @brief Laps averaged into this point (after outlier rejection)
+       */
+      std::uint32_t sampleCount{0};
     };
 
     std::expected<std::shared_ptr<Models::LapTrajectory>, GeneralError> createLapTrajectory(const std::filesystem::path &file, const CreateOptions& options = {});
     std::expected<std::shared_ptr<Models::LapTrajectory>, GeneralError> createLapTrajectory(const std::shared_ptr<SDK::DiskClient> &client, const CreateOptions& options = {});
 
-  
-    
-  
+    /**
+     * @brief Build the trajectory from already extracted `laps`, the last
+     *   step of `createLapTrajectory`
+     */
+    static std::expected<std::shared_ptr<Models::LapTrajectory>, GeneralError> CreateLapTrajectory(
+      const std::vector<TelemetryFileHandler::LapDataWithPath> &laps,
+      const Models::TrackLayoutMetadata &trackLayoutMetadata,
+      const CreateOptions& options
+    );
+
+    /**
+     * @brief Resample every lap onto a `options.resolution` point `LapDistPct`
+     *   grid (in parallel) & robustly average the laps per grid point
+     */
+    static std::expected<std::vector<FusedPoint>, GeneralError> FuseLaps(
+      const std::vector<TelemetryFileHandler::LapDataWithPath> &laps,
+      const CreateOptions& options
+    );
+
+    /**
+     * @brief Replace the `levels_of_detail` of `trajectory` with one
+     *   simplification of its `path` per size in `sizes`
+     *
+     * @return number of levels created
+     */
+    static std::size_t CreateLevelsOfDetail(
+      Models::LapTrajectory &trajectory,
+      std::span<const std::uint32_t> sizes,
+      float pixelTolerance
+    );
+
+    /**
+     * @brief The smallest level of detail that can be drawn `size` pixels
+     *   across, the full `path` when none is large enough
+     */
+    static const google::protobuf::RepeatedPtrField<Models::LapCoordinate> &SelectPath(
+      const Models::LapTrajectory &trajectory,
+      std::uint32_t size
+    );
   };
 }// namespace IRacingTools::Shared::Services
@@ -0,0 +1,240 @@
+#pragma once
+
+#include <IRacingTools/Shared/SharedAppLibPCH.h>
+
+#include <any>
+#include <chrono>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <IRacingTools/Models/Pipeline.pb.h>
+
+#include <IRacingTools/SDK/ErrorTypes.h>
+
+namespace IRacingTools::Shared::Services::Pipelines {
+  namespace fs = std::filesystem;
+  using namespace Models;
+
+  /**
+   * @brief Named values produced & consumed by the stages of a single
+   *   pipeline item.  Each artifact is written once (by the stage that
+   *   declares it as an output) before any stage reading it is started.
+   */
+  class PipelineArtifacts {
+  public:
+    template<typename T>
+    void set(const std::string &name, T value) {
+      std::scoped_lock lock(mutex_);
+      values_[name] = std::make_any<T>(std::move(value));
+    }
+
+    /**
+     * @return `nullptr` if `name` is missing or not a `T`
+     */
+    template<typename T>
+    const T *get(const std::string &name) const {
+      std::scoped_lock lock(mutex_);
+      auto it = values_.find(name);
+      return it == values_.end() ? nullptr : std::any_cast<T>(&it->second);
+    }
+
+    bool contains(const std::string &name) const {
+      std::scoped_lock lock(mutex_);
+      return values_.contains(name);
+    }
+
+    void setAny(const std::string &name, std::any value) {
+      std::scoped_lock lock(mutex_);
+      values_[name] = std::move(value);
+    }
+
+    std::optional<std::any> getAny(const std::string &name) const {
+      std::scoped_lock lock(mutex_);
+      auto it = values_.find(name);
+      if (it == values_.end())
+        return std::nullopt;
+
+      return it->second;
+    }
+
+  private:
+    mutable std::mutex mutex_{};
+    std::map<std::string, std::any> values_{};
+  };
+
+  /**
+   * @brief Serializes an artifact for checkpointing, artifacts without a
+   *   codec are always recomputed
+   */
+  struct ArtifactCodec {
+    std::function<std::string(const std::any &)> encode;
+    std::function<std::optional<std::any>(const std::string &)> decode;
+  };
+
+  /**
+   * @brief Codec for artifacts stored as `std::shared_ptr<M>`
+   */
+  template<typename M>
+  ArtifactCodec ProtoArtifactCodec() {
+    return ArtifactCodec{
+        .encode = [](const std::any &value) {
+          return std::any_cast<const std::shared_ptr<M> &>(value)->SerializeAsString();
+        },
+        .decode = [](const std::string &bytes) -> std::optional<std::any> {
+          auto message = std::make_shared<M>();
+          if (!message->ParseFromString(bytes))
+            return std::nullopt;
+
+          return std::make_any<std::shared_ptr<M>>(message);
+        }};
+  }
+
+  /**
+   * @brief DAG of stages, each declaring the artifacts it reads & writes.
+   *
+   * Stages run on their own thread pool as soon as all the stages producing
+   * their inputs have completed, so independent stages run concurrently,
+   * and items flow between stages through bounded queues.  When a
+   * `checkpointDir` is set, stage outputs are persisted keyed by a
+   * fingerprint of the item, the stage (`name` & `version`) & all of its
+   * upstream stages, so re-running an item only recomputes stages that
+   * changed or never completed.
+   */
+  class PipelineGraph {
+  public:
+    using StageFn = std::function<std::optional<SDK::GeneralError>(PipelineArtifacts &)>;
+
+    struct Stage {
+      std::string name;
+      std::vector<std::string> inputs{};
+      std::vector<std::string> outputs{};
+      StageFn fn{};
+
+      /**
+       * @brief Bump when the stage logic changes to invalidate its
+       *   checkpoints (and those of its downstream stages)
+       */
+      std::uint32_t version{1};
+
+      /**
+       * @brief Options the stage's output depends on (i.e. filters), part
+       *   of its checkpoint fingerprint like `version`
+       */
+      std::string params{};
+
+      std::size_t threadCount{1};
+      std::size_t maxAttempts{1};
+    };
+
+    struct Options {
+      /**
+       * @brief Max items queued per stage, upstream stages block when full
+       */
+      std::size_t queueCapacity{8};
+
+      std::optional<fs::path> checkpointDir{std::nullopt};
+    };
+
+    struct StageResult {
+      std::string name{};
+      PipelineStatus status{PIPELINE_STATUS_CREATED};
+      std::int64_t startedAt{0};
+      std::chrono::microseconds duration{0};
+      std::uint32_t attemptCount{0};
+      bool fromCheckpoint{false};
+    };
+
+    /**
+     * @brief A unit of work, `key` must change whenever the source changes
+     *   (i.e. path, size & modified time of a file)
+     */
+    struct Item {
+      std::string key{};
+
+      /**
+       * @brief Seeded with the inputs not produced by any stage
+       */
+      PipelineArtifacts artifacts{};
+
+      /**
+       * @brief Indexed like `stages()`
+       */
+      std::vector<StageResult> stages{};
+
+      PipelineStatus status{PIPELINE_STATUS_CREATED};
+      std::optional<SDK::GeneralError> error{std::nullopt};
+
+      /**
+       * @brief Copy status, stage results & error to `attempt`
+       */
+      void toModel(Pipeline::Attempt *attempt) const;
+    };
+
+    PipelineGraph() = default;
+    explicit PipelineGraph(const Options &options);
+
+    /**
+     * @brief Add a stage, fails if the name or an output is already in use
+     */
+    std::optional<SDK::GeneralError> addStage(Stage stage);
+
+    void setCodec(const std::string &artifact, ArtifactCodec codec);
+
+    const std::vector<Stage> &stages() const;
+
+    /**
+     * @brief Stage indexes in dependency order, fails on a cycle
+     */
+    std::expected<std::vector<std::size_t>, SDK::GeneralError> stageOrder() const;
+
+    /**
+     * @brief Run all stages for every item, returns once all items completed
+     *   or failed.  Per item failures are reported in `Item::error`.
+     */
+    std::optional<SDK::GeneralError> run(const std::vector<std::shared_ptr<Item>> &items);
+
+    std::optional<SDK::GeneralError> run(const std::shared_ptr<Item> &item);
+
+    /**
+     * @brief Remove all checkpoints of `itemKey`, i.e. once its final
+     *   output is persisted elsewhere
+     */
+    void clearCheckpoints(const std::string &itemKey);
+
+    /**
+     * @brief Remove the checkpoints of every item `isStale` rejects (or
+     *   whose key is unknown) from `checkpointDir`
+     *
+     * @return number of items removed
+     */
+    std::size_t pruneCheckpoints(const std::function<bool(const std::string &itemKey)> &isStale);
+
+  private:
+    struct RunState;
+    struct ItemRun;
+
+    void runStage(std::size_t stageIdx, const std::shared_ptr<ItemRun> &itemRun);
+    bool restoreCheckpoint(const Stage &stage, ItemRun &itemRun, std::uint64_t fingerprint);
+    void saveCheckpoint(const Stage &stage, ItemRun &itemRun, std::uint64_t fingerprint);
+    void finishItem(ItemRun &itemRun);
+    std::optional<fs::path> checkpointPath(const std::string &itemKey) const;
+
+    /**
+     * @brief `checkpointPath`, created with the item key stored in it
+     */
+    std::optional<fs::path> createCheckpointPath(const std::string &itemKey) const;
+
+    Options options_{};
+    std::vector<Stage> stages_{};
+    std::map<std::string, ArtifactCodec> codecs_{};
+  };
+
+} // namespace IRacingTools::Shared::Services::Pipelines
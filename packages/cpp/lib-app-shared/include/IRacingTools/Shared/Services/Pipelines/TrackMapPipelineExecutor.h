@@ -2,11 +2,14 @@
 
 #include <IRacingTools/Shared/SharedAppLibPCH.h>
 
+#include <IRacingTools/Models/LapTrajectory.pb.h>
 #include <IRacingTools/Models/TelemetryDataFile.pb.h>
 
 #include <IRacingTools/Shared/FileWatcher.h>
 #include <IRacingTools/Shared/ProtoHelpers.h>
+#include <IRacingTools/Shared/Services/LapTrajectoryTool.h>
 #include <IRacingTools/Shared/Services/Pipelines/PipelineExecutor.h>
+#include <IRacingTools/Shared/Services/Pipelines/PipelineGraph.h>
 #include <IRacingTools/Shared/Services/Service.h>
 
 
@@ -17,20 +20,89 @@ namespace IRacingTools::Shared::Services::Pipelines {
 
   using namespace Models;
   
+  /**
+   * @brief Track map pipeline, `header` & `laps` are read from the IBT file
+   *   concurrently & checkpointed, then fused into the `trajectory`
+   */
   class TrackMapPipelineExecutor : public PipelineExecutor<std::shared_ptr<TelemetryDataFile>> {
 
   public:
+    /**
+     * @brief `fs::path`, the only source artifact
+     */
+    static constexpr auto FileArtifact = "file";
+
+    /**
+     * @brief `std::shared_ptr<TrackLayoutMetadata>`
+     */
+    static constexpr auto HeaderArtifact = "header";
+
+    /**
+     * @brief `std::shared_ptr<std::vector<TelemetryFileHandler::LapDataWithPath>>`
+     */
+    static constexpr auto LapsArtifact = "laps";
+
+    /**
+     * @brief `std::shared_ptr<LapTrajectory>`
+     */
+    static constexpr auto TrajectoryArtifact = "trajectory";
+
     static std::shared_ptr<TrackMapPipelineExecutor> Factory() {
       return std::make_shared<TrackMapPipelineExecutor>();
     }
 
+    /**
+     * @brief Checkpoints to `PipelineCheckpointsPath` in the app data path
+     */
     TrackMapPipelineExecutor();
 
+    /**
+     * @brief `createOptions` are used by the `laps` (`includeInvalidLaps`)
+     *   & `trajectory` stages
+     */
+    explicit TrackMapPipelineExecutor(
+      const PipelineGraph::Options &options,
+      const LapTrajectoryTool::CreateOptions &createOptions = {}
+    );
+
     virtual std::optional<SDK::GeneralError> execute(PipelineAttemptEditor& attempt,
                                       const std::shared_ptr<ServiceContainer> &serviceContainer,
                                       std::shared_ptr<TelemetryDataFile> data) override;
 
+    /**
+     * @brief Run the pipeline for `file`, stage timings are recorded in
+     *   `attempt`
+     */
+    std::expected<std::shared_ptr<LapTrajectory>, SDK::GeneralError> createLapTrajectory(
+      PipelineAttemptEditor &attempt,
+      const fs::path &file
+    );
+
+    /**
+     * @brief Drop the checkpoints of `file`, once its trajectory is persisted
+     */
+    void clearCheckpoints(const fs::path &file);
+
+    /**
+     * @brief Drop the checkpoints of files that were deleted or changed
+     *   since they were processed
+     *
+     * @return number of files whose checkpoints were removed
+     */
+    std::size_t pruneCheckpoints();
+
+    PipelineGraph &graph();
+
     virtual ~TrackMapPipelineExecutor() = default;
+
+  private:
+    /**
+     * @brief Changes with the file, so a re-recorded file never hits a
+     *   stale checkpoint
+     */
+    static std::expected<std::string, SDK::GeneralError> ItemKey(const fs::path &file);
+
+    PipelineGraph graph_;
   };
 
 } // namespace IRacingTools::Shared::Services::Pipelines
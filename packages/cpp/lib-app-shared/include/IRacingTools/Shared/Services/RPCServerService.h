@@ -2,10 +2,19 @@
 
 #include <IRacingTools/Shared/SharedAppLibPCH.h>
 
+#include <chrono>
+#include <deque>
+#include <map>
 #include <memory>
+#include <regex>
+#include <string_view>
+#include <unordered_map>
+
+#include <google/protobuf/arena.h>
 
 #include <IRacingTools/Models/rpc/Envelope.pb.h>
 
+#include <IRacingTools/Shared/Common/LatencyHistogram.h>
 #include <IRacingTools/Shared/Common/TaskQueue.h>
 #include <IRacingTools/Shared/ProtoHelpers.h>
 #include <IRacingTools/Shared/Services/Service.h>
@@ -25,17 +34,78 @@ namespace IRacingTools::Shared::Services {
 
   public:
     using Envelope = std::shared_ptr<Models::RPC::Envelope>;
+
+    /**
+     * @brief Request & response envelopes of a single call, allocated on an
+     *   arena that is reset & reused once the exchange is released
+     */
+    class Exchange {
+    public:
+      explicit Exchange(std::size_t initialBlockSize);
+
+      google::protobuf::Arena *arena();
+
+      RPC::Envelope *request();
+
+      RPC::Envelope *response();
+
+      /**
+       * @brief Scratch buffer for the serialized response, keeps its capacity
+       *   between calls
+       */
+      std::string &responseBytes();
+
+      void reset();
+
+    private:
+      std::unique_ptr<char[]> initialBlock_;
+      std::unique_ptr<google::protobuf::Arena> arena_;
+      RPC::Envelope *request_{nullptr};
+      RPC::Envelope *response_{nullptr};
+      std::string responseBytes_{};
+    };
+
+    using ExchangePtr = std::shared_ptr<Exchange>;
+
     class Route {
       std::string matchExpression_;
-      std::regex matcher_;
+      bool exact_;
+      std::optional<std::regex> matcher_{};
+      std::size_t maxConcurrency_{0};
 
     public:
       explicit Route(const std::string &matchExpression = "");
       virtual ~Route() = default;
 
+      const std::string &matchExpression() const;
+
+      /**
+       * @brief Max requests of this route running at once on the worker
+       *   pool, further requests wait for a running one to complete.
+       *   `0` is unlimited.
+       */
+      std::size_t maxConcurrency() const;
+
+      /**
+       * @brief Must be set before the route is added
+       */
+      void setMaxConcurrency(std::size_t maxConcurrency);
+
+      /**
+       * @brief The path this route matches, when the match expression has no
+       *   regex syntax.  Exact routes are looked up by hash instead of being
+       *   tested one by one.
+       *
+       *  > NOTE: routes overriding `accepts` must override this as well
+       */
+      virtual std::optional<std::string_view> exactPath() const;
+
       virtual bool accepts(const std::string &path);
-      virtual std::expected<Envelope, SDK::GeneralError>
-      execute(const Envelope &messageIn, const Envelope& messageOut) = 0;
+
+      /**
+       * @brief Handle `exchange->request()`, populating `exchange->response()`
+       */
+      virtual std::optional<SDK::GeneralError> execute(const ExchangePtr &exchange) = 0;
     };
 
     /**
@@ -64,26 +134,27 @@ namespace IRacingTools::Shared::Services {
           : Route(matchExpression), executor_(executor) {
       }
 
-      virtual std::expected<Envelope, SDK::GeneralError>
-      execute(const Envelope &messageIn, const Envelope& messageOut) override {
-        auto req = std::make_shared<RequestType>();
-        if (!messageIn->payload().UnpackTo(req.get())) {
-          return std::unexpected(SDK::GeneralError("Failed to unpack payload"));
+      virtual std::optional<SDK::GeneralError> execute(const ExchangePtr &exchange) override {
+        // REQUEST LIVES ON THE EXCHANGE ARENA, THE SHARED POINTERS
+        // ALIAS THE EXCHANGE SO NO CONTROL BLOCKS ARE ALLOCATED
+        auto req = google::protobuf::Arena::CreateMessage<RequestType>(exchange->arena());
+        if (!exchange->request()->payload().UnpackTo(req)) {
+          return SDK::GeneralError("Failed to unpack payload");
         }
 
-
-
-        auto result = executor_(req, messageIn);
+        auto result = executor_(
+            std::shared_ptr<RequestType>(exchange, req),
+            std::shared_ptr<RPC::Envelope>(exchange, exchange->request()));
         if (!result) {
-          return std::unexpected(result.error());
+          return result.error();
         }
 
-        auto response = result.value();
-        auto payload = messageOut->mutable_payload();
+        auto &response = result.value();
+        auto payload = exchange->response()->mutable_payload();
         VRK_LOG_AND_FATAL_IF(
             !payload->PackFrom(*response), "Unable to pack response message");
 
-        return messageOut;
+        return std::nullopt;
       }
 
       static std::shared_ptr<TypedRoute>
@@ -99,7 +170,23 @@ namespace IRacingTools::Shared::Services {
     };
 
     struct Options {
+      /**
+       * @brief Run `executeAsync` requests on a worker pool, otherwise they
+       *   run inline on the calling thread
+       */
       bool useTaskQueue{false};
+
+      std::size_t workerCount{4};
+
+      /**
+       * @brief Size of the arena block preallocated for each exchange
+       */
+      std::size_t exchangeBlockSize{16 * 1024};
+
+      /**
+       * @brief Max released exchanges kept for reuse
+       */
+      std::size_t maxPooledExchanges{16};
     };
 
     struct {
@@ -129,15 +216,176 @@ namespace IRacingTools::Shared::Services {
      */
     virtual std::optional<SDK::GeneralError> destroy() override;
 
+    /**
+     * @brief Replace the options of a service created by a
+     *   `ServiceManager`, must be called before `start()`
+     */
+    void setOptions(const Options &options);
+
+    /**
+     * @brief Execute a request, copying it to a pooled exchange
+     *
+     * @return response envelope, which keeps the exchange alive
+     */
     Envelope execute(const Envelope &messageIn);
 
-    void addRoute(const std::shared_ptr<Route>& route);
+    /**
+     * @brief Execute `exchange->request()` in place, the response is
+     *   written to `exchange->response()`
+     */
+    void execute(const ExchangePtr &exchange);
+
+    /**
+     * @brief Called once the response of an `executeAsync` request is
+     *   populated, on a worker thread.  Requests dropped by `destroy()`
+     *   complete with `STATUS_ERROR`.
+     */
+    using Completion = std::function<void(const ExchangePtr &)>;
+
+    /**
+     * @brief Execute `exchange->request()` on the worker pool, honoring
+     *   the route's `maxConcurrency`
+     */
+    void executeAsync(const ExchangePtr &exchange, Completion onComplete);
+
+    struct RouteMetrics {
+      std::size_t running{0};
+      std::size_t waiting{0};
+      LatencyHistogram::Snapshot latency{};
+    };
+
+    /**
+     * @brief Latencies are measured from `execute`/`executeAsync` until the
+     *   response is populated, so they include time spent waiting
+     */
+    struct Metrics {
+      std::size_t inFlight{0};
+      LatencyHistogram::Snapshot latency{};
+
+      /**
+       * @brief Keyed by route match expression
+       */
+      std::map<std::string, RouteMetrics> routes{};
+    };
 
+    Metrics metrics();
 
+    /**
+     * @brief Get an exchange with empty envelopes, returned to the pool when
+     *   the last reference is released
+     */
+    ExchangePtr acquireExchange();
+
+    void addRoute(const std::shared_ptr<Route>& route);
+
+    /**
+     * @brief First registered route accepting `path`, or `nullptr`
+     */
+    std::shared_ptr<Route> findRoute(const std::string &path);
 
   private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Call;
+
+    /**
+     * @brief Concurrency gate & latency of a route, shared by the route
+     *   table snapshots
+     */
+    struct RouteState {
+      std::mutex mutex{};
+      std::size_t running{0};
+      std::deque<std::shared_ptr<Call>> waiting{};
+      LatencyHistogram latency{};
+    };
+
+    struct StringHash {
+      using is_transparent = void;
+
+      std::size_t operator()(std::string_view value) const {
+        return std::hash<std::string_view>{}(value);
+      }
+    };
+
+    /**
+     * @brief Immutable snapshot of the routes, rebuilt by `addRoute`
+     */
+    struct RouteTable {
+      struct Entry {
+        std::size_t order;
+        std::shared_ptr<Route> route;
+        std::shared_ptr<RouteState> state;
+      };
+
+      std::unordered_map<std::string, Entry, StringHash, std::equal_to<>> exact{};
+
+      /**
+       * @brief Regex & catch-all routes, in registration order
+       */
+      std::vector<Entry> patterns{};
+
+      std::size_t size{0};
+    };
+
+    struct ExchangePool {
+      std::mutex mutex{};
+      std::vector<std::unique_ptr<Exchange>> exchanges{};
+    };
+
+    /**
+     * @brief A pending `executeAsync` request, completes with an error if
+     *   destroyed before it ran
+     */
+    struct Call {
+      RPCServerService *server;
+      ExchangePtr exchange;
+      Completion onComplete;
+      std::optional<RouteTable::Entry> entry;
+      Clock::time_point startedAt;
+      bool completed{false};
+
+      ~Call();
+
+      void complete();
+    };
+
+    std::shared_ptr<const RouteTable> routeTable();
+
+    std::optional<RouteTable::Entry> findEntry(const std::string &path);
+
+    /**
+     * @brief Run the route & populate the response status, records latency
+     */
+    void executeEntry(const ExchangePtr &exchange, const std::optional<RouteTable::Entry> &entry, Clock::time_point startedAt);
+
+    /**
+     * @brief Worker pool task, dispatches the next waiting call of the route
+     *   once done
+     */
+    void runCall(const std::shared_ptr<Call> &call);
+
+    /**
+     * @brief Enqueue `call` once its route is below `maxConcurrency`
+     */
+    void dispatch(const std::shared_ptr<Call> &call);
+
+    void enqueue(const std::shared_ptr<Call> &call);
+
+    using CallQueue = TaskQueue<void, std::shared_ptr<Call>>;
+
+    std::shared_ptr<CallQueue> callQueue();
+
     Options options_;
+    LatencyHistogram latency_{};
+    std::atomic_size_t inFlight_{0};
+
     std::mutex routesMutex_{};
-    std::vector<std::shared_ptr<Route>> routes_{};
+    std::shared_ptr<const RouteTable> routeTable_{std::make_shared<RouteTable>()};
+    std::shared_ptr<ExchangePool> exchangePool_{std::make_shared<ExchangePool>()};
+
+    // DECLARED LAST, SO CALLS CANCELLED ON DESTRUCTION CAN STILL
+    // UPDATE THE METRICS ABOVE
+    std::mutex callQueueMutex_{};
+    std::shared_ptr<CallQueue> callQueue_{};
   };
 } // namespace IRacingTools::Shared::Services
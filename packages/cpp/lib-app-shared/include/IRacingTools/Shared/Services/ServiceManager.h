@@ -2,12 +2,19 @@
 
 #include <IRacingTools/Shared/SharedAppLibPCH.h>
 
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <expected>
 #include <memory>
+#include <numeric>
+#include <ranges>
 #include <type_traits>
 
 #include <IRacingTools/SDK/ErrorTypes.h>
+#include <IRacingTools/Shared/Common/TaskQueue.h>
 #include <IRacingTools/Shared/Logging/LoggingManager.h>
 #include <IRacingTools/Shared/Services/Service.h>
 #include <IRacingTools/Shared/Services/ServiceContainer.h>
@@ -15,6 +22,22 @@
 
 namespace IRacingTools::Shared::Services {
 
+  /**
+   * @brief Services a service requires to be initialized & started
+   *   before its own `init()`/`start()`, declared on the service as
+   *   `using Dependencies = std::tuple<OtherService, ...>;`
+   */
+  template<typename ServiceType>
+  struct ServiceDependencies {
+    using Type = std::tuple<>;
+  };
+
+  template<typename ServiceType>
+    requires requires { typename ServiceType::Dependencies; }
+  struct ServiceDependencies<ServiceType> {
+    using Type = typename ServiceType::Dependencies;
+  };
+
   template<typename... ServiceTypes>
   class ServiceManager : public ServiceContainer {
     static_assert((std::is_base_of_v<Service, ServiceTypes> && ...), "Only services can be passed.");
@@ -27,6 +50,68 @@ namespace IRacingTools::Shared::Services {
     using ServiceTypesTuple = std::tuple<ServiceTypes...>;
     static constexpr std::size_t ServiceCount = std::tuple_size_v<ServiceTypesTuple>;
 
+    /**
+     * @brief Options to customize the manager.
+     */
+    struct Options {
+      /**
+       * @brief Threads used to `init()`/`start()` independent services
+       *   concurrently, `0` uses one per service (startup is mostly file
+       *   IO) & `1` is sequential
+       */
+      std::size_t threadCount{0};
+    };
+
+    /**
+     * @brief Time spent in each phase
+     */
+    struct PhaseTiming {
+      std::chrono::nanoseconds init{0};
+      std::chrono::nanoseconds start{0};
+    };
+
+    /**
+     * @brief Index of `ServiceType` in `ServiceTypes...`
+     */
+    template<typename ServiceType>
+    static constexpr std::size_t IndexOf() {
+      constexpr std::array<bool, ServiceCount> matches{std::is_same_v<ServiceType, ServiceTypes>...};
+      constexpr auto index = static_cast<std::size_t>(std::ranges::find(matches, true) - matches.begin());
+      static_assert(index < ServiceCount, "Service is not managed by this ServiceManager");
+      return index;
+    }
+
+    /**
+     * @brief Add a dependency in addition to those declared by
+     *   `ServiceType::Dependencies`, must be called before `init()`
+     */
+    template<typename ServiceType, typename DependencyType>
+    void addDependency() {
+      std::scoped_lock lock(stateMutex_);
+      auto &dependencies = dependencies_[IndexOf<ServiceType>()];
+      auto dependency = IndexOf<DependencyType>();
+      if (std::ranges::find(dependencies, dependency) == dependencies.end()) {
+        dependencies.push_back(dependency);
+      }
+    }
+
+    /**
+     * @brief Time spent in `init()`/`start()` by each service, in
+     *   `ServiceTypes...` order
+     */
+    std::array<PhaseTiming, ServiceCount> serviceTimings() {
+      std::scoped_lock lock(stateMutex_);
+      return serviceTimings_;
+    }
+
+    /**
+     * @brief Wall time of the manager's `init()`/`start()`
+     */
+    PhaseTiming timing() {
+      std::scoped_lock lock(stateMutex_);
+      return timing_;
+    }
+
 
     /**
      * @brief Initialize the service
@@ -45,17 +130,12 @@ namespace IRacingTools::Shared::Services {
       createServices<0>();
 
       Log->info("Created services");
-      for (auto &service: services_) {
-        Log->info("Initializing service >> {}", service->name());
-        auto res = service->init();
+      auto err = runPhase("init", &PhaseTiming::init, [](auto &service) {
+        return service->init();
+      });
 
-        if (!res) {
-          auto err = res.error();
-          Log->critical("Initialize service ({}) failed: {}", service->name(), err.what());
-          throw err;
-        }
-
-        Log->info("Initialized service >> {}", service->name());
+      if (err) {
+        throw err.value();
       }
 
       setState(State::Initialized);
@@ -67,8 +147,6 @@ namespace IRacingTools::Shared::Services {
      * @brief Must set running == true in overridden implementation
      */
     std::optional<SDK::GeneralError>  start() {
-      // TODO: Implement dependency management and Multithreaded start
-
       std::scoped_lock lock(stateMutex_);
       if (!ServiceStateTransitionCheck(state(), State::Starting, true)) {
         Log->warn("start() can only be called when new state > {}, currently state is {}. Skipping init()",
@@ -84,17 +162,12 @@ namespace IRacingTools::Shared::Services {
 
       setState(State::Starting);
       Log->info("Starting services");
-      for (auto &service: services_) {
-        Log->info("Starting service >> {}", service->name());
-        auto res = service->start();
+      auto err = runPhase("start", &PhaseTiming::start, [](auto &service) {
+        return service->start();
+      });
 
-        if (!res) {
-          auto err = res.error();
-          Log->critical("Start service ({}) failed: {}", service->name(), err.what());
-          throw err;
-        }
-
-        Log->info("Initialized service >> {}", service->name());
+      if (err) {
+        throw err.value();
       }
 
       setState(State::Running);
@@ -116,7 +189,16 @@ namespace IRacingTools::Shared::Services {
 
       setState(State::Destroying);
       Log->info("Destroying services");
-      for (auto &service: services_) {
+
+      // DEPENDENTS ARE DESTROYED BEFORE THEIR DEPENDENCIES
+      auto order = dependencyOrder().value_or(std::vector<std::size_t>{});
+      if (order.size() != ServiceCount) {
+        order.resize(ServiceCount);
+        std::iota(order.begin(), order.end(), 0);
+      }
+
+      for (auto idx: order | std::views::reverse) {
+        auto &service = services_[idx];
         if (!service)
           continue;
         Log->info("Destroy service >> {}", service->name());
@@ -216,7 +298,14 @@ namespace IRacingTools::Shared::Services {
     /**
      * @brief Simple constructor
      */
-    ServiceManager() {
+    ServiceManager() : ServiceManager(Options{}) {
+    }
+
+    /**
+     * @brief Constructor with Options
+     */
+    explicit ServiceManager(const Options &options) : options_(options) {
+      addDeclaredDependencies<0>();
     }
 
     ~ServiceManager() {
@@ -228,7 +317,13 @@ namespace IRacingTools::Shared::Services {
 
 
   private:
+    using Clock = std::chrono::steady_clock;
+
+    Options options_;
     std::array<std::shared_ptr<Service>, ServiceCount> services_{};
+    std::array<std::vector<std::size_t>, ServiceCount> dependencies_{};
+    std::array<PhaseTiming, ServiceCount> serviceTimings_{};
+    PhaseTiming timing_{};
     std::atomic<State> state_{State::Created};
     std::recursive_mutex stateMutex_{};
     std::mutex stateChangeMutex_{};
@@ -245,5 +340,176 @@ namespace IRacingTools::Shared::Services {
         createServices<I + 1>();
       }
     };
+
+    template<::std::size_t I = 0>
+    void addDeclaredDependencies() {
+      if constexpr (I < ServiceCount) {
+        using ServiceType = std::tuple_element_t<I, ServiceTypesTuple>;
+        using DependencyTypes = typename ServiceDependencies<ServiceType>::Type;
+        [this]<typename... DependencyType>(std::type_identity<std::tuple<DependencyType...>>) {
+          (addDependency<ServiceType, DependencyType>(), ...);
+        }(std::type_identity<DependencyTypes>{});
+
+        addDeclaredDependencies<I + 1>();
+      }
+    }
+
+    /**
+     * @brief Topological order of the services (dependencies first)
+     */
+    std::expected<std::vector<std::size_t>, SDK::GeneralError> dependencyOrder() const {
+      std::array<std::size_t, ServiceCount> remaining{};
+      for (std::size_t idx = 0; idx < ServiceCount; idx++) {
+        remaining[idx] = dependencies_[idx].size();
+      }
+
+      std::vector<std::size_t> order{};
+      order.reserve(ServiceCount);
+      for (std::size_t idx = 0; idx < ServiceCount; idx++) {
+        if (!remaining[idx]) {
+          order.push_back(idx);
+        }
+      }
+
+      for (std::size_t next = 0; next < order.size(); next++) {
+        for (std::size_t idx = 0; idx < ServiceCount; idx++) {
+          if (std::ranges::find(dependencies_[idx], order[next]) != dependencies_[idx].end() && !--remaining[idx]) {
+            order.push_back(idx);
+          }
+        }
+      }
+
+      if (order.size() != ServiceCount) {
+        return std::unexpected(SDK::GeneralError(SDK::ErrorCode::General, "Service dependencies contain a cycle"));
+      }
+
+      return order;
+    }
+
+    /**
+     * @brief Run `phaseFn` for every service on a thread pool, each
+     *   service is submitted as soon as all of its dependencies complete.
+     *
+     * After the first failure no further services are submitted, the
+     * ones already running are waited on.
+     */
+    template<typename PhaseFn>
+    std::optional<SDK::GeneralError> runPhase(
+      std::string_view phaseName,
+      std::chrono::nanoseconds PhaseTiming::*timingMember,
+      PhaseFn &&phaseFn
+    ) {
+      auto order = dependencyOrder();
+      if (!order) {
+        Log->critical("{}() services failed: {}", phaseName, order.error().what());
+        return order.error();
+      }
+
+      auto phaseStart = Clock::now();
+      std::array<std::size_t, ServiceCount> remaining{};
+      std::array<std::vector<std::size_t>, ServiceCount> dependents{};
+      for (std::size_t idx = 0; idx < ServiceCount; idx++) {
+        remaining[idx] = dependencies_[idx].size();
+        for (auto dependency: dependencies_[idx]) {
+          dependents[dependency].push_back(idx);
+        }
+      }
+
+      std::mutex completedMutex{};
+      std::condition_variable completedCondition{};
+      std::deque<std::size_t> completed{};
+      std::optional<SDK::GeneralError> error{};
+
+      auto runService = [&](std::size_t idx) {
+        auto &service = services_[idx];
+        Log->info("{}() service >> {}", phaseName, service->name());
+
+        std::optional<SDK::GeneralError> serviceError{};
+        auto start = Clock::now();
+        try {
+          auto res = phaseFn(service);
+          if (!res) {
+            serviceError = res.error();
+          }
+        } catch (const SDK::GeneralError &err) {
+          serviceError = err;
+        } catch (const std::exception &err) {
+          serviceError = SDK::GeneralError(SDK::ErrorCode::General, err.what());
+        }
+
+        auto elapsed = Clock::now() - start;
+        if (serviceError) {
+          Log->critical("{}() service ({}) failed: {}", phaseName, service->name(), serviceError->what());
+        } else {
+          Log->info(
+            "{}() service >> {} completed ({}ms)",
+            phaseName,
+            service->name(),
+            std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count()
+          );
+        }
+
+        {
+          std::scoped_lock lock(completedMutex);
+          serviceTimings_[idx].*timingMember = elapsed;
+          if (serviceError && !error) {
+            error = serviceError;
+          }
+
+          completed.push_back(idx);
+        }
+        completedCondition.notify_one();
+      };
+
+      auto threadCount = options_.threadCount ? options_.threadCount : ServiceCount;
+      Common::TaskQueue<void, std::size_t> queue(
+        runService,
+        typename Common::TaskQueue<void, std::size_t>::Options{.threadCount = std::min(threadCount, ServiceCount)}
+      );
+
+      std::size_t pending = 0;
+      for (std::size_t idx = 0; idx < ServiceCount; idx++) {
+        if (!remaining[idx]) {
+          queue.enqueue(idx);
+          pending++;
+        }
+      }
+
+      std::unique_lock lock(completedMutex);
+      while (pending) {
+        completedCondition.wait(lock, [&] {
+          return !completed.empty();
+        });
+
+        auto idx = completed.front();
+        completed.pop_front();
+        pending--;
+
+        if (error) {
+          continue;
+        }
+
+        for (auto dependent: dependents[idx]) {
+          if (!--remaining[dependent]) {
+            queue.enqueue(dependent);
+            pending++;
+          }
+        }
+      }
+
+      timing_.*timingMember = Clock::now() - phaseStart;
+      if (error) {
+        return error;
+      }
+
+      Log->info(
+        "{}() {} services completed in {}ms",
+        phaseName,
+        ServiceCount,
+        std::chrono::duration_cast<std::chrono::milliseconds>(timing_.*timingMember).count()
+      );
+
+      return std::nullopt;
+    }
   };
 }// namespace IRacingTools::Shared::Services
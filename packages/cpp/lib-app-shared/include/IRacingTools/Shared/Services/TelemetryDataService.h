@@ -7,6 +7,7 @@
 #include <IRacingTools/Models/TelemetryDataFile.pb.h>
 
 #include <IRacingTools/Shared/Common/TaskQueue.h>
+#include <IRacingTools/Shared/DirectoryScanner.h>
 #include <IRacingTools/Shared/FileWatcher.h>
 #include <IRacingTools/Shared/ProtoHelpers.h>
 #include <IRacingTools/Shared/Services/Pipelines/PipelineExecutor.h>
@@ -31,8 +32,6 @@ namespace IRacingTools::Shared::Services {
     using TQArgsType = TaskQueueType::ArgsType;
     using TQFnType = TaskQueueType::FnType;
 
-    using TQPendingFileMap = std::map<std::string, TQFutureType>;
-
     using DataFileMap = std::map<std::string, std::shared_ptr<TelemetryDataFile>>;
 
     /**
@@ -41,6 +40,24 @@ namespace IRacingTools::Shared::Services {
     struct Options {
       std::optional<fs::path> jsonlFile{std::nullopt};
       std::vector<fs::path> ibtPaths{};
+
+      /**
+       * @brief Persisted `ibtPaths` fingerprints, so a rescan only
+       *   enqueues new & changed files
+       */
+      std::optional<fs::path> fingerprintFile{std::nullopt};
+
+      /**
+       * @brief Directories listed concurrently while scanning, for
+       *   `ibtPaths` on network shares
+       */
+      std::size_t scanThreadCount{1};
+
+      /**
+       * @brief IBT files are written continuously while recording, a file
+       *   is only enqueued once it has been quiet this long (or was closed)
+       */
+      std::chrono::milliseconds watchDebounce{2000};
     };
 
     TelemetryDataService() = delete;
@@ -136,7 +153,14 @@ namespace IRacingTools::Shared::Services {
 
     bool hasPendingTasks();
     std::size_t pendingTaskCount();
+    TaskQueueType::Metrics taskMetrics();
 
+    /**
+     * @brief Enqueue every new or changed IBT file in `overrideFilePaths`
+     *   (or the configured `ibtPaths`) since the previous scan
+     *
+     * @return number of files enqueued
+     */
     std::size_t scanAllFiles(const std::optional<std::vector<std::filesystem::path>>& overrideFilePaths);
 
     std::expected<std::shared_ptr<TrackLayoutMetadata>, GeneralError> getTrackLayoutMetadata(const std::shared_ptr<TelemetryDataFile>& dataFile);
@@ -147,17 +171,21 @@ namespace IRacingTools::Shared::Services {
     } events;
 
   private:
-    std::size_t enqueueFiles(const std::vector<fs::path>& files);
+    /**
+     * @brief Enqueue `files` keyed by path, a file already queued is only
+     *   processed once
+     */
+    std::size_t enqueueFiles(const std::vector<fs::path>& files, TaskPriority priority = TaskPriority::Normal);
     TQReturnType taskQueueFn(fs::path file,std::shared_ptr<TelemetryDataFile> dataFile);
 
     Options options_{};
     std::unique_ptr<JSONLinesMessageFileHandler<TelemetryDataFile>> dataFileHandler_{nullptr};
     std::vector<fs::path> filePaths_{};
     std::vector<std::unique_ptr<FileSystem::FileWatcher>> fileWatchers_{};
+    std::unique_ptr<FileSystem::DirectoryScanner> scanner_{nullptr};
     DataFileMap dataFiles_{};
 
     std::unique_ptr<TaskQueueType> fileTaskQueue_{nullptr};
-    TQPendingFileMap pendingFileMap_{};
     // std::vector<std::shared_ptr<Request>> pendingRequests_{};
   };
 } // namespace IRacingTools::Shared::Services
@@ -21,6 +21,7 @@
 
 #include <IRacingTools/Shared/Services/Pipelines/PipelineExecutor.h>
 #include <IRacingTools/Shared/Services/Service.h>
+#include <IRacingTools/Shared/Services/TrackPositionLUT.h>
 
 namespace IRacingTools::Shared::Services {
 
@@ -38,6 +39,7 @@ namespace IRacingTools::Shared::Services {
         TaskQueue<std::string, const std::shared_ptr<TelemetryDataFile> &>;
     using FileMap = std::map<std::string, std::shared_ptr<TrackMapFile>>;
     using DataFileMap = std::map<std::string, std::shared_ptr<LapTrajectory>>;
+    using PositionLUTMap = std::map<std::string, std::shared_ptr<const TrackPositionLUT>>;
 
     struct {
       EventEmitter<std::shared_ptr<TrackMapService>> onReady{};
@@ -96,6 +98,16 @@ namespace IRacingTools::Shared::Services {
 
     std::shared_ptr<TrackMapFile> get(const std::string &trackLayoutId);
 
+    /**
+     * @brief `LapDistPct` -> map position table of a layout, read from the
+     *   persisted `LapTrajectory` (or built from its path for files that
+     *   predate it) & cached until the layout's track map changes
+     *
+     * @param trackLayoutId
+     * @return `nullptr` when the layout has no usable track map
+     */
+    std::shared_ptr<const TrackPositionLUT> getPositionLUT(const std::string &trackLayoutId);
+
     /**
      * @brief
      *
@@ -148,6 +160,7 @@ namespace IRacingTools::Shared::Services {
     std::optional<SDK::GeneralError> load(bool reload = false);
     bool hasPendingTasks();
     std::size_t pendingTaskCount();
+    TrackMapTaskQueue::Metrics taskMetrics();
 
     struct {
       EventEmitter<TrackMapService *> onReady{};
@@ -170,8 +183,8 @@ namespace IRacingTools::Shared::Services {
     std::vector<fs::path> filePaths_{};
     DataFileMap dataFiles_{};
     FileMap files_{};
+    PositionLUTMap positionLUTs_{};
     std::unique_ptr<TrackMapTaskQueue> dataFileTaskQueue_{nullptr};
-    std::map<std::string, TrackMapTaskQueue::FutureType> dataFilesTaskMap_{};
     std::condition_variable dataFilesToProcessCondition_{};
 
     // std::shared_ptr<std::thread> processorThread_{nullptr};
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstdint>
+#include <expected>
+#include <span>
+#include <vector>
+
+#include <IRacingTools/Models/LapTrajectory.pb.h>
+
+#include <IRacingTools/SDK/ErrorTypes.h>
+
+#include <IRacingTools/Shared/Graphics/CoordinateToPixelConverter.h>
+
+namespace IRacingTools::Shared::Services {
+
+  /**
+   * @brief `LapDistPct` -> track map position in constant time, sampled at
+   *   `binCount` uniform steps along a layout's `LapTrajectory` path &
+   *   linearly interpolated in between.
+   *
+   * Positions are north up & normalized so the longest side of the
+   * track is `1`, i.e. `pixel = offset + position * scale`.
+   */
+  class TrackPositionLUT {
+  public:
+    static constexpr std::uint32_t DefaultBinCount = 4096;
+
+    TrackPositionLUT() = default;
+
+    /**
+     * @brief Build from the `path` of `trajectory` (`lap_percent_complete`,
+     *   `latitude` & `longitude`)
+     */
+    static std::expected<TrackPositionLUT, SDK::GeneralError>
+    Create(const Models::LapTrajectory &trajectory, std::uint32_t binCount = DefaultBinCount);
+
+    /**
+     * @brief Restore a table serialized with `toModel`
+     */
+    static std::expected<TrackPositionLUT, SDK::GeneralError>
+    FromModel(const Models::LapTrajectory::PositionLookupTable &model);
+
+    void toModel(Models::LapTrajectory::PositionLookupTable *model) const;
+
+    /**
+     * @brief Position of every pct in `pcts` (i.e. all of `CarIdxLapDistPct`),
+     *   branch free so the loop vectorizes.
+     *
+     * Negative pcts (not in world) produce `NaN` positions.
+     *
+     * @param xs, ys receive `pcts.size()` positions (must be at least as large)
+     * @return number of positions written
+     */
+    std::size_t lookup(
+      std::span<const float> pcts,
+      std::span<float> xs,
+      std::span<float> ys,
+      float scale = 1.0f,
+      float offsetX = 0.0f,
+      float offsetY = 0.0f
+    ) const;
+
+    Geometry::PixelF lookup(float pct, float scale = 1.0f, float offsetX = 0.0f, float offsetY = 0.0f) const;
+
+    std::uint32_t binCount() const {
+      return binCount_;
+    }
+
+    /**
+     * @brief Normalized size of the track (the longest side is `1`)
+     */
+    float width() const {
+      return width_;
+    }
+
+    float height() const {
+      return height_;
+    }
+
+    bool empty() const {
+      return binCount_ == 0;
+    }
+
+  private:
+    std::uint32_t binCount_{0};
+    float width_{0.0f};
+    float height_{0.0f};
+
+    /**
+     * @brief `binCount_ + 1` entries, the last repeats the first so
+     *   interpolation never wraps
+     */
+    std::vector<float> xs_{};
+    std::vector<float> ys_{};
+  };
+
+} // namespace IRacingTools::Shared::Services
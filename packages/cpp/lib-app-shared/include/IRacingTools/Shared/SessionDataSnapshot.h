@@ -0,0 +1,164 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <IRacingTools/SDK/Types.h>
+#include <IRacingTools/SDK/VarData.h>
+
+namespace IRacingTools::Shared {
+
+  /**
+   * @brief Double buffered copy of the current var row, laid out so it can
+   *   be shared as-is with readers that can not call back into native code
+   *   (i.e. a JS `ArrayBuffer`).
+   *
+   * Layout, all header words are little endian `uint32`:
+   *
+   *  - `[0, HeaderSize)` header, indexed by `HeaderField`
+   *  - `[HeaderSize + slot * slotStride, + rowSize)` row of slot `0` or `1`
+   *
+   * The writer fills the inactive slot, then flips `ActiveSlot` between two
+   * increments of `Sequence` (odd while flipping).  A reader loads an even
+   * `Sequence`, reads the `ActiveSlot` row & accepts it if `Sequence` is
+   * unchanged, so it only retries when a flip happened mid-read.
+   */
+  class SessionDataSnapshot {
+  public:
+    enum HeaderField : std::size_t {
+      Sequence = 0,
+      ActiveSlot,
+      RowSize,
+      SlotStride,
+      FrameCount,
+      SessionTick,
+
+      /**
+       * @brief Set once the var headers changed & this snapshot is no
+       *   longer written, readers must get a new snapshot
+       */
+      Invalidated,
+
+      /**
+       * @brief Bumped each time a snapshot with a new layout takes over
+       *   the region
+       */
+      LayoutVersion,
+      HeaderFieldCount
+    };
+
+    static constexpr std::size_t HeaderSize = 64;
+
+    static constexpr std::size_t SlotCount = 2;
+
+    /**
+     * @brief Position of a var in a row, mirrors `SDK::VarDataHeader`
+     */
+    struct VarLayout {
+      std::string name;
+      SDK::VarDataType type;
+      std::uint32_t offset;
+      std::uint32_t count;
+    };
+
+    /**
+     * @brief Bytes a snapshot of `headers` needs, the minimum size of a
+     *   region passed to the constructor
+     */
+    static std::size_t ByteLength(const SDK::VarHeaders &headers);
+
+    explicit SessionDataSnapshot(const SDK::VarHeaders &headers);
+
+    /**
+     * @brief Snapshot written to `region` (i.e. the backing store of a JS
+     *   `ArrayBuffer`) instead of an owned buffer.
+     *
+     *   `region` must be 8 byte aligned, at least `ByteLength(headers)`
+     *   long & outlive the snapshot.  Readers may still be reading a
+     *   previous snapshot in it, so the header is rewritten as a write.
+     */
+    SessionDataSnapshot(const SDK::VarHeaders &headers, std::span<std::byte> region);
+
+    /**
+     * @brief Same layout as `source` in `region`, seeded with the row
+     *   `source` last published (read through its sequence)
+     */
+    SessionDataSnapshot(const SessionDataSnapshot &source, std::span<std::byte> region);
+
+    SessionDataSnapshot(const SessionDataSnapshot &) = delete;
+    SessionDataSnapshot &operator=(const SessionDataSnapshot &) = delete;
+
+    const std::vector<VarLayout> &layout() const;
+
+    std::size_t rowSize() const;
+
+    std::size_t slotStride() const;
+
+    /**
+     * @brief Total size of header & slots
+     */
+    std::size_t byteLength() const;
+
+    /**
+     * @brief Start of the shared region, 8 byte aligned & stable for the
+     *   lifetime of the snapshot
+     */
+    std::byte *data();
+
+    std::uint32_t layoutVersion() const;
+
+    /**
+     * @brief true if `headers` lay out a row the same way as this snapshot
+     */
+    bool matches(const SDK::VarHeaders &headers) const;
+
+    /**
+     * @brief Copy `rowSize()` bytes of `row` to the inactive slot & publish
+     *   it, single writer only
+     */
+    void write(const char *row, std::int32_t sessionTick);
+
+    /**
+     * @brief Copy the latest published row to `row`
+     *
+     * @return sequence of the row that was read, the row is zeroed until
+     *   `FrameCount` is non zero
+     */
+    std::uint32_t read(std::span<std::byte> row) const;
+
+    void invalidate();
+
+    bool isInvalidated() const;
+
+  private:
+    SessionDataSnapshot(std::vector<VarLayout> layout, std::span<std::byte> region);
+
+    static std::vector<VarLayout> Layout(const SDK::VarHeaders &headers);
+
+    /**
+     * @brief Publish this layout in the region, keeping `Sequence` &
+     *   bumping `LayoutVersion` of whatever was there, seeded from `source`
+     *   when given
+     */
+    void publishLayout(const SessionDataSnapshot *source);
+
+    std::uint32_t readRow(std::span<std::byte> row, std::uint32_t *sessionTick) const;
+
+    std::atomic_ref<std::uint32_t> headerWord(HeaderField field) const;
+
+    std::byte *slot(std::uint32_t slotIdx) const;
+
+    std::vector<VarLayout> layout_{};
+    std::size_t rowSize_{0};
+    std::size_t slotStride_{0};
+    std::size_t byteLength_{0};
+    std::unique_ptr<std::uint64_t[]> buffer_{};
+    std::byte *data_{nullptr};
+  };
+
+} // namespace IRacingTools::Shared
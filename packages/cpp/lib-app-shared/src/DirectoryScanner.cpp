@@ -0,0 +1,448 @@
+#include <IRacingTools/Shared/DirectoryScanner.h>
+
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <thread>
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#endif
+
+#include <fmt/format.h>
+#include <gsl/util>
+
+#include <IRacingTools/Shared/Logging/LoggingManager.h>
+
+namespace IRacingTools::Shared::FileSystem {
+  using namespace IRacingTools::SDK;
+  using namespace IRacingTools::Shared::Logging;
+
+  namespace {
+    auto L = GetCategoryWithType<DirectoryScanner>();
+
+    constexpr std::array<char, 4> CacheFileMagic{'V', 'R', 'K', 'F'};
+    constexpr std::uint32_t CacheFileVersion = 1;
+
+    struct DirectoryListing {
+      std::vector<FileFingerprint> files{};
+      std::vector<fs::path> directories{};
+    };
+
+    bool MatchesExtension(const fs::path::string_type &name, const fs::path::string_type &extension) {
+      return extension.empty() || name.ends_with(extension);
+    }
+
+#ifdef _WIN32
+    /**
+     * @brief List a single directory with `FILE_ID_BOTH_DIR_INFO`, which
+     *   returns the size, write time & file id of every entry in batches
+     */
+    std::expected<DirectoryListing, GeneralError>
+    ListDirectory(const fs::path &directory, const fs::path::string_type &extension) {
+      HANDLE handle = ::CreateFileW(
+        directory.c_str(),
+        FILE_LIST_DIRECTORY,
+        FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_FLAG_BACKUP_SEMANTICS,
+        nullptr
+      );
+
+      if (handle == INVALID_HANDLE_VALUE) {
+        return std::unexpected(GeneralError(
+          ErrorCode::NotFound,
+          fmt::format("Unable to open directory ({}): {}", directory.string(), ::GetLastError())
+        ));
+      }
+
+      auto handleDisposer = gsl::finally([&] {
+        ::CloseHandle(handle);
+      });
+
+      DirectoryListing listing{};
+      std::vector<DWORD> buffer(64 * 1024 / sizeof(DWORD));
+      auto bufferSize = static_cast<DWORD>(buffer.size() * sizeof(DWORD));
+      auto infoClass = FileIdBothDirectoryRestartInfo;
+      while (::GetFileInformationByHandleEx(handle, infoClass, buffer.data(), bufferSize)) {
+        infoClass = FileIdBothDirectoryInfo;
+
+        auto entryBytes = reinterpret_cast<const std::byte *>(buffer.data());
+        while (true) {
+          auto entry = reinterpret_cast<const FILE_ID_BOTH_DIR_INFO *>(entryBytes);
+          std::wstring name(entry->FileName, entry->FileNameLength / sizeof(wchar_t));
+          if (name != L"." && name != L"..") {
+            if (entry->FileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+              if (!(entry->FileAttributes & FILE_ATTRIBUTE_REPARSE_POINT)) {
+                listing.directories.push_back(directory / name);
+              }
+            } else if (MatchesExtension(name, extension)) {
+              listing.files.push_back(
+                {.path = directory / name,
+                 .size = static_cast<std::uint64_t>(entry->EndOfFile.QuadPart),
+                 .modifiedAt = entry->LastWriteTime.QuadPart,
+                 .fileId = static_cast<std::uint64_t>(entry->FileId.QuadPart)}
+              );
+            }
+          }
+
+          if (!entry->NextEntryOffset) {
+            break;
+          }
+
+          entryBytes += entry->NextEntryOffset;
+        }
+      }
+
+      if (auto err = ::GetLastError(); err != ERROR_NO_MORE_FILES) {
+        return std::unexpected(
+          GeneralError(ErrorCode::General, fmt::format("Unable to list directory ({}): {}", directory.string(), err))
+        );
+      }
+
+      return listing;
+    }
+#else
+    std::expected<DirectoryListing, GeneralError>
+    ListDirectory(const fs::path &directory, const fs::path::string_type &extension) {
+      std::error_code errorCode{};
+      fs::directory_iterator it(directory, errorCode);
+      if (errorCode) {
+        return std::unexpected(GeneralError(
+          ErrorCode::NotFound,
+          fmt::format("Unable to open directory ({}): {}", directory.string(), errorCode.message())
+        ));
+      }
+
+      DirectoryListing listing{};
+      for (auto &entry: it) {
+        if (entry.is_directory(errorCode) && !entry.is_symlink(errorCode)) {
+          listing.directories.push_back(entry.path());
+          continue;
+        }
+
+        if (!MatchesExtension(entry.path().filename().native(), extension)) {
+          continue;
+        }
+
+        // ONE `stat` FOR SIZE, WRITE TIME & INODE
+        struct stat info{};
+        if (::stat(entry.path().c_str(), &info) || !S_ISREG(info.st_mode)) {
+          continue;
+        }
+
+        listing.files.push_back(
+          {.path = entry.path(),
+           .size = static_cast<std::uint64_t>(info.st_size),
+           .modifiedAt = static_cast<std::int64_t>(info.st_mtim.tv_sec) * 1000000000LL + info.st_mtim.tv_nsec,
+           .fileId = static_cast<std::uint64_t>(info.st_ino)}
+        );
+      }
+
+      return listing;
+    }
+#endif
+
+    /**
+     * @brief Directories shared by the enumeration threads, a thread
+     *   exits once the queue is empty & no other thread is listing
+     */
+    struct EnumerationQueue {
+      std::mutex mutex{};
+      std::condition_variable condition{};
+      std::deque<fs::path> directories{};
+      std::size_t active{0};
+      std::vector<FileFingerprint> files{};
+    };
+
+    void EnumerationWorker(EnumerationQueue &queue, const EnumerateOptions &options, const fs::path::string_type &extension) {
+      std::unique_lock lock(queue.mutex);
+      while (true) {
+        queue.condition.wait(lock, [&] {
+          return !queue.directories.empty() || !queue.active;
+        });
+
+        if (queue.directories.empty()) {
+          return;
+        }
+
+        auto directory = std::move(queue.directories.front());
+        queue.directories.pop_front();
+        queue.active++;
+        lock.unlock();
+
+        auto res = ListDirectory(directory, extension);
+        if (!res) {
+          L->warn("Skipping directory: {}", res.error().what());
+        }
+
+        lock.lock();
+        queue.active--;
+        if (res) {
+          auto &listing = res.value();
+          std::ranges::move(listing.files, std::back_inserter(queue.files));
+          if (options.recursive) {
+            std::ranges::move(listing.directories, std::back_inserter(queue.directories));
+          }
+        }
+
+        queue.condition.notify_all();
+      }
+    }
+
+    bool IsUnderRoot(const fs::path::string_type &file, const std::vector<fs::path::string_type> &roots) {
+      return std::ranges::any_of(roots, [&](auto &root) {
+        return file.size() > root.size() && file.starts_with(root) &&
+          (fs::path::preferred_separator == file[root.size()] || root.ends_with(fs::path::preferred_separator));
+      });
+    }
+  } // namespace
+
+  std::expected<std::vector<FileFingerprint>, GeneralError>
+  EnumerateFiles(const std::vector<fs::path> &paths, const EnumerateOptions &options) {
+    auto extension = fs::path(options.extension).native();
+    EnumerationQueue queue{};
+
+    // ROOTS ARE LISTED UP FRONT, AN UNAVAILABLE ROOT FAILS THE WHOLE
+    // ENUMERATION RATHER THAN LOOKING LIKE ALL OF ITS FILES WERE REMOVED
+    for (auto &path: paths) {
+      auto res = ListDirectory(fs::absolute(path).lexically_normal(), extension);
+      if (!res) {
+        return std::unexpected(res.error());
+      }
+
+      auto &listing = res.value();
+      std::ranges::move(listing.files, std::back_inserter(queue.files));
+      if (options.recursive) {
+        std::ranges::move(listing.directories, std::back_inserter(queue.directories));
+      }
+    }
+
+    auto threadCount = std::max<std::size_t>(options.threadCount, 1);
+    if (threadCount == 1 || queue.directories.empty()) {
+      EnumerationWorker(queue, options, extension);
+    } else {
+      std::vector<std::jthread> threads{};
+      for (std::size_t idx = 0; idx < threadCount; idx++) {
+        threads.emplace_back([&] {
+          EnumerationWorker(queue, options, extension);
+        });
+      }
+    }
+
+    return std::move(queue.files);
+  }
+
+  DirectoryScanner::DirectoryScanner(const Options &options) : options_(options) {
+  }
+
+  std::expected<DirectoryScanner::ScanResult, GeneralError>
+  DirectoryScanner::scan(const std::vector<fs::path> &paths) {
+    if (auto err = load()) {
+      L->warn("Unable to load fingerprints, scanning all files: {}", err->what());
+    }
+
+    auto res = EnumerateFiles(paths, options_.enumerate);
+    if (!res) {
+      return std::unexpected(res.error());
+    }
+
+    auto &files = res.value();
+    std::vector<fs::path::string_type> roots{};
+    for (auto &path: paths) {
+      roots.push_back(fs::absolute(path).lexically_normal().native());
+    }
+
+    std::scoped_lock lock(mutex_);
+    ScanResult result{.fileCount = files.size()};
+    FingerprintMap listed{};
+    listed.reserve(files.size());
+    for (auto &file: files) {
+      auto key = file.path.native();
+      auto it = fingerprints_.find(key);
+      if (it == fingerprints_.end() || it->second != file) {
+        // ONLY PROCESSED FINGERPRINTS ARE KEPT, SO THIS IS REPORTED
+        // AGAIN UNTIL `markProcessed`
+        result.changed.push_back(file.path);
+        pending_.insert_or_assign(key, file);
+      } else {
+        pending_.erase(key);
+      }
+
+      listed.emplace(std::move(key), std::move(file));
+    }
+
+    for (auto it = fingerprints_.begin(); it != fingerprints_.end();) {
+      if (listed.contains(it->first) || !IsUnderRoot(it->first, roots)) {
+        ++it;
+        continue;
+      }
+
+      result.removed.push_back(it->second.path);
+      pending_.erase(it->first);
+      it = fingerprints_.erase(it);
+      dirty_ = true;
+    }
+
+    std::erase_if(pending_, [&](auto &entry) {
+      return !listed.contains(entry.first) && IsUnderRoot(entry.first, roots);
+    });
+
+    if (dirty_) {
+      if (auto err = saveUnlocked()) {
+        L->warn("Unable to save fingerprints: {}", err->what());
+      }
+    }
+
+    return result;
+  }
+
+  void DirectoryScanner::markProcessed(const fs::path &file) {
+    std::scoped_lock lock(mutex_);
+    auto it = pending_.find(fs::absolute(file).lexically_normal().native());
+    if (it == pending_.end()) {
+      return;
+    }
+
+    fingerprints_.insert_or_assign(it->first, std::move(it->second));
+    pending_.erase(it);
+    dirty_ = true;
+
+    if (std::chrono::steady_clock::now() - savedAt_ >= SaveInterval) {
+      if (auto err = saveUnlocked()) {
+        L->warn("Unable to save fingerprints: {}", err->what());
+      }
+    }
+  }
+
+  void DirectoryScanner::forget(const fs::path &file) {
+    std::scoped_lock lock(mutex_);
+    auto key = fs::absolute(file).lexically_normal().native();
+    pending_.erase(key);
+    if (fingerprints_.erase(key)) {
+      dirty_ = true;
+    }
+  }
+
+  void DirectoryScanner::clear() {
+    std::scoped_lock lock(mutex_);
+    fingerprints_.clear();
+    pending_.clear();
+    loaded_ = true;
+    dirty_ = false;
+    if (options_.cacheFile) {
+      std::error_code errorCode{};
+      fs::remove(options_.cacheFile.value(), errorCode);
+    }
+  }
+
+  std::size_t DirectoryScanner::size() {
+    std::scoped_lock lock(mutex_);
+    return fingerprints_.size();
+  }
+
+  std::optional<GeneralError> DirectoryScanner::load() {
+    std::scoped_lock lock(mutex_);
+    if (loaded_) {
+      return std::nullopt;
+    }
+
+    loaded_ = true;
+    if (!options_.cacheFile || !fs::exists(options_.cacheFile.value())) {
+      return std::nullopt;
+    }
+
+    auto &cacheFile = options_.cacheFile.value();
+    std::ifstream input(cacheFile, std::ios::binary);
+    auto readValue = [&](auto &value) {
+      return static_cast<bool>(input.read(reinterpret_cast<char *>(&value), sizeof(value)));
+    };
+
+    std::array<char, 4> magic{};
+    std::uint32_t version{0}, count{0};
+    if (!readValue(magic) || magic != CacheFileMagic || !readValue(version) || version != CacheFileVersion ||
+        !readValue(count)) {
+      return GeneralError(ErrorCode::General, fmt::format("Invalid fingerprint file ({})", cacheFile.string()));
+    }
+
+    FingerprintMap fingerprints{};
+    fingerprints.reserve(count);
+    std::u8string pathString{};
+    for (std::uint32_t idx = 0; idx < count; idx++) {
+      FileFingerprint fingerprint{};
+      std::uint32_t pathSize{0};
+      if (!readValue(fingerprint.size) || !readValue(fingerprint.modifiedAt) || !readValue(fingerprint.fileId) ||
+          !readValue(pathSize)) {
+        return GeneralError(ErrorCode::General, fmt::format("Truncated fingerprint file ({})", cacheFile.string()));
+      }
+
+      pathString.resize(pathSize);
+      if (!input.read(reinterpret_cast<char *>(pathString.data()), pathSize)) {
+        return GeneralError(ErrorCode::General, fmt::format("Truncated fingerprint file ({})", cacheFile.string()));
+      }
+
+      fingerprint.path = fs::path(pathString);
+      auto key = fingerprint.path.native();
+      fingerprints.emplace(std::move(key), std::move(fingerprint));
+    }
+
+    fingerprints_ = std::move(fingerprints);
+    L->debug("Loaded {} fingerprints from {}", fingerprints_.size(), cacheFile.string());
+    return std::nullopt;
+  }
+
+  std::optional<GeneralError> DirectoryScanner::save() {
+    std::scoped_lock lock(mutex_);
+    return saveUnlocked();
+  }
+
+  std::optional<GeneralError> DirectoryScanner::saveUnlocked() {
+    savedAt_ = std::chrono::steady_clock::now();
+    if (!options_.cacheFile) {
+      dirty_ = false;
+      return std::nullopt;
+    }
+
+    // WRITE TO A TEMP FILE & SWAP, SO A CRASH NEVER LEAVES A PARTIAL TABLE
+    auto &cacheFile = options_.cacheFile.value();
+    auto tempFile = fs::path(cacheFile).concat(".tmp");
+    {
+      std::ofstream output(tempFile, std::ios::binary | std::ios::trunc);
+      auto writeValue = [&](const auto &value) {
+        output.write(reinterpret_cast<const char *>(&value), sizeof(value));
+      };
+
+      writeValue(CacheFileMagic);
+      writeValue(CacheFileVersion);
+      writeValue(static_cast<std::uint32_t>(fingerprints_.size()));
+      for (auto &[key, fingerprint]: fingerprints_) {
+        auto pathString = fingerprint.path.u8string();
+        writeValue(fingerprint.size);
+        writeValue(fingerprint.modifiedAt);
+        writeValue(fingerprint.fileId);
+        writeValue(static_cast<std::uint32_t>(pathString.size()));
+        output.write(reinterpret_cast<const char *>(pathString.data()), static_cast<std::streamsize>(pathString.size()));
+      }
+
+      if (!output.flush()) {
+        return GeneralError(ErrorCode::General, fmt::format("Unable to write fingerprint file ({})", tempFile.string()));
+      }
+    }
+
+    std::error_code errorCode{};
+    fs::rename(tempFile, cacheFile, errorCode);
+    if (errorCode) {
+      return GeneralError(
+        ErrorCode::General,
+        fmt::format("Unable to replace fingerprint file ({}): {}", cacheFile.string(), errorCode.message())
+      );
+    }
+
+    dirty_ = false;
+    return std::nullopt;
+  }
+
+} // namespace IRacingTools::Shared::FileSystem
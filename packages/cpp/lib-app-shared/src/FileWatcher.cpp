@@ -1,18 +1,37 @@
 #include <IRacingTools/Shared/FileWatcher.h>
+#ifdef _WIN32
 #include <windows.h>
-#include <format>
+#else
+#include <array>
+#include <cstring>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
 #include <mutex>
 
-#include <IRacingTools/SDK/Utils/UnicodeHelpers.h>
-#include <IRacingTools/Shared/Macros.h>
+#include <spdlog/spdlog.h>
 
 namespace IRacingTools::Shared {
-    using namespace IRacingTools::SDK::Utils;
-
-    FileSystem::FileWatcher::FileWatcher(std::wstring path, UnderpinningRegex pattern, Callback callback, bool autostart): path_(fs::absolute(path)),
+    FileSystem::FileWatcher::FileWatcher(std::wstring path, UnderpinningRegex pattern, Callback callback, const Options& options, bool autostart): path_(fs::absolute(path)),
         pattern_(pattern),
         callback_(callback),
-        directory_(getDirectoryHandle(path)) {
+        options_(options) {
+#ifdef _WIN32
+        directory_ = getDirectoryHandle(path);
+#else
+        std::error_code errorCode;
+        auto status = fs::status(path_, errorCode);
+        if (errorCode) {
+            throw std::system_error(errorCode);
+        }
+
+        watchingSingleFile_ = !fs::is_directory(status);
+        if (watchingSingleFile_) {
+            filename_ = path_.filename().wstring();
+        }
+#endif
         if (autostart)
             start();
     }
@@ -21,7 +40,7 @@ namespace IRacingTools::Shared {
         stop();
     }
 
-    FileSystem::FileWatcher::FileWatcher(const FileWatcher& other): FileWatcher(other.path_, other.callback_) {}
+    FileSystem::FileWatcher::FileWatcher(const FileWatcher& other): FileWatcher(other.path_, other.callback_, other.options_) {}
     FileSystem::FileWatcher& FileSystem::FileWatcher::operator=(const FileWatcher& other) {
         if (this == &other) {
             return *this;
@@ -30,7 +49,10 @@ namespace IRacingTools::Shared {
         stop();
         path_ = other.path_;
         callback_ = other.callback_;
+        options_ = other.options_;
+#ifdef _WIN32
         directory_ = getDirectoryHandle(other.path_);
+#endif
         start();
         return *this;
     }
@@ -42,14 +64,30 @@ namespace IRacingTools::Shared {
         running_ = false;
         runningPromise_ = std::promise<void>();
 
-
+#ifdef _WIN32
         SetEvent(closeEvent_);
+#else
+        std::uint64_t closeSignal = 1;
+        [[maybe_unused]] auto written = ::write(closeEvent_, &closeSignal, sizeof(closeSignal));
+#endif
 
-        cv_.notify_all();
+        // EVENTS ALREADY READ (& STILL DEBOUNCING) ARE DELIVERED BEFORE STOPPING
         watchThread_.join();
+        {
+            std::scoped_lock callbackLock(callbackMutex_);
+            stopping_ = true;
+        }
+        cv_.notify_all();
         callbackThread_.join();
 
+#ifdef _WIN32
         CloseHandle(directory_);
+#else
+        ::close(inotifyFd_);
+        ::close(closeEvent_);
+        inotifyFd_ = closeEvent_ = -1;
+        watchPaths_.clear();
+#endif
     }
 
     bool FileSystem::FileWatcher::isRunning() {
@@ -65,12 +103,28 @@ namespace IRacingTools::Shared {
       }
 
       running_ = true;
+      stopping_ = false;
 
+#ifdef _WIN32
       closeEvent_ = CreateEvent(nullptr, TRUE, FALSE, nullptr);
       if (!closeEvent_) {
         running_ = false;
         throw std::system_error(static_cast<int>(GetLastError()), std::system_category());
       }
+#else
+      inotifyFd_ = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+      closeEvent_ = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+      if (inotifyFd_ < 0 || closeEvent_ < 0) {
+        auto err = errno;
+        running_ = false;
+        if (inotifyFd_ >= 0)
+          ::close(inotifyFd_);
+        if (closeEvent_ >= 0)
+          ::close(closeEvent_);
+        inotifyFd_ = closeEvent_ = -1;
+        throw std::system_error(err, std::system_category());
+      }
+#endif
 
 
       callbackThread_ = std::thread([this] {
@@ -98,4 +152,158 @@ namespace IRacingTools::Shared {
       std::future<void> future = runningPromise_.get_future();
       future.get();//block until the monitor_directory is up and running
     }
+
+#ifndef _WIN32
+    std::uint32_t FileSystem::FileWatcher::watchMask() const {
+        std::uint32_t mask = IN_CREATE | IN_DELETE | IN_MODIFY | IN_MOVED_FROM | IN_MOVED_TO | IN_EXCL_UNLINK;
+
+        // `IN_CLOSE_WRITE` IS ONLY USEFUL TO END A DEBOUNCE EARLY, UNCOALESCED
+        // IT WOULD REPORT EVERY WRITE TWICE
+        if (options_.debounce.count() > 0 && options_.flushOnCloseWrite) {
+            mask |= IN_CLOSE_WRITE;
+        }
+
+        return mask;
+    }
+
+    void FileSystem::FileWatcher::addWatches(const fs::path& directory, std::vector<std::pair<WatchEventData, WatchEvent>>* added) {
+        auto wd = ::inotify_add_watch(inotifyFd_, directory.c_str(), watchMask());
+        if (wd < 0) {
+            spdlog::warn("Unable to watch ({}): {}", directory.string(), std::strerror(errno));
+            return;
+        }
+
+        watchPaths_[wd] = directory;
+        if (watchingSingleFile_) {
+            return;
+        }
+
+        // FILES CREATED BEFORE THE WATCH WAS ADDED ARE REPORTED AS ADDED
+        std::error_code errorCode;
+        for (auto& entry : fs::directory_iterator(directory, errorCode)) {
+            if (entry.is_directory(errorCode) && !entry.is_symlink(errorCode)) {
+                addWatches(entry.path(), added);
+            } else if (added && passFilter(entry.path().lexically_relative(path_).wstring())) {
+                added->emplace_back(
+                    WatchEventData{.path = entry.path(), .pathString = entry.path().wstring()},
+                    WatchEvent::Added
+                );
+            }
+        }
+    }
+
+    void FileSystem::FileWatcher::monitorDirectory() {
+        addWatches(watchingSingleFile_ ? path_.parent_path() : path_);
+
+        // `read` ALWAYS RETURNS WHOLE EVENTS, THE BUFFER ONLY NEEDS ALIGNMENT
+        std::vector<std::uint64_t> buffer(sBufferSize_ / sizeof(std::uint64_t));
+        auto bufferBytes = reinterpret_cast<char*>(buffer.data());
+
+        runningPromise_.set_value();
+        while (running_) {
+            std::array fds{
+                pollfd{.fd = inotifyFd_, .events = POLLIN, .revents = 0},
+                pollfd{.fd = closeEvent_, .events = POLLIN, .revents = 0}
+            };
+
+            if (::poll(fds.data(), fds.size(), -1) < 0) {
+                if (errno == EINTR)
+                    continue;
+                throw std::system_error(errno, std::system_category());
+            }
+
+            if (fds[1].revents || !running_) {
+                break;
+            }
+
+            std::vector<std::pair<WatchEventData, WatchEvent>> parsedInfo;
+            while (true) {
+                auto bytesRead = ::read(inotifyFd_, bufferBytes, buffer.size() * sizeof(std::uint64_t));
+                if (bytesRead <= 0) {
+                    break;
+                }
+
+                for (ssize_t offset = 0; offset < bytesRead;) {
+                    auto event = reinterpret_cast<const inotify_event*>(bufferBytes + offset);
+                    offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+                    if (event->mask & IN_Q_OVERFLOW) {
+                        spdlog::warn("Watcher event queue overflowed ({}), events were lost", path_.string());
+                        continue;
+                    }
+
+                    auto watchIt = watchPaths_.find(event->wd);
+                    if (watchIt == watchPaths_.end()) {
+                        continue;
+                    }
+
+                    if (event->mask & IN_IGNORED) {
+                        watchPaths_.erase(watchIt);
+                        continue;
+                    }
+
+                    if (!event->len) {
+                        continue;
+                    }
+
+                    auto changedPath = watchIt->second / event->name;
+                    if (event->mask & IN_ISDIR) {
+                        if (watchingSingleFile_) {
+                            continue;
+                        }
+
+                        if (event->mask & (IN_CREATE | IN_MOVED_TO)) {
+                            addWatches(changedPath, &parsedInfo);
+                        } else if (event->mask & IN_MOVED_FROM) {
+                            // THE WATCHES MOVE WITH THE DIRECTORY, DROP THEM & RE-ADD ON `IN_MOVED_TO`
+                            std::erase_if(watchPaths_, [&](auto& entry) {
+                                auto& [wd, watchPath] = entry;
+                                auto relative = watchPath.lexically_relative(changedPath);
+                                if (relative.empty() || *relative.begin() == "..") {
+                                    return false;
+                                }
+
+                                ::inotify_rm_watch(inotifyFd_, wd);
+                                return true;
+                            });
+                        }
+                        continue;
+                    }
+
+                    auto changedFile = watchingSingleFile_ ? changedPath.filename().wstring() : changedPath.lexically_relative(path_).wstring();
+                    if ((watchingSingleFile_ && changedFile != filename_) || !passFilter(changedFile)) {
+                        continue;
+                    }
+
+                    WatchEvent eventType = WatchEvent::Modified;
+                    if (event->mask & IN_CREATE) {
+                        eventType = WatchEvent::Added;
+                    } else if (event->mask & IN_DELETE) {
+                        eventType = WatchEvent::Removed;
+                    } else if (event->mask & IN_MOVED_FROM) {
+                        eventType = WatchEvent::RenamedOld;
+                    } else if (event->mask & IN_MOVED_TO) {
+                        eventType = WatchEvent::RenamedNew;
+                    }
+
+                    parsedInfo.emplace_back(
+                        WatchEventData{
+                            .path = changedPath,
+                            .pathString = changedPath.wstring(),
+                            .closedAfterWrite = (event->mask & IN_CLOSE_WRITE) != 0
+                        },
+                        eventType
+                    );
+                }
+            }
+
+            //dispatch callbacks
+            {
+                std::scoped_lock lock(callbackMutex_);
+                callbackInformation_.insert(callbackInformation_.end(), parsedInfo.begin(), parsedInfo.end());
+            }
+            cv_.notify_all();
+        }
+    }
+#endif
 }
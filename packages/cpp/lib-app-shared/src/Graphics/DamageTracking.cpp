@@ -0,0 +1,265 @@
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <tuple>
+
+#include <IRacingTools/Shared/Graphics/DamageTracking.h>
+
+#if defined(_M_X64) || defined(__x86_64__) || defined(__SSE2__)
+#define IRT_DAMAGE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace IRacingTools::Shared::Graphics {
+  namespace {
+
+    /**
+     * @brief SSE2 is part of x64, so no runtime dispatch is needed
+     */
+    bool BytesEqual(const std::uint8_t *a, const std::uint8_t *b, std::size_t len) {
+      std::size_t i = 0;
+#ifdef IRT_DAMAGE_SSE2
+      auto load = [](const std::uint8_t *p) {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+      };
+
+      for (; i + 64 <= len; i += 64) {
+        auto eq = _mm_and_si128(
+          _mm_and_si128(_mm_cmpeq_epi8(load(a + i), load(b + i)), _mm_cmpeq_epi8(load(a + i + 16), load(b + i + 16))),
+          _mm_and_si128(
+            _mm_cmpeq_epi8(load(a + i + 32), load(b + i + 32)),
+            _mm_cmpeq_epi8(load(a + i + 48), load(b + i + 48))
+          )
+        );
+        if (_mm_movemask_epi8(eq) != 0xFFFF)
+          return false;
+      }
+
+      for (; i + 16 <= len; i += 16) {
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(load(a + i), load(b + i))) != 0xFFFF)
+          return false;
+      }
+#endif
+      return std::memcmp(a + i, b + i, len - i) == 0;
+    }
+
+    /**
+     * @brief Join rects sharing a row (`vertical == false`) or a column,
+     *   that touch or overlap along it
+     */
+    std::vector<DamageRect> JoinNeighbours(std::vector<DamageRect> rects, bool vertical) {
+      auto key = [vertical](const DamageRect &rect) {
+        return vertical ? std::tuple(rect.x, rect.width, rect.y) : std::tuple(rect.y, rect.height, rect.x);
+      };
+
+      std::ranges::sort(rects, {}, key);
+
+      std::vector<DamageRect> joined{};
+      joined.reserve(rects.size());
+      for (auto &rect : rects) {
+        if (!joined.empty()) {
+          auto &last = joined.back();
+          auto sameLine = vertical ? last.x == rect.x && last.width == rect.width
+                                   : last.y == rect.y && last.height == rect.height;
+          auto touches = vertical ? rect.y <= last.bottom() : rect.x <= last.right();
+          if (sameLine && touches) {
+            last = UnionDamageRect(last, rect);
+            continue;
+          }
+        }
+
+        joined.push_back(rect);
+      }
+
+      return joined;
+    }
+
+    /**
+     * @brief Merge rects overlapping vertically into full width bands,
+     *   bounds the pairwise merge below
+     */
+    std::vector<DamageRect> CollapseBands(std::vector<DamageRect> rects) {
+      std::ranges::sort(rects, {}, &DamageRect::y);
+
+      std::vector<DamageRect> bands{};
+      for (auto &rect : rects) {
+        if (!bands.empty() && rect.y < bands.back().bottom()) {
+          bands.back() = UnionDamageRect(bands.back(), rect);
+        } else {
+          bands.push_back(rect);
+        }
+      }
+
+      return bands;
+    }
+  } // namespace
+
+  DamageRect UnionDamageRect(const DamageRect &a, const DamageRect &b) {
+    if (a.empty())
+      return b;
+
+    if (b.empty())
+      return a;
+
+    auto x = std::min(a.x, b.x);
+    auto y = std::min(a.y, b.y);
+    return {x, y, std::max(a.right(), b.right()) - x, std::max(a.bottom(), b.bottom()) - y};
+  }
+
+  DamageRect ClipDamageRect(const DamageRect &rect, std::uint32_t width, std::uint32_t height) {
+    if (rect.x >= width || rect.y >= height)
+      return {};
+
+    return {rect.x, rect.y, std::min(rect.width, width - rect.x), std::min(rect.height, height - rect.y)};
+  }
+
+  std::vector<DamageRect> DiffTiles(
+    const std::uint8_t *previous,
+    const std::uint8_t *current,
+    const DamageFrameLayout &layout,
+    std::uint32_t tileSize
+  ) {
+    std::vector<DamageRect> damage{};
+    if (!previous || !current || layout.width == 0 || layout.height == 0 || tileSize == 0)
+      return damage;
+
+    auto tilesX = (layout.width + tileSize - 1) / tileSize;
+    auto rowBytes = static_cast<std::size_t>(layout.width) * layout.bpp;
+    std::vector<std::uint8_t> dirty(tilesX);
+
+    for (std::uint32_t tileY = 0; tileY * tileSize < layout.height; tileY++) {
+      std::ranges::fill(dirty, 0);
+      auto remaining = tilesX;
+      auto top = tileY * tileSize;
+      auto bottom = std::min(top + tileSize, layout.height);
+
+      // ROW BY ROW, SO BOTH FRAMES ARE READ SEQUENTIALLY
+      for (auto y = top; y < bottom && remaining > 0; y++) {
+        auto offset = static_cast<std::size_t>(y) * layout.stride;
+        auto previousRow = previous + offset;
+        auto currentRow = current + offset;
+        if (BytesEqual(previousRow, currentRow, rowBytes))
+          continue;
+
+        for (std::uint32_t tileX = 0; tileX < tilesX; tileX++) {
+          if (dirty[tileX])
+            continue;
+
+          auto x = tileX * tileSize;
+          auto begin = static_cast<std::size_t>(x) * layout.bpp;
+          auto len = static_cast<std::size_t>(std::min(tileSize, layout.width - x)) * layout.bpp;
+          if (!BytesEqual(previousRow + begin, currentRow + begin, len)) {
+            dirty[tileX] = 1;
+            remaining--;
+          }
+        }
+      }
+
+      for (std::uint32_t tileX = 0; tileX < tilesX; tileX++) {
+        if (dirty[tileX]) {
+          auto x = tileX * tileSize;
+          damage.push_back({x, top, std::min(tileSize, layout.width - x), bottom - top});
+        }
+      }
+    }
+
+    return damage;
+  }
+
+  std::vector<DamageRect> MergeDamageRects(std::vector<DamageRect> rects, std::size_t maxRects) {
+    std::erase_if(rects, [](const DamageRect &rect) { return rect.empty(); });
+    if (rects.size() <= 1)
+      return rects;
+
+    maxRects = std::max<std::size_t>(maxRects, 1);
+    rects = JoinNeighbours(JoinNeighbours(std::move(rects), false), true);
+    if (rects.size() > maxRects * 4)
+      rects = CollapseBands(std::move(rects));
+
+    while (rects.size() > maxRects) {
+      std::size_t bestA = 0, bestB = 1;
+      auto bestCost = std::numeric_limits<std::int64_t>::max();
+      for (std::size_t a = 0; a < rects.size(); a++) {
+        for (std::size_t b = a + 1; b < rects.size(); b++) {
+          auto cost = static_cast<std::int64_t>(UnionDamageRect(rects[a], rects[b]).area()) -
+            static_cast<std::int64_t>(rects[a].area()) - static_cast<std::int64_t>(rects[b].area());
+          if (cost < bestCost) {
+            bestCost = cost;
+            bestA = a;
+            bestB = b;
+          }
+        }
+      }
+
+      rects[bestA] = UnionDamageRect(rects[bestA], rects[bestB]);
+      rects.erase(rects.begin() + static_cast<std::ptrdiff_t>(bestB));
+    }
+
+    return rects;
+  }
+
+  void CopyDamageRects(
+    const std::uint8_t *src,
+    std::uint8_t *dst,
+    const DamageFrameLayout &layout,
+    std::span<const DamageRect> rects
+  ) {
+    for (auto &damage : rects) {
+      auto rect = ClipDamageRect(damage, layout.width, layout.height);
+      if (rect.empty())
+        continue;
+
+      auto len = static_cast<std::size_t>(rect.width) * layout.bpp;
+      for (auto y = rect.y; y < rect.bottom(); y++) {
+        auto offset = static_cast<std::size_t>(y) * layout.stride + static_cast<std::size_t>(rect.x) * layout.bpp;
+        std::memcpy(dst + offset, src + offset, len);
+      }
+    }
+  }
+
+  DamageHistory::DamageHistory(std::size_t depth) : depth_(std::max<std::size_t>(depth, 1)) {
+  }
+
+  void DamageHistory::push(std::uint32_t frameIndex, std::optional<std::vector<DamageRect>> damage) {
+    // FRAME INDEXES MUST ASCEND, OTHERWISE NOTHING BEFORE THIS FRAME IS KNOWN
+    if (!entries_.empty() && entries_.back().frameIndex >= frameIndex)
+      entries_.clear();
+
+    entries_.push_back({frameIndex, std::move(damage)});
+    while (entries_.size() > depth_)
+      entries_.pop_front();
+  }
+
+  std::optional<std::vector<DamageRect>> DamageHistory::since(
+    std::uint32_t from,
+    std::uint32_t to,
+    std::size_t maxRects
+  ) const {
+    if (from == 0 || to < from)
+      return std::nullopt;
+
+    if (from == to)
+      return std::vector<DamageRect>{};
+
+    // EVERY FRAME IN `(from, to]` MUST BE RECORDED
+    auto first = std::ranges::find(entries_, from + 1, &Entry::frameIndex);
+    if (first == entries_.end() || entries_.back().frameIndex < to)
+      return std::nullopt;
+
+    std::vector<DamageRect> damage{};
+    auto expected = from + 1;
+    for (auto it = first; it != entries_.end() && it->frameIndex <= to; ++it, expected++) {
+      if (it->frameIndex != expected || !it->damage)
+        return std::nullopt;
+
+      damage.insert(damage.end(), it->damage->begin(), it->damage->end());
+    }
+
+    return MergeDamageRects(std::move(damage), maxRects);
+  }
+
+  void DamageHistory::reset() {
+    entries_.clear();
+  }
+
+} // namespace IRacingTools::Shared::Graphics
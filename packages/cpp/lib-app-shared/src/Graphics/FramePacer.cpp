@@ -0,0 +1,175 @@
+#include <algorithm>
+
+#include <IRacingTools/Shared/Graphics/FramePacer.h>
+
+namespace IRacingTools::Shared::Graphics {
+  namespace {
+    constexpr auto RateWindow = std::chrono::seconds(1);
+
+    FramePacer::Duration ToInterval(double fps) {
+      return std::chrono::duration_cast<FramePacer::Duration>(std::chrono::duration<double>(1.0 / fps));
+    }
+
+    double ToSeconds(FramePacer::Duration duration) {
+      return std::chrono::duration<double>(duration).count();
+    }
+  } // namespace
+
+  void FramePacer::RateCounter::tick(TimePoint now) {
+    if (count == 0 && rate == 0) {
+      windowStart = now;
+    } else if (auto elapsed = now - windowStart; elapsed >= RateWindow) {
+      rate = count / ToSeconds(elapsed);
+      count = 0;
+      windowStart = now;
+    }
+
+    count++;
+  }
+
+  double FramePacer::RateCounter::value(TimePoint now) const {
+    // UNTIL THE FIRST WINDOW ENDS, OR ONCE A WINDOW STALLS (DECAYING
+    // TOWARDS 0), THE CURRENT WINDOW IS ALL THERE IS
+    auto elapsed = now - windowStart;
+    if (rate == 0 || elapsed >= RateWindow)
+      return elapsed.count() > 0 ? count / ToSeconds(elapsed) : 0.0;
+
+    return rate;
+  }
+
+  FramePacer::FramePacer() : FramePacer(Options{}) {
+  }
+
+  FramePacer::FramePacer(const Options& options) : options_(options) {
+  }
+
+  void FramePacer::reset(std::size_t overlayCount) {
+    overlays_.clear();
+    overlays_.resize(overlayCount);
+    pendingSubmit_ = true;
+  }
+
+  FramePacer::Duration FramePacer::Tolerance(Duration interval) {
+    return interval / 8;
+  }
+
+  FramePacer::OverlayState& FramePacer::overlay(std::size_t overlayIdx) {
+    if (overlayIdx >= overlays_.size())
+      overlays_.resize(overlayIdx + 1);
+
+    return overlays_[overlayIdx];
+  }
+
+  void FramePacer::observeConsumerFrame(std::uint64_t consumerFrameNumber, TimePoint now) {
+    // FIRST SAMPLE, OR THE CONSUMER RESTARTED
+    if (!consumerSample_ || consumerFrameNumber < consumerSample_->frameNumber) {
+      consumerSample_ = {consumerFrameNumber, now};
+      consumerPeriod_.reset();
+      return;
+    }
+
+    auto elapsed = now - consumerSample_->at;
+    if (elapsed < options_.consumerSampleWindow)
+      return;
+
+    // A LONG GAP IS AN IDLE (OR STALLED) CONSUMER, NOT ITS CADENCE
+    auto frames = consumerFrameNumber - consumerSample_->frameNumber;
+    if (elapsed >= options_.consumerIdleTimeout) {
+      consumerSample_ = {consumerFrameNumber, now};
+      consumerPeriod_.reset();
+      return;
+    }
+
+    if (frames == 0)
+      return;
+
+    auto period = elapsed / static_cast<Duration::rep>(frames);
+    consumerPeriod_ = consumerPeriod_ ? (*consumerPeriod_ * 3 + period) / 4 : period;
+    consumerSample_ = {consumerFrameNumber, now};
+  }
+
+  std::optional<FramePacer::Duration> FramePacer::consumerPeriod() const {
+    return consumerPeriod_;
+  }
+
+  bool FramePacer::shouldRender(std::size_t overlayIdx, double maxFPS, bool hasNewFrame, TimePoint now) {
+    auto& state = overlay(overlayIdx);
+    state.maxFPS = maxFPS > 0 ? maxFPS : options_.defaultMaxFPS;
+    state.minInterval = ToInterval(state.maxFPS);
+    if (!hasNewFrame)
+      return false;
+
+    if (state.renderedAt && now - *state.renderedAt < state.minInterval - Tolerance(state.minInterval)) {
+      // ONLY THE FIRST HELD BACK FRAME IS COUNTED UNTIL THE NEXT RENDER,
+      // THE PRODUCER MAY HAVE REPLACED IT MANY TIMES SINCE
+      if (!state.pending)
+        state.skipped++;
+
+      state.pending = true;
+      return false;
+    }
+
+    return true;
+  }
+
+  void FramePacer::markRendered(std::size_t overlayIdx, TimePoint now) {
+    auto& state = overlay(overlayIdx);
+    state.renderedAt = now;
+    state.pending = false;
+    state.rendered++;
+    state.fps.tick(now);
+  }
+
+  bool FramePacer::shouldSubmit(bool changed, TimePoint now) {
+    pendingSubmit_ = pendingSubmit_ || changed;
+    if (!submittedAt_)
+      return true;
+
+    auto sinceSubmit = now - *submittedAt_;
+    if (!pendingSubmit_)
+      return sinceSubmit >= options_.keepAliveInterval;
+
+    // A CONSUMER ONLY SHOWS ONE SUBMIT PER FRAME, THE REST IS WASTED
+    return !consumerPeriod_ || sinceSubmit >= *consumerPeriod_ - Tolerance(*consumerPeriod_);
+  }
+
+  void FramePacer::markSubmitted(TimePoint now) {
+    submittedAt_ = now;
+    pendingSubmit_ = false;
+    submitted_++;
+    submitFPS_.tick(now);
+  }
+
+  FramePacer::TimePoint FramePacer::nextWakeAt(TimePoint now) const {
+    auto wakeAt = (submittedAt_ ? *submittedAt_ : now) + options_.keepAliveInterval;
+    if (pendingSubmit_ && submittedAt_ && consumerPeriod_)
+      wakeAt = std::min(wakeAt, *submittedAt_ + *consumerPeriod_ - Tolerance(*consumerPeriod_));
+
+    for (auto& state : overlays_) {
+      if (state.pending && state.renderedAt)
+        wakeAt = std::min(wakeAt, *state.renderedAt + state.minInterval - Tolerance(state.minInterval));
+    }
+
+    return std::max(wakeAt, now);
+  }
+
+  FramePacer::Metrics FramePacer::metrics(TimePoint now) const {
+    Metrics metrics{
+      .submitFPS = submitFPS_.value(now),
+      .submitted = submitted_,
+      .consumerFPS = consumerPeriod_ && consumerPeriod_->count() > 0 ? 1.0 / ToSeconds(*consumerPeriod_) : 0.0
+    };
+
+    for (auto& state : overlays_) {
+      metrics.overlays.push_back({
+        .maxFPS = state.maxFPS,
+        .fps = state.fps.value(now),
+        .rendered = state.rendered,
+        .skipped = state.skipped
+      });
+    }
+
+    return metrics;
+  }
+
+} // namespace IRacingTools::Shared::Graphics
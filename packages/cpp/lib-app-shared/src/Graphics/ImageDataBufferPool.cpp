@@ -0,0 +1,124 @@
+#include <algorithm>
+#include <bit>
+#include <new>
+#include <ranges>
+
+#include <IRacingTools/Shared/Graphics/ImageDataBufferPool.h>
+
+namespace IRacingTools::Shared::Graphics {
+  namespace {
+    std::uint8_t *AllocateBlock(std::size_t capacity) {
+      return static_cast<std::uint8_t *>(
+        ::operator new[](capacity, std::align_val_t{ImageDataBufferPool::Alignment})
+      );
+    }
+
+    void FreeBlock(std::uint8_t *data) {
+      ::operator delete[](data, std::align_val_t{ImageDataBufferPool::Alignment});
+    }
+  } // namespace
+
+  struct ImageDataBufferPool::State {
+    Options options;
+    mutable std::mutex mutex{};
+    std::unordered_map<std::size_t, std::vector<std::uint8_t *>> cached{};
+    Metrics metrics{};
+
+    ~State() {
+      for (auto &blocks : cached | std::views::values) {
+        for (auto data : blocks)
+          FreeBlock(data);
+      }
+    }
+  };
+
+  void ImageDataBufferPool::BlockDeleter::operator()(std::uint8_t *data) const {
+    if (!data)
+      return;
+
+    auto pool = state.lock();
+    if (!pool) {
+      FreeBlock(data);
+      return;
+    }
+
+    std::scoped_lock lock(pool->mutex);
+    auto &metrics = pool->metrics;
+    auto &blocks = pool->cached[capacity];
+    metrics.releases++;
+    metrics.liveBytes -= capacity;
+    if (blocks.size() < pool->options.maxCachedPerClass &&
+        metrics.cachedBytes + capacity <= pool->options.maxCachedBytes) {
+      blocks.push_back(data);
+      metrics.cachedBytes += capacity;
+      metrics.cachedBlocks++;
+      return;
+    }
+
+    metrics.frees++;
+    FreeBlock(data);
+  }
+
+  ImageDataBufferPool::ImageDataBufferPool() : ImageDataBufferPool(Options{}) {
+  }
+
+  ImageDataBufferPool::ImageDataBufferPool(const Options &options)
+      : state_(std::make_shared<State>(options)) {
+  }
+
+  std::shared_ptr<ImageDataBufferPool> ImageDataBufferPool::Default() {
+    static const auto instance = std::make_shared<ImageDataBufferPool>();
+    return instance;
+  }
+
+  std::size_t ImageDataBufferPool::SizeClass(std::size_t size) {
+    size = std::max<std::size_t>(size, 1);
+
+    // 4 CLASSES PER POWER OF TWO, NEVER BELOW A PAGE
+    auto step = std::max<std::size_t>(std::bit_floor(size) / 4, Alignment);
+    return (size + step - 1) / step * step;
+  }
+
+  ImageDataBufferPool::Block ImageDataBufferPool::acquire(std::size_t size) {
+    auto capacity = SizeClass(size);
+    BlockDeleter deleter{state_, capacity};
+    {
+      std::scoped_lock lock(state_->mutex);
+      auto &metrics = state_->metrics;
+      metrics.liveBytes += capacity;
+      if (auto it = state_->cached.find(capacity); it != state_->cached.end() && !it->second.empty()) {
+        auto data = it->second.back();
+        it->second.pop_back();
+        metrics.reuses++;
+        metrics.cachedBytes -= capacity;
+        metrics.cachedBlocks--;
+        return Block(data, std::move(deleter));
+      }
+
+      metrics.allocations++;
+    }
+
+    return Block(AllocateBlock(capacity), std::move(deleter));
+  }
+
+  void ImageDataBufferPool::trim() {
+    std::scoped_lock lock(state_->mutex);
+    auto &metrics = state_->metrics;
+    for (auto &blocks : state_->cached | std::views::values) {
+      for (auto data : blocks)
+        FreeBlock(data);
+
+      metrics.frees += blocks.size();
+      blocks.clear();
+    }
+
+    metrics.cachedBytes = 0;
+    metrics.cachedBlocks = 0;
+  }
+
+  ImageDataBufferPool::Metrics ImageDataBufferPool::metrics() const {
+    std::scoped_lock lock(state_->mutex);
+    return state_->metrics;
+  }
+
+} // namespace IRacingTools::Shared::Graphics
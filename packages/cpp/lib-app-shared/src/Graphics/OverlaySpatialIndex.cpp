@@ -0,0 +1,278 @@
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <limits>
+
+#include <IRacingTools/Shared/Graphics/OverlaySpatialIndex.h>
+
+namespace IRacingTools::Shared::Graphics {
+  namespace {
+
+    /**
+     * @brief Quads per leaf, overlays are few so leaves stay small
+     */
+    constexpr std::uint32_t LeafSize = 2;
+
+    /**
+     * @brief Rays per traversal, one bit each in the active mask
+     */
+    constexpr std::size_t PacketSize = 32;
+
+    /**
+     * @brief Same as the `Ray::Intersects(Plane)` epsilon `RayIntersectsRect` relies on
+     */
+    constexpr float ParallelEpsilon = 1e-20f;
+
+    /**
+     * @brief Bounds padding (metres), keeps edge hits the quad test accepts
+     */
+    constexpr float BoundsPadding = 1e-5f;
+
+    constexpr float Infinity = std::numeric_limits<float>::infinity();
+
+    OverlayVector3 Add(const OverlayVector3 &a, const OverlayVector3 &b) {
+      return {a.x + b.x, a.y + b.y, a.z + b.z};
+    }
+
+    OverlayVector3 Subtract(const OverlayVector3 &a, const OverlayVector3 &b) {
+      return {a.x - b.x, a.y - b.y, a.z - b.z};
+    }
+
+    OverlayVector3 Scale(const OverlayVector3 &v, float scale) {
+      return {v.x * scale, v.y * scale, v.z * scale};
+    }
+
+    float Dot(const OverlayVector3 &a, const OverlayVector3 &b) {
+      return a.x * b.x + a.y * b.y + a.z * b.z;
+    }
+
+    OverlayVector3 Cross(const OverlayVector3 &a, const OverlayVector3 &b) {
+      return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+    }
+
+    /**
+     * @brief `Vector3::Transform(v, q)` for a unit `q`
+     */
+    OverlayVector3 Rotate(const OverlayQuaternion &q, const OverlayVector3 &v) {
+      const OverlayVector3 axis{q.x, q.y, q.z};
+      auto t = Scale(Cross(axis, v), 2.0f);
+      return Add(Add(v, Scale(t, q.w)), Cross(axis, t));
+    }
+
+    float Axis(const OverlayVector3 &v, int axis) {
+      return axis == 0 ? v.x : axis == 1 ? v.y : v.z;
+    }
+
+  } // namespace
+
+  OverlaySpatialIndex::PreparedRay OverlaySpatialIndex::PrepareRay(const OverlayRay &ray) {
+    auto direction = Rotate(ray.orientation, {0.0f, 0.0f, -1.0f});
+    return {
+      .origin = ray.origin,
+      .direction = direction,
+      .inverseDirection = {1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z},
+    };
+  }
+
+  OverlaySpatialIndex::Prepared OverlaySpatialIndex::PrepareQuad(const OverlayQuad &quad, std::size_t index) {
+    Prepared prepared{
+      .index = index,
+      .overlayIdx = quad.overlayIdx,
+      .center = quad.center,
+      .axisX = Rotate(quad.orientation, {1.0f, 0.0f, 0.0f}),
+      .axisY = Rotate(quad.orientation, {0.0f, 1.0f, 0.0f}),
+      .normal = Rotate(quad.orientation, {0.0f, 0.0f, 1.0f}),
+      .halfWidth = quad.width / 2,
+      .halfHeight = quad.height / 2,
+    };
+
+    // CORNERS ARE `center ± axisX * halfWidth ± axisY * halfHeight`
+    OverlayVector3 extent{
+      std::abs(prepared.axisX.x) * prepared.halfWidth + std::abs(prepared.axisY.x) * prepared.halfHeight + BoundsPadding,
+      std::abs(prepared.axisX.y) * prepared.halfWidth + std::abs(prepared.axisY.y) * prepared.halfHeight + BoundsPadding,
+      std::abs(prepared.axisX.z) * prepared.halfWidth + std::abs(prepared.axisY.z) * prepared.halfHeight + BoundsPadding,
+    };
+    prepared.bounds = {Subtract(quad.center, extent), Add(quad.center, extent)};
+    return prepared;
+  }
+
+  void OverlaySpatialIndex::IntersectQuad(const PreparedRay &ray, const Prepared &quad, std::optional<OverlayHit> &nearest) {
+    const auto denominator = Dot(quad.normal, ray.direction);
+    if (std::abs(denominator) <= ParallelEpsilon)
+      return;
+
+    const auto distance = Dot(Subtract(quad.center, ray.origin), quad.normal) / denominator;
+    if (distance < 0 || (nearest && (distance > nearest->distance || (distance == nearest->distance && quad.index > nearest->index))))
+      return;
+
+    const auto point = Subtract(Add(ray.origin, Scale(ray.direction, distance)), quad.center);
+    const auto x = Dot(point, quad.axisX);
+    const auto y = Dot(point, quad.axisY);
+    if (std::abs(x) > quad.halfWidth || std::abs(y) > quad.halfHeight)
+      return;
+
+    nearest = OverlayHit{
+      .index = quad.index,
+      .overlayIdx = quad.overlayIdx,
+      .distance = distance,
+      .u = quad.halfWidth > 0 ? 0.5f + x / (2 * quad.halfWidth) : 0.5f,
+      .v = quad.halfHeight > 0 ? 0.5f - y / (2 * quad.halfHeight) : 0.5f,
+    };
+  }
+
+  std::optional<OverlayHit> IntersectOverlayQuads(const OverlayRay &ray, std::span<const OverlayQuad> quads) {
+    const auto prepared = OverlaySpatialIndex::PrepareRay(ray);
+
+    std::optional<OverlayHit> nearest{};
+    for (std::size_t idx = 0; idx < quads.size(); idx++)
+      OverlaySpatialIndex::IntersectQuad(prepared, OverlaySpatialIndex::PrepareQuad(quads[idx], idx), nearest);
+
+    return nearest;
+  }
+
+  bool OverlaySpatialIndex::update(std::span<const OverlayQuad> quads) {
+    if (std::ranges::equal(quads, quads_))
+      return false;
+
+    quads_.assign(quads.begin(), quads.end());
+    prepared_.clear();
+    nodes_.clear();
+    if (quads_.empty())
+      return true;
+
+    prepared_.reserve(quads_.size());
+    for (std::size_t idx = 0; idx < quads_.size(); idx++)
+      prepared_.push_back(PrepareQuad(quads_[idx], idx));
+
+    nodes_.reserve(2 * quads_.size());
+    nodes_.emplace_back();
+    build(0, 0, static_cast<std::uint32_t>(prepared_.size()));
+    return true;
+  }
+
+  void OverlaySpatialIndex::build(std::uint32_t node, std::uint32_t first, std::uint32_t count) {
+    auto begin = prepared_.begin() + first;
+    auto end = begin + count;
+
+    Bounds bounds{{Infinity, Infinity, Infinity}, {-Infinity, -Infinity, -Infinity}};
+    Bounds centers = bounds;
+    for (auto it = begin; it != end; ++it) {
+      bounds.min = {std::min(bounds.min.x, it->bounds.min.x), std::min(bounds.min.y, it->bounds.min.y), std::min(bounds.min.z, it->bounds.min.z)};
+      bounds.max = {std::max(bounds.max.x, it->bounds.max.x), std::max(bounds.max.y, it->bounds.max.y), std::max(bounds.max.z, it->bounds.max.z)};
+      centers.min = {std::min(centers.min.x, it->center.x), std::min(centers.min.y, it->center.y), std::min(centers.min.z, it->center.z)};
+      centers.max = {std::max(centers.max.x, it->center.x), std::max(centers.max.y, it->center.y), std::max(centers.max.z, it->center.z)};
+    }
+
+    nodes_[node].bounds = bounds;
+    if (count <= LeafSize) {
+      nodes_[node].first = first;
+      nodes_[node].count = count;
+      return;
+    }
+
+    // MEDIAN SPLIT ALONG THE AXIS THE CENTERS SPREAD MOST ON
+    const auto spread = Subtract(centers.max, centers.min);
+    const int axis = spread.x >= spread.y && spread.x >= spread.z ? 0 : spread.y >= spread.z ? 1 : 2;
+    const auto half = count / 2;
+    std::nth_element(begin, begin + half, end, [axis](const Prepared &a, const Prepared &b) {
+      return Axis(a.center, axis) < Axis(b.center, axis);
+    });
+
+    const auto left = static_cast<std::uint32_t>(nodes_.size());
+    nodes_.emplace_back();
+    nodes_.emplace_back();
+    nodes_[node].first = left;
+    nodes_[node].count = 0;
+
+    build(left, first, half);
+    build(left + 1, first + half, count - half);
+  }
+
+  std::optional<OverlayHit> OverlaySpatialIndex::intersect(const OverlayRay &ray) const {
+    std::optional<OverlayHit> hit{};
+    intersect({&ray, 1}, {&hit, 1});
+    return hit;
+  }
+
+  std::optional<OverlayHit> OverlaySpatialIndex::intersectLinear(const OverlayRay &ray) const {
+    const auto prepared = PrepareRay(ray);
+
+    std::optional<OverlayHit> nearest{};
+    for (auto &quad : prepared_)
+      IntersectQuad(prepared, quad, nearest);
+
+    return nearest;
+  }
+
+  void OverlaySpatialIndex::intersect(std::span<const OverlayRay> rays, std::span<std::optional<OverlayHit>> hits) const {
+    std::ranges::fill(hits, std::nullopt);
+    if (nodes_.empty())
+      return;
+
+    std::array<PreparedRay, PacketSize> packet{};
+    for (std::size_t packetStart = 0; packetStart < rays.size() && packetStart < hits.size(); packetStart += PacketSize) {
+      const auto packetCount = std::min({PacketSize, rays.size() - packetStart, hits.size() - packetStart});
+      for (std::size_t idx = 0; idx < packetCount; idx++)
+        packet[idx] = PrepareRay(rays[packetStart + idx]);
+
+      auto packetHits = hits.subspan(packetStart, packetCount);
+
+      // EVERY NODE IS FETCHED ONCE PER PACKET, WITH THE RAYS STILL ABLE TO
+      // HIT SOMETHING CLOSER THAN THEIR NEAREST HIT SO FAR
+      struct Pending {
+        std::uint32_t node;
+        std::uint32_t mask;
+      };
+
+      std::array<Pending, 64> stack;
+      std::size_t stackSize = 0;
+      stack[stackSize++] = {0, packetCount == PacketSize ? ~0u : (1u << packetCount) - 1};
+
+      while (stackSize > 0) {
+        const auto [nodeIdx, pendingMask] = stack[--stackSize];
+        const auto &node = nodes_[nodeIdx];
+
+        std::uint32_t mask = 0;
+        for (auto bits = pendingMask; bits; bits &= bits - 1) {
+          const auto rayIdx = static_cast<std::size_t>(std::countr_zero(bits));
+          const auto &ray = packet[rayIdx];
+          const auto &nearest = packetHits[rayIdx];
+
+          float entry = 0.0f;
+          float exit = nearest ? nearest->distance : Infinity;
+          for (int axis = 0; axis < 3; axis++) {
+            const auto origin = Axis(ray.origin, axis);
+            const auto inverse = Axis(ray.inverseDirection, axis);
+            const auto t1 = (Axis(node.bounds.min, axis) - origin) * inverse;
+            const auto t2 = (Axis(node.bounds.max, axis) - origin) * inverse;
+
+            // NaN (A RAY IN A SLAB PLANE) LEAVES THE RANGE AS IS
+            entry = std::max(entry, std::min(t1, t2));
+            exit = std::min(exit, std::max(t1, t2));
+          }
+
+          if (entry <= exit)
+            mask |= 1u << rayIdx;
+        }
+
+        if (!mask)
+          continue;
+
+        if (node.count == 0) {
+          stack[stackSize++] = {node.first + 1, mask};
+          stack[stackSize++] = {node.first, mask};
+          continue;
+        }
+
+        for (auto quad = prepared_.begin() + node.first; quad != prepared_.begin() + node.first + node.count; ++quad) {
+          for (auto bits = mask; bits; bits &= bits - 1) {
+            const auto rayIdx = static_cast<std::size_t>(std::countr_zero(bits));
+            IntersectQuad(packet[rayIdx], *quad, packetHits[rayIdx]);
+          }
+        }
+      }
+    }
+  }
+
+} // namespace IRacingTools::Shared::Graphics
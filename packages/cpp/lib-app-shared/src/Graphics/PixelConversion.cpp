@@ -0,0 +1,383 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include <IRacingTools/Shared/Graphics/PixelConversion.h>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define IRT_PIXEL_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#endif
+
+// MSVC accepts any intrinsic without `/arch`, GCC & Clang need the
+// functions using them to opt in to the instruction set
+#if defined(__GNUC__) || defined(__clang__)
+#define IRT_PIXEL_TARGET(isa) __attribute__((target(isa)))
+#else
+#define IRT_PIXEL_TARGET(isa)
+#endif
+
+namespace IRacingTools::Shared::Graphics {
+  namespace {
+
+    /**
+     * @brief Conversion resolved to the steps actually needed
+     */
+    struct ConversionSteps {
+      PixelLayout layout;
+      bool premultiply;
+      bool tint;
+
+      /**
+       * @brief Tint as 0-255 multipliers, in BGRA order
+       */
+      std::array<std::uint16_t, 4> tintBGRA;
+    };
+
+    std::uint16_t ToMultiplier(float value) {
+      return static_cast<std::uint16_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * 255.0f));
+    }
+
+    ConversionSteps ToSteps(const PixelConversion &conversion) {
+      ConversionSteps steps{
+        .layout = conversion.layout,
+        .premultiply = conversion.alpha == PixelAlpha::Straight && conversion.layout != PixelLayout::RGB,
+        .tint = false,
+        .tintBGRA = {
+          ToMultiplier(conversion.tint[2]),
+          ToMultiplier(conversion.tint[1]),
+          ToMultiplier(conversion.tint[0]),
+          ToMultiplier(conversion.tint[3])
+        }
+      };
+
+      steps.tint = std::ranges::any_of(steps.tintBGRA, [](auto value) { return value != 255; });
+      return steps;
+    }
+
+    /**
+     * @brief `value / 255` rounded to nearest, exact for `value <= 255 * 255`
+     */
+    constexpr std::uint32_t Div255(std::uint32_t value) {
+      value += 128;
+      return (value + (value >> 8)) >> 8;
+    }
+
+    void ConvertScalar(
+      const std::uint8_t *src,
+      std::uint8_t *dst,
+      std::size_t begin,
+      std::size_t count,
+      const ConversionSteps &steps
+    ) {
+      auto srcBPP = PixelLayoutBPP(steps.layout);
+      for (auto i = begin; i < count; i++) {
+        auto in = src + i * srcBPP;
+        std::uint32_t px[4];
+        switch (steps.layout) {
+          case PixelLayout::BGRA:
+            px[0] = in[0], px[1] = in[1], px[2] = in[2], px[3] = in[3];
+            break;
+          case PixelLayout::RGBA:
+            px[0] = in[2], px[1] = in[1], px[2] = in[0], px[3] = in[3];
+            break;
+          case PixelLayout::RGB:
+            px[0] = in[2], px[1] = in[1], px[2] = in[0], px[3] = 255;
+            break;
+        }
+
+        if (steps.premultiply) {
+          for (int c = 0; c < 3; c++)
+            px[c] = Div255(px[c] * px[3]);
+        }
+
+        if (steps.tint) {
+          for (int c = 0; c < 4; c++)
+            px[c] = Div255(px[c] * steps.tintBGRA[c]);
+        }
+
+        auto out = dst + i * 4;
+        for (int c = 0; c < 4; c++)
+          out[c] = static_cast<std::uint8_t>(px[c]);
+      }
+    }
+
+#ifdef IRT_PIXEL_X86
+    bool CpuSupports(PixelKernel kernel) {
+#if defined(_MSC_VER) && !defined(__clang__)
+      int info[4]{};
+      __cpuid(info, 0);
+      auto maxLeaf = info[0];
+
+      __cpuid(info, 1);
+      auto ssse3 = (info[2] & (1 << 9)) != 0;
+      if (kernel == PixelKernel::SSSE3) {
+        return ssse3;
+      }
+
+      // AVX2 also needs the OS to save the YMM registers (OSXSAVE + XCR0)
+      auto osxsave = (info[2] & (1 << 27)) != 0;
+      auto avx = (info[2] & (1 << 28)) != 0;
+      if (maxLeaf < 7 || !osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6) {
+        return false;
+      }
+
+      __cpuidex(info, 7, 0);
+      return (info[1] & (1 << 5)) != 0;
+#else
+      __builtin_cpu_init();
+      return kernel == PixelKernel::SSSE3 ? __builtin_cpu_supports("ssse3") : __builtin_cpu_supports("avx2");
+#endif
+    }
+
+    /**
+     * @brief Shuffle of 4 source pixels (16 or 12 bytes) into BGRA,
+     *   `-1` zeroes the alpha of `RGB`, which is then set to `0xFF`
+     */
+    std::array<std::int8_t, 16> ShuffleMask(PixelLayout layout) {
+      std::array<std::int8_t, 16> mask{};
+      for (std::int8_t k = 0; k < 4; k++) {
+        auto out = mask.data() + k * 4;
+        if (layout == PixelLayout::RGB) {
+          out[0] = k * 3 + 2, out[1] = k * 3 + 1, out[2] = k * 3, out[3] = -1;
+        } else if (layout == PixelLayout::RGBA) {
+          out[0] = k * 4 + 2, out[1] = k * 4 + 1, out[2] = k * 4, out[3] = k * 4 + 3;
+        } else {
+          out[0] = k * 4, out[1] = k * 4 + 1, out[2] = k * 4 + 2, out[3] = k * 4 + 3;
+        }
+      }
+
+      return mask;
+    }
+
+    // SSSE3, 4 PIXELS PER STEP
+
+    IRT_PIXEL_TARGET("ssse3")
+    __m128i Div255SSE(__m128i value) {
+      value = _mm_add_epi16(value, _mm_set1_epi16(128));
+      return _mm_srli_epi16(_mm_add_epi16(value, _mm_srli_epi16(value, 8)), 8);
+    }
+
+    /**
+     * @brief Premultiply and/or tint 2 BGRA pixels widened to 16bit words
+     */
+    IRT_PIXEL_TARGET("ssse3")
+    __m128i ScaleSSE(__m128i words, const ConversionSteps &steps, __m128i tint) {
+      if (steps.premultiply) {
+        // ALPHA ITSELF IS MULTIPLIED BY 255, SO IT IS KEPT
+        auto alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(words, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+        alpha = _mm_or_si128(
+          _mm_and_si128(alpha, _mm_setr_epi16(-1, -1, -1, 0, -1, -1, -1, 0)),
+          _mm_setr_epi16(0, 0, 0, 255, 0, 0, 0, 255)
+        );
+        words = Div255SSE(_mm_mullo_epi16(words, alpha));
+      }
+
+      if (steps.tint)
+        words = Div255SSE(_mm_mullo_epi16(words, tint));
+
+      return words;
+    }
+
+    IRT_PIXEL_TARGET("ssse3")
+    std::size_t ConvertSSSE3(const std::uint8_t *src, std::uint8_t *dst, std::size_t count, const ConversionSteps &steps) {
+      auto srcBPP = PixelLayoutBPP(steps.layout);
+      auto shuffleMask = ShuffleMask(steps.layout);
+      auto shuffle = _mm_loadu_si128(reinterpret_cast<const __m128i *>(shuffleMask.data()));
+      auto opaque = _mm_set1_epi32(steps.layout == PixelLayout::RGB ? static_cast<int>(0xFF000000) : 0);
+      auto &t = steps.tintBGRA;
+      auto tint = _mm_setr_epi16(t[0], t[1], t[2], t[3], t[0], t[1], t[2], t[3]);
+      auto zero = _mm_setzero_si128();
+
+      // EVERY LOAD READS 16 BYTES, FOR RGB THAT IS PAST THE 4TH PIXEL
+      std::size_t i = 0;
+      for (; i * srcBPP + 16 <= count * srcBPP; i += 4) {
+        auto px = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i * srcBPP));
+        px = _mm_or_si128(_mm_shuffle_epi8(px, shuffle), opaque);
+        if (steps.premultiply || steps.tint) {
+          px = _mm_packus_epi16(
+            ScaleSSE(_mm_unpacklo_epi8(px, zero), steps, tint),
+            ScaleSSE(_mm_unpackhi_epi8(px, zero), steps, tint)
+          );
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i * 4), px);
+      }
+
+      return i;
+    }
+
+    // AVX2, 8 PIXELS PER STEP
+
+    IRT_PIXEL_TARGET("avx2")
+    __m256i Div255AVX2(__m256i value) {
+      value = _mm256_add_epi16(value, _mm256_set1_epi16(128));
+      return _mm256_srli_epi16(_mm256_add_epi16(value, _mm256_srli_epi16(value, 8)), 8);
+    }
+
+    IRT_PIXEL_TARGET("avx2")
+    __m256i ScaleAVX2(__m256i words, const ConversionSteps &steps, __m256i tint) {
+      if (steps.premultiply) {
+        auto alpha = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(words, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+        alpha = _mm256_or_si256(
+          _mm256_and_si256(alpha, _mm256_setr_epi16(-1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1, 0)),
+          _mm256_setr_epi16(0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255)
+        );
+        words = Div255AVX2(_mm256_mullo_epi16(words, alpha));
+      }
+
+      if (steps.tint)
+        words = Div255AVX2(_mm256_mullo_epi16(words, tint));
+
+      return words;
+    }
+
+    IRT_PIXEL_TARGET("avx2")
+    std::size_t ConvertAVX2(const std::uint8_t *src, std::uint8_t *dst, std::size_t count, const ConversionSteps &steps) {
+      auto srcBPP = PixelLayoutBPP(steps.layout);
+      auto shuffleMask = ShuffleMask(steps.layout);
+      auto shuffle = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(shuffleMask.data())));
+      auto opaque = _mm256_set1_epi32(steps.layout == PixelLayout::RGB ? static_cast<int>(0xFF000000) : 0);
+      auto &t = steps.tintBGRA;
+      auto tint = _mm256_setr_epi16(
+        t[0], t[1], t[2], t[3], t[0], t[1], t[2], t[3], t[0], t[1], t[2], t[3], t[0], t[1], t[2], t[3]
+      );
+      auto zero = _mm256_setzero_si256();
+
+      // EACH 128BIT LANE HOLDS 4 PIXELS, LOADED SEPARATELY SO RGB LINES UP
+      std::size_t i = 0;
+      for (; (i + 4) * srcBPP + 16 <= count * srcBPP; i += 8) {
+        auto in = src + i * srcBPP;
+        auto px = _mm256_inserti128_si256(
+          _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in))),
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + 4 * srcBPP)),
+          1
+        );
+        px = _mm256_or_si256(_mm256_shuffle_epi8(px, shuffle), opaque);
+        if (steps.premultiply || steps.tint) {
+          px = _mm256_packus_epi16(
+            ScaleAVX2(_mm256_unpacklo_epi8(px, zero), steps, tint),
+            ScaleAVX2(_mm256_unpackhi_epi8(px, zero), steps, tint)
+          );
+        }
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i * 4), px);
+      }
+
+      return i;
+    }
+#endif
+
+    void ConvertRow(
+      const std::uint8_t *src,
+      std::uint8_t *dst,
+      std::size_t count,
+      const ConversionSteps &steps,
+      PixelKernel kernel
+    ) {
+      std::size_t done = 0;
+#ifdef IRT_PIXEL_X86
+      switch (kernel) {
+        case PixelKernel::AVX2:
+          done = ConvertAVX2(src, dst, count, steps);
+          break;
+        case PixelKernel::SSSE3:
+          done = ConvertSSSE3(src, dst, count, steps);
+          break;
+        default:
+          break;
+      }
+#endif
+
+      ConvertScalar(src, dst, done, count, steps);
+    }
+  } // namespace
+
+  bool PixelConversion::isCopy() const {
+    return layout == PixelLayout::BGRA && alpha == PixelAlpha::Premultiplied && !ToSteps(*this).tint;
+  }
+
+  bool IsPixelKernelSupported(PixelKernel kernel) {
+    switch (kernel) {
+      case PixelKernel::Auto:
+      case PixelKernel::Scalar:
+        return true;
+#ifdef IRT_PIXEL_X86
+      case PixelKernel::SSSE3: {
+        static const bool supported = CpuSupports(PixelKernel::SSSE3);
+        return supported;
+      }
+      case PixelKernel::AVX2: {
+        static const bool supported = CpuSupports(PixelKernel::AVX2);
+        return supported;
+      }
+#endif
+      default:
+        return false;
+    }
+  }
+
+  PixelKernel GetPixelKernel(PixelKernel kernel) {
+    if (kernel != PixelKernel::Auto && IsPixelKernelSupported(kernel)) {
+      return kernel;
+    }
+
+    // Requested kernel not available (or `Auto`), step down to the widest supported one
+    for (auto candidate : {PixelKernel::AVX2, PixelKernel::SSSE3}) {
+      if ((kernel == PixelKernel::Auto || candidate < kernel) && IsPixelKernelSupported(candidate)) {
+        return candidate;
+      }
+    }
+
+    return PixelKernel::Scalar;
+  }
+
+  void ConvertPixels(
+    const std::uint8_t *src,
+    std::uint8_t *dst,
+    std::size_t count,
+    const PixelConversion &conversion,
+    PixelKernel kernel
+  ) {
+    if (conversion.isCopy()) {
+      std::memcpy(dst, src, count * 4);
+      return;
+    }
+
+    ConvertRow(src, dst, count, ToSteps(conversion), GetPixelKernel(kernel));
+  }
+
+  void ConvertPixelRects(
+    const std::uint8_t *src,
+    std::uint32_t srcStride,
+    std::uint8_t *dst,
+    const DamageFrameLayout &dstLayout,
+    std::span<const DamageRect> rects,
+    const PixelConversion &conversion,
+    PixelKernel kernel
+  ) {
+    auto copy = conversion.isCopy();
+    auto steps = ToSteps(conversion);
+    auto srcBPP = conversion.srcBPP();
+    kernel = GetPixelKernel(kernel);
+    for (auto &damage : rects) {
+      auto rect = ClipDamageRect(damage, dstLayout.width, dstLayout.height);
+      if (rect.empty())
+        continue;
+
+      for (auto y = rect.y; y < rect.bottom(); y++) {
+        auto in = src + static_cast<std::size_t>(y) * srcStride + static_cast<std::size_t>(rect.x) * srcBPP;
+        auto out = dst + static_cast<std::size_t>(y) * dstLayout.stride + static_cast<std::size_t>(rect.x) * dstLayout.bpp;
+        if (copy) {
+          std::memcpy(out, in, static_cast<std::size_t>(rect.width) * 4);
+        } else {
+          ConvertRow(in, out, rect.width, steps, kernel);
+        }
+      }
+    }
+  }
+
+} // namespace IRacingTools::Shared::Graphics
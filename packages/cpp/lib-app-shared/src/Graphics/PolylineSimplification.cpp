@@ -0,0 +1,80 @@
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include <IRacingTools/Shared/Graphics/PolylineSimplification.h>
+
+namespace IRacingTools::Shared::Geometry {
+  namespace {
+    /**
+     * @brief Distance from `p` to the segment `a` -> `b`
+     */
+    double SegmentDistance(const PixelD &p, const PixelD &a, const PixelD &b) {
+      auto dx = b.x - a.x;
+      auto dy = b.y - a.y;
+      auto lengthSquared = dx * dx + dy * dy;
+      auto t = lengthSquared > 0.0 ? ((p.x - a.x) * dx + (p.y - a.y) * dy) / lengthSquared : 0.0;
+      t = std::clamp(t, 0.0, 1.0);
+      return std::hypot(p.x - (a.x + t * dx), p.y - (a.y + t * dy));
+    }
+  } // namespace
+
+  std::vector<std::size_t> SimplifyPolyline(std::span<const PixelD> points, double tolerance) {
+    auto count = points.size();
+    if (count <= 2) {
+      std::vector<std::size_t> indexes(count);
+      for (std::size_t idx = 0; idx < count; idx++)
+        indexes[idx] = idx;
+
+      return indexes;
+    }
+
+    std::vector<bool> keep(count, false);
+    keep.front() = keep.back() = true;
+
+    // Explicit stack, track paths are thousands of points
+    std::vector<std::pair<std::size_t, std::size_t>> ranges{{0, count - 1}};
+    while (!ranges.empty()) {
+      auto [first, last] = ranges.back();
+      ranges.pop_back();
+
+      auto maxDistance = 0.0;
+      auto maxIdx = first;
+      for (auto idx = first + 1; idx < last; idx++) {
+        auto distance = SegmentDistance(points[idx], points[first], points[last]);
+        if (distance > maxDistance) {
+          maxDistance = distance;
+          maxIdx = idx;
+        }
+      }
+
+      if (maxDistance > tolerance) {
+        keep[maxIdx] = true;
+        ranges.emplace_back(first, maxIdx);
+        ranges.emplace_back(maxIdx, last);
+      }
+    }
+
+    std::vector<std::size_t> indexes{};
+    for (std::size_t idx = 0; idx < count; idx++) {
+      if (keep[idx])
+        indexes.push_back(idx);
+    }
+
+    return indexes;
+  }
+
+  double PolylineDeviation(std::span<const PixelD> points, std::span<const std::size_t> indexes) {
+    auto maxDistance = 0.0;
+    for (std::size_t segment = 1; segment < indexes.size(); segment++) {
+      auto first = indexes[segment - 1];
+      auto last = indexes[segment];
+      for (auto idx = first + 1; idx < last; idx++) {
+        maxDistance = std::max(maxDistance, SegmentDistance(points[idx], points[first], points[last]));
+      }
+    }
+
+    return maxDistance;
+  }
+
+} // namespace IRacingTools::Shared::Geometry
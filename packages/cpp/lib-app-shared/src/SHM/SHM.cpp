@@ -3,6 +3,8 @@
 //
 
 
+#include <bit>
+
 #include <IRacingTools/Models/LapTrajectory.pb.h>
 #include <IRacingTools/Models/TrackMap.pb.h>
 #include <IRacingTools/SDK/Utils/LockHelpers.h>
@@ -10,6 +12,7 @@
 #include <IRacingTools/SDK/Utils/UnicodeHelpers.h>
 #include <IRacingTools/Shared/ProtoHelpers.h>
 #include <IRacingTools/Shared/SHM/SHM.h>
+#include <IRacingTools/Shared/SHM/SHMOverlayRenderCache.h>
 
 #include <spdlog/spdlog.h>
 
@@ -19,6 +22,22 @@ namespace IRacingTools::Shared::SHM {
 
   namespace {
     auto L = Logging::GetCategoryWithName("SHM");
+
+    /**
+     * @brief Consumers the writer paces to, a viewer window polling the same
+     *   SHM must not speed it up
+     */
+    bool IsVRConsumer(ConsumerKind kind) {
+      switch (kind) {
+      case ConsumerKind::SteamVR:
+      case ConsumerKind::OpenXR:
+      case ConsumerKind::OculusD3D11:
+      case ConsumerKind::OculusD3D12:
+        return true;
+      default:
+        return false;
+      }
+    }
   }
 
 
@@ -36,6 +55,18 @@ namespace IRacingTools::Shared::SHM {
     winrt::handle eventHandle_;
     winrt::handle mutexHandle_;
     std::byte* mapping_ = nullptr;
+    SHMLayout* layout_ = nullptr;
+
+    /**
+     * @brief This process' copy, the writer publishes it, readers refresh it
+     */
+    FrameMetadata current_{};
+
+    /**
+     * @brief `metadata.version()` when `current_` was refreshed, at most
+     *   the version of the copy
+     */
+    std::uint64_t currentVersion_{0};
     FrameMetadata* metadata_ = nullptr;
     LockState lockState_{LockState::Unlocked};
     friend class SHMReader;
@@ -82,7 +113,9 @@ namespace IRacingTools::Shared::SHM {
       fileHandle_ = std::move(fileHandle);
       eventHandle_ = std::move(eventHandle);
       mutexHandle_ = std::move(mutexHandle);
-      metadata_ = reinterpret_cast<FrameMetadata*>(mapping_);
+      layout_ = reinterpret_cast<SHMLayout*>(mapping_);
+      current_ = layout_->metadata.load();
+      metadata_ = &current_;
     }
 
     virtual ~Impl() {
@@ -100,6 +133,39 @@ namespace IRacingTools::Shared::SHM {
       return mapping_;
     }
 
+    /**
+     * @brief Make the writer's copy visible to readers
+     */
+    void publish() {
+      layout_->metadata.store(current_);
+    }
+
+    /**
+     * @brief Take a complete copy of the latest published metadata, never
+     *   blocks on the writer
+     */
+    void refresh() {
+      currentVersion_ = layout_->metadata.version();
+      current_ = layout_->metadata.load();
+    }
+
+    /**
+     * @brief true once the writer published enough frames since `refresh()`
+     *   that its next frame (possibly being written now) reuses the
+     *   swapchain texture of `current_`
+     */
+    bool isCurrentStale() const {
+      return layout_->metadata.version() - currentVersion_ >= SHMSwapchainLength - 1;
+    }
+
+    /**
+     * @brief Start over with empty metadata, i.e. the previous writer is gone
+     */
+    void reset() {
+      current_ = {};
+      layout_->metadata.reset(current_);
+    }
+
 
     void lock() override {
       L->trace("SHM::Impl::lock()");
@@ -109,7 +175,7 @@ namespace IRacingTools::Shared::SHM {
         // success
         break;
       case WAIT_ABANDONED:
-        *metadata_ = {};
+        this->reset();
         break;
       default:
         L->error(
@@ -120,6 +186,9 @@ namespace IRacingTools::Shared::SHM {
         return;
       }
 
+      // ANOTHER WRITER MAY HAVE PUBLISHED SINCE THIS COPY WAS TAKEN, CONTINUE
+      // FROM ITS FRAME NUMBER & FENCE VALUES
+      this->refresh();
       lockState_ = LockState::Locked;
     }
 
@@ -131,7 +200,7 @@ namespace IRacingTools::Shared::SHM {
         // success
         break;
       case WAIT_ABANDONED:
-        *metadata_ = {};
+        this->reset();
         break;
       case WAIT_TIMEOUT:
         // expected in try_lock()
@@ -143,6 +212,7 @@ namespace IRacingTools::Shared::SHM {
         return false;
       }
 
+      this->refresh();
       lockState_ = LockState::Locked;
       return true;
     }
@@ -205,6 +275,34 @@ namespace IRacingTools::Shared::SHM {
   }
 
 
+  std::size_t SHMOverlayFrameConfig::getRenderCacheKey() const {
+    auto key = SHMOverlayRenderCache::Combine(std::hash<uint64_t>{}(overlayIdx), contentVersion);
+    for (auto value : {
+           locationOnTexture.offset_.x_,
+           locationOnTexture.offset_.y_,
+           locationOnTexture.size_.width_,
+           locationOnTexture.size_.height_,
+           std::bit_cast<uint32_t>(vr.opacity.normal)
+         }) {
+      key = SHMOverlayRenderCache::Combine(key, value);
+    }
+
+    return key;
+  }
+
+  bool SHMOverlayFrameConfig::isSameFrame(const SHMOverlayFrameConfig& other) const {
+    return overlayIdx == other.overlayIdx &&
+      contentVersion == other.contentVersion &&
+      locationOnTexture == other.locationOnTexture &&
+      vrEnabled == other.vrEnabled &&
+      vr.layout == other.vr.layout &&
+      vr.enableGazeZoom == other.vr.enableGazeZoom &&
+      vr.zoomScale == other.vr.zoomScale &&
+      vr.gazeTargetScale == other.vr.gazeTargetScale &&
+      vr.opacity == other.vr.opacity &&
+      screen.rect == other.screen.rect;
+  }
+
   class Writer::Impl : public SHM::Impl {
     friend class Writer;
     DWORD processId_ = GetCurrentProcessId();
@@ -223,7 +321,7 @@ namespace IRacingTools::Shared::SHM {
     }
 
     impl_->gpuAdapterId_ = gpuAdapterId;
-    *impl_->metadata_ = FrameMetadata{};
+    impl_->reset();
 
     // L->info("Writer initialized.");
   }
@@ -233,6 +331,7 @@ namespace IRacingTools::Shared::SHM {
 
     // const auto oldId = impl_->metadata_->sessionId;
     *impl_->metadata_ = {};
+    impl_->publish();
     FlushViewOfFile(impl_->mapping_, NULL);
 
 
@@ -254,6 +353,7 @@ namespace IRacingTools::Shared::SHM {
     //   State::Locked>(p);
     impl_->metadata_->frameNumber++;
     impl_->metadata_->overlayFrameCount = 0;
+    impl_->publish();
   }
 
   Writer::NextFrameInfo Writer::beginFrame() noexcept {
@@ -293,6 +393,14 @@ namespace IRacingTools::Shared::SHM {
       overlayFrameConfigs.data(),
       sizeof(SHMOverlayFrameConfig) * overlayFrameConfigs.size()
     );
+    impl_->publish();
+  }
+
+  uint64_t Writer::consumerFrameNumber() const {
+    if (!impl_ || !impl_->layout_)
+      return 0;
+
+    return static_cast<uint64_t>(InterlockedCompareExchange64(&impl_->layout_->consumerFrameNumber, 0, 0));
   }
 
   void Writer::lock() {
@@ -389,6 +497,19 @@ namespace IRacingTools::Shared::SHM {
     return metadata_->frameNumber;
   }
 
+  size_t Snapshot::getOverlayRenderCacheKey(const SHMOverlayFrameConfig& overlayFrameConfig) const {
+    if (!this->hasMetadata()) {
+      return 0;
+    }
+
+    auto key = SHMOverlayRenderCache::Combine(std::hash<uint64_t>{}(metadata_->sessionId), overlayFrameConfig.getRenderCacheKey());
+    for (auto tint : metadata_->config.tint) {
+      key = SHMOverlayRenderCache::Combine(key, std::bit_cast<uint32_t>(tint));
+    }
+
+    return key;
+  }
+
   SHMConfig Snapshot::getConfig() const {
     if (!this->hasMetadata()) {
       return {};
@@ -465,10 +586,10 @@ namespace IRacingTools::Shared::SHM {
 
 
   uint64_t SHMReader::getFrameCountForMetricsOnly() const {
-    if (!(p && p->metadata_)) {
+    if (!(p && p->layout_)) {
       return {};
     }
-    return p->metadata_->frameNumber;
+    return p->layout_->metadata.load().frameNumber;
   }
 
 
@@ -483,7 +604,13 @@ namespace IRacingTools::Shared::SHM {
   }
 
   SHMReader::operator bool() const {
-    return p && p->isValid() & p->metadata_->haveOverlayProducer();
+    if (!(p && p->isValid())) {
+      return false;
+    }
+
+    // EVERY READ STARTS HERE, THE REST OF IT USES THIS COPY
+    p->refresh();
+    return p->metadata_->haveOverlayProducer();
   }
 
   Writer::operator bool() const {
@@ -550,10 +677,24 @@ namespace IRacingTools::Shared::SHM {
       handles = {};
     }
     if (!handles) {
-      handles = std::make_unique<IPCHandles>(p->feederProcessHandle_.get(), *p->metadata_);
+      try {
+        handles = std::make_unique<IPCHandles>(p->feederProcessHandle_.get(), *p->metadata_);
+      } catch (const winrt::hresult_error& err) {
+        // THE FEEDER MAY HAVE EXITED OR CLOSED THE HANDLES SINCE IT PUBLISHED
+        L->warn("Unable to duplicate SHM handles: {:#010x}", static_cast<uint32_t>(err.code().value));
+        return {nullptr};
+      }
     }
 
-    return Snapshot(p->metadata_, copier, handles.get(), dest);
+    Snapshot snapshot(p->metadata_, copier, handles.get(), dest);
+
+    // NO LOCK IS HELD WHILE THE COPY IS QUEUED, SO IF THE WRITER WENT ROUND
+    // THE SWAPCHAIN THE SOURCE TEXTURE MAY ALREADY HOLD ANOTHER FRAME
+    if (p->isCurrentStale()) {
+      return {nullptr};
+    }
+
+    return snapshot;
   }
 
   size_t SHMReader::getRenderCacheKey(ConsumerKind kind) const {
@@ -590,6 +731,8 @@ namespace IRacingTools::Shared::SHM {
       L->debug("maybeGet: updating session");
 
     this->updateSession();
+    if (IsVRConsumer(consumerKind_))
+      InterlockedIncrement64(&p->layout_->consumerFrameNumber);
 
     //ActiveConsumers::Set(consumerKind_);
     if (L->should_log(spdlog::level::debug))
@@ -624,9 +767,6 @@ namespace IRacingTools::Shared::SHM {
       }
     }
 
-    // TraceLoggingWriteTagged(activity, "LockingSHM");
-    std::unique_lock lock(*p);
-    // TraceLoggingWriteTagged(activity, "LockedSHM");
     // VRK_TraceLoggingScopedActivity(
     //   maybeGetActivity, "MaybeGetUncached");
 
@@ -717,7 +857,6 @@ namespace IRacingTools::Shared::SHM {
       return maybeGet();
     }
 
-    std::unique_lock lock(*p);
     auto snapshot = this->maybeGetUncached(consumerKind_);
     if (snapshot.hasMetadata()) {
       cache_.push_front(snapshot);
@@ -0,0 +1,38 @@
+#include <algorithm>
+#include <functional>
+
+#include <IRacingTools/Shared/SHM/SHMOverlayRenderCache.h>
+
+namespace IRacingTools::Shared::SHM {
+
+  std::size_t SHMOverlayRenderCache::Combine(std::size_t seed, std::size_t value) {
+    // SAME MIX AS `boost::hash_combine`
+    return seed ^ (std::hash<std::size_t>{}(value) + static_cast<std::size_t>(0x9e3779b97f4a7c15ull) + (seed << 6) + (seed >> 2));
+  }
+
+  SHMOverlayRenderCache::Diff SHMOverlayRenderCache::diff(std::span<const Entry> entries) const {
+    Diff diff{};
+
+    // MOVED, ADDED OR REMOVED SLOTS LEAVE STALE PIXELS BEHIND
+    diff.full = !rendered_ || rendered_->size() != entries.size() ||
+      !std::equal(entries.begin(), entries.end(), rendered_->begin(), [](auto& entry, auto& rendered) {
+        return entry.slot == rendered.slot;
+      });
+
+    for (std::size_t idx = 0; idx < entries.size(); idx++) {
+      if (diff.full || entries[idx].key != rendered_->at(idx).key)
+        diff.changed.push_back(idx);
+    }
+
+    return diff;
+  }
+
+  void SHMOverlayRenderCache::update(std::span<const Entry> entries) {
+    rendered_.emplace(entries.begin(), entries.end());
+  }
+
+  void SHMOverlayRenderCache::reset() {
+    rendered_.reset();
+  }
+
+} // namespace IRacingTools::Shared::SHM
@@ -0,0 +1,288 @@
+#include <algorithm>
+
+#include <IRacingTools/SDK/DiskClientDataFrameProcessor.h>
+#include <IRacingTools/Shared/Logging/LoggingManager.h>
+#include <IRacingTools/Shared/Services/LapTimingEngine.h>
+
+namespace IRacingTools::Shared::Services {
+  using namespace IRacingTools::Shared::Logging;
+
+  namespace {
+    auto L = GetCategoryWithType<LapTimingEngine>();
+
+    /**
+     * @brief Time at which `pCheck` was crossed, `p1` & `p2` are unwrapped
+     *   (`p2 > p1`, `p2` may exceed `1` when crossing start/finish)
+     */
+    double InterpolateTimeAcrossPoint(double t1, double t2, float p1, float p2, float pCheck) {
+      auto pct = (pCheck - p1) / (p2 - p1);
+      return t1 + (t2 - t1) * pct;
+    }
+  } // namespace
+
+  LapTimingEngine::LapTimingEngine() {
+    reset();
+  }
+
+  LapTimingEngine::LapTimingEngine(const SDK::SessionInfo::SplitTimeInfo& splitTimeInfo) {
+    setSplits(splitTimeInfo);
+  }
+
+  void LapTimingEngine::setSplits(std::span<const float> sectorStartPcts) {
+    splits_.assign(1, 0.0f);
+    for (auto pct : sectorStartPcts) {
+      if (pct > 0.0f && pct < 1.0f) {
+        splits_.push_back(pct);
+      }
+    }
+
+    std::ranges::sort(splits_);
+    auto duplicates = std::ranges::unique(splits_);
+    splits_.erase(duplicates.begin(), duplicates.end());
+
+    reset();
+  }
+
+  void LapTimingEngine::setSplits(const SDK::SessionInfo::SplitTimeInfo& splitTimeInfo) {
+    std::vector<float> pcts{};
+    pcts.reserve(splitTimeInfo.sectors.size());
+    for (auto& sector : splitTimeInfo.sectors) {
+      pcts.push_back(sector.sectorStartPct);
+    }
+
+    setSplits(pcts);
+  }
+
+  void LapTimingEngine::reset() {
+    lastSessionTime_ = -1.0;
+    lapCount_.fill(0);
+    lastLapTime_.fill(-1.0);
+    bestLapTime_.fill(-1.0);
+    for (std::size_t carIdx = 0; carIdx < MaxCars; carIdx++) {
+      resetCar(carIdx);
+    }
+  }
+
+  void LapTimingEngine::resetCar(std::size_t carIdx) {
+    lastPct_[carIdx] = -1.0f;
+    sector_[carIdx] = -1;
+    lapStartTime_[carIdx] = -1.0;
+    sectorStartTime_[carIdx] = -1.0;
+  }
+
+  std::size_t LapTimingEngine::update(double sessionTime, std::span<const float> lapDistPct, std::vector<Event>& events) {
+    // if time moves backwards we're in a new session
+    if (lastSessionTime_ > sessionTime) {
+      reset();
+    }
+
+    auto carCount = std::min(lapDistPct.size(), MaxCars);
+    auto pcts = lapDistPct.data();
+
+    // Sector of every car, branch free so the compiler vectorizes it
+    std::fill_n(currentSector_.begin(), carCount, 0);
+    for (std::size_t split = 1; split < splits_.size(); split++) {
+      auto splitPct = splits_[split];
+      for (std::size_t carIdx = 0; carIdx < carCount; carIdx++) {
+        currentSector_[carIdx] += pcts[carIdx] >= splitPct;
+      }
+    }
+
+    std::size_t eventCount = 0;
+    for (std::size_t carIdx = 0; carIdx < carCount; carIdx++) {
+      auto currentPct = pcts[carIdx];
+      auto currentSector = currentSector_[carIdx];
+      auto advance = currentPct - lastPct_[carIdx];
+      if (currentSector == sector_[carIdx] && advance >= 0.0f && advance <= MaxTickAdvance) {
+        lastPct_[carIdx] = currentPct;
+        continue;
+      }
+
+      // blinked out of the world (towed, in the garage), the laps
+      // & sectors in progress can no longer be timed
+      if (currentPct < 0.0f) {
+        resetCar(carIdx);
+        continue;
+      }
+
+      // first sighting, nothing to interpolate from
+      if (lastPct_[carIdx] < 0.0f || lastSessionTime_ < 0.0) {
+        lastPct_[carIdx] = currentPct;
+        sector_[carIdx] = currentSector;
+        continue;
+      }
+
+      eventCount += processCrossings(carIdx, currentPct, sessionTime, events);
+    }
+
+    lastSessionTime_ = sessionTime;
+    return eventCount;
+  }
+
+  std::size_t LapTimingEngine::processCrossings(
+    std::size_t carIdx,
+    float currentPct,
+    double sessionTime,
+    std::vector<Event>& events
+  ) {
+    auto previousPct = lastPct_[carIdx];
+    // shortest way around the lap, i.e. `0.95 -> 0.05` crossed start/finish
+    auto advance = currentPct - previousPct;
+    if (advance < -0.5f) {
+      advance += 1.0f;
+    } else if (advance >= 0.5f) {
+      advance -= 1.0f;
+    }
+
+    // reversing, keep the furthest position so splits are not crossed twice
+    if (advance <= 0.0f && advance >= -MaxTickAdvance) {
+      return 0;
+    }
+
+    lastPct_[carIdx] = currentPct;
+    sector_[carIdx] = currentSector_[carIdx];
+
+    // teleported (tow, reset), the lap & sector in progress can not be timed
+    if (advance < 0.0f || advance > MaxTickAdvance) {
+      lapStartTime_[carIdx] = -1.0;
+      sectorStartTime_[carIdx] = -1.0;
+      return 0;
+    }
+
+    auto endPct = previousPct + advance;
+    auto splitCount = splits_.size();
+    std::size_t eventCount = 0;
+    for (auto wrap : {0.0f, 1.0f}) {
+      for (std::size_t split = 0; split < splitCount; split++) {
+        auto splitPct = splits_[split] + wrap;
+        if (splitPct <= previousPct || splitPct > endPct) {
+          continue;
+        }
+
+        auto crossingTime = InterpolateTimeAcrossPoint(lastSessionTime_, sessionTime, previousPct, endPct, splitPct);
+        auto completedSector = static_cast<std::int32_t>(split == 0 ? splitCount - 1 : split - 1);
+
+        // single split means the lap is the only sector
+        if (splitCount > 1) {
+          auto& sectorStartTime = sectorStartTime_[carIdx];
+          events.push_back(
+            {
+              .type = EventType::Sector,
+              .carIdx = static_cast<std::int32_t>(carIdx),
+              .lap = lapCount_[carIdx],
+              .sectorNum = completedSector,
+              .sessionTime = crossingTime,
+              .elapsed = sectorStartTime >= 0.0 ? crossingTime - sectorStartTime : -1.0
+            }
+          );
+          eventCount++;
+        }
+
+        sectorStartTime_[carIdx] = crossingTime;
+
+        if (split == 0) {
+          auto& lapStartTime = lapStartTime_[carIdx];
+          auto lapTime = lapStartTime >= 0.0 ? crossingTime - lapStartTime : -1.0;
+          if (lapTime >= 0.0) {
+            lastLapTime_[carIdx] = lapTime;
+            if (bestLapTime_[carIdx] < 0.0 || lapTime < bestLapTime_[carIdx]) {
+              bestLapTime_[carIdx] = lapTime;
+            }
+          }
+
+          events.push_back(
+            {
+              .type = EventType::Lap,
+              .carIdx = static_cast<std::int32_t>(carIdx),
+              .lap = lapCount_[carIdx],
+              .sessionTime = crossingTime,
+              .elapsed = lapTime
+            }
+          );
+          eventCount++;
+
+          lapStartTime = crossingTime;
+          lapCount_[carIdx]++;
+        }
+      }
+    }
+
+    return eventCount;
+  }
+
+  Expected<std::size_t> LapTimingEngine::update(Client& client, std::vector<Event>& events) {
+    auto sessionTime = client.getVarDouble(KnownVarName::SessionTime);
+    auto lapDistPctIdx = client.getVarIdx(KnownVarName::CarIdxLapDistPct);
+    if (!sessionTime || !lapDistPctIdx) {
+      return std::unexpected(GeneralError(ErrorCode::General, "SessionTime or CarIdxLapDistPct unavailable"));
+    }
+
+    std::array<float, MaxCars> lapDistPct{};
+    lapDistPct.fill(-1.0f);
+    auto carCount = client.getVarArray(lapDistPctIdx.value(), std::span{lapDistPct});
+    if (!carCount) {
+      return std::unexpected(GeneralError(ErrorCode::General, "CarIdxLapDistPct could not be read"));
+    }
+
+    return update(sessionTime.value(), std::span<const float>{lapDistPct.data(), carCount.value()}, events);
+  }
+
+  Expected<std::size_t> LapTimingEngine::run(const std::shared_ptr<DiskClient>& client, std::vector<Event>& events) {
+    if (auto sessionInfo = client->getSessionInfo().lock()) {
+      setSplits(sessionInfo->splitTimeInfo);
+    } else {
+      reset();
+    }
+
+    // Resolved once, the var layout is fixed for the whole file
+    auto lapDistPctIdx = client->getVarIdx(KnownVarName::CarIdxLapDistPct);
+    if (!lapDistPctIdx) {
+      return std::unexpected(
+        GeneralError(ErrorCode::General, fmt::format("CarIdxLapDistPct not recorded in {}", client->getClientId()))
+      );
+    }
+
+    std::array<float, MaxCars> lapDistPct{};
+    std::optional<GeneralError> error{};
+    DiskClientDataFrameProcessor<std::vector<Event>> processor(client);
+    auto res = processor.run(
+      [&](const auto& context, auto& result) {
+        auto carCount = client->getVarArray(lapDistPctIdx.value(), std::span{lapDistPct});
+        if (!carCount) {
+          error = GeneralError(ErrorCode::General, "CarIdxLapDistPct could not be read");
+          return false;
+        }
+
+        update(context.sessionTimeSeconds, std::span<const float>{lapDistPct.data(), carCount.value()}, result);
+        return true;
+      },
+      events
+    );
+
+    if (error) {
+      return std::unexpected(error.value());
+    }
+
+    if (res) {
+      L->debug("Processed {} samples, {} events", res.value(), events.size());
+    }
+
+    return res;
+  }
+
+  const std::vector<float>& LapTimingEngine::splits() const {
+    return splits_;
+  }
+
+  double LapTimingEngine::lastLapTime(std::size_t carIdx) const {
+    return carIdx < MaxCars ? lastLapTime_[carIdx] : -1.0;
+  }
+
+  double LapTimingEngine::bestLapTime(std::size_t carIdx) const {
+    return carIdx < MaxCars ? bestLapTime_[carIdx] : -1.0;
+  }
+
+  std::int32_t LapTimingEngine::lapCount(std::size_t carIdx) const {
+    return carIdx < MaxCars ? lapCount_[carIdx] : 0;
+  }
+} // namespace IRacingTools::Shared::Services
@@ -1,11 +1,17 @@
+#include <IRacingTools/Shared/Common/TaskQueue.h>
 #include <IRacingTools/Shared/FileSystemHelpers.h>
+#include <IRacingTools/Shared/Graphics/CoordinateToPixelConverter.h>
+#include <IRacingTools/Shared/Graphics/PolylineSimplification.h>
 #include <IRacingTools/Shared/Logging/LoggingManager.h>
 #include <IRacingTools/Shared/Services/LapTrajectoryTool.h>
 #include <IRacingTools/Shared/Utils/SessionInfoHelpers.h>
 
+#include <algorithm>
+#include <cmath>
 #include <fstream>
 #include <iostream>
 #include <magic_enum.hpp>
+#include <ranges>
 
 
 #include <google/protobuf/util/json_util.h>
@@ -18,10 +24,372 @@ namespace IRacingTools::Shared::Services {
   using namespace IRacingTools::SDK::Utils;
   using namespace spdlog;
 
+  using Geometry::LocalProjection;
+
   namespace {
     auto L = GetCategoryWithType<LapTrajectoryTool>();
+
+    /**
+     * @brief Largest `LapDistPct` gap between two samples that is still
+     *   interpolated, anything wider (dropped frames, pits) is a hole
+     */
+    constexpr float MaxSampleGapPct = 0.02f;
+
+    /**
+     * @brief Floor for the outlier distance, so near identical laps
+     *   (MAD ~ 0) do not reject everything but the median
+     */
+    constexpr double MinOutlierDistanceMeters = 0.25;
+
+    /**
+     * @brief Scales the median absolute deviation to a standard deviation
+     */
+    constexpr double MADToSigma = 1.4826;
+
+    struct LocalPoint {
+      double x{0.0};
+      double y{0.0};
+      double altitude{0.0};
+      double lapDistance{0.0};
+      double lapTime{0.0};
+      bool valid{false};
+    };
+
+    using ResampledLap = std::vector<LocalPoint>;
+
+    /**
+     * @brief Linear interpolation of a lap's samples at each grid `LapDistPct`
+     */
+    ResampledLap ResampleLap(
+      const TelemetryFileHandler::LapDataWithPath &lap,
+      const LocalProjection &projection,
+      std::size_t resolution
+    ) {
+      auto &coords = std::get<4>(lap);
+
+      // Keep strictly increasing `LapDistPct` samples, the first & last frames
+      // of a lap often still belong to the neighbouring lap (`0.99`, `0.0`)
+      std::vector<const TelemetryFileHandler::LapPositionCoordinate *> samples{};
+      samples.reserve(coords.size());
+      for (auto &coord : coords) {
+        auto pct = std::get<2>(coord);
+        if (std::get<4>(coord) == 0.0 || std::get<5>(coord) == 0.0 || pct < 0.0f || pct > 1.0f) {
+          continue;
+        }
+
+        if (samples.empty() ? pct > 0.5f : pct <= std::get<2>(*samples.back())) {
+          continue;
+        }
+
+        samples.push_back(&coord);
+      }
+
+      ResampledLap points(resolution);
+      if (samples.size() < 2) {
+        return points;
+      }
+
+      std::size_t next = 1;
+      for (std::size_t idx = 0; idx < resolution; idx++) {
+        auto pct = static_cast<float>(idx) / static_cast<float>(resolution);
+        while (next < samples.size() && std::get<2>(*samples[next]) < pct) {
+          next++;
+        }
+
+        if (next >= samples.size()) {
+          break;
+        }
+
+        auto &s1 = *samples[next - 1];
+        auto &s2 = *samples[next];
+        auto p1 = std::get<2>(s1);
+        auto p2 = std::get<2>(s2);
+        if (pct < p1 || p2 - p1 > MaxSampleGapPct) {
+          continue;
+        }
+
+        auto t = static_cast<double>((pct - p1) / (p2 - p1));
+        auto [x1, y1] = projection.toLocal(std::get<4>(s1), std::get<5>(s1));
+        auto [x2, y2] = projection.toLocal(std::get<4>(s2), std::get<5>(s2));
+        auto lerp = [t](double v1, double v2) {
+          return v1 + (v2 - v1) * t;
+        };
+
+        points[idx] = LocalPoint{
+          .x = lerp(x1, x2),
+          .y = lerp(y1, y2),
+          .altitude = lerp(std::get<6>(s1), std::get<6>(s2)),
+          .lapDistance = lerp(std::get<3>(s1), std::get<3>(s2)),
+          .lapTime = lerp(std::get<1>(s1), std::get<1>(s2)),
+          .valid = true
+        };
+      }
+
+      return points;
+    }
+
+    double Median(std::vector<double> &values) {
+      auto mid = values.begin() + values.size() / 2;
+      std::nth_element(values.begin(), mid, values.end());
+      if (values.size() % 2) {
+        return *mid;
+      }
+
+      return (*mid + *std::max_element(values.begin(), mid)) / 2.0;
+    }
+
+    /**
+     * @brief Median, then mean of the samples within the MAD based
+     *   outlier distance of it
+     */
+    LocalPoint FusePoint(const std::vector<const LocalPoint *> &samples, double outlierThreshold, std::uint32_t &sampleCount) {
+      std::vector<double> xs{}, ys{};
+      for (auto sample : samples) {
+        xs.push_back(sample->x);
+        ys.push_back(sample->y);
+      }
+
+      auto medianX = Median(xs);
+      auto medianY = Median(ys);
+
+      std::vector<double> distances{};
+      for (auto sample : samples) {
+        distances.push_back(std::hypot(sample->x - medianX, sample->y - medianY));
+      }
+
+      auto deviations = distances;
+      auto maxDistance = std::max(outlierThreshold * MADToSigma * Median(deviations), MinOutlierDistanceMeters);
+
+      LocalPoint fused{.valid = true};
+      sampleCount = 0;
+      for (std::size_t idx = 0; idx < samples.size(); idx++) {
+        if (distances[idx] > maxDistance) {
+          continue;
+        }
+
+        auto &sample = *samples[idx];
+        fused.x += sample.x;
+        fused.y += sample.y;
+        fused.altitude += sample.altitude;
+        fused.lapDistance += sample.lapDistance;
+        fused.lapTime += sample.lapTime;
+        sampleCount++;
+      }
+
+      // the median itself is always within `maxDistance`
+      auto count = static_cast<double>(sampleCount);
+      fused.x /= count;
+      fused.y /= count;
+      fused.altitude /= count;
+      fused.lapDistance /= count;
+      fused.lapTime /= count;
+      return fused;
+    }
   }// namespace
 
+  std::expected<std::vector<LapTrajectoryTool::FusedPoint>, GeneralError> LapTrajectoryTool::FuseLaps(
+    const std::vector<TelemetryFileHandler::LapDataWithPath> &laps,
+    const CreateOptions &options
+  ) {
+    auto resolution = options.resolution;
+    if (laps.empty() || resolution < 3) {
+      return std::unexpected(GeneralError(ErrorCode::General, "at least one lap & a resolution of 3 are required"));
+    }
+
+    // Project everything around the first valid coordinate
+    std::optional<LocalProjection> projection{};
+    for (auto &lap : laps) {
+      for (auto &coord : std::get<4>(lap)) {
+        if (std::get<4>(coord) != 0.0 && std::get<5>(coord) != 0.0) {
+          projection.emplace(std::get<4>(coord), std::get<5>(coord));
+          break;
+        }
+      }
+
+      if (projection)
+        break;
+    }
+
+    if (!projection) {
+      return std::unexpected(GeneralError(ErrorCode::General, "no valid coordinates found"));
+    }
+
+    // RESAMPLE EACH LAP (PARALLEL)
+    auto threadCount = options.threadCount.value_or(
+      std::clamp<std::size_t>(std::thread::hardware_concurrency(), 1, laps.size())
+    );
+
+    std::vector<ResampledLap> resampledLaps{};
+    {
+      using ResampleQueue = Common::TaskQueue<ResampledLap, std::size_t>;
+      ResampleQueue queue(
+        [&](std::size_t lapIdx) {
+          return ResampleLap(laps[lapIdx], projection.value(), resolution);
+        },
+        ResampleQueue::Options{.threadCount = std::max<std::size_t>(threadCount, 1)}
+      );
+
+      std::vector<ResampleQueue::FutureType> futures{};
+      for (std::size_t lapIdx = 0; lapIdx < laps.size(); lapIdx++) {
+        futures.push_back(queue.enqueue(lapIdx));
+      }
+
+      for (auto &future : futures) {
+        resampledLaps.push_back(future.get());
+      }
+    }
+
+    // FUSE PER GRID POINT
+    std::vector<LocalPoint> fused(resolution);
+    std::vector<std::uint32_t> sampleCounts(resolution, 0);
+    std::vector<const LocalPoint *> samples{};
+    for (std::size_t idx = 0; idx < resolution; idx++) {
+      samples.clear();
+      for (auto &resampledLap : resampledLaps) {
+        if (resampledLap[idx].valid) {
+          samples.push_back(&resampledLap[idx]);
+        }
+      }
+
+      if (!samples.empty()) {
+        fused[idx] = FusePoint(samples, options.outlierThreshold, sampleCounts[idx]);
+      }
+    }
+
+    // FILL HOLES (no lap covered the grid point) FROM THE NEAREST
+    // FUSED NEIGHBOURS, AROUND THE LAP
+    std::vector<std::size_t> validIndexes{};
+    for (std::size_t idx = 0; idx < resolution; idx++) {
+      if (fused[idx].valid)
+        validIndexes.push_back(idx);
+    }
+
+    if (validIndexes.size() < 2) {
+      return std::unexpected(GeneralError(ErrorCode::General, "laps do not cover enough of the track"));
+    }
+
+    for (std::size_t validIdx = 0; validIdx < validIndexes.size(); validIdx++) {
+      auto from = validIndexes[validIdx];
+      auto to = validIndexes[(validIdx + 1) % validIndexes.size()];
+      auto gap = (to + resolution - from) % resolution;
+      for (std::size_t step = 1; step < gap; step++) {
+        auto t = static_cast<double>(step) / static_cast<double>(gap);
+        auto &p1 = fused[from];
+        auto &p2 = fused[to];
+        auto lerp = [t](double v1, double v2) {
+          return v1 + (v2 - v1) * t;
+        };
+
+        // lap distance & time restart at start/finish
+        auto wraps = to < from;
+        fused[(from + step) % resolution] = LocalPoint{
+          .x = lerp(p1.x, p2.x),
+          .y = lerp(p1.y, p2.y),
+          .altitude = lerp(p1.altitude, p2.altitude),
+          .lapDistance = wraps ? p1.lapDistance : lerp(p1.lapDistance, p2.lapDistance),
+          .lapTime = wraps ? p1.lapTime : lerp(p1.lapTime, p2.lapTime),
+          .valid = true
+        };
+      }
+    }
+
+    // OUTPUT WITH CUMULATIVE DISTANCE (planar, the great circle formula
+    // loses precision over the few meters between grid points)
+    std::vector<FusedPoint> points{};
+    points.reserve(resolution);
+    for (std::size_t idx = 0; idx < resolution; idx++) {
+      auto &point = fused[idx];
+      auto coord = projection->toCoordinate(point.x, point.y);
+      auto distance = 0.0;
+      if (idx > 0) {
+        auto &previous = fused[idx - 1];
+        distance = points.back().distance + std::hypot(point.x - previous.x, point.y - previous.y);
+      }
+
+      points.push_back(
+        FusedPoint{
+          .lapPercentComplete = static_cast<float>(idx) / static_cast<float>(resolution),
+          .lapTime = point.lapTime,
+          .lapDistance = static_cast<float>(point.lapDistance),
+          .latitude = coord.latitude,
+          .longitude = coord.longitude,
+          .altitude = static_cast<float>(point.altitude),
+          .distance = distance,
+          .sampleCount = sampleCounts[idx]
+        }
+      );
+    }
+
+    return points;
+  }
+
+
+  std::size_t LapTrajectoryTool::CreateLevelsOfDetail(
+    Models::LapTrajectory &trajectory,
+    std::span<const std::uint32_t> sizes,
+    float pixelTolerance
+  ) {
+    trajectory.clear_levels_of_detail();
+
+    auto &path = trajectory.path();
+    if (path.size() < 3 || sizes.empty()) {
+      return 0;
+    }
+
+    // SIMPLIFY IN LOCAL METERS, SO THE TOLERANCE IS THE SAME IN X & Y
+    std::vector<Geometry::Coordinate<>> coords{};
+    coords.reserve(path.size());
+    for (auto &coord : path) {
+      coords.push_back({coord.latitude(), coord.longitude()});
+    }
+
+    std::vector<Geometry::PixelD> points(coords.size());
+    LocalProjection::FromCenter(coords).toLocal(coords, points);
+
+    auto [minX, maxX] = std::ranges::minmax(points | std::views::transform(&Geometry::PixelD::x));
+    auto [minY, maxY] = std::ranges::minmax(points | std::views::transform(&Geometry::PixelD::y));
+    auto extent = std::max(maxX - minX, maxY - minY);
+
+    std::vector<std::uint32_t> sortedSizes(sizes.begin(), sizes.end());
+    std::ranges::sort(sortedSizes, std::greater{});
+
+    for (auto size : sortedSizes) {
+      if (size == 0)
+        continue;
+
+      // Every level is simplified from the full path, so the
+      // error bound does not accumulate across levels
+      auto toleranceMeters = extent * pixelTolerance / static_cast<double>(size);
+      auto indexes = Geometry::SimplifyPolyline(points, toleranceMeters);
+
+      auto lod = trajectory.add_levels_of_detail();
+      lod->set_max_size(size);
+      lod->set_pixel_tolerance(pixelTolerance);
+      lod->set_tolerance_meters(static_cast<float>(toleranceMeters));
+      lod->mutable_path()->Reserve(static_cast<int>(indexes.size()));
+      for (auto idx : indexes) {
+        lod->add_path()->CopyFrom(path[static_cast<int>(idx)]);
+      }
+
+      L->debug("Level of detail {}px: {} of {} points", size, indexes.size(), path.size());
+    }
+
+    return trajectory.levels_of_detail_size();
+  }
+
+  const google::protobuf::RepeatedPtrField<Models::LapCoordinate> &LapTrajectoryTool::SelectPath(
+    const Models::LapTrajectory &trajectory,
+    std::uint32_t size
+  ) {
+    const Models::LapTrajectory::LevelOfDetail *selected = nullptr;
+    for (auto &lod : trajectory.levels_of_detail()) {
+      if (lod.max_size() >= size && (!selected || lod.max_size() < selected->max_size())) {
+        selected = &lod;
+      }
+    }
+
+    return selected ? selected->path() : trajectory.path();
+  }
 
   std::expected<std::shared_ptr<Models::LapTrajectory>, GeneralError>
   LapTrajectoryTool::createLapTrajectory(const std::filesystem::path &file, const CreateOptions& options) {
@@ -32,27 +400,29 @@ namespace IRacingTools::Shared::Services {
   std::expected<std::shared_ptr<Models::LapTrajectory>, GeneralError>
   LapTrajectoryTool::createLapTrajectory(const std::shared_ptr<SDK::DiskClient> &client, const CreateOptions& options) {
     TelemetryFileHandler telemFile(client);
-    auto lapsRes = telemFile.getLapData();
+    auto lapsRes = telemFile.getLapData(options.includeInvalidLaps);
     if (!lapsRes) {
       return std::unexpected(lapsRes.error());
     }
 
-    auto& laps = lapsRes.value();
-    
     auto sessionInfo = client->getSessionInfo().lock();
     if (!sessionInfo) {
       return std::unexpected(GeneralError(ErrorCode::General, "session info from weak ptr was not available"));
     }
 
-    std::string trackLayoutId;
-    {
-      auto res = Shared::Utils::GetSessionInfoTrackLayoutId(sessionInfo);
-      if (!res) {
-        return std::unexpected(GeneralError(ErrorCode::General, "session info could not determine trackLayoutId"));
-      }
-
-      trackLayoutId = res.value();
+    Models::TrackLayoutMetadata trackLayoutMetadata{};
+    if (!Shared::Utils::GetSessionInfoTrackLayoutMetadata(&trackLayoutMetadata, sessionInfo.get())) {
+      return std::unexpected(GeneralError(ErrorCode::General, "session info could not determine trackLayoutId"));
     }
+
+    return CreateLapTrajectory(lapsRes.value(), trackLayoutMetadata, options);
+  }
+
+  std::expected<std::shared_ptr<Models::LapTrajectory>, GeneralError> LapTrajectoryTool::CreateLapTrajectory(
+    const std::vector<TelemetryFileHandler::LapDataWithPath> &laps,
+    const Models::TrackLayoutMetadata &trackLayoutMetadata,
+    const CreateOptions& options
+  ) {
     // FIND BEST LAP TIME
     // TODO: Add optional predicate command to allow
     //  User specified optimization/selection
@@ -70,15 +440,7 @@ namespace IRacingTools::Shared::Services {
     {
       auto timestamp = TimeEpoch<std::chrono::milliseconds>().count();
       trajectory->set_timestamp(timestamp);
-      
-      auto& winfo = sessionInfo->weekendInfo;
-      auto trackLayoutMetadata = trajectory->mutable_track_layout_metadata();
-      auto trackMetadata = trackLayoutMetadata->mutable_track_metadata();
-      trackMetadata->set_id(winfo.trackID);
-      trackMetadata->set_name(winfo.trackName);
-
-      trackLayoutMetadata->set_name(winfo.trackConfigName);
-      trackLayoutMetadata->set_id(trackLayoutId);
+      trajectory->mutable_track_layout_metadata()->CopyFrom(trackLayoutMetadata);
     }
 
     auto lapMeta = trajectory->mutable_metadata();
@@ -89,26 +451,64 @@ namespace IRacingTools::Shared::Services {
     lapMeta->set_lap_time(std::floor(std::get<2>(bestLap) * 1000.0));
     lapMeta->set_valid(std::get<3>(bestLap) == 0);
 
-    // Get the coords from the lap data tuple
-    auto& coords = std::get<4>(bestLap);    
-    for (auto& coord : coords) {
-      auto lat = std::get<4>(coord);
-      auto lon = std::get<5>(coord);
-      if (lat == 0.0 || lon == 0.0)
-        continue;
-      
-      auto point = trajectory->add_path();
-      point->set_lap_time(std::floor<int32_t>(std::get<1>(coord) * 1000.0));
-      point->set_lap_percent_complete(std::get<2>(coord));
-      point->set_lap_distance(std::get<3>(coord));
-      point->set_latitude(std::get<4>(coord));
-      point->set_longitude(std::get<5>(coord));
-      point->set_altitude(std::get<6>(coord));
+    if (options.fuseLaps) {
+      auto fusedRes = FuseLaps(laps, options);
+      if (!fusedRes) {
+        return std::unexpected(fusedRes.error());
+      }
+
+      for (auto& fusedPoint : fusedRes.value()) {
+        auto point = trajectory->add_path();
+        point->set_lap_time(std::floor<int32_t>(fusedPoint.lapTime * 1000.0));
+        point->set_lap_percent_complete(fusedPoint.lapPercentComplete);
+        point->set_lap_distance(fusedPoint.lapDistance);
+        point->set_latitude(fusedPoint.latitude);
+        point->set_longitude(fusedPoint.longitude);
+        point->set_altitude(fusedPoint.altitude);
+        point->set_lap_distance_calculated(static_cast<float>(fusedPoint.distance));
+      }
+
+      L->info("Fused {} laps into {} path points", laps.size(), trajectory->path_size());
+    } else {
+      // Get the coords from the lap data tuple
+      auto& coords = std::get<4>(bestLap);
+      for (auto& coord : coords) {
+        auto lat = std::get<4>(coord);
+        auto lon = std::get<5>(coord);
+        if (lat == 0.0 || lon == 0.0)
+          continue;
+
+        auto point = trajectory->add_path();
+        point->set_lap_time(std::floor<int32_t>(std::get<1>(coord) * 1000.0));
+        point->set_lap_percent_complete(std::get<2>(coord));
+        point->set_lap_distance(std::get<3>(coord));
+        point->set_latitude(std::get<4>(coord));
+        point->set_longitude(std::get<5>(coord));
+        point->set_altitude(std::get<6>(coord));
+      }
     }
 
     if (trajectory->path_size() == 0)
       return std::unexpected(GeneralError(ErrorCode::General, "no valid path points found"));
 
+    if (auto lodCount = CreateLevelsOfDetail(*trajectory, options.lodSizes, options.lodPixelTolerance)) {
+      L->info(
+        "Created {} levels of detail, {} -> {} points",
+        lodCount,
+        trajectory->path_size(),
+        trajectory->levels_of_detail(static_cast<int>(lodCount) - 1).path_size()
+      );
+    }
+
+    if (options.lutBinCount) {
+      auto lutRes = TrackPositionLUT::Create(*trajectory, options.lutBinCount);
+      if (!lutRes) {
+        return std::unexpected(lutRes.error());
+      }
+
+      lutRes->toModel(trajectory->mutable_position_lookup_table());
+    }
+
     if (options.outputDir) {
       // TODO: Specify output directory in TelemetryDataService
       // auto& outputFile = options.outputFile.value();
@@ -0,0 +1,497 @@
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <fstream>
+#include <set>
+
+#include <fmt/format.h>
+
+#include <IRacingTools/Shared/Chrono.h>
+#include <IRacingTools/Shared/Common/TaskQueue.h>
+#include <IRacingTools/Shared/Logging/LoggingManager.h>
+#include <IRacingTools/Shared/Services/Pipelines/PipelineGraph.h>
+
+namespace IRacingTools::Shared::Services::Pipelines {
+  using namespace IRacingTools::SDK;
+  using namespace IRacingTools::Shared::Logging;
+
+  namespace {
+    auto L = GetCategoryWithType<PipelineGraph>();
+
+    constexpr std::string_view CheckpointExtension = ".ckpt";
+    constexpr std::string_view AttemptFilename = "attempt.pb";
+
+    /**
+     * @brief The raw item key, checkpoint dirs are named by its hash
+     */
+    constexpr std::string_view ItemKeyFilename = "item.key";
+
+    /**
+     * @brief FNV-1a, stable across runs & platforms unlike `std::hash`
+     */
+    std::uint64_t Fingerprint(std::uint64_t seed, std::string_view value) {
+      auto hash = seed ^ 0xcbf29ce484222325ULL;
+      for (auto c : value) {
+        hash ^= static_cast<std::uint8_t>(c);
+        hash *= 0x100000001b3ULL;
+      }
+
+      // SEPARATOR, SO ("ab","c") != ("a","bc")
+      hash ^= 0xff;
+      hash *= 0x100000001b3ULL;
+      return hash;
+    }
+
+    /**
+     * @brief Write to a temp file & swap, so a crash never leaves a partial file
+     */
+    bool WriteFileAtomic(const fs::path &file, std::uint64_t fingerprint, const std::string &bytes) {
+      auto tempFile = fs::path(file).concat(".tmp");
+      {
+        std::ofstream output(tempFile, std::ios::binary | std::ios::trunc);
+        output.write(reinterpret_cast<const char *>(&fingerprint), sizeof(fingerprint));
+        output.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        if (!output.good())
+          return false;
+      }
+
+      std::error_code errorCode{};
+      fs::rename(tempFile, file, errorCode);
+      return !errorCode;
+    }
+
+    std::optional<std::string> ReadFile(const fs::path &file, std::uint64_t fingerprint) {
+      std::ifstream input(file, std::ios::binary);
+      std::uint64_t fileFingerprint{0};
+      if (!input.read(reinterpret_cast<char *>(&fileFingerprint), sizeof(fileFingerprint)) ||
+          fileFingerprint != fingerprint) {
+        return std::nullopt;
+      }
+
+      return std::string(std::istreambuf_iterator<char>(input), {});
+    }
+  } // namespace
+
+  /**
+   * @brief Per run state shared by all items
+   */
+  struct PipelineGraph::RunState {
+    using StageQueue = Common::TaskQueue<void, std::shared_ptr<ItemRun>>;
+
+    std::vector<std::vector<std::size_t>> dependents{};
+    std::vector<std::size_t> upstreamCounts{};
+    std::vector<std::unique_ptr<StageQueue>> queues{};
+
+    std::mutex mutex{};
+    std::condition_variable cv{};
+    std::size_t remainingItems{0};
+  };
+
+  struct PipelineGraph::ItemRun {
+    std::shared_ptr<Item> item;
+    RunState *state;
+
+    std::vector<std::uint64_t> fingerprints{};
+    std::unique_ptr<std::atomic_size_t[]> remainingUpstream{};
+    std::atomic_size_t remainingStages{0};
+    std::atomic_bool failed{false};
+
+    std::mutex errorMutex{};
+  };
+
+  void PipelineGraph::Item::toModel(Pipeline::Attempt *attempt) const {
+    attempt->set_status(status);
+    attempt->clear_stages();
+    for (auto &result : stages) {
+      auto stage = attempt->add_stages();
+      stage->set_name(result.name);
+      stage->set_status(result.status);
+      stage->set_started_at(result.startedAt);
+      stage->set_duration_micros(result.duration.count());
+      stage->set_attempt_count(static_cast<std::int32_t>(result.attemptCount));
+      stage->set_from_checkpoint(result.fromCheckpoint);
+    }
+
+    if (error) {
+      auto log = attempt->add_logs();
+      log->set_level(PipelineLog::ERR);
+      log->set_message(error->what());
+    }
+  }
+
+  PipelineGraph::PipelineGraph(const Options &options) : options_(options) {
+  }
+
+  std::optional<GeneralError> PipelineGraph::addStage(Stage stage) {
+    for (auto &existing : stages_) {
+      if (existing.name == stage.name) {
+        return GeneralError(ErrorCode::General, fmt::format("Stage ({}) already exists", stage.name));
+      }
+
+      for (auto &output : stage.outputs) {
+        if (std::ranges::find(existing.outputs, output) != existing.outputs.end()) {
+          return GeneralError(
+            ErrorCode::General,
+            fmt::format("Artifact ({}) of stage ({}) is already produced by ({})", output, stage.name, existing.name)
+          );
+        }
+      }
+    }
+
+    if (!stage.fn) {
+      return GeneralError(ErrorCode::General, fmt::format("Stage ({}) has no function", stage.name));
+    }
+
+    stages_.push_back(std::move(stage));
+    return std::nullopt;
+  }
+
+  void PipelineGraph::setCodec(const std::string &artifact, ArtifactCodec codec) {
+    codecs_[artifact] = std::move(codec);
+  }
+
+  const std::vector<PipelineGraph::Stage> &PipelineGraph::stages() const {
+    return stages_;
+  }
+
+  std::expected<std::vector<std::size_t>, GeneralError> PipelineGraph::stageOrder() const {
+    std::map<std::string, std::size_t> producers{};
+    for (std::size_t idx = 0; idx < stages_.size(); idx++) {
+      for (auto &output : stages_[idx].outputs) {
+        producers[output] = idx;
+      }
+    }
+
+    // KAHN'S ALGORITHM, INPUTS WITHOUT A PRODUCER ARE ITEM SOURCES
+    std::vector<std::set<std::size_t>> upstream(stages_.size());
+    for (std::size_t idx = 0; idx < stages_.size(); idx++) {
+      for (auto &input : stages_[idx].inputs) {
+        if (auto it = producers.find(input); it != producers.end()) {
+          upstream[idx].insert(it->second);
+        }
+      }
+    }
+
+    std::vector<std::size_t> order{};
+    std::vector<bool> visited(stages_.size(), false);
+    while (order.size() < stages_.size()) {
+      auto before = order.size();
+      for (std::size_t idx = 0; idx < stages_.size(); idx++) {
+        if (visited[idx])
+          continue;
+
+        if (std::ranges::all_of(upstream[idx], [&](auto upstreamIdx) { return visited[upstreamIdx]; })) {
+          visited[idx] = true;
+          order.push_back(idx);
+        }
+      }
+
+      if (order.size() == before) {
+        return std::unexpected(GeneralError(ErrorCode::General, "Pipeline stages contain a cycle"));
+      }
+    }
+
+    return order;
+  }
+
+  std::optional<GeneralError> PipelineGraph::run(const std::shared_ptr<Item> &item) {
+    return run(std::vector{item});
+  }
+
+  std::optional<GeneralError> PipelineGraph::run(const std::vector<std::shared_ptr<Item>> &items) {
+    auto orderRes = stageOrder();
+    if (!orderRes) {
+      return orderRes.error();
+    }
+
+    auto &order = orderRes.value();
+    auto stageCount = stages_.size();
+
+    std::map<std::string, std::size_t> producers{};
+    for (std::size_t idx = 0; idx < stageCount; idx++) {
+      for (auto &output : stages_[idx].outputs) {
+        producers[output] = idx;
+      }
+    }
+
+    RunState state{};
+    state.dependents.resize(stageCount);
+    state.upstreamCounts.resize(stageCount, 0);
+    std::vector<std::set<std::size_t>> upstream(stageCount);
+    for (std::size_t idx = 0; idx < stageCount; idx++) {
+      for (auto &input : stages_[idx].inputs) {
+        if (auto it = producers.find(input); it != producers.end() && upstream[idx].insert(it->second).second) {
+          state.dependents[it->second].push_back(idx);
+        }
+      }
+
+      state.upstreamCounts[idx] = upstream[idx].size();
+    }
+
+    // PREPARE EACH ITEM, FINGERPRINTS CHAIN THROUGH THE UPSTREAM STAGES
+    std::vector<std::shared_ptr<ItemRun>> itemRuns{};
+    for (auto &item : items) {
+      auto itemRun = std::make_shared<ItemRun>();
+      itemRun->item = item;
+      itemRun->state = &state;
+      itemRun->fingerprints.resize(stageCount, 0);
+      itemRun->remainingUpstream = std::make_unique<std::atomic_size_t[]>(stageCount);
+      itemRun->remainingStages = stageCount;
+      for (auto idx : order) {
+        auto &stage = stages_[idx];
+        auto fingerprint = Fingerprint(Fingerprint(0, item->key), stage.name);
+        fingerprint = Fingerprint(fingerprint, std::to_string(stage.version));
+        fingerprint = Fingerprint(fingerprint, stage.params);
+        for (auto upstreamIdx : upstream[idx]) {
+          fingerprint = Fingerprint(fingerprint, std::to_string(itemRun->fingerprints[upstreamIdx]));
+        }
+
+        itemRun->fingerprints[idx] = fingerprint;
+        itemRun->remainingUpstream[idx] = state.upstreamCounts[idx];
+      }
+
+      item->status = PIPELINE_STATUS_PROCESSING;
+      item->error = std::nullopt;
+      item->stages.assign(stageCount, StageResult{});
+      for (std::size_t idx = 0; idx < stageCount; idx++) {
+        item->stages[idx].name = stages_[idx].name;
+      }
+
+      itemRuns.push_back(itemRun);
+    }
+
+    if (itemRuns.empty() || stageCount == 0) {
+      for (auto &item : items) {
+        item->status = PIPELINE_STATUS_COMPLETE;
+      }
+
+      return std::nullopt;
+    }
+
+    state.remainingItems = itemRuns.size();
+
+    // ONE QUEUE PER STAGE, BOUNDED SO A FAST STAGE CAN NOT RUN AWAY FROM A
+    // SLOW ONE DOWNSTREAM
+    for (std::size_t idx = 0; idx < stageCount; idx++) {
+      state.queues.push_back(std::make_unique<RunState::StageQueue>(
+        [this, idx](std::shared_ptr<ItemRun> itemRun) {
+          runStage(idx, itemRun);
+        },
+        RunState::StageQueue::Options{
+          .threadCount = std::max<std::size_t>(stages_[idx].threadCount, 1),
+          .capacity = options_.queueCapacity}
+      ));
+    }
+
+    for (auto &itemRun : itemRuns) {
+      for (std::size_t idx = 0; idx < stageCount; idx++) {
+        if (state.upstreamCounts[idx] == 0) {
+          state.queues[idx]->enqueue(itemRun);
+        }
+      }
+    }
+
+    {
+      std::unique_lock lock(state.mutex);
+      state.cv.wait(lock, [&] { return state.remainingItems == 0; });
+    }
+
+    for (auto &queue : state.queues) {
+      queue->destroy();
+    }
+
+    return std::nullopt;
+  }
+
+  void PipelineGraph::runStage(std::size_t stageIdx, const std::shared_ptr<ItemRun> &itemRun) {
+    auto &stage = stages_[stageIdx];
+    auto &item = *itemRun->item;
+    auto &result = item.stages[stageIdx];
+    auto fingerprint = itemRun->fingerprints[stageIdx];
+
+    auto startedAt = std::chrono::steady_clock::now();
+    result.startedAt = TimeEpoch<std::chrono::milliseconds, std::chrono::system_clock>().count();
+
+    if (itemRun->failed) {
+      result.status = PIPELINE_STATUS_SKIPPED;
+    } else if (restoreCheckpoint(stage, *itemRun, fingerprint)) {
+      result.status = PIPELINE_STATUS_COMPLETE;
+      result.fromCheckpoint = true;
+    } else {
+      std::optional<GeneralError> error{std::nullopt};
+      auto maxAttempts = std::max<std::size_t>(stage.maxAttempts, 1);
+      for (std::size_t attempt = 0; attempt < maxAttempts; attempt++) {
+        result.attemptCount++;
+        try {
+          error = stage.fn(item.artifacts);
+        } catch (const std::exception &err) {
+          error = GeneralError(ErrorCode::General, err.what());
+        }
+
+        if (!error)
+          break;
+
+        L->warn("Stage ({}) attempt {}/{} failed for ({}): {}", stage.name, attempt + 1, maxAttempts, item.key, error->what());
+      }
+
+      if (error) {
+        result.status = PIPELINE_STATUS_ERROR;
+        std::scoped_lock lock(itemRun->errorMutex);
+        if (!itemRun->failed.exchange(true)) {
+          item.error = GeneralError(ErrorCode::General, fmt::format("Stage ({}) failed: {}", stage.name, error->what()));
+        }
+      } else {
+        result.status = PIPELINE_STATUS_COMPLETE;
+        saveCheckpoint(stage, *itemRun, fingerprint);
+      }
+    }
+
+    result.duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startedAt);
+
+    // DOWNSTREAM STAGES WHOSE INPUTS ARE NOW ALL AVAILABLE, SKIPPED STAGES
+    // STILL PROPAGATE SO EVERY STAGE OF THE ITEM IS ACCOUNTED FOR
+    auto state = itemRun->state;
+    for (auto dependentIdx : state->dependents[stageIdx]) {
+      if (--itemRun->remainingUpstream[dependentIdx] == 0) {
+        state->queues[dependentIdx]->enqueue(itemRun);
+      }
+    }
+
+    if (--itemRun->remainingStages == 0) {
+      finishItem(*itemRun);
+    }
+  }
+
+  bool PipelineGraph::restoreCheckpoint(const Stage &stage, ItemRun &itemRun, std::uint64_t fingerprint) {
+    auto dir = checkpointPath(itemRun.item->key);
+    if (!dir || stage.outputs.empty()) {
+      return false;
+    }
+
+    std::vector<std::pair<std::string, std::any>> restored{};
+    for (auto &output : stage.outputs) {
+      auto codecIt = codecs_.find(output);
+      if (codecIt == codecs_.end()) {
+        return false;
+      }
+
+      auto bytes = ReadFile(dir.value() / (output + std::string(CheckpointExtension)), fingerprint);
+      if (!bytes) {
+        return false;
+      }
+
+      auto value = codecIt->second.decode(bytes.value());
+      if (!value) {
+        L->warn("Invalid checkpoint ({}) for ({}), recomputing", output, itemRun.item->key);
+        return false;
+      }
+
+      restored.emplace_back(output, std::move(value.value()));
+    }
+
+    for (auto &[name, value] : restored) {
+      itemRun.item->artifacts.setAny(name, std::move(value));
+    }
+
+    L->debug("Restored stage ({}) for ({}) from checkpoint", stage.name, itemRun.item->key);
+    return true;
+  }
+
+  void PipelineGraph::saveCheckpoint(const Stage &stage, ItemRun &itemRun, std::uint64_t fingerprint) {
+    auto dir = createCheckpointPath(itemRun.item->key);
+    if (!dir) {
+      return;
+    }
+
+    for (auto &output : stage.outputs) {
+      auto codecIt = codecs_.find(output);
+      auto value = itemRun.item->artifacts.getAny(output);
+      if (codecIt == codecs_.end() || !value) {
+        continue;
+      }
+
+      auto file = dir.value() / (output + std::string(CheckpointExtension));
+      if (!WriteFileAtomic(file, fingerprint, codecIt->second.encode(value.value()))) {
+        L->warn("Unable to write checkpoint: {}", file.string());
+      }
+    }
+  }
+
+  void PipelineGraph::finishItem(ItemRun &itemRun) {
+    auto &item = *itemRun.item;
+    item.status = itemRun.failed ? PIPELINE_STATUS_ERROR : PIPELINE_STATUS_COMPLETE;
+
+    // PERSIST THE ATTEMPT, SO PROGRESS IS NOT ONLY KEPT IN MEMORY
+    if (auto dir = createCheckpointPath(item.key)) {
+      Pipeline::Attempt attempt{};
+      item.toModel(&attempt);
+      WriteFileAtomic(dir.value() / AttemptFilename, 0, attempt.SerializeAsString());
+    }
+
+    auto state = itemRun.state;
+    {
+      std::scoped_lock lock(state->mutex);
+      state->remainingItems--;
+    }
+
+    state->cv.notify_all();
+  }
+
+  std::optional<fs::path> PipelineGraph::checkpointPath(const std::string &itemKey) const {
+    if (!options_.checkpointDir) {
+      return std::nullopt;
+    }
+
+    return options_.checkpointDir.value() / fmt::format("{:016x}", Fingerprint(0, itemKey));
+  }
+
+  std::optional<fs::path> PipelineGraph::createCheckpointPath(const std::string &itemKey) const {
+    auto dir = checkpointPath(itemKey);
+    if (!dir) {
+      return std::nullopt;
+    }
+
+    std::error_code errorCode{};
+    fs::create_directories(dir.value(), errorCode);
+
+    auto keyFile = dir.value() / ItemKeyFilename;
+    if (!fs::exists(keyFile, errorCode) && !WriteFileAtomic(keyFile, 0, itemKey)) {
+      L->warn("Unable to write checkpoint key: {}", keyFile.string());
+    }
+
+    return dir;
+  }
+
+  void PipelineGraph::clearCheckpoints(const std::string &itemKey) {
+    if (auto dir = checkpointPath(itemKey)) {
+      std::error_code errorCode{};
+      fs::remove_all(dir.value(), errorCode);
+    }
+  }
+
+  std::size_t PipelineGraph::pruneCheckpoints(const std::function<bool(const std::string &itemKey)> &isStale) {
+    std::error_code errorCode{};
+    if (!options_.checkpointDir || !fs::is_directory(options_.checkpointDir.value(), errorCode)) {
+      return 0;
+    }
+
+    std::vector<fs::path> staleDirs{};
+    for (auto &entry : fs::directory_iterator(options_.checkpointDir.value(), errorCode)) {
+      if (!entry.is_directory(errorCode))
+        continue;
+
+      auto itemKey = ReadFile(entry.path() / ItemKeyFilename, 0);
+      if (!itemKey || isStale(itemKey.value())) {
+        staleDirs.push_back(entry.path());
+      }
+    }
+
+    for (auto &dir : staleDirs) {
+      L->debug("Removing stale checkpoints: {}", dir.string());
+      fs::remove_all(dir, errorCode);
+    }
+
+    return staleDirs.size();
+  }
+
+} // namespace IRacingTools::Shared::Services::Pipelines
@@ -1,4 +1,7 @@
+#include <cstring>
+
 #include <IRacingTools/SDK/Utils/SDKMacros.h>
+#include <IRacingTools/Shared/FileSystemHelpers.h>
 #include <IRacingTools/Shared/Services/LapTrajectoryTool.h>
 #include <IRacingTools/Shared/Services/Pipelines/PipelineExecutorRegistry.h>
 #include <IRacingTools/Shared/Services/Pipelines/TrackMapPipelineExecutor.h>
@@ -8,9 +11,244 @@
 namespace IRacingTools::Shared::Services::Pipelines {
   namespace {
     auto L = Logging::GetCategoryWithType<TrackMapPipelineExecutor>();
+
+    using LapDataList = std::vector<TelemetryFileHandler::LapDataWithPath>;
+
+    template<typename T>
+    void AppendValue(std::string &bytes, const T &value) {
+      bytes.append(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+
+    template<typename T>
+    bool ReadValue(std::string_view &bytes, T &value) {
+      if (bytes.size() < sizeof(T))
+        return false;
+
+      std::memcpy(&value, bytes.data(), sizeof(T));
+      bytes.remove_prefix(sizeof(T));
+      return true;
+    }
+
+    /**
+     * @brief Raw dump of the lap columns, far cheaper to read back than
+     *   re-processing every IBT data frame
+     */
+    ArtifactCodec LapsCodec() {
+      return ArtifactCodec{
+          .encode = [](const std::any &value) {
+            auto &laps = *std::any_cast<const std::shared_ptr<LapDataList> &>(value);
+            std::string bytes{};
+            AppendValue(bytes, static_cast<std::uint64_t>(laps.size()));
+            for (auto &[sessionTime, lap, lapTime, incidentCount, coords] : laps) {
+              AppendValue(bytes, sessionTime);
+              AppendValue(bytes, lap);
+              AppendValue(bytes, lapTime);
+              AppendValue(bytes, incidentCount);
+              AppendValue(bytes, static_cast<std::uint64_t>(coords.size()));
+              for (auto &coord : coords) {
+                std::apply(
+                    [&](auto &...fields) { (AppendValue(bytes, fields), ...); },
+                    static_cast<const TelemetryFileHandler::LapPositionCoordinateTuple &>(coord));
+              }
+            }
+
+            return bytes;
+          },
+          .decode = [](const std::string &data) -> std::optional<std::any> {
+            std::string_view bytes{data};
+            std::uint64_t lapCount{0};
+            if (!ReadValue(bytes, lapCount))
+              return std::nullopt;
+
+            auto laps = std::make_shared<LapDataList>();
+            for (std::uint64_t lapIdx = 0; lapIdx < lapCount; lapIdx++) {
+              TelemetryFileHandler::LapDataWithPath lapData{};
+              auto &[sessionTime, lap, lapTime, incidentCount, coords] = lapData;
+              std::uint64_t coordCount{0};
+              if (!ReadValue(bytes, sessionTime) || !ReadValue(bytes, lap) || !ReadValue(bytes, lapTime) ||
+                  !ReadValue(bytes, incidentCount) || !ReadValue(bytes, coordCount)) {
+                return std::nullopt;
+              }
+
+              coords.reserve(std::min<std::uint64_t>(coordCount, bytes.size()));
+              for (std::uint64_t coordIdx = 0; coordIdx < coordCount; coordIdx++) {
+                TelemetryFileHandler::LapPositionCoordinateTuple fields{};
+                auto valid = std::apply([&](auto &...values) { return (ReadValue(bytes, values) && ...); }, fields);
+                if (!valid)
+                  return std::nullopt;
+
+                coords.emplace_back(fields);
+              }
+
+              laps->push_back(std::move(lapData));
+            }
+
+            if (!bytes.empty())
+              return std::nullopt;
+
+            return std::make_any<std::shared_ptr<LapDataList>>(laps);
+          }};
+    }
+
+    std::shared_ptr<SDK::DiskClient> OpenDiskClient(const fs::path &file) {
+      return std::make_shared<SDK::DiskClient>(file, file.string());
+    }
+
+    /**
+     * @brief `true` unless the `path|size|modified` item key still matches
+     *   the file on disk
+     */
+    bool IsStaleItemKey(const std::string &itemKey) {
+      auto modifiedSep = itemKey.rfind('|');
+      auto sizeSep = modifiedSep == std::string::npos || modifiedSep == 0
+        ? std::string::npos
+        : itemKey.rfind('|', modifiedSep - 1);
+      if (sizeSep == std::string::npos)
+        return true;
+
+      fs::path file{itemKey.substr(0, sizeSep)};
+      std::error_code errorCode{};
+      auto size = fs::file_size(file, errorCode);
+      auto modifiedAt = fs::last_write_time(file, errorCode);
+      if (errorCode)
+        return true;
+
+      return itemKey.substr(sizeSep + 1) != fmt::format("{}|{}", size, modifiedAt.time_since_epoch().count());
+    }
+  } // namespace
+
+  TrackMapPipelineExecutor::TrackMapPipelineExecutor()
+      : TrackMapPipelineExecutor(PipelineGraph::Options{.checkpointDir = GetAppDataPath() / PipelineCheckpointsPath}) {
   }
 
-  TrackMapPipelineExecutor::TrackMapPipelineExecutor() : PipelineExecutor(PIPELINE_TYPE_TRACK_MAP) {
+  TrackMapPipelineExecutor::TrackMapPipelineExecutor(
+    const PipelineGraph::Options &options,
+    const LapTrajectoryTool::CreateOptions &createOptions
+  )
+      : PipelineExecutor(PIPELINE_TYPE_TRACK_MAP), graph_(options) {
+    std::vector<PipelineGraph::Stage> stages{
+        {.name = "header",
+         .inputs = {FileArtifact},
+         .outputs = {HeaderArtifact},
+         .fn = [](PipelineArtifacts &artifacts) -> std::optional<GeneralError> {
+           auto &file = *artifacts.get<fs::path>(FileArtifact);
+           auto client = OpenDiskClient(file);
+           auto clientDisposer = gsl::finally([&] { client->close(); });
+           if (client->hasNext())
+             client->next();
+
+           auto res = Utils::GetSessionInfoTrackLayoutMetadata(client->getSessionInfo().lock());
+           if (!res) {
+             return res.error();
+           }
+
+           artifacts.set(HeaderArtifact, res.value());
+           return std::nullopt;
+         }},
+        {.name = "laps",
+         .inputs = {FileArtifact},
+         .outputs = {LapsArtifact},
+         .fn = [includeInvalidLaps = createOptions.includeInvalidLaps](PipelineArtifacts &artifacts) -> std::optional<GeneralError> {
+           auto &file = *artifacts.get<fs::path>(FileArtifact);
+           auto client = OpenDiskClient(file);
+           auto clientDisposer = gsl::finally([&] { client->close(); });
+
+           TelemetryFileHandler handler(client);
+           auto res = handler.getLapData(includeInvalidLaps);
+           if (!res) {
+             return res.error();
+           }
+
+           artifacts.set(LapsArtifact, std::make_shared<LapDataList>(std::move(res.value())));
+           return std::nullopt;
+         },
+         .params = fmt::format("includeInvalidLaps={}", createOptions.includeInvalidLaps)},
+        {.name = "trajectory",
+         .inputs = {HeaderArtifact, LapsArtifact},
+         .outputs = {TrajectoryArtifact},
+         .fn = [createOptions](PipelineArtifacts &artifacts) -> std::optional<GeneralError> {
+           auto header = artifacts.get<std::shared_ptr<TrackLayoutMetadata>>(HeaderArtifact);
+           auto laps = artifacts.get<std::shared_ptr<LapDataList>>(LapsArtifact);
+           auto res = LapTrajectoryTool::CreateLapTrajectory(**laps, **header, createOptions);
+           if (!res) {
+             return res.error();
+           }
+
+           artifacts.set(TrajectoryArtifact, res.value());
+           return std::nullopt;
+         }}};
+
+    for (auto &stage : stages) {
+      auto err = graph_.addStage(std::move(stage));
+      VRK_LOG_AND_FATAL_IF(err.has_value(), "Invalid track map pipeline stage: {}", err->what());
+    }
+
+    graph_.setCodec(HeaderArtifact, ProtoArtifactCodec<TrackLayoutMetadata>());
+    graph_.setCodec(LapsArtifact, LapsCodec());
+    graph_.setCodec(TrajectoryArtifact, ProtoArtifactCodec<LapTrajectory>());
+  }
+
+  PipelineGraph &TrackMapPipelineExecutor::graph() {
+    return graph_;
+  }
+
+  std::expected<std::string, GeneralError> TrackMapPipelineExecutor::ItemKey(const fs::path &file) {
+    std::error_code errorCode{};
+    auto size = fs::file_size(file, errorCode);
+    auto modifiedAt = fs::last_write_time(file, errorCode);
+    if (errorCode) {
+      return std::unexpected(
+        GeneralError(ErrorCode::General, fmt::format("Unable to stat ({}): {}", file.string(), errorCode.message()))
+      );
+    }
+
+    return fmt::format("{}|{}|{}", file.string(), size, modifiedAt.time_since_epoch().count());
+  }
+
+  void TrackMapPipelineExecutor::clearCheckpoints(const fs::path &file) {
+    if (auto itemKey = ItemKey(file)) {
+      graph_.clearCheckpoints(itemKey.value());
+    }
+  }
+
+  std::size_t TrackMapPipelineExecutor::pruneCheckpoints() {
+    return graph_.pruneCheckpoints(IsStaleItemKey);
+  }
+
+  std::expected<std::shared_ptr<LapTrajectory>, GeneralError>
+  TrackMapPipelineExecutor::createLapTrajectory(PipelineAttemptEditor &attempt, const fs::path &file) {
+    auto itemKey = ItemKey(file);
+    if (!itemKey) {
+      return std::unexpected(itemKey.error());
+    }
+
+    auto item = std::make_shared<PipelineGraph::Item>();
+    item->key = std::move(itemKey.value());
+    item->artifacts.set(FileArtifact, file);
+
+    attempt.setStatus(PipelineStatus::PIPELINE_STATUS_PROCESSING);
+    if (auto err = graph_.run(item)) {
+      attempt.setStatus(PipelineStatus::PIPELINE_STATUS_ERROR);
+      return std::unexpected(err.value());
+    }
+
+    item->toModel(attempt.attempt);
+    for (auto &stage : item->stages) {
+      L->info(
+        "Stage ({}) {} in {}ms{} >> {}",
+        stage.name,
+        magic_enum::enum_name(stage.status),
+        stage.duration.count() / 1000,
+        stage.fromCheckpoint ? " (checkpoint)" : "",
+        file.string()
+      );
+    }
+
+    if (item->error) {
+      return std::unexpected(item->error.value());
+    }
+
+    return *item->artifacts.get<std::shared_ptr<LapTrajectory>>(TrajectoryArtifact);
   }
 
   std::optional<SDK::GeneralError> TrackMapPipelineExecutor::execute(PipelineAttemptEditor& attempt,
@@ -36,11 +274,11 @@ namespace IRacingTools::Shared::Services::Pipelines {
     VRK_LOG_AND_FATAL_IF(!tmService, "Unable to get valid TrackMapService");
 
     L->info("Calling createLapTrajectory with ({})", file.string());
-    auto client = std::make_shared<SDK::DiskClient>(file, file.string());
-    auto sessionInfo = client->getSessionInfo().lock();
     std::string trackLayoutId;
     {
-      auto res = Utils::GetSessionInfoTrackLayoutId(sessionInfo);
+      auto client = OpenDiskClient(file);
+      auto clientDisposer = gsl::finally([&] { client->close(); });
+      auto res = Utils::GetSessionInfoTrackLayoutId(client->getSessionInfo().lock());
       if (!res){
         L->warn("Invalid IBT file, can not get track layout id: {}", file.string());
         return std::nullopt;
@@ -53,8 +291,7 @@ namespace IRacingTools::Shared::Services::Pipelines {
       return std::nullopt;
     }
     
-    LapTrajectoryTool tool;
-    auto res = tool.createLapTrajectory(client);
+    auto res = createLapTrajectory(attempt, file);
     if (!res) {
       auto err = res.error();
       return onError("Failed to generate lap trajectory >> {}", err.what());
@@ -1,8 +1,11 @@
 
 #include <chrono>
 #include <magic_enum.hpp>
+#include <ranges>
 #include <regex>
 
+#include <gsl/util>
+
 #include <IRacingTools/Shared/Logging/LoggingManager.h>
 #include <IRacingTools/Shared/Services/RPCServerService.h>
 
@@ -12,15 +15,91 @@ namespace IRacingTools::Shared::Services {
 
   namespace {
     auto L = GetCategoryWithType<RPCServerService>();
+
+    /**
+     * @brief `true` if `expression` only matches itself
+     */
+    bool IsLiteralExpression(const std::string &expression) {
+      return !expression.empty() &&
+          expression.find_first_of("\\^$.|?*+()[]{}") == std::string::npos;
+    }
+
+    void PrepareResponse(RPC::Envelope &messageIn, RPC::Envelope *messageOut) {
+      messageOut->set_id(messageIn.id());
+      messageOut->set_request_path(messageIn.request_path());
+      messageOut->set_kind(RPC::Envelope::KIND_RESPONSE);
+      messageOut->set_status(RPC::Envelope::STATUS_IN_PROGRESS);
+    }
+
+    void SetResponseError(RPC::Envelope *messageOut, const std::string &details) {
+      messageOut->set_status(RPC::Envelope::STATUS_ERROR);
+      messageOut->set_error_details(details);
+    }
   } // namespace
 
+  RPCServerService::Exchange::Exchange(std::size_t initialBlockSize)
+      : initialBlock_(std::make_unique<char[]>(initialBlockSize)) {
+    google::protobuf::ArenaOptions arenaOptions{};
+    arenaOptions.initial_block = initialBlock_.get();
+    arenaOptions.initial_block_size = initialBlockSize;
+    arena_ = std::make_unique<google::protobuf::Arena>(arenaOptions);
+    reset();
+  }
+
+  google::protobuf::Arena *RPCServerService::Exchange::arena() {
+    return arena_.get();
+  }
+
+  RPC::Envelope *RPCServerService::Exchange::request() {
+    return request_;
+  }
+
+  RPC::Envelope *RPCServerService::Exchange::response() {
+    return response_;
+  }
+
+  std::string &RPCServerService::Exchange::responseBytes() {
+    return responseBytes_;
+  }
+
+  void RPCServerService::Exchange::reset() {
+    // FREES EVERYTHING BUT THE INITIAL BLOCK
+    arena_->Reset();
+    request_ = google::protobuf::Arena::CreateMessage<RPC::Envelope>(arena_.get());
+    response_ = google::protobuf::Arena::CreateMessage<RPC::Envelope>(arena_.get());
+    responseBytes_.clear();
+  }
 
   RPCServerService::Route::Route(const std::string &matchExpression)
-      : matchExpression_(matchExpression), matcher_{matchExpression_} {
+      : matchExpression_(matchExpression), exact_(IsLiteralExpression(matchExpression)) {
+    if (!exact_ && !matchExpression_.empty())
+      matcher_.emplace(matchExpression_);
+  }
+
+  const std::string &RPCServerService::Route::matchExpression() const {
+    return matchExpression_;
+  }
+
+  std::size_t RPCServerService::Route::maxConcurrency() const {
+    return maxConcurrency_;
+  }
+
+  void RPCServerService::Route::setMaxConcurrency(std::size_t maxConcurrency) {
+    maxConcurrency_ = maxConcurrency;
+  }
+
+  std::optional<std::string_view> RPCServerService::Route::exactPath() const {
+    if (!exact_)
+      return std::nullopt;
+
+    return matchExpression_;
   }
 
   bool RPCServerService::Route::accepts(const std::string &path) {
-    return matchExpression_.empty() || std::regex_match(path, matcher_);
+    if (exact_)
+      return path == matchExpression_;
+
+    return !matcher_ || std::regex_match(path, matcher_.value());
   }
 
   RPCServerService::RPCServerService(
@@ -36,6 +115,12 @@ namespace IRacingTools::Shared::Services {
   }
 
 
+  void RPCServerService::setOptions(const Options &options) {
+    std::scoped_lock lock(stateMutex_);
+    assert(state() < State::Starting);
+    options_ = options;
+  }
+
   std::expected<bool, SDK::GeneralError> RPCServerService::init() {
     std::scoped_lock lock(stateMutex_);
 
@@ -52,8 +137,13 @@ namespace IRacingTools::Shared::Services {
         return state() == State::Running;
 
       setState(State::Starting);
+    }
 
-      return true;
+    if (options_.useTaskQueue) {
+      std::scoped_lock lock(callQueueMutex_);
+      callQueue_ = std::make_shared<CallQueue>(
+          [this](std::shared_ptr<Call> call) { runCall(call); },
+          CallQueue::Options{.threadCount = std::max<std::size_t>(options_.workerCount, 1)});
     }
 
     setState(State::Running);
@@ -68,43 +158,273 @@ namespace IRacingTools::Shared::Services {
 
     setState(State::Destroying);
 
+    std::shared_ptr<CallQueue> queue;
+    {
+      std::scoped_lock queueLock(callQueueMutex_);
+      queue = std::move(callQueue_);
+    }
+
+    // QUEUED CALLS ARE CANCELLED WHEN THE QUEUE DROPS THEM
+    if (queue)
+      queue->destroy();
+
+    auto routeTable = this->routeTable();
+    auto clearWaiting = [](const RouteTable::Entry &entry) {
+      std::deque<std::shared_ptr<Call>> waiting;
+      {
+        std::scoped_lock entryLock(entry.state->mutex);
+        waiting.swap(entry.state->waiting);
+      }
+    };
+
+    for (auto &entry: routeTable->exact | std::views::values)
+      clearWaiting(entry);
+
+    for (auto &entry: routeTable->patterns)
+      clearWaiting(entry);
+
     setState(State::Destroyed);
     return std::nullopt;
   }
   RPCServerService::Envelope
   RPCServerService::execute(const Envelope &messageIn) {
-    auto requestPath = messageIn->request_path();
-
-    auto messageOut = std::make_shared<Models::RPC::Envelope>();
-    messageOut->set_id(messageIn->id());
-    messageOut->set_request_path(messageIn->request_path());
-    messageOut->set_kind(RPC::Envelope::KIND_RESPONSE);
-    messageOut->set_status(RPC::Envelope::STATUS_IN_PROGRESS);
-
-    for (auto &route: routes_) {
-      if (route->accepts(requestPath)) {
-        auto result = route->execute(messageIn, messageOut);
-        if (result) {
-          messageOut = result.value();
-          messageOut->set_status(Models::RPC::Envelope::STATUS_DONE);
+    auto exchange = acquireExchange();
+    exchange->request()->CopyFrom(*messageIn);
+    execute(exchange);
+
+    return Envelope(exchange, exchange->response());
+  }
+
+  void RPCServerService::execute(const ExchangePtr &exchange) {
+    auto startedAt = Clock::now();
+    inFlight_++;
+    executeEntry(exchange, findEntry(exchange->request()->request_path()), startedAt);
+    inFlight_--;
+  }
+
+  void RPCServerService::executeAsync(const ExchangePtr &exchange, Completion onComplete) {
+    inFlight_++;
+    auto call = std::make_shared<Call>(
+        this,
+        exchange,
+        std::move(onComplete),
+        findEntry(exchange->request()->request_path()),
+        Clock::now());
+
+    // NOTHING TO RUN, OR NO WORKERS TO RUN IT ON
+    if (!call->entry || !callQueue()) {
+      executeEntry(call->exchange, call->entry, call->startedAt);
+      call->complete();
+      return;
+    }
+
+    dispatch(call);
+  }
+
+  RPCServerService::Metrics RPCServerService::metrics() {
+    Metrics metrics{
+        .inFlight = inFlight_.load(),
+        .latency = latency_.snapshot()};
+
+    auto routeTable = this->routeTable();
+    auto addRoute = [&](const RouteTable::Entry &entry) {
+      RouteMetrics routeMetrics{.latency = entry.state->latency.snapshot()};
+      {
+        std::scoped_lock lock(entry.state->mutex);
+        routeMetrics.running = entry.state->running;
+        routeMetrics.waiting = entry.state->waiting.size();
+      }
+
+      metrics.routes.emplace(entry.route->matchExpression(), std::move(routeMetrics));
+    };
+
+    for (auto &entry: routeTable->exact | std::views::values)
+      addRoute(entry);
+
+    for (auto &entry: routeTable->patterns)
+      addRoute(entry);
+
+    return metrics;
+  }
+
+  RPCServerService::Call::~Call() {
+    if (completed)
+      return;
+
+    PrepareResponse(*exchange->request(), exchange->response());
+    SetResponseError(exchange->response(), "Request cancelled");
+    complete();
+  }
+
+  void RPCServerService::Call::complete() {
+    completed = true;
+    server->inFlight_--;
+    if (onComplete)
+      onComplete(exchange);
+  }
+
+  void RPCServerService::executeEntry(
+      const ExchangePtr &exchange,
+      const std::optional<RouteTable::Entry> &entry,
+      Clock::time_point startedAt) {
+    auto messageOut = exchange->response();
+    PrepareResponse(*exchange->request(), messageOut);
+
+    if (!entry) {
+      SetResponseError(messageOut, "No matching route found");
+      return;
+    }
+
+    try {
+      if (auto err = entry->route->execute(exchange); err.has_value()) {
+        SetResponseError(messageOut, err->what());
+      } else {
+        messageOut->set_status(Models::RPC::Envelope::STATUS_DONE);
+      }
+    } catch (const std::exception &err) {
+      SetResponseError(messageOut, err.what());
+    } catch (...) {
+      SetResponseError(messageOut, "Unknown route error");
+    }
+
+    auto latency = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - startedAt);
+    entry->state->latency.record(latency);
+    latency_.record(latency);
+  }
+
+  void RPCServerService::runCall(const std::shared_ptr<Call> &call) {
+    // COMPLETED LAST, SO THE ROUTE NO LONGER COUNTS THE CALL AS RUNNING
+    auto completeCall = gsl::finally([&] { call->complete(); });
+
+    // HAND THE SLOT TO THE NEXT WAITING CALL, IF ANY, EVEN IF THE CALL THROWS
+    auto releaseSlot = gsl::finally([&] {
+      auto &state = *call->entry->state;
+      std::shared_ptr<Call> next{};
+      {
+        std::scoped_lock lock(state.mutex);
+        if (state.waiting.empty()) {
+          state.running--;
         } else {
-          auto &err = result.error();
-          messageOut->set_status(Models::RPC::Envelope::STATUS_ERROR);
-          messageOut->set_error_details(err.what());
+          next = std::move(state.waiting.front());
+          state.waiting.pop_front();
         }
-        return messageOut;
       }
+
+      if (next)
+        enqueue(next);
+    });
+
+    executeEntry(call->exchange, call->entry, call->startedAt);
+  }
+
+  void RPCServerService::dispatch(const std::shared_ptr<Call> &call) {
+    auto &state = *call->entry->state;
+    auto limit = call->entry->route->maxConcurrency();
+    {
+      std::scoped_lock lock(state.mutex);
+      if (limit > 0 && state.running >= limit) {
+        state.waiting.push_back(call);
+        return;
+      }
+
+      state.running++;
     }
-    messageOut->set_status(Models::RPC::Envelope::STATUS_ERROR);
-    messageOut->set_error_details("No matching route found");
-    return messageOut;
 
+    enqueue(call);
+  }
+
+  void RPCServerService::enqueue(const std::shared_ptr<Call> &call) {
+    // IF THE QUEUE IS GONE, THE CALL IS CANCELLED ONCE RELEASED
+    if (auto queue = callQueue())
+      queue->enqueue(call);
+  }
+
+  std::shared_ptr<RPCServerService::CallQueue> RPCServerService::callQueue() {
+    std::scoped_lock lock(callQueueMutex_);
+    return callQueue_;
+  }
+
+  RPCServerService::ExchangePtr RPCServerService::acquireExchange() {
+    std::unique_ptr<Exchange> exchange{};
+    {
+      std::scoped_lock lock(exchangePool_->mutex);
+      auto &exchanges = exchangePool_->exchanges;
+      if (!exchanges.empty()) {
+        exchange = std::move(exchanges.back());
+        exchanges.pop_back();
+      }
+    }
+
+    if (!exchange)
+      exchange = std::make_unique<Exchange>(options_.exchangeBlockSize);
+
+    return ExchangePtr(
+        exchange.release(),
+        [pool = std::weak_ptr(exchangePool_), maxPooled = options_.maxPooledExchanges](Exchange *released) {
+          std::unique_ptr<Exchange> owned(released);
+          auto exchangePool = pool.lock();
+          if (!exchangePool)
+            return;
+
+          owned->reset();
+
+          std::scoped_lock lock(exchangePool->mutex);
+          if (exchangePool->exchanges.size() < maxPooled)
+            exchangePool->exchanges.push_back(std::move(owned));
+        });
   }
 
   void
   RPCServerService::addRoute(const std::shared_ptr<Route> &route) {
     std::scoped_lock lock(routesMutex_);
-    routes_.push_back(route);
+
+    // COPY ON WRITE, SO `findRoute` NEVER HOLDS THE LOCK WHILE MATCHING
+    auto routeTable = std::make_shared<RouteTable>(*routeTable_);
+    RouteTable::Entry entry{routeTable->size++, route, std::make_shared<RouteState>()};
+    if (auto path = route->exactPath(); path.has_value()) {
+      // FIRST REGISTERED ROUTE WINS, MATCHING THE PREVIOUS LINEAR SCAN
+      routeTable->exact.emplace(std::string(path.value()), std::move(entry));
+    } else {
+      routeTable->patterns.push_back(std::move(entry));
+    }
+
+    routeTable_ = std::move(routeTable);
+  }
+
+  std::shared_ptr<RPCServerService::Route>
+  RPCServerService::findRoute(const std::string &path) {
+    auto entry = findEntry(path);
+    return entry ? entry->route : nullptr;
+  }
+
+  std::shared_ptr<const RPCServerService::RouteTable> RPCServerService::routeTable() {
+    std::scoped_lock lock(routesMutex_);
+    return routeTable_;
+  }
+
+  std::optional<RPCServerService::RouteTable::Entry>
+  RPCServerService::findEntry(const std::string &path) {
+    auto routeTable = this->routeTable();
+
+    const RouteTable::Entry *match = nullptr;
+    if (auto it = routeTable->exact.find(std::string_view(path)); it != routeTable->exact.end())
+      match = &it->second;
+
+    // ONLY PATTERNS REGISTERED BEFORE THE EXACT MATCH CAN TAKE PRECEDENCE
+    for (auto &entry: routeTable->patterns) {
+      if (match && entry.order > match->order)
+        break;
+
+      if (entry.route->accepts(path)) {
+        match = &entry;
+        break;
+      }
+    }
+
+    if (!match)
+      return std::nullopt;
+
+    return *match;
   }
 
 
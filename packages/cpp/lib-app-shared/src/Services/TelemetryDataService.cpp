@@ -85,6 +85,14 @@ namespace IRacingTools::Shared::Services {
                          ? std::vector<fs::path>{GetIRacingTelemetryPath()}
                          : options_.ibtPaths;
 
+        if (scanner_) {
+          scanner_->save();
+        }
+
+        scanner_ = std::make_unique<FileSystem::DirectoryScanner>(FileSystem::DirectoryScanner::Options{
+            .enumerate = {.extension = Extensions::IBT, .threadCount = options_.scanThreadCount},
+            .cacheFile = options_.fingerprintFile.value_or(GetAppDataPath() / TelemetryDataFileFingerprintsFilename)});
+
         dataFileHandler_->events.onRead.subscribe(onReadHandler);
       }
     }
@@ -115,7 +123,7 @@ namespace IRacingTools::Shared::Services {
     for (auto &path: filePaths_) {
       L->info("Creating watcher @ {}", path.string());
       fileWatchers_.push_back(std::make_unique<FileSystem::FileWatcher>(
-          path.wstring(),
+          path,
           [&](const FileSystem::FileWatcher::WatchEventData &file,
               FileSystem::WatchEvent eventType) {
             auto eventMsg = std::format(
@@ -126,20 +134,41 @@ namespace IRacingTools::Shared::Services {
 
             L->debug("FileWatcherEvent >> {}", eventMsg);
 
+            if (!HasFileExtension(file.path, Extensions::IBT)) {
+              return;
+            }
+
             if (eventType == FileSystem::WatchEvent::Removed) {
+              fileTaskQueue_->cancel(fs::absolute(file.path).string());
               return;
             }
 
+            // A FRESHLY WRITTEN SESSION IS PROCESSED BEFORE ANY BACKGROUND
+            // RESCAN STILL QUEUED
             std::scoped_lock handlerLock(stateMutex_);
-            enqueueFiles({file.path});
-          }));
+            enqueueFiles({file.path}, TaskPriority::High);
+          },
+          FileSystem::FileWatcher::Options{.debounce = options_.watchDebounce}));
     }
 
     return true;
   }
 
   std::size_t TelemetryDataService::scanAllFiles(const std::optional<std::vector<std::filesystem::path>>& overrideFilePaths) {
-    return enqueueFiles(listTelemetryFiles(!overrideFilePaths ? filePaths_ : overrideFilePaths.value()));
+    auto& paths = !overrideFilePaths ? filePaths_ : overrideFilePaths.value();
+    auto res = scanner_->scan(paths);
+    if (!res) {
+      L->warn("Incremental scan failed, enqueueing all files: {}", res.error().what());
+      return enqueueFiles(listTelemetryFiles(paths), TaskPriority::Low);
+    }
+
+    auto& result = res.value();
+    L->info("Scanned {} files, {} new or changed, {} removed", result.fileCount, result.changed.size(), result.removed.size());
+    for (auto& file : result.removed) {
+      fileTaskQueue_->cancel(file.string());
+    }
+
+    return enqueueFiles(result.changed, TaskPriority::Low);
   }
 
 
@@ -182,6 +211,14 @@ namespace IRacingTools::Shared::Services {
       fileTaskQueue_->destroy();
       fileTaskQueue_ = nullptr;
     }
+
+    // FILES STILL QUEUED WERE NEVER MARKED PROCESSED, THE NEXT SCAN
+    // REPORTS THEM AGAIN
+    if (scanner_) {
+      if (auto err = scanner_->save()) {
+        L->warn("Unable to save fingerprints: {}", err->what());
+      }
+    }
     setState(State::Destroyed);
     return std::nullopt;
   }
@@ -193,6 +230,7 @@ namespace IRacingTools::Shared::Services {
    */
   std::optional<SDK::GeneralError>
   TelemetryDataService::clearTelemetryFileCache() {
+    scanner_->clear();
     auto res = dataFileHandler_->clear();
     if (res) {
       L->error("Unable to remove underlying data file: {}", res.value().what());
@@ -210,6 +248,10 @@ namespace IRacingTools::Shared::Services {
     return fileTaskQueue_->pendingTaskCount();
   }
 
+  TelemetryDataService::TaskQueueType::Metrics TelemetryDataService::taskMetrics() {
+    return fileTaskQueue_->metrics();
+  }
+
 
 
   std::expected<std::shared_ptr<TrackLayoutMetadata>, GeneralError>
@@ -248,15 +290,12 @@ namespace IRacingTools::Shared::Services {
 
     return tlm;
   }
-  std::size_t TelemetryDataService::enqueueFiles(const std::vector<fs::path>& files) {
+  std::size_t TelemetryDataService::enqueueFiles(const std::vector<fs::path>& files, TaskPriority priority) {
     std::atomic_int queueCount = 0;
     {
       std::scoped_lock lock(stateMutex_);
 
       for (auto& file : files) {
-        if (pendingFileMap_.contains(file.string()))
-          continue;
-
         fs::path finalFile = file;
         if (!finalFile.is_absolute()) {
           finalFile = fs::absolute(file);
@@ -267,15 +306,18 @@ namespace IRacingTools::Shared::Services {
           auto tsRes = CheckFileInfoModified(dataFile, finalFile);
           if (!tsRes) {
             L->warn("Unable to check timestamps for {}: {}", finalFile.string(), tsRes.error().what());
+            scanner_->forget(finalFile);
             continue;
           }
 
           if (!tsRes.value().first) {
+            // ALREADY UP TO DATE
+            scanner_->markProcessed(finalFile);
             continue;
           }
         }
 
-        pendingFileMap_[file.string()] = fileTaskQueue_->enqueue(finalFile, dataFile);
+        fileTaskQueue_->enqueue({.priority = priority, .key = finalFile.string()}, finalFile, dataFile);
         ++queueCount;
       }
     }
@@ -287,6 +329,9 @@ namespace IRacingTools::Shared::Services {
     auto res = ProcessTelemetryDataFile(shared_from_this(), file, dataFile);
     if (!res) {
       L->error("Failed to process {}", file.string());
+
+      // RETRY ON THE NEXT SCAN
+      scanner_->forget(file);
       events.onFilesChanged.publish(this, {});
       return nullptr;
     }
@@ -295,6 +340,8 @@ namespace IRacingTools::Shared::Services {
       set(tdf);
     }
 
+    // ONLY NOW IS THE FILE SKIPPED BY LATER SCANS
+    scanner_->markProcessed(file);
     return tdf;
   }
 
@@ -15,6 +15,7 @@
 #include <IRacingTools/Shared/Logging/LoggingManager.h>
 #include <IRacingTools/Shared/ProtoHelpers.h>
 #include <IRacingTools/Shared/Services/LapTrajectoryTool.h>
+#include <IRacingTools/Shared/Services/Pipelines/TrackMapPipelineExecutor.h>
 #include <IRacingTools/Shared/Services/TelemetryDataService.h>
 #include <IRacingTools/Shared/Services/TrackMapService.h>
 #include <IRacingTools/Shared/Utils/SessionInfoHelpers.h>
@@ -101,16 +102,11 @@ namespace IRacingTools::Shared::Services {
     tmFile->mutable_track_layout_metadata()->CopyFrom(
         dataFile->track_layout_metadata());
 
-    // CREATE DISK CLIENT
-    auto client = std::make_shared<SDK::DiskClient>(file, file.string());
-    auto clientDisposer = gsl::finally([&] {
-      if (client)
-        client->close();
-    });
-
-    // CREATE THE TRAJECTORY
-    LapTrajectoryTool tool;
-    auto res = tool.createLapTrajectory(client);
+    // CREATE THE TRAJECTORY, RESUMING FROM ANY CHECKPOINTED STAGES
+    TrackMapPipelineExecutor executor;
+    Pipeline pipeline{};
+    TrackMapPipelineExecutor::PipelineAttemptEditor attempt(&pipeline, pipeline.add_attempts());
+    auto res = executor.createLapTrajectory(attempt, file);
     if (!res) {
       auto err = res.error();
       return onError("Failed to generate lap trajectory >> {}", err.what());
@@ -141,6 +137,9 @@ namespace IRacingTools::Shared::Services {
       return onError("Failed to get file info for file > {}", ltFile.string());
     }
 
+    // THE TRAJECTORY IS PERSISTED, SO ITS INTERMEDIATE STAGES ARE NOT NEEDED ANYMORE
+    executor.clearCheckpoints(file);
+
 
     L->info(
         "Saved LapTrajectory for trackLayoutId ({})",
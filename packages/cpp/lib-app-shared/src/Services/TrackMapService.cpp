@@ -17,6 +17,7 @@
 #include <IRacingTools/Shared/ProtoHelpers.h>
 #include <IRacingTools/Shared/Services/LapTrajectoryTool.h>
 #include <IRacingTools/Shared/Services/Pipelines/PipelineExecutorRegistry.h>
+#include <IRacingTools/Shared/Services/Pipelines/TrackMapPipelineExecutor.h>
 #include <IRacingTools/Shared/Services/TelemetryDataService.h>
 #include <IRacingTools/Shared/Services/TrackMapService.h>
 #include <IRacingTools/Shared/Utils/SessionInfoHelpers.h>
@@ -75,21 +76,18 @@ namespace IRacingTools::Shared::Services {
     std::scoped_lock lock(stateMutex_);
 
 
+    // KEYED BY FILE, A FILE STILL QUEUED IS GENERATED ONCE WITH THE LATEST
+    // DATA FILE
     for (auto &changedDataFile: changedDataFiles) {
-      auto &file = changedDataFile->file_info().file();
-      if (dataFilesTaskMap_.contains(changedDataFile->file_info().file())) {
-        L->info("All ready enqueued ({})", file);
-        continue;
-      }
-      dataFilesTaskMap_[file] =
-          dataFileTaskQueue_->enqueue(std::shared_ptr(changedDataFile));
+      dataFileTaskQueue_->enqueue(
+          {.key = changedDataFile->file_info().file()},
+          std::shared_ptr(changedDataFile));
     }
   }
 
   std::string TrackMapService::dataFileTaskQueueFn(
       const std::shared_ptr<TelemetryDataFile> &dataFile) {
     auto &fileStr = dataFile->file_info().file();
-    dataFilesTaskMap_.erase(fileStr);
 
     auto res = GenerateTrackMap(getContainer(), dataFile);
     if (!res) {
@@ -158,6 +156,11 @@ namespace IRacingTools::Shared::Services {
         return std::unexpected(loadError.value());
       }
 
+      // CHECKPOINTS OF FILES DELETED OR CHANGED SINCE THEY WERE PROCESSED ARE NEVER RESUMED
+      if (auto pruned = Pipelines::TrackMapPipelineExecutor().pruneCheckpoints()) {
+        L->info("Removed stale pipeline checkpoints of {} files", pruned);
+      }
+
       // TODO: Add JSONLines data file loading here
       auto tds = getContainer()->getService<TelemetryDataService>();
       tds->events.onFilesChanged.subscribe(
@@ -234,7 +237,12 @@ namespace IRacingTools::Shared::Services {
    * @return std::optional<SDK::GeneralError>
    */
   std::optional<SDK::GeneralError> TrackMapService::clearTrackMapCache() {
+    std::scoped_lock lock(stateMutex_);
     dataFiles_.clear();
+    positionLUTs_.clear();
+
+    std::error_code errorCode{};
+    fs::remove_all(GetAppDataPath() / PipelineCheckpointsPath, errorCode);
 
     return std::nullopt;
   }
@@ -298,6 +306,34 @@ namespace IRacingTools::Shared::Services {
     return std::make_shared<LapTrajectory>(dataRes.value());
   }
 
+  std::shared_ptr<const TrackPositionLUT>
+  TrackMapService::getPositionLUT(const std::string &trackLayoutId) {
+    std::scoped_lock lock(stateMutex_);
+    if (auto it = positionLUTs_.find(trackLayoutId); it != positionLUTs_.end()) {
+      return it->second;
+    }
+
+    auto lt = getData(trackLayoutId);
+    if (!lt) {
+      return nullptr;
+    }
+
+    auto lutRes = lt->has_position_lookup_table()
+                    ? TrackPositionLUT::FromModel(lt->position_lookup_table())
+                    : TrackPositionLUT::Create(*lt);
+    if (!lutRes) {
+      L->error(
+          "Unable to get position lookup table ({}): {}",
+          trackLayoutId,
+          lutRes.error().what());
+      return nullptr;
+    }
+
+    auto lut = std::make_shared<const TrackPositionLUT>(std::move(lutRes.value()));
+    positionLUTs_[trackLayoutId] = lut;
+    return lut;
+  }
+
   std::shared_ptr<TrackMapFile>
   TrackMapService::get(const std::string &trackLayoutId) {
     std::scoped_lock lock(stateMutex_);
@@ -333,6 +369,9 @@ namespace IRacingTools::Shared::Services {
 
       // MOVE NEW DATA FILES WITH CHANGES ON TO `dataFiles_` member
       files_ = std::move(newFiles);
+
+      // THE TRAJECTORY (& ITS LOOKUP TABLE) MAY HAVE BEEN REGENERATED
+      positionLUTs_.erase(trackLayoutId);
     }
 
     events.onFilesChanged.publish(this, {tmFile});
@@ -362,6 +401,10 @@ namespace IRacingTools::Shared::Services {
     return dataFileTaskQueue_->pendingTaskCount();
   }
 
+  TrackMapService::TrackMapTaskQueue::Metrics TrackMapService::taskMetrics() {
+    return dataFileTaskQueue_->metrics();
+  }
+
   std::expected<std::shared_ptr<TrackMapService>, SDK::GeneralError>
   TrackMapService::save() {
 
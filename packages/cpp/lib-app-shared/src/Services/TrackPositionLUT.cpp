@@ -0,0 +1,173 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <ranges>
+
+#include <fmt/format.h>
+
+#include <IRacingTools/Shared/Services/TrackPositionLUT.h>
+
+namespace IRacingTools::Shared::Services {
+  using namespace IRacingTools::SDK;
+
+  namespace {
+    struct Sample {
+      float pct;
+      double x;
+      double y;
+    };
+
+    constexpr float NaN = std::numeric_limits<float>::quiet_NaN();
+  } // namespace
+
+  std::expected<TrackPositionLUT, GeneralError>
+  TrackPositionLUT::Create(const Models::LapTrajectory &trajectory, std::uint32_t binCount) {
+    if (binCount < 2) {
+      return std::unexpected(GeneralError(ErrorCode::General, "binCount must be at least 2"));
+    }
+
+    // PROJECT THE PATH
+    std::vector<Sample> samples{};
+    samples.reserve(trajectory.path_size());
+    std::optional<Geometry::LocalProjection> projection{};
+    for (auto &coord : trajectory.path()) {
+      auto pct = coord.lap_percent_complete();
+      if (coord.latitude() == 0.0 || coord.longitude() == 0.0 || pct < 0.0f || pct >= 1.0f) {
+        continue;
+      }
+
+      if (!projection) {
+        projection.emplace(coord.latitude(), coord.longitude());
+      }
+
+      auto [x, y] = projection->toLocal(coord.latitude(), coord.longitude());
+      samples.push_back({pct, x, y});
+    }
+
+    std::ranges::stable_sort(samples, {}, &Sample::pct);
+    auto duplicates = std::ranges::unique(samples, {}, &Sample::pct);
+    samples.erase(duplicates.begin(), duplicates.end());
+
+    if (samples.size() < 3) {
+      return std::unexpected(
+        GeneralError(ErrorCode::General, fmt::format("Not enough path points ({}) to build a lookup table", samples.size()))
+      );
+    }
+
+    // NORMALIZE, NORTH UP WITH THE LONGEST SIDE == 1
+    auto [minX, maxX] = std::ranges::minmax(samples | std::views::transform(&Sample::x));
+    auto [minY, maxY] = std::ranges::minmax(samples | std::views::transform(&Sample::y));
+    auto extent = std::max(maxX - minX, maxY - minY);
+    if (extent <= 0.0) {
+      return std::unexpected(GeneralError(ErrorCode::General, "Path has no extent"));
+    }
+
+    TrackPositionLUT lut{};
+    lut.binCount_ = binCount;
+    lut.width_ = static_cast<float>((maxX - minX) / extent);
+    lut.height_ = static_cast<float>((maxY - minY) / extent);
+    lut.xs_.resize(binCount + 1);
+    lut.ys_.resize(binCount + 1);
+
+    // SAMPLE EACH BIN, WRAPPING AROUND START/FINISH BEFORE THE FIRST &
+    // AFTER THE LAST PATH POINT
+    auto &first = samples.front();
+    auto &last = samples.back();
+    std::size_t next = 0;
+    for (std::uint32_t bin = 0; bin < binCount; bin++) {
+      auto pct = static_cast<float>(bin) / static_cast<float>(binCount);
+      while (next < samples.size() && samples[next].pct <= pct) {
+        next++;
+      }
+
+      auto &s1 = next == 0 ? last : samples[next - 1];
+      auto &s2 = next == samples.size() ? first : samples[next];
+      auto p1 = next == 0 ? s1.pct - 1.0f : s1.pct;
+      auto p2 = next == samples.size() ? s2.pct + 1.0f : s2.pct;
+      auto t = static_cast<double>((pct - p1) / (p2 - p1));
+
+      lut.xs_[bin] = static_cast<float>((s1.x + (s2.x - s1.x) * t - minX) / extent);
+      lut.ys_[bin] = static_cast<float>((maxY - (s1.y + (s2.y - s1.y) * t)) / extent);
+    }
+
+    lut.xs_[binCount] = lut.xs_[0];
+    lut.ys_[binCount] = lut.ys_[0];
+    return lut;
+  }
+
+  std::expected<TrackPositionLUT, GeneralError>
+  TrackPositionLUT::FromModel(const Models::LapTrajectory::PositionLookupTable &model) {
+    auto binCount = model.bin_count();
+    auto expectedSize = static_cast<int>(binCount) + 1;
+    if (binCount < 2 || model.x_size() != expectedSize || model.y_size() != expectedSize) {
+      return std::unexpected(GeneralError(
+        ErrorCode::General,
+        fmt::format("Invalid position lookup table (bins={},x={},y={})", binCount, model.x_size(), model.y_size())
+      ));
+    }
+
+    TrackPositionLUT lut{};
+    lut.binCount_ = binCount;
+    lut.width_ = model.width();
+    lut.height_ = model.height();
+    lut.xs_.assign(model.x().begin(), model.x().end());
+    lut.ys_.assign(model.y().begin(), model.y().end());
+    return lut;
+  }
+
+  void TrackPositionLUT::toModel(Models::LapTrajectory::PositionLookupTable *model) const {
+    model->Clear();
+    model->set_bin_count(binCount_);
+    model->set_width(width_);
+    model->set_height(height_);
+    model->mutable_x()->Add(xs_.begin(), xs_.end());
+    model->mutable_y()->Add(ys_.begin(), ys_.end());
+  }
+
+  std::size_t TrackPositionLUT::lookup(
+    std::span<const float> pcts,
+    std::span<float> xs,
+    std::span<float> ys,
+    float scale,
+    float offsetX,
+    float offsetY
+  ) const {
+    auto count = std::min({pcts.size(), xs.size(), ys.size()});
+    if (empty()) {
+      std::fill_n(xs.begin(), count, NaN);
+      std::fill_n(ys.begin(), count, NaN);
+      return count;
+    }
+
+    auto bins = static_cast<float>(binCount_);
+    auto maxBin = binCount_ - 1;
+    auto tableX = xs_.data();
+    auto tableY = ys_.data();
+    auto outX = xs.data();
+    auto outY = ys.data();
+    auto inPct = pcts.data();
+
+    for (std::size_t idx = 0; idx < count; idx++) {
+      auto pct = inPct[idx];
+      auto t = (pct - std::floor(pct)) * bins;
+      auto bin = std::min(static_cast<std::uint32_t>(t), maxBin);
+      auto f = t - static_cast<float>(bin);
+
+      auto x = tableX[bin] + (tableX[bin + 1] - tableX[bin]) * f;
+      auto y = tableY[bin] + (tableY[bin + 1] - tableY[bin]) * f;
+
+      auto inWorld = pct >= 0.0f;
+      outX[idx] = inWorld ? offsetX + x * scale : NaN;
+      outY[idx] = inWorld ? offsetY + y * scale : NaN;
+    }
+
+    return count;
+  }
+
+  Geometry::PixelF TrackPositionLUT::lookup(float pct, float scale, float offsetX, float offsetY) const {
+    Geometry::PixelF pixel{};
+    lookup(std::span{&pct, 1}, std::span{&pixel.x, 1}, std::span{&pixel.y, 1}, scale, offsetX, offsetY);
+    return pixel;
+  }
+
+} // namespace IRacingTools::Shared::Services
@@ -2,8 +2,10 @@
 // Created by jglanz on 1/28/2024.
 //
 
+#include <array>
 #include <cstdio>
 #include <iostream>
+#include <span>
 #include <utility>
 
 #include <IRacingTools/Shared/Chrono.h>
@@ -66,28 +68,36 @@ namespace IRacingTools::Shared {
     auto drivers = sessionInfo ? sessionInfo->driverInfo.drivers : std::vector<SDK::SessionInfo::Driver>{};
     cars_.clear();
 
-    sessionTimeMillis_ = SessionTimeToMillis(sessionTimeVar.getDouble());
+    sessionTimeMillis_ = SessionTimeToMillis(sessionTimeVar.get());
 
-    for (int index = 0; index < Resources::MaxCars; index++) {
-      auto trackSurface = IRVAR(CarIdxTrackSurface).getInt(index);
-
-      std::optional<SDK::SessionInfo::Driver> driver =
-          drivers.size() > index ? std::make_optional(drivers[index]) : std::nullopt;
+    // Read every `CarIdx*` array in one pass, cars not in world
+    // (`trackSurface == -1`) read as `lap == -1` & are skipped below
+    std::array<std::int32_t, Resources::MaxCars> trackSurfaces{}, laps{}, lapsCompleted{}, positions{}, clazzPositions{};
+    std::array<float, Resources::MaxCars> lapPercentCompletes{}, estimatedTimes{};
 
-      auto lap = lapVar.getInt(index);
-      auto pos = posVar.getInt(index);
+    IRVAR(CarIdxTrackSurface).getArray(std::span{trackSurfaces});
+    lapVar.getArrayMasked(std::span{laps}, std::span<const std::int32_t>{trackSurfaces}, -1);
+    posVar.getArray(std::span{positions});
+    lapsCompletedVar.getArray(std::span{lapsCompleted});
+    clazzPosVar.getArray(std::span{clazzPositions});
+    lapPercentCompleteVar.getArray(std::span{lapPercentCompletes});
+    estTimeVar.getArray(std::span{estimatedTimes});
 
-      if (trackSurface == -1 || lap == -1 || pos == 0) {
+    for (int index = 0; index < Resources::MaxCars; index++) {
+      if (laps[index] == -1 || positions[index] == 0) {
         continue;
       }
 
+      std::optional<SDK::SessionInfo::Driver> driver =
+          drivers.size() > index ? std::make_optional(drivers[index]) : std::nullopt;
+
       cars_.emplace_back(
           SessionCarState{.index = index,
-                          .lap = lapVar.getInt(index),
-                          .lapsCompleted = lapsCompletedVar.getInt(index),
-                          .lapPercentComplete = lapPercentCompleteVar.getFloat(index),
-                          .estimatedTime = estTimeVar.getFloat(index),
-                          .position = {.overall = posVar.getInt(index), .clazz = clazzPosVar.getInt(index)},
+                          .lap = laps[index],
+                          .lapsCompleted = lapsCompleted[index],
+                          .lapPercentComplete = lapPercentCompletes[index],
+                          .estimatedTime = estimatedTimes[index],
+                          .position = {.overall = positions[index], .clazz = clazzPositions[index]},
                           .driver = std::move(driver)});
     }
   }
@@ -0,0 +1,192 @@
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+#include <IRacingTools/Shared/SessionDataSnapshot.h>
+
+namespace IRacingTools::Shared {
+
+  namespace {
+    constexpr std::size_t AlignUp8(std::size_t size) {
+      return (size + 7) & ~static_cast<std::size_t>(7);
+    }
+
+    std::size_t LayoutRowSize(const std::vector<SessionDataSnapshot::VarLayout> &layout) {
+      std::size_t rowSize{0};
+      for (auto &varLayout: layout)
+        rowSize = std::max<std::size_t>(rowSize, varLayout.offset + SDK::VarDataTypeSizeTable[varLayout.type] * varLayout.count);
+
+      return rowSize;
+    }
+  } // namespace
+
+  std::vector<SessionDataSnapshot::VarLayout> SessionDataSnapshot::Layout(const SDK::VarHeaders &headers) {
+    std::vector<VarLayout> layout{};
+    layout.reserve(headers.size());
+    for (auto &header: headers) {
+      layout.push_back(
+        VarLayout{
+          .name = std::string(header.name, strnlen(header.name, sizeof(header.name))),
+          .type = header.type,
+          .offset = static_cast<std::uint32_t>(std::max(header.offset, 0)),
+          .count = static_cast<std::uint32_t>(std::max(header.count, 0))
+        }
+      );
+    }
+
+    return layout;
+  }
+
+  std::size_t SessionDataSnapshot::ByteLength(const SDK::VarHeaders &headers) {
+    return HeaderSize + SlotCount * AlignUp8(LayoutRowSize(Layout(headers)));
+  }
+
+  SessionDataSnapshot::SessionDataSnapshot(const SDK::VarHeaders &headers) : SessionDataSnapshot(Layout(headers), {}) {
+    publishLayout(nullptr);
+  }
+
+  SessionDataSnapshot::SessionDataSnapshot(const SDK::VarHeaders &headers, std::span<std::byte> region) :
+    SessionDataSnapshot(Layout(headers), region) {
+    publishLayout(nullptr);
+  }
+
+  SessionDataSnapshot::SessionDataSnapshot(const SessionDataSnapshot &source, std::span<std::byte> region) :
+    SessionDataSnapshot(source.layout_, region) {
+    assert(source.data_ != data_);
+    publishLayout(&source);
+  }
+
+  SessionDataSnapshot::SessionDataSnapshot(std::vector<VarLayout> layout, std::span<std::byte> region) :
+    layout_(std::move(layout)) {
+    rowSize_ = LayoutRowSize(layout_);
+    slotStride_ = AlignUp8(rowSize_);
+    byteLength_ = HeaderSize + SlotCount * slotStride_;
+
+    if (region.empty()) {
+      buffer_ = std::make_unique<std::uint64_t[]>(byteLength_ / sizeof(std::uint64_t));
+      data_ = reinterpret_cast<std::byte *>(buffer_.get());
+    } else {
+      assert(region.size() >= byteLength_ && reinterpret_cast<std::uintptr_t>(region.data()) % 8 == 0);
+      data_ = region.data();
+    }
+  }
+
+  void SessionDataSnapshot::publishLayout(const SessionDataSnapshot *source) {
+    auto sequence = headerWord(Sequence);
+    auto current = sequence.load(std::memory_order_relaxed) & ~1u;
+    sequence.store(current + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    std::uint32_t sessionTick{0};
+    bool seeded = source && source->headerWord(FrameCount).load(std::memory_order_acquire) > 0;
+    if (seeded)
+      source->readRow({slot(0), rowSize_}, &sessionTick);
+    else
+      std::memset(slot(0), 0, rowSize_);
+
+    headerWord(ActiveSlot).store(0, std::memory_order_relaxed);
+    headerWord(RowSize).store(static_cast<std::uint32_t>(rowSize_), std::memory_order_relaxed);
+    headerWord(SlotStride).store(static_cast<std::uint32_t>(slotStride_), std::memory_order_relaxed);
+    headerWord(FrameCount).store(seeded ? 1 : 0, std::memory_order_relaxed);
+    headerWord(SessionTick).store(sessionTick, std::memory_order_relaxed);
+    headerWord(Invalidated).store(0, std::memory_order_relaxed);
+    headerWord(LayoutVersion).fetch_add(1, std::memory_order_relaxed);
+
+    sequence.store(current + 2, std::memory_order_release);
+  }
+
+  const std::vector<SessionDataSnapshot::VarLayout> &SessionDataSnapshot::layout() const {
+    return layout_;
+  }
+
+  std::size_t SessionDataSnapshot::rowSize() const {
+    return rowSize_;
+  }
+
+  std::size_t SessionDataSnapshot::slotStride() const {
+    return slotStride_;
+  }
+
+  std::size_t SessionDataSnapshot::byteLength() const {
+    return byteLength_;
+  }
+
+  std::byte *SessionDataSnapshot::data() {
+    return data_;
+  }
+
+  std::uint32_t SessionDataSnapshot::layoutVersion() const {
+    return headerWord(LayoutVersion).load(std::memory_order_acquire);
+  }
+
+  bool SessionDataSnapshot::matches(const SDK::VarHeaders &headers) const {
+    return std::ranges::equal(
+      Layout(headers),
+      layout_,
+      [](const VarLayout &a, const VarLayout &b) {
+        return a.offset == b.offset && a.count == b.count && a.type == b.type && a.name == b.name;
+      }
+    );
+  }
+
+  void SessionDataSnapshot::write(const char *row, std::int32_t sessionTick) {
+    if (!row || isInvalidated())
+      return;
+
+    auto sequence = headerWord(Sequence);
+    auto activeSlot = headerWord(ActiveSlot);
+    auto nextSlot = 1 - activeSlot.load(std::memory_order_relaxed);
+
+    // READERS ONLY EVER READ THE ACTIVE SLOT, SO THIS COPY IS NOT GUARDED
+    std::memcpy(slot(nextSlot), row, rowSize_);
+
+    auto current = sequence.load(std::memory_order_relaxed);
+    sequence.store(current + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    activeSlot.store(nextSlot, std::memory_order_relaxed);
+    headerWord(SessionTick).store(static_cast<std::uint32_t>(sessionTick), std::memory_order_relaxed);
+    headerWord(FrameCount).fetch_add(1, std::memory_order_relaxed);
+
+    sequence.store(current + 2, std::memory_order_release);
+  }
+
+  std::uint32_t SessionDataSnapshot::read(std::span<std::byte> row) const {
+    return readRow(row, nullptr);
+  }
+
+  std::uint32_t SessionDataSnapshot::readRow(std::span<std::byte> row, std::uint32_t *sessionTick) const {
+    auto sequence = headerWord(Sequence);
+    auto size = std::min(row.size(), rowSize_);
+    while (true) {
+      auto before = sequence.load(std::memory_order_acquire);
+      if (before & 1)
+        continue;
+
+      std::memcpy(row.data(), slot(headerWord(ActiveSlot).load(std::memory_order_relaxed)), size);
+      if (sessionTick)
+        *sessionTick = headerWord(SessionTick).load(std::memory_order_relaxed);
+
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (sequence.load(std::memory_order_relaxed) == before)
+        return before;
+    }
+  }
+
+  void SessionDataSnapshot::invalidate() {
+    headerWord(Invalidated).store(1, std::memory_order_release);
+  }
+
+  bool SessionDataSnapshot::isInvalidated() const {
+    return headerWord(Invalidated).load(std::memory_order_acquire) != 0;
+  }
+
+  std::atomic_ref<std::uint32_t> SessionDataSnapshot::headerWord(HeaderField field) const {
+    return std::atomic_ref(reinterpret_cast<std::uint32_t *>(data_)[field]);
+  }
+
+  std::byte *SessionDataSnapshot::slot(std::uint32_t slotIdx) const {
+    return data_ + HeaderSize + slotIdx * slotStride_;
+  }
+
+} // namespace IRacingTools::Shared
@@ -0,0 +1,139 @@
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <gtest/gtest.h>
+
+#include <IRacingTools/Shared/Common/CoalescingEventQueue.h>
+#include <IRacingTools/Shared/Logging/LoggingManager.h>
+
+using namespace IRacingTools::Shared::Logging;
+using namespace IRacingTools::Shared::Common;
+
+namespace {
+
+  class CoalescingEventQueueTests;
+
+  auto L = GetCategoryWithType<CoalescingEventQueueTests>();
+
+  class CoalescingEventQueueTests : public testing::Test {
+  protected:
+    CoalescingEventQueueTests() = default;
+
+    virtual void TearDown() override {
+      L->flush();
+    }
+  };
+
+  enum class EventKind { Available, Info, Frame };
+
+  struct Event {
+    EventKind kind;
+    int value;
+  };
+
+  using Queue = CoalescingEventQueue<EventKind, Event>;
+
+  bool Push(Queue &queue, EventKind kind, int value) {
+    return queue.push(kind, Event{kind, value}, kind == EventKind::Frame ? EventDelivery::Latest : EventDelivery::Every);
+  }
+} // namespace
+
+TEST_F(CoalescingEventQueueTests, coalesces_latest_and_keeps_order) {
+  Queue queue{};
+  EXPECT_TRUE(Push(queue, EventKind::Frame, 1));
+  EXPECT_FALSE(Push(queue, EventKind::Info, 2));
+  EXPECT_FALSE(Push(queue, EventKind::Frame, 3));
+  EXPECT_FALSE(Push(queue, EventKind::Frame, 4));
+
+  bool hasMore = true;
+  auto batch = queue.drain(hasMore);
+  EXPECT_FALSE(hasMore);
+  ASSERT_EQ(batch.size(), 2);
+  EXPECT_EQ(batch[0].kind, EventKind::Info);
+  EXPECT_EQ(batch[1].value, 4);
+
+  auto metrics = queue.metrics();
+  EXPECT_EQ(metrics.pushed, 4);
+  EXPECT_EQ(metrics.coalesced, 2);
+  EXPECT_EQ(metrics.delivered, 2);
+  EXPECT_EQ(metrics.queued, 0);
+
+  // DRAINED, SO THE NEXT PUSH SCHEDULES AGAIN
+  EXPECT_TRUE(Push(queue, EventKind::Frame, 5));
+}
+
+TEST_F(CoalescingEventQueueTests, bounded_without_dropping_every_events) {
+  Queue queue(Queue::Options{.capacity = 2, .maxBatchSize = 2});
+  EXPECT_TRUE(Push(queue, EventKind::Frame, 1));
+  Push(queue, EventKind::Available, 2);
+
+  // EVICTS THE FRAME
+  Push(queue, EventKind::Info, 3);
+
+  // FULL OF `Every` EVENTS, THE FRAME IS DROPPED
+  Push(queue, EventKind::Frame, 4);
+
+  // `Every` EVENTS ARE KEPT PAST CAPACITY
+  Push(queue, EventKind::Info, 5);
+
+  auto metrics = queue.metrics();
+  EXPECT_EQ(metrics.dropped, 2);
+  EXPECT_EQ(metrics.queued, 3);
+
+  bool hasMore = false;
+  auto batch = queue.drain(hasMore);
+  EXPECT_TRUE(hasMore);
+  ASSERT_EQ(batch.size(), 2);
+  EXPECT_EQ(batch[0].value, 2);
+  EXPECT_EQ(batch[1].value, 3);
+
+  // STILL SCHEDULED UNTIL EMPTY
+  EXPECT_FALSE(Push(queue, EventKind::Frame, 6));
+
+  batch = queue.drain(hasMore);
+  EXPECT_FALSE(hasMore);
+  ASSERT_EQ(batch.size(), 2);
+  EXPECT_EQ(batch[0].value, 5);
+  EXPECT_EQ(batch[1].value, 6);
+  EXPECT_EQ(queue.metrics().batches, 2);
+}
+
+TEST_F(CoalescingEventQueueTests, single_drain_scheduled_across_threads) {
+  Queue queue(Queue::Options{.capacity = 8, .maxBatchSize = 4});
+  std::atomic_int scheduled{0};
+  std::atomic_bool producing{true};
+  std::vector<int> infos{};
+
+  std::thread producer([&] {
+    for (int idx = 0; idx < 20000; idx++) {
+      if (Push(queue, idx % 100 == 0 ? EventKind::Info : EventKind::Frame, idx))
+        scheduled++;
+    }
+    producing = false;
+  });
+
+  int drains = 0;
+  while (producing || queue.metrics().queued) {
+    if (scheduled.load() == drains) {
+      std::this_thread::yield();
+      continue;
+    }
+
+    bool hasMore = false;
+    do {
+      for (auto &event: queue.drain(hasMore)) {
+        if (event.kind == EventKind::Info)
+          infos.push_back(event.value);
+      }
+    } while (hasMore);
+    drains++;
+  }
+
+  producer.join();
+
+  auto metrics = queue.metrics();
+  EXPECT_EQ(scheduled.load(), drains);
+  EXPECT_EQ(infos.size(), 200);
+  EXPECT_TRUE(std::ranges::is_sorted(infos));
+  EXPECT_EQ(metrics.pushed, metrics.delivered + metrics.coalesced + metrics.dropped);
+}
@@ -0,0 +1,149 @@
+#include <chrono>
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <gtest/gtest.h>
+
+#include <IRacingTools/Shared/Graphics/CoordinateToPixelConverter.h>
+#include <IRacingTools/Shared/Logging/LoggingManager.h>
+
+using namespace IRacingTools::Shared;
+using namespace IRacingTools::Shared::Geometry;
+using namespace IRacingTools::Shared::Logging;
+
+namespace {
+  class CoordinateToPixelConverterTests;
+
+  auto L = GetCategoryWithType<CoordinateToPixelConverterTests>();
+
+  class CoordinateToPixelConverterTests : public testing::Test {
+  protected:
+    CoordinateToPixelConverterTests() = default;
+
+    virtual void TearDown() override {
+      L->flush();
+    }
+  };
+
+  constexpr Coordinate<> kCoordinate_NYC = {40.7468831, -73.994756};
+  constexpr Coordinate<> kCoordinate_SFO = {37.6164442, -122.3886441};
+
+  /**
+   * @brief A wobbly ~4.5km lap (Montreal sized) sampled `count` times
+   */
+  std::vector<Coordinate<>> MakeTrack(std::size_t count, double latitude = 45.5, double longitude = -73.52) {
+    std::mt19937 rng{5};
+    std::normal_distribution<double> noise(0.0, 0.000002);
+    std::vector<Coordinate<>> coords{};
+    coords.reserve(count);
+    for (std::size_t idx = 0; idx < count; idx++) {
+      auto angle = 2.0 * std::numbers::pi * static_cast<double>(idx) / static_cast<double>(count);
+      auto radius = 0.006 + 0.002 * std::sin(5.0 * angle);
+      coords.push_back({latitude + radius * std::sin(angle) + noise(rng), longitude + 1.4 * radius * std::cos(angle) + noise(rng)});
+    }
+
+    return coords;
+  }
+} // namespace
+
+TEST_F(CoordinateToPixelConverterTests, local_projection_matches_mercator) {
+  for (auto latitude : {0.0, 45.5, -37.8, 63.0}) {
+    auto coords = MakeTrack(20000, latitude);
+    CoordinateToPixelConverter<double> converter{};
+
+    std::vector<PixelD> exact(coords.size()), local(coords.size());
+    ASSERT_EQ(converter.coordinatesToPixels(coords, exact, ProjectionMode::Exact), coords.size());
+    ASSERT_EQ(converter.coordinatesToPixels(coords, local, ProjectionMode::Local), coords.size());
+
+    // both round to whole pixels, so the results only differ when
+    // the value is on a rounding boundary
+    std::size_t mismatches = 0;
+    for (std::size_t idx = 0; idx < coords.size(); idx++) {
+      ASSERT_EQ(exact[idx].x, local[idx].x) << idx;
+      ASSERT_LE(std::abs(exact[idx].y - local[idx].y), 1.0) << idx;
+      mismatches += exact[idx].y != local[idx].y;
+    }
+
+    EXPECT_LT(mismatches, coords.size() / 1000) << latitude;
+
+    auto single = converter.coordinateToPixel(coords[123]);
+    EXPECT_EQ(single.x, exact[123].x);
+    EXPECT_EQ(single.y, exact[123].y);
+  }
+}
+
+TEST_F(CoordinateToPixelConverterTests, auto_falls_back_to_exact) {
+  CoordinateToPixelConverter<double> converter{};
+  std::vector<Coordinate<>> coords{kCoordinate_NYC, kCoordinate_SFO};
+  EXPECT_FALSE(GetCoordinateBounds<double>(coords).isLocal());
+
+  std::vector<PixelD> pixels(2);
+  converter.coordinatesToPixels(coords, pixels);
+  EXPECT_EQ(pixels[1].x, converter.coordinateToPixel(kCoordinate_SFO).x);
+  EXPECT_EQ(pixels[1].y, converter.coordinateToPixel(kCoordinate_SFO).y);
+
+  std::vector<double> distances(2);
+  CalculateDistances(coords, distances, MetricUnit::Kilometer);
+  EXPECT_EQ(distances[1], CalculateDistance(kCoordinate_NYC, kCoordinate_SFO, MetricUnit::Kilometer));
+}
+
+TEST_F(CoordinateToPixelConverterTests, local_distances_match_great_circle) {
+  auto coords = MakeTrack(4000);
+  std::vector<double> exact(coords.size()), local(coords.size());
+  CalculateDistances(coords, exact, MetricUnit::Meter, true, ProjectionMode::Exact);
+  CalculateDistances(coords, local, MetricUnit::Meter, true, ProjectionMode::Local);
+
+  EXPECT_EQ(local[0], 0.0);
+  EXPECT_GT(local.back(), 4000.0);
+
+  // `acos` loses ~mm per meter long segment, the sum is far more accurate
+  EXPECT_NEAR(local.back(), exact.back(), exact.back() * 1e-4);
+
+  // a single long segment
+  std::vector<Coordinate<>> pair{coords[0], coords[2000]};
+  std::vector<double> segment(2);
+  CalculateDistances(pair, segment, MetricUnit::Meter, false, ProjectionMode::Local);
+  EXPECT_NEAR(segment[1], CalculateDistance(coords[0], coords[2000]), 0.05);
+}
+
+TEST_F(CoordinateToPixelConverterTests, benchmark_batch_projection) {
+  auto coords = MakeTrack(1 << 20);
+  CoordinateToPixelConverter<double> converter{};
+  std::vector<PixelD> pixels(coords.size());
+
+  auto timeIt = [&](auto&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+  };
+
+  auto singleMs = timeIt([&] {
+    for (std::size_t idx = 0; idx < coords.size(); idx++) {
+      pixels[idx] = converter.coordinateToPixel(coords[idx]);
+    }
+  });
+  auto batchMs = timeIt([&] {
+    converter.coordinatesToPixels(coords, pixels);
+  });
+
+  std::vector<double> distances(coords.size());
+  auto distanceSingleMs = timeIt([&] {
+    for (std::size_t idx = 1; idx < coords.size(); idx++) {
+      distances[idx] = CalculateDistance(coords[idx - 1], coords[idx]);
+    }
+  });
+  auto distanceBatchMs = timeIt([&] {
+    CalculateDistances(coords, distances);
+  });
+
+  L->info(
+    "{} coordinates, projection {:.2f}ms -> {:.2f}ms, distances {:.2f}ms -> {:.2f}ms",
+    coords.size(),
+    singleMs,
+    batchMs,
+    distanceSingleMs,
+    distanceBatchMs
+  );
+
+  EXPECT_GT(pixels.back().x, 0.0);
+}
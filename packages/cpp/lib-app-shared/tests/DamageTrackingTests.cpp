@@ -0,0 +1,176 @@
+#include <chrono>
+#include <cstring>
+#include <numeric>
+#include <gtest/gtest.h>
+
+#include <IRacingTools/Shared/Graphics/DamageTracking.h>
+#include <IRacingTools/Shared/Logging/LoggingManager.h>
+
+using namespace IRacingTools::Shared::Logging;
+using namespace IRacingTools::Shared::Graphics;
+
+namespace {
+
+  class DamageTrackingTests;
+
+  auto L = GetCategoryWithType<DamageTrackingTests>();
+
+  class DamageTrackingTests : public testing::Test {
+  protected:
+    DamageTrackingTests() = default;
+
+    virtual void TearDown() override {
+      L->flush();
+    }
+  };
+
+  std::vector<std::uint8_t> MakeFrame(const DamageFrameLayout &layout) {
+    std::vector<std::uint8_t> frame(layout.size());
+    std::iota(frame.begin(), frame.end(), std::uint8_t{0});
+    return frame;
+  }
+
+  void Touch(std::vector<std::uint8_t> &frame, const DamageFrameLayout &layout, std::uint32_t x, std::uint32_t y) {
+    frame[static_cast<std::size_t>(y) * layout.stride + x * layout.bpp + 1] ^= 0xFF;
+  }
+} // namespace
+
+TEST_F(DamageTrackingTests, diff_finds_changed_tiles) {
+  // 100x70 HAS PARTIAL TILES ON THE RIGHT & BOTTOM EDGES
+  DamageFrameLayout layout{100, 70, 100 * 4, 4};
+  auto previous = MakeFrame(layout);
+  auto current = previous;
+
+  EXPECT_TRUE(DiffTiles(previous.data(), current.data(), layout).empty());
+
+  Touch(current, layout, 5, 5);
+  Touch(current, layout, 99, 69);
+  Touch(current, layout, 40, 33);
+
+  auto damage = DiffTiles(previous.data(), current.data(), layout);
+  ASSERT_EQ(damage.size(), 3);
+  EXPECT_EQ(damage[0], (DamageRect{0, 0, 32, 32}));
+  EXPECT_EQ(damage[1], (DamageRect{32, 32, 32, 32}));
+  EXPECT_EQ(damage[2], (DamageRect{96, 64, 4, 6}));
+
+  // COPYING THE DAMAGE MAKES THE FRAMES EQUAL AGAIN
+  CopyDamageRects(current.data(), previous.data(), layout, damage);
+  EXPECT_EQ(previous, current);
+}
+
+TEST_F(DamageTrackingTests, merge_joins_and_limits_rects) {
+  // A 3x2 BLOCK OF TILES COLLAPSES TO ONE RECT
+  std::vector<DamageRect> block{};
+  for (std::uint32_t y = 0; y < 2; y++) {
+    for (std::uint32_t x = 0; x < 3; x++)
+      block.push_back({x * 32, y * 32, 32, 32});
+  }
+
+  auto merged = MergeDamageRects(block);
+  ASSERT_EQ(merged.size(), 1);
+  EXPECT_EQ(merged[0], (DamageRect{0, 0, 96, 64}));
+
+  // SCATTERED TILES ARE KEPT UNTIL THE LIMIT, THEN THE CLOSEST ARE MERGED
+  std::vector<DamageRect> scattered{{0, 0, 32, 32}, {64, 0, 32, 32}, {512, 512, 32, 32}, {0, 0, 0, 32}};
+  merged = MergeDamageRects(scattered, 3);
+  EXPECT_EQ(merged.size(), 3);
+
+  merged = MergeDamageRects(scattered, 2);
+  ASSERT_EQ(merged.size(), 2);
+  EXPECT_NE(std::ranges::find(merged, DamageRect{0, 0, 96, 32}), merged.end());
+  EXPECT_NE(std::ranges::find(merged, DamageRect{512, 512, 32, 32}), merged.end());
+
+  // EVERY INPUT RECT STAYS COVERED
+  std::vector<DamageRect> many{};
+  for (std::uint32_t idx = 0; idx < 200; idx++)
+    many.push_back({(idx * 97) % 1900, (idx * 61) % 1000, 32, 32});
+
+  merged = MergeDamageRects(many, 8);
+  EXPECT_LE(merged.size(), 8);
+  for (auto &rect : many) {
+    EXPECT_TRUE(std::ranges::any_of(merged, [&](auto &cover) {
+      return UnionDamageRect(cover, rect) == cover;
+    }));
+  }
+}
+
+TEST_F(DamageTrackingTests, history_spans_frames) {
+  DamageHistory history(4);
+  history.push(1, std::nullopt);
+  history.push(2, std::vector<DamageRect>{{0, 0, 32, 32}});
+  history.push(3, std::vector<DamageRect>{{32, 0, 32, 32}});
+
+  EXPECT_FALSE(history.since(0, 3).has_value());
+  EXPECT_FALSE(history.since(0, 1).has_value());
+  EXPECT_TRUE(history.since(3, 3)->empty());
+
+  auto damage = history.since(1, 3);
+  ASSERT_TRUE(damage.has_value());
+  ASSERT_EQ(damage->size(), 1);
+  EXPECT_EQ(damage->front(), (DamageRect{0, 0, 64, 32}));
+
+  // FULL FRAME DAMAGE & FRAMES OLDER THAN THE HISTORY ARE UNKNOWN
+  history.push(4, std::nullopt);
+  EXPECT_FALSE(history.since(3, 4).has_value());
+  history.push(5, std::vector<DamageRect>{});
+  history.push(6, std::vector<DamageRect>{});
+  EXPECT_FALSE(history.since(1, 6).has_value());
+  EXPECT_TRUE(history.since(4, 6)->empty());
+
+  // FRAME INDEXES GOING BACKWARDS DROP THE HISTORY
+  history.push(2, std::vector<DamageRect>{});
+  EXPECT_FALSE(history.since(5, 6).has_value());
+}
+
+TEST_F(DamageTrackingTests, BenchmarkDiffAndPartialCopy) {
+  DamageFrameLayout layout{1920, 1080, 1920 * 4, 4};
+  auto previous = MakeFrame(layout);
+  auto current = previous;
+  std::vector<std::uint8_t> target(layout.size());
+
+  // A FEW CHANGED DIGITS, AS A WIDGET TYPICALLY PRODUCES
+  for (std::uint32_t y = 500; y < 540; y++) {
+    for (std::uint32_t x = 900; x < 980; x++)
+      Touch(current, layout, x, y);
+  }
+
+#ifdef DEBUG
+  constexpr int Iterations = 20;
+#else
+  constexpr int Iterations = 200;
+#endif
+
+  auto timeIt = [&](auto &&fn) {
+    auto start = std::chrono::steady_clock::now();
+    for (int idx = 0; idx < Iterations; idx++)
+      fn();
+
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / Iterations;
+  };
+
+  auto fullCopyMicros = timeIt([&] { std::memcpy(target.data(), current.data(), layout.size()); });
+
+  std::vector<DamageRect> damage{};
+  auto diffMicros = timeIt([&] {
+    damage = MergeDamageRects(DiffTiles(previous.data(), current.data(), layout));
+    CopyDamageRects(current.data(), target.data(), layout, damage);
+  });
+
+  auto unchangedMicros = timeIt([&] { DiffTiles(previous.data(), previous.data(), layout); });
+
+  std::uint64_t damagedArea = 0;
+  for (auto &rect : damage)
+    damagedArea += rect.area();
+
+  L->info(
+    "1080p frame: full copy {:.1f}us, diff + partial copy {:.1f}us ({} rects, {} px), unchanged diff {:.1f}us",
+    fullCopyMicros,
+    diffMicros,
+    damage.size(),
+    damagedArea,
+    unchangedMicros
+  );
+
+  ASSERT_EQ(damage.size(), 1);
+  EXPECT_EQ(damage[0], (DamageRect{896, 480, 96, 64}));
+}
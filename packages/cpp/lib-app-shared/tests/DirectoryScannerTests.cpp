@@ -0,0 +1,227 @@
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <gtest/gtest.h>
+
+#include <IRacingTools/Shared/DirectoryScanner.h>
+#include <IRacingTools/Shared/FileSystemHelpers.h>
+#include <IRacingTools/Shared/Logging/LoggingManager.h>
+
+using namespace IRacingTools::Shared;
+using namespace IRacingTools::Shared::FileSystem;
+using namespace IRacingTools::Shared::Logging;
+
+namespace {
+  class DirectoryScannerTests;
+
+  auto L = GetCategoryWithType<DirectoryScannerTests>();
+
+  class DirectoryScannerTests : public testing::Test {
+  protected:
+    DirectoryScannerTests() = default;
+
+    virtual void SetUp() override {
+      auto testName = testing::UnitTest::GetInstance()->current_test_info()->name();
+      root_ = GetTemporaryDirectory("directory-scanner") / testName;
+      fs::remove_all(root_);
+      fs::create_directories(root_ / "data");
+    }
+
+    virtual void TearDown() override {
+      std::error_code ignored{};
+      fs::remove_all(root_, ignored);
+      L->flush();
+    }
+
+    fs::path dataPath() const {
+      return root_ / "data";
+    }
+
+    DirectoryScanner::Options options() const {
+      return {.enumerate = {.extension = ".ibt"}, .cacheFile = root_ / "fingerprints.bin"};
+    }
+
+    fs::path root_{};
+  };
+
+  void WriteFile(const fs::path &file, const std::string &content = "ibt") {
+    fs::create_directories(file.parent_path());
+    std::ofstream(file, std::ios::binary | std::ios::trunc) << content;
+  }
+
+  /**
+   * @brief Scan & mark every reported file processed
+   */
+  std::expected<DirectoryScanner::ScanResult, IRacingTools::SDK::GeneralError>
+  ScanAndProcess(DirectoryScanner &scanner, const std::vector<fs::path> &paths) {
+    auto res = scanner.scan(paths);
+    if (res) {
+      for (auto &file: res->changed)
+        scanner.markProcessed(file);
+    }
+
+    return res;
+  }
+} // namespace
+
+TEST_F(DirectoryScannerTests, reports_new_changed_and_removed_files) {
+  auto a = dataPath() / "a.ibt";
+  auto b = dataPath() / "nested" / "b.ibt";
+  auto c = dataPath() / "nested" / "deeper" / "c.ibt";
+  WriteFile(a);
+  WriteFile(b);
+  WriteFile(c);
+  WriteFile(dataPath() / "notes.txt");
+
+  DirectoryScanner scanner(options());
+  auto res = ScanAndProcess(scanner, {dataPath()});
+  ASSERT_TRUE(res.has_value()) << res.error().what();
+  EXPECT_EQ(res->fileCount, 3);
+  EXPECT_EQ(res->changed.size(), 3);
+
+  res = ScanAndProcess(scanner, {dataPath()});
+  ASSERT_TRUE(res.has_value());
+  EXPECT_TRUE(res->changed.empty());
+  EXPECT_TRUE(res->removed.empty());
+
+  WriteFile(b, "ibt, but longer");
+  fs::remove(c);
+  auto d = dataPath() / "d.ibt";
+  WriteFile(d);
+
+  res = ScanAndProcess(scanner, {dataPath()});
+  ASSERT_TRUE(res.has_value());
+  ASSERT_EQ(res->changed.size(), 2);
+  EXPECT_NE(std::ranges::find(res->changed, fs::absolute(b)), res->changed.end());
+  EXPECT_NE(std::ranges::find(res->changed, fs::absolute(d)), res->changed.end());
+  ASSERT_EQ(res->removed.size(), 1);
+  EXPECT_EQ(res->removed[0], fs::absolute(c));
+
+  // SAME SIZE, NEWER WRITE TIME
+  fs::last_write_time(a, fs::last_write_time(a) + std::chrono::hours(1));
+  res = ScanAndProcess(scanner, {dataPath()});
+  ASSERT_TRUE(res.has_value());
+  ASSERT_EQ(res->changed.size(), 1);
+  EXPECT_EQ(res->changed[0], fs::absolute(a));
+
+  // FORGOTTEN FILES ARE REPORTED AGAIN
+  scanner.forget(d);
+  res = scanner.scan({dataPath()});
+  ASSERT_TRUE(res.has_value());
+  ASSERT_EQ(res->changed.size(), 1);
+  EXPECT_EQ(res->changed[0], fs::absolute(d));
+}
+
+TEST_F(DirectoryScannerTests, persists_fingerprints) {
+  WriteFile(dataPath() / "a.ibt");
+  WriteFile(dataPath() / "b.ibt");
+
+  {
+    DirectoryScanner scanner(options());
+    auto res = ScanAndProcess(scanner, {dataPath()});
+    ASSERT_TRUE(res.has_value());
+    EXPECT_EQ(res->changed.size(), 2);
+    ASSERT_FALSE(scanner.save().has_value());
+  }
+
+  WriteFile(dataPath() / "c.ibt");
+
+  DirectoryScanner scanner(options());
+  auto res = ScanAndProcess(scanner, {dataPath()});
+  ASSERT_TRUE(res.has_value());
+  ASSERT_EQ(res->changed.size(), 1);
+  EXPECT_EQ(res->changed[0].filename(), "c.ibt");
+  EXPECT_EQ(scanner.size(), 3);
+
+  scanner.clear();
+  EXPECT_FALSE(fs::exists(root_ / "fingerprints.bin"));
+  res = scanner.scan({dataPath()});
+  ASSERT_TRUE(res.has_value());
+  EXPECT_EQ(res->changed.size(), 3);
+}
+
+TEST_F(DirectoryScannerTests, keeps_other_roots_and_fails_missing_roots) {
+  auto other = root_ / "other";
+  WriteFile(dataPath() / "a.ibt");
+  WriteFile(other / "b.ibt");
+
+  DirectoryScanner scanner(options());
+  ASSERT_TRUE(ScanAndProcess(scanner, {dataPath(), other}).has_value());
+
+  // SCANNING ONE ROOT DOES NOT REMOVE THE OTHER
+  auto res = scanner.scan({other});
+  ASSERT_TRUE(res.has_value());
+  EXPECT_TRUE(res->removed.empty());
+  EXPECT_EQ(scanner.size(), 2);
+
+  EXPECT_FALSE(scanner.scan({root_ / "missing"}).has_value());
+  EXPECT_EQ(scanner.size(), 2);
+}
+
+TEST_F(DirectoryScannerTests, unprocessed_files_are_reported_again) {
+  auto a = dataPath() / "a.ibt";
+  auto b = dataPath() / "b.ibt";
+  WriteFile(a);
+  WriteFile(b);
+
+  {
+    DirectoryScanner scanner(options());
+    auto res = scanner.scan({dataPath()});
+    ASSERT_TRUE(res.has_value());
+    EXPECT_EQ(res->changed.size(), 2);
+
+    // ONLY `a` IS PROCESSED BEFORE SHUTDOWN, `b` WAS STILL QUEUED
+    scanner.markProcessed(a);
+    ASSERT_FALSE(scanner.save().has_value());
+
+    res = scanner.scan({dataPath()});
+    ASSERT_TRUE(res.has_value());
+    ASSERT_EQ(res->changed.size(), 1);
+    EXPECT_EQ(res->changed[0], fs::absolute(b));
+  }
+
+  DirectoryScanner scanner(options());
+  auto res = scanner.scan({dataPath()});
+  ASSERT_TRUE(res.has_value());
+  ASSERT_EQ(res->changed.size(), 1);
+  EXPECT_EQ(res->changed[0], fs::absolute(b));
+  EXPECT_EQ(scanner.size(), 1);
+}
+
+TEST_F(DirectoryScannerTests, benchmark_unchanged_rescan) {
+  constexpr int DirectoryCount = 100;
+  constexpr int FilesPerDirectory = 100;
+  for (int dirIdx = 0; dirIdx < DirectoryCount; dirIdx++) {
+    for (int fileIdx = 0; fileIdx < FilesPerDirectory; fileIdx++) {
+      WriteFile(dataPath() / std::format("session-{}", dirIdx) / std::format("lap-{}.ibt", fileIdx));
+    }
+  }
+
+  auto timeIt = [](auto &&fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+  };
+
+  auto serialFiles = EnumerateFiles({dataPath()}, {.extension = ".ibt"});
+  auto parallelFiles = EnumerateFiles({dataPath()}, {.extension = ".ibt", .threadCount = 4});
+  ASSERT_TRUE(serialFiles.has_value() && parallelFiles.has_value());
+  EXPECT_EQ(serialFiles->size(), DirectoryCount * FilesPerDirectory);
+  EXPECT_EQ(parallelFiles->size(), serialFiles->size());
+
+  DirectoryScanner scanner(options());
+  std::size_t changed = 0;
+  auto coldMs = timeIt([&] {
+    changed = ScanAndProcess(scanner, {dataPath()})->changed.size();
+  });
+  EXPECT_EQ(changed, DirectoryCount * FilesPerDirectory);
+  ASSERT_FALSE(scanner.save().has_value());
+
+  DirectoryScanner reloaded(options());
+  auto warmMs = timeIt([&] {
+    changed = reloaded.scan({dataPath()})->changed.size();
+  });
+  EXPECT_EQ(changed, 0);
+
+  L->info("{} files, cold scan {:.2f}ms, unchanged rescan {:.2f}ms", DirectoryCount * FilesPerDirectory, coldMs, warmMs);
+}
@@ -1,5 +1,6 @@
 #include <ctime>
 
+#include <IRacingTools/SDK/Utils/FileHelpers.h>
 #include <IRacingTools/Shared/FileSystemHelpers.h>
 #include <IRacingTools/Shared/FileWatcher.h>
 #include <IRacingTools/Shared/Logging/LoggingManager.h>
@@ -1,15 +1,14 @@
-#include <IRacingTools/SDK/Utils/ConsoleHelpers.h>
-#include <IRacingTools/Shared/FileSystemHelpers.h>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
 #include <IRacingTools/Shared/FileWatcher.h>
-#include <IRacingTools/Shared/Logging/LoggingManager.h>
 
-#include <fmt/core.h>
 #include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
 
-using namespace IRacingTools::Shared::Logging;
-using namespace IRacingTools::SDK;
-using namespace IRacingTools::SDK::Utils;
-using namespace IRacingTools::Shared;
 using namespace IRacingTools::Shared::FileSystem;
 using namespace  std::chrono_literals;
 
@@ -17,16 +16,29 @@ namespace fs = std::filesystem;
 
 namespace {
 
-  class FileWatcherTests;
+  // PORTABLE HELPERS ONLY, THE WATCHER IS ALSO TESTED ON LINUX (INOTIFY)
+  auto L = spdlog::default_logger();
+
+  fs::path GetTestDirectory(const std::string& name) {
+    auto path = fs::temp_directory_path() / "filewatch-tests" / name;
+    fs::remove_all(path);
+    fs::create_directories(path);
+    return path;
+  }
 
-  auto L = GetCategoryWithType<FileWatcherTests>();
+  bool WriteTestFile(const fs::path& path, const std::string& text) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << text;
+    file.close();
+    return !file.fail();
+  }
 
   class FileWatcherTests : public testing::Test {
   protected:
     FileWatcherTests() = default;
 
     virtual void SetUp() override {
-      L->flush_on(Level::trace);
+      L->flush_on(spdlog::level::trace);
     }
 
     virtual void TearDown() override {
@@ -36,7 +48,7 @@ namespace {
 }// namespace
 
 TEST_F(FileWatcherTests, watch) {
-    auto tmpPath = GetTemporaryDirectory("filewatch-tests");
+    auto tmpPath = GetTestDirectory("watch");
     L->info("FileUtilTests using temp dir ({})", tmpPath.string());
     std::atomic_int changeCount = 0;
     FileWatcher watch(
@@ -52,12 +64,135 @@ TEST_F(FileWatcherTests, watch) {
     auto file1 = tmpPath / "test.dat";
     spdlog::info("FileUtilTests file1 ({})", file1.string());
 
-    auto res = Utils::WriteTextFile(file1, "test123");
-    EXPECT_TRUE(res.has_value()) << "Failed to write file1";
+    EXPECT_TRUE(WriteTestFile(file1, "test123")) << "Failed to write file1";
 
     std::this_thread::sleep_for(1s);
     EXPECT_EQ(changeCount, 2);
 
     watch.stop();
 
-}
\ No newline at end of file
+}
+TEST_F(FileWatcherTests, debounce_coalesces_writes) {
+    auto tmpPath = GetTestDirectory("debounce");
+
+    std::mutex eventsMutex{};
+    std::vector<std::pair<fs::path, WatchEvent>> events{};
+    FileWatcher watch(
+        tmpPath,
+        [&](auto& data, auto changeType) {
+            std::scoped_lock lock(eventsMutex);
+            events.emplace_back(data.path, changeType);
+        },
+        FileWatcher::Options{.debounce = 300ms, .flushOnCloseWrite = false}
+    );
+
+    watch.start();
+
+    // A FILE BEING RECORDED, APPENDED TO MANY TIMES
+    auto file1 = tmpPath / "recording.ibt";
+    {
+        std::ofstream out(file1, std::ios::binary);
+        for (int idx = 0; idx < 20; idx++) {
+            out << "sample" << idx;
+            out.flush();
+            std::this_thread::sleep_for(10ms);
+        }
+    }
+
+    std::this_thread::sleep_for(100ms);
+    {
+        std::scoped_lock lock(eventsMutex);
+        EXPECT_TRUE(events.empty()) << "Delivered before the file was quiet";
+    }
+
+    std::this_thread::sleep_for(1s);
+    watch.stop();
+
+    ASSERT_EQ(events.size(), 1);
+    EXPECT_EQ(events[0].first, file1);
+    EXPECT_EQ(events[0].second, WatchEvent::Added);
+}
+
+TEST_F(FileWatcherTests, watches_new_subdirectories) {
+    auto tmpPath = GetTestDirectory("recursive");
+
+    std::mutex eventsMutex{};
+    std::vector<fs::path> files{};
+    FileWatcher watch(
+        tmpPath,
+        [&](auto& data, auto) {
+            std::scoped_lock lock(eventsMutex);
+            files.push_back(data.path);
+        },
+        FileWatcher::Options{.debounce = 100ms}
+    );
+
+    watch.start();
+
+    auto file1 = tmpPath / "session" / "nested" / "lap.ibt";
+    fs::create_directories(file1.parent_path());
+    EXPECT_TRUE(WriteTestFile(file1, "test123")) << "Failed to write file1";
+
+    std::this_thread::sleep_for(1s);
+    watch.stop();
+
+    ASSERT_EQ(files.size(), 1);
+    EXPECT_EQ(files[0], file1);
+}
+
+TEST_F(FileWatcherTests, stop_flushes_debounced_events) {
+    auto tmpPath = GetTestDirectory("stop-flush");
+
+    std::mutex eventsMutex{};
+    std::vector<fs::path> files{};
+    FileWatcher watch(
+        tmpPath,
+        [&](auto& data, auto) {
+            std::scoped_lock lock(eventsMutex);
+            files.push_back(data.path);
+        },
+        FileWatcher::Options{.debounce = 10s, .flushOnCloseWrite = false}
+    );
+
+    watch.start();
+
+    auto file1 = tmpPath / "pending.ibt";
+    EXPECT_TRUE(WriteTestFile(file1, "test123")) << "Failed to write file1";
+
+    // STILL DEBOUNCING WHEN STOPPED
+    std::this_thread::sleep_for(500ms);
+    {
+        std::scoped_lock lock(eventsMutex);
+        EXPECT_TRUE(files.empty());
+    }
+
+    watch.stop();
+
+    ASSERT_EQ(files.size(), 1);
+    EXPECT_EQ(files[0], file1);
+}
+
+#ifndef _WIN32
+TEST_F(FileWatcherTests, close_write_ends_debounce) {
+    auto tmpPath = GetTestDirectory("close-write");
+
+    std::atomic_int changeCount = 0;
+    FileWatcher watch(
+        tmpPath,
+        [&](auto& data, auto) {
+            EXPECT_TRUE(data.closedAfterWrite);
+            ++changeCount;
+        },
+        FileWatcher::Options{.debounce = 10s}
+    );
+
+    watch.start();
+
+    EXPECT_TRUE(WriteTestFile(tmpPath / "copied.ibt", "test123")) << "Failed to write file1";
+
+    std::this_thread::sleep_for(500ms);
+    EXPECT_EQ(changeCount, 1);
+
+    watch.stop();
+}
+#endif
@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+
+#include <IRacingTools/Shared/Graphics/FramePacer.h>
+#include <IRacingTools/Shared/Logging/LoggingManager.h>
+
+using namespace IRacingTools::Shared::Logging;
+using namespace IRacingTools::Shared::Graphics;
+using namespace std::chrono_literals;
+
+namespace {
+
+  class FramePacerTests;
+
+  auto L = GetCategoryWithType<FramePacerTests>();
+
+  class FramePacerTests : public testing::Test {
+  protected:
+    FramePacerTests() = default;
+
+    virtual void TearDown() override {
+      L->flush();
+    }
+  };
+
+  /**
+   * @brief Time only moves when told to
+   */
+  struct FakeClock {
+    FramePacer::TimePoint now{std::chrono::seconds(1000)};
+
+    FramePacer::TimePoint advance(FramePacer::Duration duration) {
+      now += duration;
+      return now;
+    }
+  };
+} // namespace
+
+TEST_F(FramePacerTests, renders_only_new_frames_up_to_max_fps) {
+  FakeClock clock;
+  FramePacer pacer;
+  pacer.reset(2);
+
+  // NOTHING NEW, NOTHING TO RENDER
+  EXPECT_FALSE(pacer.shouldRender(0, 10, false, clock.now));
+
+  // A 60HZ PRODUCER LIMITED TO 10FPS, FOR 1 SECOND
+  std::uint32_t rendered = 0;
+  for (int frame = 0; frame < 60; frame++) {
+    if (pacer.shouldRender(0, 10, true, clock.now)) {
+      pacer.markRendered(0, clock.now);
+      rendered++;
+    }
+    clock.advance(FramePacer::Duration(1s) / 60);
+  }
+
+  EXPECT_EQ(rendered, 10);
+
+  // OVERLAY 1 USES THE DEFAULT (90FPS), SO EVERY 60HZ FRAME IS RENDERED
+  for (int frame = 0; frame < 10; frame++) {
+    ASSERT_TRUE(pacer.shouldRender(1, 0, true, clock.now));
+    pacer.markRendered(1, clock.now);
+    clock.advance(FramePacer::Duration(1s) / 60);
+  }
+
+  auto metrics = pacer.metrics(clock.now);
+  ASSERT_EQ(metrics.overlays.size(), 2);
+  EXPECT_EQ(metrics.overlays[0].rendered, 10);
+  EXPECT_EQ(metrics.overlays[0].skipped, 10);
+  EXPECT_DOUBLE_EQ(metrics.overlays[0].maxFPS, 10);
+  EXPECT_NEAR(metrics.overlays[0].fps, 10, 2);
+  EXPECT_DOUBLE_EQ(metrics.overlays[1].maxFPS, 90);
+  EXPECT_EQ(metrics.overlays[1].skipped, 0);
+}
+
+TEST_F(FramePacerTests, wakes_for_held_back_frames) {
+  FakeClock clock;
+  FramePacer pacer;
+  pacer.reset(1);
+
+  ASSERT_TRUE(pacer.shouldRender(0, 4, true, clock.now));
+  pacer.markRendered(0, clock.now);
+  pacer.markSubmitted(clock.now);
+  auto submittedAt = clock.now;
+
+  // THE LAST FRAME OF A BURST IS HELD BACK, BUT RENDERED ONCE DUE
+  clock.advance(10ms);
+  ASSERT_FALSE(pacer.shouldRender(0, 4, true, clock.now));
+
+  auto wakeAt = pacer.nextWakeAt(clock.now);
+  EXPECT_GT(wakeAt, clock.now);
+  EXPECT_LE(wakeAt - clock.now, 250ms);
+
+  clock.now = wakeAt;
+  EXPECT_TRUE(pacer.shouldRender(0, 4, true, clock.now));
+  pacer.markRendered(0, clock.now);
+
+  // NOTHING HELD BACK, THE KEEP ALIVE IS NEXT
+  EXPECT_EQ(pacer.nextWakeAt(clock.now), submittedAt + FramePacer::Options{}.keepAliveInterval);
+}
+
+TEST_F(FramePacerTests, submits_once_per_consumer_frame) {
+  FakeClock clock;
+  FramePacer pacer;
+  pacer.reset(1);
+
+  // A 90HZ CONSUMER
+  std::uint64_t consumerFrame = 0;
+  for (int idx = 0; idx < 90; idx++) {
+    pacer.observeConsumerFrame(consumerFrame++, clock.now);
+    clock.advance(FramePacer::Duration(1s) / 90);
+  }
+
+  ASSERT_TRUE(pacer.consumerPeriod().has_value());
+  EXPECT_NEAR(pacer.metrics(clock.now).consumerFPS, 90, 1);
+
+  // CHANGES EVERY 2MS ARE SUBMITTED AT THE CONSUMER RATE
+  std::uint32_t submitted = 0;
+  for (int idx = 0; idx < 500; idx++) {
+    if (pacer.shouldSubmit(true, clock.now)) {
+      pacer.markSubmitted(clock.now);
+      submitted++;
+    }
+    clock.advance(2ms);
+  }
+
+  EXPECT_GE(submitted, 80);
+  EXPECT_LE(submitted, 100);
+
+  // A DEFERRED SUBMIT WAKES THE RENDERER BEFORE THE NEXT CONSUMER FRAME
+  pacer.markSubmitted(clock.now);
+  EXPECT_FALSE(pacer.shouldSubmit(true, clock.now));
+  EXPECT_LE(pacer.nextWakeAt(clock.now) - clock.now, *pacer.consumerPeriod());
+
+  // AN IDLE CONSUMER IS FORGOTTEN
+  clock.advance(2s);
+  pacer.observeConsumerFrame(consumerFrame, clock.now);
+  EXPECT_FALSE(pacer.consumerPeriod().has_value());
+}
+
+TEST_F(FramePacerTests, keeps_overlays_alive) {
+  FakeClock clock;
+  FramePacer::Options options{};
+  FramePacer pacer(options);
+  pacer.reset(1);
+
+  // THE FIRST SUBMIT IS IMMEDIATE
+  ASSERT_TRUE(pacer.shouldSubmit(false, clock.now));
+  pacer.markSubmitted(clock.now);
+
+  // UNCHANGED CANVAS IS ONLY RESUBMITTED FOR THE KEEP ALIVE
+  clock.advance(options.keepAliveInterval / 2);
+  EXPECT_FALSE(pacer.shouldSubmit(false, clock.now));
+  EXPECT_EQ(pacer.nextWakeAt(clock.now), clock.now + options.keepAliveInterval / 2);
+
+  clock.advance(options.keepAliveInterval / 2);
+  EXPECT_TRUE(pacer.shouldSubmit(false, clock.now));
+  pacer.markSubmitted(clock.now);
+
+  // A LAYOUT CHANGE RESUBMITS RIGHT AWAY
+  clock.advance(1ms);
+  pacer.reset(2);
+  EXPECT_TRUE(pacer.shouldSubmit(false, clock.now));
+}
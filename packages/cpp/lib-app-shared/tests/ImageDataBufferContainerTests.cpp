@@ -0,0 +1,179 @@
+// `ImageDataBuffer` & its container pull in `SHM.h` & the DX headers
+#ifdef _WIN32
+#include <atomic>
+#include <cstring>
+#include <random>
+#include <thread>
+#include <gtest/gtest.h>
+
+#include <IRacingTools/Shared/Graphics/ImageDataBufferContainer.h>
+#include <IRacingTools/Shared/Graphics/ImageDataBufferPool.h>
+#include <IRacingTools/Shared/Graphics/PixelConversion.h>
+#include <IRacingTools/Shared/Logging/LoggingManager.h>
+
+using namespace IRacingTools::Shared::Logging;
+using namespace IRacingTools::Shared::Graphics;
+
+namespace {
+
+  class ImageDataBufferContainerTests;
+
+  auto L = GetCategoryWithType<ImageDataBufferContainerTests>();
+
+  class ImageDataBufferContainerTests : public testing::Test {
+  protected:
+    ImageDataBufferContainerTests() = default;
+
+    virtual void TearDown() override {
+      L->flush();
+    }
+  };
+
+  std::vector<std::uint8_t> RandomPixels(std::size_t size) {
+    std::mt19937 rng(size);
+    std::vector<std::uint8_t> pixels(size);
+    for (auto &value : pixels)
+      value = static_cast<std::uint8_t>(rng());
+
+    return pixels;
+  }
+} // namespace
+
+TEST_F(ImageDataBufferContainerTests, buffer_keeps_capacity_on_resize) {
+  auto pool = std::make_shared<ImageDataBufferPool>();
+  BGRAImageDataBuffer buffer(800, 600, pool);
+  auto capacity = buffer.capacity();
+  std::vector<std::uint8_t> frame(800 * 600 * 4, 0x7F);
+
+  // SHRINKING & GROWING BACK DOES NOT ALLOCATE
+  buffer.resize(400, 300);
+  buffer.resize(800, 600);
+  EXPECT_EQ(buffer.capacity(), capacity);
+  EXPECT_EQ(pool->metrics().allocations, 1);
+
+  // UNTIL THE BUFFER IS UNDERUSED FOR LONG ENOUGH
+  buffer.resize(400, 300);
+  for (std::uint32_t idx = 0; idx < BGRAImageDataBuffer::ShrinkAfterFrames; idx++)
+    ASSERT_TRUE(buffer.produce(frame.data(), buffer.size()));
+
+  EXPECT_LT(buffer.capacity(), capacity);
+  EXPECT_GE(buffer.capacity(), buffer.size());
+}
+
+TEST_F(ImageDataBufferContainerTests, resize_does_not_thrash) {
+  auto pool = ImageDataBufferPool::Default();
+  BGRAImageDataBufferContainer container(320, 240);
+  auto consumer = container.newBuffer();
+  std::vector<std::uint8_t> frame(340 * 260 * 4, 0x10);
+
+  auto allocations = pool->metrics().allocations;
+  for (std::uint32_t idx = 0; idx < 40; idx++) {
+    // A WINDOW RESIZE DRAG, BACK & FORTH
+    auto delta = idx % 20 < 10 ? idx % 10 : 10 - idx % 10;
+    ASSERT_TRUE(container.resize(320 + delta * 2, 240 + delta * 2));
+    frame[idx] = static_cast<std::uint8_t>(idx);
+    ASSERT_TRUE(container.produce(frame.data(), container.getImageDataSize()));
+    ASSERT_TRUE(container.consume(consumer));
+    EXPECT_EQ(consumer->width(), container.width());
+    EXPECT_EQ(0, std::memcmp(consumer->data(), frame.data(), consumer->size()));
+  }
+
+  // EACH SLOT GROWS ONCE, SHRINKING KEEPS THE CAPACITY
+  EXPECT_LE(pool->metrics().allocations - allocations, 3);
+
+  // NOTHING NEW UNTIL THE NEXT FRAME
+  EXPECT_FALSE(container.consume(consumer));
+  container.destroy();
+  EXPECT_FALSE(container.produce(frame.data(), container.getImageDataSize()));
+}
+
+TEST_F(ImageDataBufferContainerTests, rejected_frame_resets_damage) {
+  BGRAImageDataBufferContainer container(32, 32);
+  auto consumer = container.newBuffer();
+  std::vector<std::uint8_t> frame(container.getImageDataSize(), 0x10);
+
+  // EVERY SLOT HOLDS THE SAME FRAME
+  for (std::uint32_t idx = 0; idx < 4; idx++) {
+    ASSERT_TRUE(container.produce(frame.data(), container.getImageDataSize()));
+    ASSERT_TRUE(container.consume(consumer));
+  }
+
+  // THE PRODUCER SENDS A NEW FRAME THAT IS REJECTED...
+  std::fill(frame.begin(), frame.end(), 0x20);
+  EXPECT_FALSE(container.produce(frame.data(), container.getImageDataSize() - 1));
+
+  // ...THEN ONLY THE DAMAGE RELATIVE TO IT
+  frame[0] = 0x30;
+  std::vector<DamageRect> damage{{0, 0, 1, 1}};
+  ASSERT_TRUE(container.produce(frame.data(), container.getImageDataSize(), std::span<const DamageRect>(damage)));
+  ASSERT_TRUE(container.consume(consumer));
+  EXPECT_EQ(0, std::memcmp(consumer->data(), frame.data(), consumer->size()));
+}
+
+TEST_F(ImageDataBufferContainerTests, handoff_never_tears_frames) {
+  BGRAImageDataBufferContainer container(64, 64);
+  constexpr std::uint32_t FrameCount = 2000;
+
+  std::atomic_bool done{false};
+  std::thread producer([&] {
+    std::vector<std::uint8_t> frame(container.getImageDataSize());
+    for (std::uint32_t idx = 1; idx <= FrameCount; idx++) {
+      std::memset(frame.data(), static_cast<int>(idx & 0xFF), frame.size());
+      EXPECT_TRUE(container.produce(frame.data(), static_cast<std::uint32_t>(frame.size())));
+    }
+    done = true;
+  });
+
+  // EVERY CONSUMED FRAME IS WHOLE & NEWER THAN THE LAST
+  auto consumer = container.newBuffer();
+  std::uint32_t lastFrameIndex = 0, consumed = 0;
+  while (true) {
+    auto finished = done.load();
+    if (!container.consume(consumer)) {
+      if (finished)
+        break;
+
+      continue;
+    }
+
+    auto data = consumer->data();
+    EXPECT_GT(consumer->frameIndex(), lastFrameIndex);
+    EXPECT_EQ(data[0], static_cast<std::uint8_t>(consumer->frameIndex() & 0xFF));
+    EXPECT_EQ(std::memcmp(data, data + 1, consumer->size() - 1), 0);
+    lastFrameIndex = consumer->frameIndex();
+    consumed++;
+  }
+
+  producer.join();
+  EXPECT_GT(consumed, 0);
+}
+
+TEST_F(ImageDataBufferContainerTests, converts_on_produce) {
+  BGRAImageDataBufferContainer container(64, 48);
+  PixelConversion conversion{PixelLayout::RGBA, PixelAlpha::Straight};
+  auto consumer = container.newBuffer();
+  auto frame = RandomPixels(64 * 48 * 4);
+  std::vector<std::uint8_t> expected(64 * 48 * 4);
+
+  for (std::uint32_t idx = 0; idx < 12; idx++) {
+    // A CHANGED PIXEL PER FRAME, THEN A TINT CHANGE HALF WAY
+    frame[(idx * 997) % frame.size()] ^= 0xFF;
+    if (idx == 6)
+      conversion.tint = {1, 1, 1, 0.5f};
+
+    ASSERT_TRUE(container.produce(frame.data(), static_cast<std::uint32_t>(frame.size()), std::nullopt, conversion));
+    ASSERT_TRUE(container.consume(consumer));
+
+    ConvertPixels(frame.data(), expected.data(), 64 * 48, conversion, PixelKernel::Scalar);
+    ASSERT_EQ(std::vector(consumer->data(), consumer->data() + consumer->size()), expected) << idx;
+  }
+
+  // RGB INPUT IS SMALLER THAN THE BUFFER
+  conversion.layout = PixelLayout::RGB;
+  EXPECT_FALSE(container.produce(frame.data(), 64 * 48 * 2, std::nullopt, conversion));
+  ASSERT_TRUE(container.produce(frame.data(), 64 * 48 * 3, std::nullopt, conversion));
+  ASSERT_TRUE(container.consume(consumer));
+  ConvertPixels(frame.data(), expected.data(), 64 * 48, conversion, PixelKernel::Scalar);
+  EXPECT_EQ(std::vector(consumer->data(), consumer->data() + consumer->size()), expected);
+}
+#endif
@@ -0,0 +1,137 @@
+#include <chrono>
+#include <cstring>
+#include <gtest/gtest.h>
+
+#include <IRacingTools/Shared/Graphics/ImageDataBufferPool.h>
+#include <IRacingTools/Shared/Logging/LoggingManager.h>
+
+using namespace IRacingTools::Shared::Logging;
+using namespace IRacingTools::Shared::Graphics;
+
+namespace {
+
+  class ImageDataBufferPoolTests;
+
+  auto L = GetCategoryWithType<ImageDataBufferPoolTests>();
+
+  class ImageDataBufferPoolTests : public testing::Test {
+  protected:
+    ImageDataBufferPoolTests() = default;
+
+    virtual void TearDown() override {
+      L->flush();
+    }
+  };
+} // namespace
+
+TEST_F(ImageDataBufferPoolTests, size_classes) {
+  EXPECT_EQ(ImageDataBufferPool::SizeClass(0), ImageDataBufferPool::Alignment);
+  EXPECT_EQ(ImageDataBufferPool::SizeClass(100), ImageDataBufferPool::Alignment);
+
+  // AT MOST 25% OVER THE REQUESTED SIZE, ALWAYS PAGE ALIGNED
+  for (std::size_t size : {5000ull, 65537ull, 1920ull * 1080 * 4, 1921ull * 1081 * 4}) {
+    auto capacity = ImageDataBufferPool::SizeClass(size);
+    EXPECT_GE(capacity, size);
+    EXPECT_LE(capacity, size + size / 4 + ImageDataBufferPool::Alignment);
+    EXPECT_EQ(capacity % ImageDataBufferPool::Alignment, 0);
+  }
+
+  // SLIGHTLY DIFFERENT SIZES SHARE A CLASS
+  EXPECT_EQ(ImageDataBufferPool::SizeClass(1000 * 1000 * 4), ImageDataBufferPool::SizeClass(1001 * 1001 * 4));
+}
+
+TEST_F(ImageDataBufferPoolTests, reuses_released_blocks) {
+  auto pool = std::make_shared<ImageDataBufferPool>(ImageDataBufferPool::Options{.maxCachedPerClass = 1});
+  auto block = pool->acquire(640 * 480 * 4);
+  auto data = block.get();
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(data) % ImageDataBufferPool::Alignment, 0);
+  EXPECT_EQ(pool->metrics().liveBytes, ImageDataBufferPool::Capacity(block));
+
+  block.reset();
+  auto metrics = pool->metrics();
+  EXPECT_EQ(metrics.liveBytes, 0);
+  EXPECT_EQ(metrics.cachedBlocks, 1);
+
+  block = pool->acquire(640 * 480 * 4);
+  EXPECT_EQ(block.get(), data);
+
+  // ONLY ONE BLOCK PER CLASS IS KEPT
+  auto other = pool->acquire(640 * 480 * 4);
+  block.reset();
+  other.reset();
+
+  metrics = pool->metrics();
+  EXPECT_EQ(metrics.allocations, 2);
+  EXPECT_EQ(metrics.reuses, 1);
+  EXPECT_EQ(metrics.releases, 3);
+  EXPECT_EQ(metrics.frees, 1);
+  EXPECT_EQ(metrics.cachedBlocks, 1);
+
+  pool->trim();
+  EXPECT_EQ(pool->metrics().cachedBytes, 0);
+  EXPECT_EQ(pool->metrics().frees, 2);
+}
+
+TEST_F(ImageDataBufferPoolTests, blocks_outlive_pool) {
+  auto pool = std::make_shared<ImageDataBufferPool>();
+  auto block = pool->acquire(4096);
+  pool.reset();
+
+  std::memset(block.get(), 0xFF, 4096);
+  block.reset();
+}
+
+TEST_F(ImageDataBufferPoolTests, BenchmarkAcquireRelease) {
+  auto pool = std::make_shared<ImageDataBufferPool>();
+  constexpr std::size_t Size = 1920 * 1080 * 4;
+
+#ifdef DEBUG
+  constexpr int Iterations = 20;
+#else
+  constexpr int Iterations = 200;
+#endif
+
+  auto timeIt = [&](auto &&fn) {
+    auto start = std::chrono::steady_clock::now();
+    for (int idx = 0; idx < Iterations; idx++)
+      fn();
+
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / Iterations;
+  };
+
+  // TOUCH EACH PAGE, AS A FRAME COPY WOULD, THROUGH VOLATILE SO THE
+  // ALLOCATOR BASELINE CANNOT BE OPTIMIZED AWAY
+  constexpr std::size_t Pages = (Size + ImageDataBufferPool::Alignment - 1) / ImageDataBufferPool::Alignment;
+  std::uint64_t checksum = 0;
+  auto touch = [&](std::uint8_t *data) {
+    volatile std::uint8_t *bytes = data;
+    for (std::size_t offset = 0; offset < Size; offset += ImageDataBufferPool::Alignment) {
+      bytes[offset] = 1;
+      checksum += bytes[offset];
+    }
+  };
+
+  auto allocatorMicros = timeIt([&] {
+    std::unique_ptr<std::uint8_t[]> data(new std::uint8_t[Size]);
+    touch(data.get());
+  });
+
+  auto poolMicros = timeIt([&] {
+    auto block = pool->acquire(Size);
+    touch(block.get());
+  });
+
+  auto metrics = pool->metrics();
+  L->info(
+    "1080p buffer: allocator {:.1f}us, pool {:.1f}us ({} allocations, {} reuses, checksum {})",
+    allocatorMicros,
+    poolMicros,
+    metrics.allocations,
+    metrics.reuses,
+    checksum
+  );
+
+  EXPECT_EQ(checksum, Pages * Iterations * 2);
+  EXPECT_EQ(metrics.allocations, 1);
+  EXPECT_EQ(metrics.reuses, Iterations - 1);
+}
@@ -0,0 +1,254 @@
+#include <chrono>
+#include <cmath>
+#include <fmt/core.h>
+#include <gtest/gtest.h>
+
+#include <IRacingTools/SDK/DiskClient.h>
+#include <IRacingTools/Shared/Logging/LoggingManager.h>
+#include <IRacingTools/Shared/Services/LapTimingEngine.h>
+
+using namespace IRacingTools::SDK;
+using namespace IRacingTools::Shared;
+using namespace IRacingTools::Shared::Logging;
+using namespace IRacingTools::Shared::Services;
+
+namespace fs = std::filesystem;
+
+namespace {
+  class LapTimingEngineTests;
+
+  auto L = GetCategoryWithType<LapTimingEngineTests>();
+
+  class LapTimingEngineTests : public testing::Test {
+  protected:
+    LapTimingEngineTests() = default;
+
+    virtual void TearDown() override {
+      L->flush();
+    }
+  };
+
+  using Event = LapTimingEngine::Event;
+  using EventType = LapTimingEngine::EventType;
+
+  constexpr double TickRate = 60.0;
+
+  /**
+   * @brief Drive cars around at a constant lap time each, `lapTimes[i]`
+   *   seconds per lap starting at `startPct[i]`
+   */
+  struct SyntheticField {
+    std::vector<double> lapTimes;
+    std::vector<float> startPcts;
+
+    std::vector<float> pcts(double sessionTime) const {
+      std::vector<float> values(lapTimes.size());
+      for (std::size_t carIdx = 0; carIdx < values.size(); carIdx++) {
+        auto pct = startPcts[carIdx] + sessionTime / lapTimes[carIdx];
+        values[carIdx] = static_cast<float>(pct - std::floor(pct));
+      }
+
+      return values;
+    }
+  };
+
+  std::vector<Event> RunField(LapTimingEngine& engine, const SyntheticField& field, double seconds) {
+    std::vector<Event> events{};
+    auto ticks = static_cast<std::size_t>(seconds * TickRate);
+    for (std::size_t tick = 0; tick <= ticks; tick++) {
+      auto sessionTime = tick / TickRate;
+      auto pcts = field.pcts(sessionTime);
+      engine.update(sessionTime, pcts, events);
+    }
+
+    return events;
+  }
+
+  std::vector<Event> FilterEvents(const std::vector<Event>& events, EventType type, std::int32_t carIdx) {
+    std::vector<Event> filtered{};
+    std::ranges::copy_if(events, std::back_inserter(filtered), [&](auto& event) {
+      return event.type == type && event.carIdx == carIdx;
+    });
+
+    return filtered;
+  }
+} // namespace
+
+TEST_F(LapTimingEngineTests, interpolates_lap_times) {
+  LapTimingEngine engine{};
+  SyntheticField field{.lapTimes = {90.0, 101.3}, .startPcts = {0.5f, 0.95f}};
+  auto events = RunField(engine, field, 400.0);
+
+  for (std::int32_t carIdx = 0; carIdx < 2; carIdx++) {
+    auto laps = FilterEvents(events, EventType::Lap, carIdx);
+    ASSERT_GE(laps.size(), 3) << carIdx;
+
+    // first crossing starts the first timed lap
+    EXPECT_EQ(laps[0].elapsed, -1.0);
+    for (std::size_t idx = 1; idx < laps.size(); idx++) {
+      EXPECT_NEAR(laps[idx].elapsed, field.lapTimes[carIdx], 1e-3) << carIdx;
+      EXPECT_EQ(laps[idx].lap, static_cast<std::int32_t>(idx));
+    }
+
+    EXPECT_NEAR(engine.bestLapTime(carIdx), field.lapTimes[carIdx], 1e-3);
+    EXPECT_NEAR(engine.lastLapTime(carIdx), field.lapTimes[carIdx], 1e-3);
+  }
+
+  // no sectors configured, lap events only
+  EXPECT_TRUE(std::ranges::none_of(events, [](auto& event) {
+    return event.type == EventType::Sector;
+  }));
+}
+
+TEST_F(LapTimingEngineTests, emits_sector_splits) {
+  SessionInfo::SplitTimeInfo splitTimeInfo{
+    .sectors = {{.sectorNum = 0, .sectorStartPct = 0.0f}, {.sectorNum = 1, .sectorStartPct = 0.3f}, {.sectorNum = 2, .sectorStartPct = 0.7f}}
+  };
+
+  LapTimingEngine engine{splitTimeInfo};
+  ASSERT_EQ(engine.splits().size(), 3);
+
+  SyntheticField field{.lapTimes = {100.0}, .startPcts = {0.1f}};
+  auto events = RunField(engine, field, 350.0);
+
+  auto sectors = FilterEvents(events, EventType::Sector, 0);
+  ASSERT_GE(sectors.size(), 6);
+  EXPECT_EQ(sectors[0].sectorNum, 0);
+  EXPECT_EQ(sectors[0].elapsed, -1.0);
+
+  constexpr std::array ExpectedSectorTimes = {30.0, 40.0, 30.0};
+  for (std::size_t idx = 1; idx < sectors.size(); idx++) {
+    auto& sector = sectors[idx];
+    EXPECT_EQ(sector.sectorNum, static_cast<std::int32_t>(idx % 3));
+    EXPECT_NEAR(sector.elapsed, ExpectedSectorTimes[sector.sectorNum], 1e-3) << idx;
+  }
+
+  // the last sector completes with the lap
+  auto laps = FilterEvents(events, EventType::Lap, 0);
+  ASSERT_GE(laps.size(), 2);
+  EXPECT_NEAR(laps[1].elapsed, 100.0, 1e-3);
+}
+
+TEST_F(LapTimingEngineTests, invalidates_on_blink_teleport_and_reverse) {
+  LapTimingEngine engine{};
+  std::vector<Event> events{};
+
+  // blinked out mid lap, the next crossing is not timed
+  engine.update(0.0, std::vector{0.97f}, events);
+  engine.update(1.0, std::vector{0.03f}, events);
+  engine.update(2.0, std::vector{-1.0f}, events);
+  engine.update(3.0, std::vector{0.98f}, events);
+  engine.update(4.0, std::vector{0.02f}, events);
+  ASSERT_EQ(events.size(), 2);
+  EXPECT_NEAR(events[0].sessionTime, 0.5, 1e-4);
+  EXPECT_EQ(events[1].elapsed, -1.0);
+
+  // reversing back over start/finish & driving forward again is not a lap
+  events.clear();
+  engine.update(5.0, std::vector{0.99f}, events);
+  engine.update(6.0, std::vector{0.01f}, events);
+  engine.update(7.0, std::vector{0.03f}, events);
+  EXPECT_TRUE(events.empty());
+
+  // teleport (more than `MaxTickAdvance` in one tick)
+  double sessionTime = 8.0;
+  for (auto pct = 0.5f; pct < 1.0f; pct += 0.05f) {
+    engine.update(sessionTime++, std::vector{pct}, events);
+  }
+
+  engine.update(sessionTime++, std::vector{0.02f}, events);
+  ASSERT_EQ(events.size(), 1);
+  EXPECT_EQ(events[0].elapsed, -1.0);
+
+  // time moving backwards is a new session
+  engine.update(1.0, std::vector{0.5f}, events);
+  EXPECT_EQ(engine.lapCount(0), 0);
+  EXPECT_EQ(engine.bestLapTime(0), -1.0);
+}
+
+TEST_F(LapTimingEngineTests, batch_recorded_race) {
+  auto raceDir = fs::current_path() / "data" / "ibt" / "race-recordings" / "f4-tsukubu";
+  if (!fs::exists(raceDir)) {
+    GTEST_SKIP() << "No race recording found";
+  }
+
+  std::optional<fs::path> file{};
+  for (auto& entry : fs::directory_iterator(raceDir)) {
+    if (entry.path().extension() == ".ibt") {
+      file = entry.path();
+    }
+  }
+
+  ASSERT_TRUE(file.has_value());
+  auto client = std::make_shared<DiskClient>(file.value(), file->string());
+
+  LapTimingEngine engine{};
+  std::vector<Event> events{};
+  auto start = std::chrono::steady_clock::now();
+  auto res = engine.run(client, events);
+  auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+  ASSERT_TRUE(res.has_value()) << res.error().what();
+
+  L->info("Processed {} samples into {} events in {:.1f}ms", res.value(), events.size(), elapsed);
+
+  auto timedLaps = std::ranges::count_if(events, [](auto& event) {
+    return event.type == EventType::Lap && event.elapsed > 0.0;
+  });
+  EXPECT_GT(timedLaps, 0);
+  for (auto& event : events) {
+    if (event.type == EventType::Lap && event.elapsed > 0.0) {
+      EXPECT_GT(event.elapsed, 30.0) << "car " << event.carIdx << " lap " << event.lap;
+    }
+  }
+}
+
+TEST_F(LapTimingEngineTests, benchmark_full_field) {
+  // 60hz x 64 cars x 24h in release builds, 1h in debug builds
+#ifdef NDEBUG
+  constexpr double Seconds = 24.0 * 60.0 * 60.0;
+#else
+  constexpr double Seconds = 60.0 * 60.0;
+#endif
+
+  SyntheticField field{};
+  for (std::size_t carIdx = 0; carIdx < LapTimingEngine::MaxCars; carIdx++) {
+    field.lapTimes.push_back(88.0 + static_cast<double>(carIdx) * 0.25);
+    field.startPcts.push_back(static_cast<float>(carIdx) / LapTimingEngine::MaxCars);
+  }
+
+  // Pre-generate one lap worth of ticks, so the timing covers the engine only
+  auto ticksPerLap = static_cast<std::size_t>(field.lapTimes[0] * TickRate);
+  std::vector<std::vector<float>> pctTicks{};
+  for (std::size_t tick = 0; tick < ticksPerLap; tick++) {
+    pctTicks.push_back(field.pcts(tick / TickRate));
+  }
+
+  SessionInfo::SplitTimeInfo splitTimeInfo{
+    .sectors = {{.sectorNum = 0, .sectorStartPct = 0.0f}, {.sectorNum = 1, .sectorStartPct = 0.33f}, {.sectorNum = 2, .sectorStartPct = 0.66f}}
+  };
+
+  LapTimingEngine engine{splitTimeInfo};
+  std::vector<Event> events{};
+  events.reserve(1024);
+
+  auto ticks = static_cast<std::size_t>(Seconds * TickRate);
+  std::size_t eventCount = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (std::size_t tick = 0; tick < ticks; tick++) {
+    // time keeps moving forward while the pcts repeat every lap
+    eventCount += engine.update(tick / TickRate, pctTicks[tick % ticksPerLap], events);
+    events.clear();
+  }
+
+  auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  L->info(
+    "{} ticks x {} cars in {:.3f}s ({:.1f}ns per tick), {} events",
+    ticks,
+    LapTimingEngine::MaxCars,
+    elapsed,
+    elapsed * 1e9 / static_cast<double>(ticks),
+    eventCount
+  );
+
+  EXPECT_GT(engine.lapCount(0), static_cast<std::int32_t>(Seconds / field.lapTimes[0]) - 2);
+}
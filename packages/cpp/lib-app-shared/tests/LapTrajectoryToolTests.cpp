@@ -0,0 +1,213 @@
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <gtest/gtest.h>
+
+#include <IRacingTools/SDK/DiskClient.h>
+#include <IRacingTools/Shared/Logging/LoggingManager.h>
+#include <IRacingTools/Shared/Services/LapTrajectoryTool.h>
+
+using namespace IRacingTools::SDK;
+using namespace IRacingTools::Shared;
+using namespace IRacingTools::Shared::Logging;
+using namespace IRacingTools::Shared::Services;
+
+namespace fs = std::filesystem;
+
+namespace {
+  class LapTrajectoryToolTests;
+
+  auto L = GetCategoryWithType<LapTrajectoryToolTests>();
+
+  class LapTrajectoryToolTests : public testing::Test {
+  protected:
+    LapTrajectoryToolTests() = default;
+
+    virtual void TearDown() override {
+      L->flush();
+    }
+  };
+
+  using LapCoordinate = TelemetryFileHandler::LapPositionCoordinate;
+
+  // ~1km radius circle
+  constexpr double CenterLatitude = 45.5;
+  constexpr double CenterLongitude = -73.5;
+  constexpr double RadiusDegrees = 0.009;
+  constexpr double MetersPerDegree = 111195.0;
+
+  // longitude degrees shrink with latitude
+  const double LongitudeScale = std::cos(CenterLatitude / 180.0 * std::numbers::pi);
+  constexpr double LapTime = 90.0;
+
+  /**
+   * @brief A lap around the circle at 60hz, `noiseDegrees` of gaussian noise
+   *   per sample & `offsetDegrees` added to the whole lap
+   */
+  TelemetryFileHandler::LapDataWithPath MakeLap(int lap, double noiseDegrees, double offsetDegrees, std::mt19937& rng) {
+    std::normal_distribution<double> noise(0.0, noiseDegrees);
+    std::vector<LapCoordinate> coords{};
+
+    // starts on the tail of the previous lap, as recorded laps do
+    coords.emplace_back(TelemetryFileHandler::LapPositionCoordinateTuple{lap, 0.0, 0.999f, 0.0f, CenterLatitude, CenterLongitude + RadiusDegrees / LongitudeScale, 0.0f});
+
+    auto samples = static_cast<int>(LapTime * 60.0);
+    for (int sample = 0; sample < samples; sample++) {
+      auto pct = static_cast<double>(sample) / samples;
+      auto angle = pct * 2.0 * std::numbers::pi;
+      coords.emplace_back(
+        TelemetryFileHandler::LapPositionCoordinateTuple{
+          lap,
+          pct * LapTime,
+          static_cast<float>(pct),
+          static_cast<float>(pct * 2000.0),
+          CenterLatitude + RadiusDegrees * std::sin(angle) + offsetDegrees + noise(rng),
+          CenterLongitude + (RadiusDegrees * std::cos(angle) + offsetDegrees + noise(rng)) / LongitudeScale,
+          10.0f
+        }
+      );
+    }
+
+    return {lap * LapTime, lap, LapTime, 0, coords};
+  }
+
+  double RadiusError(double latitude, double longitude) {
+    return std::abs(std::hypot(latitude - CenterLatitude, (longitude - CenterLongitude) * LongitudeScale) - RadiusDegrees);
+  }
+} // namespace
+
+TEST_F(LapTrajectoryToolTests, fuses_noisy_laps) {
+  std::mt19937 rng{42};
+  std::vector<TelemetryFileHandler::LapDataWithPath> laps{};
+  for (int lap = 1; lap <= 8; lap++) {
+    laps.push_back(MakeLap(lap, 0.00002, 0.0, rng));
+  }
+
+  // off track the whole lap, must be rejected as an outlier
+  laps.push_back(MakeLap(9, 0.00002, 0.0005, rng));
+
+  LapTrajectoryTool::CreateOptions options{.resolution = 1024, .threadCount = 4};
+  auto res = LapTrajectoryTool::FuseLaps(laps, options);
+  ASSERT_TRUE(res.has_value()) << res.error().what();
+
+  auto& points = res.value();
+  ASSERT_EQ(points.size(), options.resolution);
+
+  double fusedError = 0.0;
+  for (std::size_t idx = 0; idx < points.size(); idx++) {
+    auto& point = points[idx];
+    EXPECT_FLOAT_EQ(point.lapPercentComplete, static_cast<float>(idx) / options.resolution);
+    // the outlier lap is never averaged in
+    EXPECT_LE(point.sampleCount, 8) << idx;
+    EXPECT_GE(point.sampleCount, 5) << idx;
+    if (idx > 0) {
+      EXPECT_GT(point.distance, points[idx - 1].distance);
+      EXPECT_GE(point.lapTime, points[idx - 1].lapTime);
+    }
+
+    fusedError += RadiusError(point.latitude, point.longitude);
+  }
+
+  fusedError /= points.size();
+
+  // a single noisy lap is worse than the fusion of all of them
+  double lapError = 0.0;
+  auto& coords = std::get<4>(laps[0]);
+  for (std::size_t idx = 1; idx < coords.size(); idx++) {
+    lapError += RadiusError(std::get<4>(coords[idx]), std::get<5>(coords[idx]));
+  }
+
+  lapError /= coords.size() - 1;
+  EXPECT_LT(fusedError * 2.0, lapError);
+
+  // circumference of a ~1km radius circle
+  auto circumference = 2.0 * std::numbers::pi * RadiusDegrees * MetersPerDegree;
+  EXPECT_NEAR(points.back().distance, circumference, circumference * 0.03);
+}
+
+TEST_F(LapTrajectoryToolTests, fills_uncovered_points) {
+  std::mt19937 rng{7};
+  auto lap = MakeLap(1, 0.0, 0.0, rng);
+
+  // drop a slice of the lap, wider than the interpolated gap
+  auto& coords = std::get<4>(lap);
+  std::erase_if(coords, [](auto& coord) {
+    auto pct = std::get<2>(coord);
+    return pct > 0.4f && pct < 0.45f;
+  });
+
+  LapTrajectoryTool::CreateOptions options{.resolution = 200};
+  auto res = LapTrajectoryTool::FuseLaps({lap}, options);
+  ASSERT_TRUE(res.has_value()) << res.error().what();
+  ASSERT_EQ(res->size(), options.resolution);
+
+  auto& hole = res->at(85);
+  EXPECT_EQ(hole.sampleCount, 0);
+  EXPECT_LT(RadiusError(hole.latitude, hole.longitude), RadiusDegrees * 0.05);
+  EXPECT_EQ(res->at(20).sampleCount, 1);
+}
+
+TEST_F(LapTrajectoryToolTests, rejects_empty_input) {
+  EXPECT_FALSE(LapTrajectoryTool::FuseLaps({}, {}).has_value());
+}
+
+TEST_F(LapTrajectoryToolTests, creates_levels_of_detail) {
+  std::mt19937 rng{3};
+  auto fusedRes = LapTrajectoryTool::FuseLaps({MakeLap(1, 0.0, 0.0, rng)}, {});
+  ASSERT_TRUE(fusedRes.has_value()) << fusedRes.error().what();
+
+  IRacingTools::Models::LapTrajectory trajectory{};
+  for (auto& point : fusedRes.value()) {
+    auto coord = trajectory.add_path();
+    coord->set_latitude(point.latitude);
+    coord->set_longitude(point.longitude);
+    coord->set_lap_percent_complete(point.lapPercentComplete);
+  }
+
+  std::vector<std::uint32_t> sizes{128, 1024, 256};
+  ASSERT_EQ(LapTrajectoryTool::CreateLevelsOfDetail(trajectory, sizes, 0.5f), 3);
+
+  // descending, each coarser level has fewer points & a larger tolerance
+  auto& lods = trajectory.levels_of_detail();
+  EXPECT_EQ(lods[0].max_size(), 1024);
+  EXPECT_EQ(lods[2].max_size(), 128);
+  for (int idx = 1; idx < lods.size(); idx++) {
+    EXPECT_LT(lods[idx].path_size(), lods[idx - 1].path_size());
+    EXPECT_GT(lods[idx].tolerance_meters(), lods[idx - 1].tolerance_meters());
+  }
+
+  EXPECT_LT(lods[0].path_size() * 10, trajectory.path_size());
+
+  // the tolerance scales with the track extent (2 x radius)
+  auto extentMeters = 2.0 * RadiusDegrees * MetersPerDegree;
+  EXPECT_NEAR(lods[2].tolerance_meters(), extentMeters * 0.5 / 128.0, extentMeters * 0.01);
+
+  EXPECT_EQ(&LapTrajectoryTool::SelectPath(trajectory, 200), &lods[1].path());
+  EXPECT_EQ(&LapTrajectoryTool::SelectPath(trajectory, 100), &lods[2].path());
+  EXPECT_EQ(&LapTrajectoryTool::SelectPath(trajectory, 4096), &trajectory.path());
+
+  // recreating replaces the levels
+  ASSERT_EQ(LapTrajectoryTool::CreateLevelsOfDetail(trajectory, {}, 0.5f), 0);
+  EXPECT_EQ(trajectory.levels_of_detail_size(), 0);
+}
+
+TEST_F(LapTrajectoryToolTests, fuses_ibt_laps) {
+  auto file = fs::current_path() / "data" / "ibt" / "telemetry" / "ibt-fixture-superformulalights324_montreal.ibt";
+  if (!fs::exists(file)) {
+    GTEST_SKIP() << "No fixture found";
+  }
+
+  auto client = std::make_shared<DiskClient>(file, file.string());
+  auto res = LapTrajectoryTool{}.createLapTrajectory(client);
+  ASSERT_TRUE(res.has_value()) << res.error().what();
+
+  auto& trajectory = res.value();
+  ASSERT_EQ(trajectory->path_size(), LapTrajectoryTool::DefaultResolution);
+  ASSERT_GT(trajectory->levels_of_detail_size(), 0);
+  EXPECT_LT(LapTrajectoryTool::SelectPath(*trajectory, 256).size(), trajectory->path_size());
+  for (int idx = 1; idx < trajectory->path_size(); idx++) {
+    EXPECT_GE(trajectory->path(idx).lap_distance_calculated(), trajectory->path(idx - 1).lap_distance_calculated());
+  }
+
+  L->info("Fused trajectory length {:.1f}m", trajectory->path(trajectory->path_size() - 1).lap_distance_calculated());
+}
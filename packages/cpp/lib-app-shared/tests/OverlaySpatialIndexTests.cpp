@@ -0,0 +1,215 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <gtest/gtest.h>
+
+#include <IRacingTools/Shared/Graphics/OverlaySpatialIndex.h>
+#include <IRacingTools/Shared/Logging/LoggingManager.h>
+
+using namespace IRacingTools::Shared::Graphics;
+using namespace IRacingTools::Shared::Logging;
+
+namespace {
+
+  class OverlaySpatialIndexTests;
+
+  auto L = GetCategoryWithType<OverlaySpatialIndexTests>();
+
+  /**
+   * @brief `MaxViewCount`, `Constants.h` is not included so the tests stay
+   *   free of Windows headers
+   */
+  constexpr std::size_t ViewCount = 8;
+
+  class OverlaySpatialIndexTests : public testing::Test {
+  protected:
+    OverlaySpatialIndexTests() = default;
+
+    virtual void TearDown() override {
+      L->flush();
+    }
+  };
+
+  OverlayQuaternion MakeRotation(float yaw, float pitch) {
+    // YAW ABOUT Y, THEN PITCH ABOUT X
+    auto cy = std::cos(yaw / 2), sy = std::sin(yaw / 2);
+    auto cp = std::cos(pitch / 2), sp = std::sin(pitch / 2);
+    return {cy * sp, sy * cp, -sy * sp, cy * cp};
+  }
+
+  /**
+   * @brief Overlays scattered around the viewer, facing it, like a cockpit
+   *   full of widgets
+   */
+  std::vector<OverlayQuad> MakeQuads(std::size_t count, std::mt19937 &random) {
+    std::uniform_real_distribution<float> angle(-1.2f, 1.2f);
+    std::uniform_real_distribution<float> distance(0.4f, 2.0f);
+    std::uniform_real_distribution<float> size(0.05f, 0.4f);
+
+    std::vector<OverlayQuad> quads{};
+    for (std::size_t idx = 0; idx < count; idx++) {
+      auto yaw = angle(random), pitch = angle(random) / 2, radius = distance(random);
+      quads.push_back(
+        {
+          .overlayIdx = idx + 100,
+          .center = {-std::sin(yaw) * radius, std::sin(pitch) * radius, -std::cos(yaw) * radius},
+          .orientation = MakeRotation(yaw, pitch),
+          .width = size(random),
+          .height = size(random),
+        }
+      );
+    }
+
+    return quads;
+  }
+
+  std::vector<OverlayRay> MakeRays(std::size_t count, std::mt19937 &random) {
+    std::uniform_real_distribution<float> angle(-1.3f, 1.3f);
+    std::uniform_real_distribution<float> offset(-0.2f, 0.2f);
+
+    std::vector<OverlayRay> rays{};
+    for (std::size_t idx = 0; idx < count; idx++)
+      rays.push_back({{offset(random), offset(random), offset(random)}, MakeRotation(angle(random), angle(random) / 2)});
+
+    return rays;
+  }
+} // namespace
+
+TEST_F(OverlaySpatialIndexTests, hits_quad_facing_ray) {
+  std::vector<OverlayQuad> quads{
+    {.overlayIdx = 7, .center = {0.0f, 0.0f, -1.0f}, .width = 0.4f, .height = 0.2f},
+    // BEHIND THE FIRST ONE
+    {.overlayIdx = 8, .center = {0.0f, 0.0f, -2.0f}, .width = 1.0f, .height = 1.0f},
+  };
+
+  OverlaySpatialIndex index;
+  ASSERT_TRUE(index.update(quads));
+
+  auto hit = index.intersect(OverlayRay{.origin = {0.1f, 0.05f, 0.0f}});
+  ASSERT_TRUE(hit);
+  EXPECT_EQ(hit->index, 0);
+  EXPECT_EQ(hit->overlayIdx, 7);
+  EXPECT_FLOAT_EQ(hit->distance, 1.0f);
+  EXPECT_FLOAT_EQ(hit->u, 0.75f);
+  EXPECT_FLOAT_EQ(hit->v, 0.25f);
+
+  // PAST THE FIRST QUAD'S EDGE
+  hit = index.intersect(OverlayRay{.origin = {0.3f, 0.0f, 0.0f}});
+  ASSERT_TRUE(hit);
+  EXPECT_EQ(hit->overlayIdx, 8);
+
+  // POINTING AWAY
+  EXPECT_FALSE(index.intersect(OverlayRay{.orientation = MakeRotation(std::numbers::pi_v<float>, 0.0f)}));
+}
+
+TEST_F(OverlaySpatialIndexTests, rebuilds_only_on_layout_change) {
+  std::mt19937 random{1};
+  auto quads = MakeQuads(ViewCount, random);
+
+  OverlaySpatialIndex index;
+  EXPECT_FALSE(index.update({}));
+  EXPECT_TRUE(index.update(quads));
+  EXPECT_FALSE(index.update(quads));
+  EXPECT_EQ(index.size(), quads.size());
+
+  quads[3].center.x += 0.01f;
+  EXPECT_TRUE(index.update(quads));
+
+  quads.pop_back();
+  EXPECT_TRUE(index.update(quads));
+  EXPECT_TRUE(index.update({}));
+  EXPECT_FALSE(index.intersect(OverlayRay{}));
+}
+
+TEST_F(OverlaySpatialIndexTests, matches_linear_scan) {
+  std::mt19937 random{2};
+  for (std::size_t count : {1, 2, 3, 8, 33, 256}) {
+    auto quads = MakeQuads(count, random);
+    auto rays = MakeRays(2000, random);
+
+    OverlaySpatialIndex index;
+    index.update(quads);
+
+    std::vector<std::optional<OverlayHit>> hits(rays.size());
+    index.intersect(rays, hits);
+
+    std::size_t hitCount = 0;
+    for (std::size_t idx = 0; idx < rays.size(); idx++) {
+      auto expected = IntersectOverlayQuads(rays[idx], quads);
+      auto single = index.intersect(rays[idx]);
+      auto linear = index.intersectLinear(rays[idx]);
+      ASSERT_EQ(expected.has_value(), hits[idx].has_value()) << "count=" << count << " ray=" << idx;
+      ASSERT_EQ(expected.has_value(), single.has_value());
+      ASSERT_EQ(expected.has_value(), linear.has_value());
+      if (!expected)
+        continue;
+
+      hitCount++;
+      EXPECT_EQ(expected->index, hits[idx]->index);
+      EXPECT_EQ(expected->index, single->index);
+      EXPECT_EQ(expected->index, linear->index);
+      EXPECT_EQ(expected->distance, hits[idx]->distance);
+    }
+
+    if (count >= ViewCount) {
+      EXPECT_GT(hitCount, 0);
+    }
+  }
+}
+
+TEST_F(OverlaySpatialIndexTests, BenchmarkIntersect) {
+#ifdef DEBUG
+  constexpr std::size_t Iterations = 20;
+#else
+  constexpr std::size_t Iterations = 200;
+#endif
+
+  std::mt19937 random{3};
+
+  // CONTROLLER RAYS ALL OVER THE COCKPIT, SO EVERY SIZE GETS HITS & MISSES
+  auto rays = MakeRays(1024, random);
+  std::vector<std::optional<OverlayHit>> hits(rays.size());
+
+  for (std::size_t count = ViewCount; count <= 256; count *= 2) {
+    auto quads = MakeQuads(count, random);
+
+    auto start = std::chrono::steady_clock::now();
+    OverlaySpatialIndex index;
+    index.update(quads);
+    auto buildMicros = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+    // BOTH OVER THE SAME PREPARED QUADS, SO ONLY THE TRAVERSAL DIFFERS
+    std::size_t linearHits = 0;
+    start = std::chrono::steady_clock::now();
+    for (std::size_t idx = 0; idx < Iterations; idx++) {
+      for (auto &ray : rays)
+        linearHits += index.intersectLinear(ray).has_value();
+    }
+    auto linearNanos =
+      std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / (Iterations * rays.size());
+
+    std::size_t indexHits = 0;
+    start = std::chrono::steady_clock::now();
+    for (std::size_t idx = 0; idx < Iterations; idx++) {
+      index.intersect(rays, hits);
+      indexHits += std::ranges::count_if(hits, [](auto &hit) { return hit.has_value(); });
+    }
+    auto indexNanos =
+      std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / (Iterations * rays.size());
+
+    L->info(
+      "{} overlays: build {:.1f}us, per ray linear {:.1f}ns, indexed {:.1f}ns ({} of {} rays hit)",
+      count,
+      buildMicros,
+      linearNanos,
+      indexNanos,
+      indexHits / Iterations,
+      rays.size()
+    );
+
+    EXPECT_EQ(linearHits, indexHits);
+    EXPECT_GT(indexHits, 0);
+  }
+}
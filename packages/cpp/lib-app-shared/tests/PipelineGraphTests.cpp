@@ -0,0 +1,228 @@
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <gtest/gtest.h>
+
+#include <IRacingTools/Shared/FileSystemHelpers.h>
+#include <IRacingTools/Shared/Logging/LoggingManager.h>
+#include <IRacingTools/Shared/Services/Pipelines/PipelineGraph.h>
+
+using namespace IRacingTools::Shared;
+using namespace IRacingTools::Shared::Logging;
+using namespace IRacingTools::Shared::Services::Pipelines;
+using namespace IRacingTools::SDK;
+using namespace IRacingTools::Models;
+
+namespace {
+  class PipelineGraphTests;
+
+  auto L = GetCategoryWithType<PipelineGraphTests>();
+
+  class PipelineGraphTests : public testing::Test {
+  protected:
+    PipelineGraphTests() = default;
+
+    fs::path checkpointDir{};
+
+    virtual void SetUp() override {
+      checkpointDir = GetTemporaryDirectory("pipeline-graph-tests") / "checkpoints";
+      fs::remove_all(checkpointDir);
+    }
+
+    virtual void TearDown() override {
+      fs::remove_all(checkpointDir);
+      L->flush();
+    }
+  };
+
+  /**
+   * @brief `source -> (left, right) -> joined`, where `left` & `right`
+   *   each wait for the other to start, so they only complete when run
+   *   concurrently
+   */
+  struct DiamondGraph {
+    std::atomic_int runs{0};
+    std::atomic_int started{0};
+    PipelineGraph graph;
+
+    explicit DiamondGraph(const PipelineGraph::Options &options, std::uint32_t joinVersion = 1) : graph(options) {
+      auto branch = [this](const char *output, int factor) {
+        return [this, output, factor](PipelineArtifacts &artifacts) -> std::optional<GeneralError> {
+          runs++;
+          started++;
+          auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+          while (started < 2 && std::chrono::steady_clock::now() < deadline)
+            std::this_thread::yield();
+
+          if (started < 2)
+            return GeneralError(ErrorCode::General, "branches did not run concurrently");
+
+          auto source = *artifacts.get<std::shared_ptr<PipelineLog>>("source");
+          auto value = std::make_shared<PipelineLog>();
+          value->set_message(std::format("{}{}", source->message(), factor));
+          artifacts.set(output, value);
+          return std::nullopt;
+        };
+      };
+
+      EXPECT_FALSE(graph.addStage({.name = "left", .inputs = {"source"}, .outputs = {"left"}, .fn = branch("left", 1)}));
+      EXPECT_FALSE(graph.addStage({.name = "right", .inputs = {"source"}, .outputs = {"right"}, .fn = branch("right", 2)}));
+      EXPECT_FALSE(graph.addStage(
+        {.name = "joined",
+         .inputs = {"left", "right"},
+         .outputs = {"joined"},
+         .fn =
+           [this](PipelineArtifacts &artifacts) -> std::optional<GeneralError> {
+             runs++;
+             auto left = *artifacts.get<std::shared_ptr<PipelineLog>>("left");
+             auto right = *artifacts.get<std::shared_ptr<PipelineLog>>("right");
+             artifacts.set("joined", std::format("{}+{}", left->message(), right->message()));
+             return std::nullopt;
+           },
+         .version = joinVersion}
+      ));
+
+      graph.setCodec("left", ProtoArtifactCodec<PipelineLog>());
+      graph.setCodec("right", ProtoArtifactCodec<PipelineLog>());
+    }
+  };
+
+  std::shared_ptr<PipelineGraph::Item> MakeItem(const std::string &key) {
+    auto item = std::make_shared<PipelineGraph::Item>();
+    item->key = key;
+    auto source = std::make_shared<PipelineLog>();
+    source->set_message(key);
+    item->artifacts.set("source", source);
+    return item;
+  }
+} // namespace
+
+TEST_F(PipelineGraphTests, runs_independent_stages_concurrently) {
+  DiamondGraph diamond(PipelineGraph::Options{});
+
+  auto order = diamond.graph.stageOrder();
+  ASSERT_TRUE(order.has_value());
+  EXPECT_EQ(order->back(), 2);
+
+  auto item = MakeItem("a");
+  ASSERT_FALSE(diamond.graph.run(item));
+  ASSERT_FALSE(item->error.has_value()) << item->error->what();
+  EXPECT_EQ(item->status, PIPELINE_STATUS_COMPLETE);
+  EXPECT_EQ(*item->artifacts.get<std::string>("joined"), "a1+a2");
+
+  Pipeline::Attempt attempt{};
+  item->toModel(&attempt);
+  ASSERT_EQ(attempt.stages_size(), 3);
+  EXPECT_EQ(attempt.stages(2).name(), "joined");
+  EXPECT_EQ(attempt.stages(2).attempt_count(), 1);
+  EXPECT_GT(attempt.stages(0).started_at(), 0);
+}
+
+TEST_F(PipelineGraphTests, resumes_from_checkpoints) {
+  PipelineGraph::Options options{.checkpointDir = checkpointDir};
+  {
+    DiamondGraph diamond(options);
+    auto item = MakeItem("b");
+    ASSERT_FALSE(diamond.graph.run(item));
+    EXPECT_EQ(diamond.runs, 3);
+  }
+
+  // `joined` HAS NO CODEC, ONLY IT RUNS AGAIN
+  {
+    DiamondGraph diamond(options);
+    auto item = MakeItem("b");
+    ASSERT_FALSE(diamond.graph.run(item));
+    EXPECT_EQ(diamond.runs, 1);
+    EXPECT_TRUE(item->stages[0].fromCheckpoint);
+    EXPECT_TRUE(item->stages[1].fromCheckpoint);
+    EXPECT_EQ(*item->artifacts.get<std::string>("joined"), "b1+b2");
+  }
+
+  // A CHANGED ITEM KEY INVALIDATES EVERYTHING
+  {
+    DiamondGraph diamond(options);
+    auto item = MakeItem("c");
+    ASSERT_FALSE(diamond.graph.run(item));
+    EXPECT_EQ(diamond.runs, 3);
+  }
+
+  EXPECT_TRUE(fs::exists(checkpointDir));
+}
+
+TEST_F(PipelineGraphTests, failed_stage_skips_downstream) {
+  std::atomic_int attempts{0};
+  std::atomic_bool downstreamRan{false};
+  PipelineGraph graph(PipelineGraph::Options{.queueCapacity = 1});
+  ASSERT_FALSE(graph.addStage(
+    {.name = "flaky",
+     .inputs = {"source"},
+     .outputs = {"parsed"},
+     .fn =
+       [&](PipelineArtifacts &artifacts) -> std::optional<GeneralError> {
+         auto source = *artifacts.get<std::shared_ptr<PipelineLog>>("source");
+         if (source->message() == "bad" || attempts++ == 0)
+           return GeneralError(ErrorCode::General, "parse failed");
+
+         artifacts.set("parsed", source->message());
+         return std::nullopt;
+       },
+     .maxAttempts = 2}
+  ));
+  ASSERT_FALSE(graph.addStage(
+    {.name = "consumer",
+     .inputs = {"parsed"},
+     .outputs = {"consumed"},
+     .fn = [&](PipelineArtifacts &artifacts) -> std::optional<GeneralError> {
+       downstreamRan = *artifacts.get<std::string>("parsed") == "good";
+       return std::nullopt;
+     }}
+  ));
+
+  // DUPLICATE OUTPUT
+  EXPECT_TRUE(graph.addStage({.name = "other", .outputs = {"parsed"}, .fn = [](auto &) { return std::nullopt; }}));
+
+  auto good = MakeItem("good");
+  auto bad = MakeItem("bad");
+  ASSERT_FALSE(graph.run(std::vector{good, bad}));
+
+  EXPECT_EQ(good->status, PIPELINE_STATUS_COMPLETE);
+  EXPECT_EQ(good->stages[0].attemptCount, 2);
+  EXPECT_TRUE(downstreamRan);
+
+  EXPECT_EQ(bad->status, PIPELINE_STATUS_ERROR);
+  ASSERT_TRUE(bad->error.has_value());
+  EXPECT_EQ(bad->stages[0].status, PIPELINE_STATUS_ERROR);
+  EXPECT_EQ(bad->stages[1].status, PIPELINE_STATUS_SKIPPED);
+}
+
+TEST_F(PipelineGraphTests, rejects_cycles) {
+  PipelineGraph graph{};
+  auto noop = [](PipelineArtifacts &) -> std::optional<GeneralError> { return std::nullopt; };
+  ASSERT_FALSE(graph.addStage({.name = "a", .inputs = {"y"}, .outputs = {"x"}, .fn = noop}));
+  ASSERT_FALSE(graph.addStage({.name = "b", .inputs = {"x"}, .outputs = {"y"}, .fn = noop}));
+
+  EXPECT_FALSE(graph.stageOrder().has_value());
+  EXPECT_TRUE(graph.run(MakeItem("d")).has_value());
+}
+
+TEST_F(PipelineGraphTests, clears_and_prunes_checkpoints) {
+  PipelineGraph::Options options{.checkpointDir = checkpointDir};
+  for (auto key : {"d", "e"}) {
+    DiamondGraph diamond(options);
+    ASSERT_FALSE(diamond.graph.run(MakeItem(key)));
+  }
+
+  {
+    DiamondGraph diamond(options);
+    EXPECT_EQ(diamond.graph.pruneCheckpoints([](auto &itemKey) { return itemKey == "e"; }), 1);
+
+    ASSERT_FALSE(diamond.graph.run(MakeItem("d")));
+    EXPECT_EQ(diamond.runs, 1);
+    ASSERT_FALSE(diamond.graph.run(MakeItem("e")));
+    EXPECT_EQ(diamond.runs, 4);
+
+    diamond.graph.clearCheckpoints("d");
+    ASSERT_FALSE(diamond.graph.run(MakeItem("d")));
+    EXPECT_EQ(diamond.runs, 7);
+  }
+}
@@ -0,0 +1,164 @@
+#include <chrono>
+#include <random>
+#include <gtest/gtest.h>
+
+#include <IRacingTools/Shared/Graphics/PixelConversion.h>
+#include <IRacingTools/Shared/Logging/LoggingManager.h>
+
+using namespace IRacingTools::Shared::Logging;
+using namespace IRacingTools::Shared::Graphics;
+
+namespace {
+
+  class PixelConversionTests;
+
+  auto L = GetCategoryWithType<PixelConversionTests>();
+
+  class PixelConversionTests : public testing::Test {
+  protected:
+    PixelConversionTests() = default;
+
+    virtual void TearDown() override {
+      L->flush();
+    }
+  };
+
+  std::vector<std::uint8_t> RandomPixels(std::size_t count, std::uint32_t bpp) {
+    std::mt19937 rng(count);
+    std::vector<std::uint8_t> pixels(count * bpp);
+    for (auto &value : pixels)
+      value = static_cast<std::uint8_t>(rng());
+
+    return pixels;
+  }
+
+  std::vector<PixelConversion> AllConversions() {
+    std::vector<PixelConversion> conversions{};
+    for (auto layout : {PixelLayout::BGRA, PixelLayout::RGBA, PixelLayout::RGB}) {
+      for (auto alpha : {PixelAlpha::Premultiplied, PixelAlpha::Straight}) {
+        conversions.push_back({layout, alpha});
+        conversions.push_back({layout, alpha, {0.5f, 0.25f, 1.0f, 0.75f}});
+      }
+    }
+
+    return conversions;
+  }
+} // namespace
+
+TEST_F(PixelConversionTests, converts_known_pixels) {
+  // R=200 G=100 B=50 A=128
+  std::vector<std::uint8_t> rgba{200, 100, 50, 128};
+  std::vector<std::uint8_t> out(4);
+
+  ConvertPixels(rgba.data(), out.data(), 1, {PixelLayout::RGBA, PixelAlpha::Premultiplied}, PixelKernel::Scalar);
+  EXPECT_EQ(out, (std::vector<std::uint8_t>{50, 100, 200, 128}));
+
+  ConvertPixels(rgba.data(), out.data(), 1, {PixelLayout::RGBA, PixelAlpha::Straight}, PixelKernel::Scalar);
+  EXPECT_EQ(out, (std::vector<std::uint8_t>{25, 50, 100, 128}));
+
+  std::vector<std::uint8_t> rgb{200, 100, 50};
+  ConvertPixels(rgb.data(), out.data(), 1, {PixelLayout::RGB, PixelAlpha::Straight}, PixelKernel::Scalar);
+  EXPECT_EQ(out, (std::vector<std::uint8_t>{50, 100, 200, 255}));
+
+  // TINT IS RGBA, APPLIED TO EACH CHANNEL
+  ConvertPixels(rgb.data(), out.data(), 1, {PixelLayout::RGB, PixelAlpha::Premultiplied, {0.5f, 1.0f, 0.0f, 0.5f}}, PixelKernel::Scalar);
+  EXPECT_EQ(out, (std::vector<std::uint8_t>{0, 100, 100, 128}));
+
+  EXPECT_TRUE(PixelConversion{}.isCopy());
+  EXPECT_FALSE((PixelConversion{PixelLayout::BGRA, PixelAlpha::Premultiplied, {1, 1, 1, 0.9f}}.isCopy()));
+}
+
+TEST_F(PixelConversionTests, premultiply_is_exact) {
+  // EVERY COLOR & ALPHA PAIR ROUNDS TO NEAREST
+  std::vector<std::uint8_t> bgra{};
+  for (std::uint32_t a = 0; a < 256; a++) {
+    for (std::uint32_t c = 0; c < 256; c++) {
+      bgra.insert(bgra.end(), {static_cast<std::uint8_t>(c), 0, 0, static_cast<std::uint8_t>(a)});
+    }
+  }
+
+  std::vector<std::uint8_t> out(bgra.size());
+  for (auto kernel : {PixelKernel::Scalar, PixelKernel::SSSE3, PixelKernel::AVX2}) {
+    if (!IsPixelKernelSupported(kernel))
+      continue;
+
+    ConvertPixels(bgra.data(), out.data(), bgra.size() / 4, {PixelLayout::BGRA, PixelAlpha::Straight}, kernel);
+    for (std::size_t i = 0; i < out.size(); i += 4) {
+      auto expected = (bgra[i] * bgra[i + 3] + 127) / 255;
+      ASSERT_EQ(out[i], expected) << "c=" << int(bgra[i]) << " a=" << int(bgra[i + 3]);
+      ASSERT_EQ(out[i + 3], bgra[i + 3]);
+    }
+  }
+}
+
+TEST_F(PixelConversionTests, kernels_match_scalar) {
+  for (auto &conversion : AllConversions()) {
+    // ODD COUNTS EXERCISE THE SCALAR TAIL AFTER THE VECTOR LOOPS
+    for (std::size_t count : {1, 3, 4, 7, 8, 9, 31, 257}) {
+      auto src = RandomPixels(count, conversion.srcBPP());
+      std::vector<std::uint8_t> expected(count * 4), actual(count * 4);
+      ConvertPixels(src.data(), expected.data(), count, conversion, PixelKernel::Scalar);
+
+      for (auto kernel : {PixelKernel::SSSE3, PixelKernel::AVX2}) {
+        if (!IsPixelKernelSupported(kernel))
+          continue;
+
+        std::ranges::fill(actual, 0);
+        ConvertPixels(src.data(), actual.data(), count, conversion, kernel);
+        ASSERT_EQ(actual, expected) << "layout=" << int(conversion.layout) << " alpha=" << int(conversion.alpha)
+                                    << " count=" << count << " kernel=" << int(kernel);
+      }
+    }
+  }
+}
+
+TEST_F(PixelConversionTests, converts_rects_only) {
+  DamageFrameLayout layout{40, 20, 40 * 4, 4};
+  PixelConversion conversion{PixelLayout::RGB, PixelAlpha::Straight};
+  auto src = RandomPixels(layout.width * layout.height, 3);
+  std::vector<std::uint8_t> full(layout.size()), partial(layout.size(), 0);
+  ConvertPixels(src.data(), full.data(), layout.width * layout.height, conversion);
+
+  std::vector<DamageRect> rects{{3, 2, 17, 5}, {30, 15, 20, 20}};
+  ConvertPixelRects(src.data(), layout.width * 3, partial.data(), layout, rects, conversion);
+
+  for (std::uint32_t y = 0; y < layout.height; y++) {
+    for (std::uint32_t x = 0; x < layout.width; x++) {
+      auto inside = std::ranges::any_of(rects, [&](auto &rect) {
+        return x >= rect.x && x < rect.right() && y >= rect.y && y < rect.bottom();
+      });
+      auto offset = y * layout.stride + x * 4;
+      auto pixel = std::vector(partial.begin() + offset, partial.begin() + offset + 4);
+      if (inside) {
+        ASSERT_EQ(pixel, std::vector(full.begin() + offset, full.begin() + offset + 4)) << x << "," << y;
+      } else {
+        ASSERT_EQ(pixel, std::vector<std::uint8_t>(4, 0)) << x << "," << y;
+      }
+    }
+  }
+}
+
+TEST_F(PixelConversionTests, BenchmarkKernels) {
+  constexpr std::size_t Count = 1920 * 1080;
+  auto src = RandomPixels(Count, 4);
+  std::vector<std::uint8_t> dst(Count * 4);
+  PixelConversion conversion{PixelLayout::RGBA, PixelAlpha::Straight};
+
+#ifdef DEBUG
+  constexpr int Iterations = 5;
+#else
+  constexpr int Iterations = 50;
+#endif
+
+  for (auto kernel : {PixelKernel::Scalar, PixelKernel::SSSE3, PixelKernel::AVX2}) {
+    if (!IsPixelKernelSupported(kernel))
+      continue;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int idx = 0; idx < Iterations; idx++)
+      ConvertPixels(src.data(), dst.data(), Count, conversion, kernel);
+
+    auto micros = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / Iterations;
+    L->info("1080p RGBA straight -> BGRA premultiplied, kernel {}: {:.1f}us", int(kernel), micros);
+  }
+}
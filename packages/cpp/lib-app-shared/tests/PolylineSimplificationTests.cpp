@@ -0,0 +1,56 @@
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <gtest/gtest.h>
+
+#include <IRacingTools/Shared/Graphics/PolylineSimplification.h>
+
+using namespace IRacingTools::Shared::Geometry;
+
+namespace {
+  std::vector<PixelD> MakeCircle(std::size_t count, double radius) {
+    std::vector<PixelD> points{};
+    for (std::size_t idx = 0; idx < count; idx++) {
+      auto angle = 2.0 * std::numbers::pi * static_cast<double>(idx) / static_cast<double>(count);
+      points.push_back({radius * std::cos(angle), radius * std::sin(angle)});
+    }
+
+    return points;
+  }
+} // namespace
+
+TEST(PolylineSimplificationTests, collinear_points_collapse) {
+  std::vector<PixelD> points{};
+  for (int idx = 0; idx <= 100; idx++) {
+    points.push_back({static_cast<double>(idx), 2.0 * idx});
+  }
+
+  auto indexes = SimplifyPolyline(points, 0.01);
+  ASSERT_EQ(indexes.size(), 2);
+  EXPECT_EQ(indexes.front(), 0);
+  EXPECT_EQ(indexes.back(), 100);
+}
+
+TEST(PolylineSimplificationTests, error_is_bounded) {
+  auto points = MakeCircle(2048, 1000.0);
+
+  std::size_t previousCount = points.size();
+  for (auto tolerance : {0.1, 0.5, 2.0, 8.0}) {
+    auto indexes = SimplifyPolyline(points, tolerance);
+    EXPECT_EQ(indexes.front(), 0);
+    EXPECT_EQ(indexes.back(), points.size() - 1);
+    EXPECT_TRUE(std::ranges::is_sorted(indexes));
+    EXPECT_LE(PolylineDeviation(points, indexes), tolerance);
+    EXPECT_LT(indexes.size(), previousCount) << tolerance;
+    previousCount = indexes.size();
+  }
+
+  // a half pixel on a 2000px wide circle is an order of magnitude fewer points
+  EXPECT_LT(SimplifyPolyline(points, 0.5).size(), points.size() / 10);
+}
+
+TEST(PolylineSimplificationTests, keeps_small_inputs) {
+  std::vector<PixelD> points{{0.0, 0.0}, {1.0, 1.0}};
+  EXPECT_EQ(SimplifyPolyline(points, 10.0).size(), 2);
+  EXPECT_TRUE(SimplifyPolyline({}, 10.0).empty());
+}
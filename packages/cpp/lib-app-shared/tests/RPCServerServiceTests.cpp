@@ -1,3 +1,7 @@
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
 
 #include <fmt/core.h>
 #include <gtest/gtest.h>
@@ -95,3 +99,339 @@ TEST_F(RPCServerServiceTests, SimpleRouteSync) {
   EXPECT_EQ(messageOut->status(), RPC::Envelope::STATUS_ERROR);
   manager->destroy();
 }
+
+TEST_F(RPCServerServiceTests, RouteTablePrecedence) {
+  using ServiceManagerType = ServiceManager<RPCServerService>;
+  auto manager = std::make_shared<ServiceManagerType>();
+  manager->init();
+  manager->start();
+
+  auto rpcService = manager->getService<RPCServerService>();
+  auto makeRoute = [](int factor, const std::string &matchExpression) {
+    return RPCServerService::TypedRoute<SizeI, SizeI>::Create(
+        [factor](const std::shared_ptr<SizeI> &request, const std::shared_ptr<RPC::Envelope> &)
+            -> std::expected<std::shared_ptr<SizeI>, GeneralError> {
+          auto response = std::make_shared<SizeI>();
+          response->set_width(request->width() * factor);
+          return response;
+        },
+        matchExpression);
+  };
+
+  rpcService->addRoute(makeRoute(2, "/tracks"));
+  rpcService->addRoute(makeRoute(3, "/tracks/.*"));
+  rpcService->addRoute(makeRoute(4, "/tracks/list"));
+  rpcService->addRoute(makeRoute(5, "/tracks"));
+
+  EXPECT_EQ(rpcService->findRoute("/unknown"), nullptr);
+
+  auto call = [&](const std::string &path) {
+    auto exchange = rpcService->acquireExchange();
+    exchange->request()->set_request_path(path);
+    SizeI request{};
+    request.set_width(1);
+    EXPECT_TRUE(exchange->request()->mutable_payload()->PackFrom(request));
+
+    rpcService->execute(exchange);
+    EXPECT_EQ(exchange->response()->status(), RPC::Envelope::STATUS_DONE);
+
+    SizeI response{};
+    EXPECT_TRUE(exchange->response()->payload().UnpackTo(&response));
+    return response.width();
+  };
+
+  // EXACT ROUTES REGISTERED FIRST WIN, AS DO PATTERNS REGISTERED BEFORE AN EXACT ROUTE
+  EXPECT_EQ(call("/tracks"), 2);
+  EXPECT_EQ(call("/tracks/list"), 3);
+  EXPECT_EQ(call("/tracks/other"), 3);
+
+  manager->destroy();
+}
+
+TEST_F(RPCServerServiceTests, ExchangesAreReused) {
+  using ServiceManagerType = ServiceManager<RPCServerService>;
+  auto manager = std::make_shared<ServiceManagerType>();
+  manager->init();
+  manager->start();
+
+  auto rpcService = manager->getService<RPCServerService>();
+  auto exchange = rpcService->acquireExchange();
+  auto exchangePtr = exchange.get();
+  exchange->request()->set_id("first");
+  exchange.reset();
+
+  exchange = rpcService->acquireExchange();
+  EXPECT_EQ(exchange.get(), exchangePtr);
+  EXPECT_TRUE(exchange->request()->id().empty());
+  EXPECT_EQ(exchange->request()->GetArena(), exchange->arena());
+
+  // RESPONSE ENVELOPES RETURNED BY THE COMPAT API HOLD THEIR EXCHANGE
+  auto messageIn = std::make_shared<RPC::Envelope>();
+  messageIn->set_request_path("/missing");
+  auto messageOut = rpcService->execute(messageIn);
+  EXPECT_NE(messageOut->GetArena(), nullptr);
+  EXPECT_EQ(messageOut->status(), RPC::Envelope::STATUS_ERROR);
+
+  manager->destroy();
+}
+
+TEST_F(RPCServerServiceTests, BenchmarkRequestThroughput) {
+  using ServiceManagerType = ServiceManager<RPCServerService>;
+  auto manager = std::make_shared<ServiceManagerType>();
+  manager->init();
+  manager->start();
+
+  auto rpcService = manager->getService<RPCServerService>();
+  auto executor = [](const std::shared_ptr<SizeI> &request, const std::shared_ptr<RPC::Envelope> &)
+      -> std::expected<std::shared_ptr<SizeI>, GeneralError> {
+    auto response = std::make_shared<SizeI>();
+    response->set_width(request->width() + 1);
+    return response;
+  };
+
+  // 64 EXACT ROUTES AHEAD OF A REGEX ROUTE, THE PREVIOUS LINEAR SCAN WORST CASE
+  for (int idx = 0; idx < 64; idx++)
+    rpcService->addRoute(RPCServerService::TypedRoute<SizeI, SizeI>::Create(executor, fmt::format("/route/{}", idx)));
+
+  rpcService->addRoute(RPCServerService::TypedRoute<SizeI, SizeI>::Create(executor, "/pattern/[0-9]+"));
+
+  SizeI request{};
+  request.set_width(1);
+  RPC::Envelope requestEnvelope{};
+  requestEnvelope.set_request_path("/route/63");
+  ASSERT_TRUE(requestEnvelope.mutable_payload()->PackFrom(request));
+  auto requestBytes = requestEnvelope.SerializeAsString();
+
+#ifdef DEBUG
+  constexpr int RequestCount = 20000;
+#else
+  constexpr int RequestCount = 200000;
+#endif
+
+  auto timeIt = [&](auto &&fn) {
+    auto start = std::chrono::steady_clock::now();
+    for (int idx = 0; idx < RequestCount; idx++)
+      fn();
+
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  };
+
+  std::string responseBytes{};
+  auto envelopeSeconds = timeIt([&] {
+    auto messageIn = std::make_shared<RPC::Envelope>();
+    ASSERT_TRUE(messageIn->ParseFromString(requestBytes));
+    auto messageOut = rpcService->execute(messageIn);
+    messageOut->SerializeToString(&responseBytes);
+  });
+
+  auto exchangeSeconds = timeIt([&] {
+    auto exchange = rpcService->acquireExchange();
+    ASSERT_TRUE(exchange->request()->ParseFromString(requestBytes));
+    rpcService->execute(exchange);
+    exchange->response()->SerializeToString(&exchange->responseBytes());
+  });
+
+  L->info(
+      "{} requests, copied envelopes {:.0f} req/s, in place exchanges {:.0f} req/s",
+      RequestCount,
+      RequestCount / envelopeSeconds,
+      RequestCount / exchangeSeconds);
+
+  RPC::Envelope responseEnvelope{};
+  ASSERT_TRUE(responseEnvelope.ParseFromString(responseBytes));
+  EXPECT_EQ(responseEnvelope.status(), RPC::Envelope::STATUS_DONE);
+
+  manager->destroy();
+}
+
+TEST_F(RPCServerServiceTests, AsyncRespectsRouteConcurrency) {
+  using ServiceManagerType = ServiceManager<RPCServerService>;
+  auto manager = std::make_shared<ServiceManagerType>();
+  manager->init();
+
+  auto rpcService = manager->getService<RPCServerService>();
+  rpcService->setOptions({.useTaskQueue = true});
+  manager->start();
+  std::atomic_int running{0};
+  std::atomic_int maxRunning{0};
+  auto route = RPCServerService::TypedRoute<SizeI, SizeI>::Create(
+      [&](const std::shared_ptr<SizeI> &request, const std::shared_ptr<RPC::Envelope> &)
+          -> std::expected<std::shared_ptr<SizeI>, GeneralError> {
+        auto current = ++running;
+        auto max = maxRunning.load();
+        while (current > max && !maxRunning.compare_exchange_weak(max, current)) {
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        running--;
+
+        auto response = std::make_shared<SizeI>();
+        response->set_width(request->width() * 2);
+        return response;
+      },
+      "/limited");
+  route->setMaxConcurrency(2);
+  rpcService->addRoute(route);
+
+  constexpr int RequestCount = 16;
+  std::atomic_int completed{0};
+  std::atomic_int done{0};
+  std::promise<void> allCompleted{};
+  for (int idx = 0; idx < RequestCount; idx++) {
+    auto exchange = rpcService->acquireExchange();
+    exchange->request()->set_request_path(idx == 0 ? "/missing" : "/limited");
+    SizeI request{};
+    request.set_width(idx);
+    ASSERT_TRUE(exchange->request()->mutable_payload()->PackFrom(request));
+
+    rpcService->executeAsync(exchange, [&](const RPCServerService::ExchangePtr &completedExchange) {
+      if (completedExchange->response()->status() == RPC::Envelope::STATUS_DONE)
+        done++;
+
+      if (++completed == RequestCount)
+        allCompleted.set_value();
+    });
+  }
+
+  ASSERT_EQ(allCompleted.get_future().wait_for(std::chrono::seconds(10)), std::future_status::ready);
+  EXPECT_EQ(done, RequestCount - 1);
+  EXPECT_LE(maxRunning, 2);
+
+  auto metrics = rpcService->metrics();
+  EXPECT_EQ(metrics.inFlight, 0);
+  EXPECT_EQ(metrics.latency.count, RequestCount - 1);
+  ASSERT_TRUE(metrics.routes.contains("/limited"));
+
+  auto &routeMetrics = metrics.routes["/limited"];
+  EXPECT_EQ(routeMetrics.running, 0);
+  EXPECT_EQ(routeMetrics.waiting, 0);
+  EXPECT_EQ(routeMetrics.latency.count, RequestCount - 1);
+
+  // QUEUED BEHIND THE LIMIT, SO LATER CALLS WAITED AT LEAST 2 SLEEPS
+  EXPECT_GE(routeMetrics.latency.maxMicros, 2000);
+
+  manager->destroy();
+}
+
+TEST_F(RPCServerServiceTests, AsyncThrowingRouteReleasesSlot) {
+  using ServiceManagerType = ServiceManager<RPCServerService>;
+  auto manager = std::make_shared<ServiceManagerType>();
+  manager->init();
+
+  auto rpcService = manager->getService<RPCServerService>();
+  rpcService->setOptions({.useTaskQueue = true});
+  manager->start();
+  auto route = RPCServerService::TypedRoute<SizeI, SizeI>::Create(
+      [](const std::shared_ptr<SizeI> &, const std::shared_ptr<RPC::Envelope> &)
+          -> std::expected<std::shared_ptr<SizeI>, GeneralError> {
+        throw std::runtime_error("route failed");
+      },
+      "/throws");
+  route->setMaxConcurrency(1);
+  rpcService->addRoute(route);
+
+  constexpr int RequestCount = 4;
+  std::atomic_int failed{0};
+  std::atomic_int completed{0};
+  std::promise<void> allCompleted{};
+  for (int idx = 0; idx < RequestCount; idx++) {
+    auto exchange = rpcService->acquireExchange();
+    exchange->request()->set_request_path("/throws");
+    ASSERT_TRUE(exchange->request()->mutable_payload()->PackFrom(SizeI{}));
+    rpcService->executeAsync(exchange, [&](const RPCServerService::ExchangePtr &completedExchange) {
+      auto response = completedExchange->response();
+      if (response->status() == RPC::Envelope::STATUS_ERROR && response->error_details() == "route failed")
+        failed++;
+
+      if (++completed == RequestCount)
+        allCompleted.set_value();
+    });
+  }
+
+  // EVERY CALL QUEUED BEHIND THE FIRST STILL RUNS
+  ASSERT_EQ(allCompleted.get_future().wait_for(std::chrono::seconds(10)), std::future_status::ready);
+  EXPECT_EQ(failed, RequestCount);
+
+  auto metrics = rpcService->metrics();
+  EXPECT_EQ(metrics.inFlight, 0);
+  EXPECT_EQ(metrics.routes["/throws"].running, 0);
+
+  manager->destroy();
+}
+
+TEST_F(RPCServerServiceTests, AsyncCallsCancelledOnDestroy) {
+  using ServiceManagerType = ServiceManager<RPCServerService>;
+  auto manager = std::make_shared<ServiceManagerType>();
+  manager->init();
+
+  auto rpcService = manager->getService<RPCServerService>();
+  rpcService->setOptions({.useTaskQueue = true});
+  manager->start();
+  std::promise<void> started{};
+  std::promise<void> release{};
+  auto released = release.get_future().share();
+  auto route = RPCServerService::TypedRoute<SizeI, SizeI>::Create(
+      [&started, released](const std::shared_ptr<SizeI> &, const std::shared_ptr<RPC::Envelope> &)
+          -> std::expected<std::shared_ptr<SizeI>, GeneralError> {
+        started.set_value();
+        released.wait();
+        return std::make_shared<SizeI>();
+      },
+      "/blocked");
+  route->setMaxConcurrency(1);
+  rpcService->addRoute(route);
+
+  std::atomic_int done{0};
+  std::atomic_int cancelled{0};
+  for (int idx = 0; idx < 4; idx++) {
+    auto exchange = rpcService->acquireExchange();
+    exchange->request()->set_request_path("/blocked");
+    exchange->request()->set_id(std::to_string(idx));
+    ASSERT_TRUE(exchange->request()->mutable_payload()->PackFrom(SizeI{}));
+    rpcService->executeAsync(exchange, [&](const RPCServerService::ExchangePtr &completedExchange) {
+      auto response = completedExchange->response();
+      EXPECT_EQ(response->id(), completedExchange->request()->id());
+      if (response->status() == RPC::Envelope::STATUS_DONE)
+        done++;
+      else if (response->error_details() == "Request cancelled")
+        cancelled++;
+    });
+  }
+
+  ASSERT_EQ(started.get_future().wait_for(std::chrono::seconds(10)), std::future_status::ready);
+  EXPECT_EQ(rpcService->metrics().routes["/blocked"].waiting, 3);
+
+  // RELEASED WHILE `destroy` WAITS FOR THE RUNNING CALL
+  std::thread releaser([&] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    release.set_value();
+  });
+
+  rpcService->destroy();
+  releaser.join();
+
+  EXPECT_EQ(done, 1);
+  EXPECT_EQ(cancelled, 3);
+  EXPECT_EQ(rpcService->metrics().inFlight, 0);
+
+  manager->destroy();
+}
+
+TEST_F(RPCServerServiceTests, LatencyHistogramPercentiles) {
+  LatencyHistogram histogram{};
+  for (int idx = 1; idx <= 100; idx++)
+    histogram.record(std::chrono::microseconds(idx * 10));
+
+  auto snapshot = histogram.snapshot();
+  EXPECT_EQ(snapshot.count, 100);
+  EXPECT_EQ(snapshot.maxMicros, 1000);
+  EXPECT_DOUBLE_EQ(snapshot.meanMicros(), 505.0);
+
+  // BUCKET UPPER BOUNDS, SO WITHIN 2X OF THE EXACT VALUE
+  EXPECT_EQ(snapshot.percentileMicros(0.5), 511);
+  EXPECT_EQ(snapshot.percentileMicros(0.99), 1000);
+  EXPECT_EQ(snapshot.percentileMicros(0.0), 15);
+  EXPECT_EQ(LatencyHistogram::BucketIndex(0), 0);
+  EXPECT_EQ(LatencyHistogram::BucketIndex(1), 1);
+  EXPECT_EQ(LatencyHistogram::BucketIndex(1024), 11);
+}
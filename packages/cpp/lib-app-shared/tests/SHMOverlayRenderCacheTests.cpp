@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include <IRacingTools/Shared/Logging/LoggingManager.h>
+#include <IRacingTools/Shared/SHM/SHMOverlayRenderCache.h>
+
+using namespace IRacingTools::Shared::Logging;
+using namespace IRacingTools::Shared::SHM;
+
+namespace {
+
+  class SHMOverlayRenderCacheTests;
+
+  auto L = GetCategoryWithType<SHMOverlayRenderCacheTests>();
+
+  class SHMOverlayRenderCacheTests : public testing::Test {
+  protected:
+    SHMOverlayRenderCacheTests() = default;
+
+    virtual void TearDown() override {
+      L->flush();
+    }
+  };
+
+  using Entry = SHMOverlayRenderCache::Entry;
+} // namespace
+
+TEST_F(SHMOverlayRenderCacheTests, redraws_only_changed_overlays) {
+  SHMOverlayRenderCache cache;
+  std::vector<Entry> entries{{0, 10}, {1, 20}, {2, 30}};
+
+  // NOTHING DRAWN YET
+  auto diff = cache.diff(entries);
+  EXPECT_TRUE(diff.full);
+  EXPECT_EQ(diff.changed, (std::vector<std::size_t>{0, 1, 2}));
+  cache.update(entries);
+
+  // A RESUBMIT OF THE SAME CONTENT
+  EXPECT_TRUE(cache.diff(entries).empty());
+
+  // ONE OVERLAY CHANGED
+  entries[1].key = 21;
+  diff = cache.diff(entries);
+  EXPECT_FALSE(diff.full);
+  EXPECT_EQ(diff.changed, (std::vector<std::size_t>{1}));
+  cache.update(entries);
+  EXPECT_TRUE(cache.diff(entries).empty());
+
+  // FORGOTTEN, i.e. A NEW SWAPCHAIN
+  cache.reset();
+  EXPECT_TRUE(cache.diff(entries).full);
+}
+
+TEST_F(SHMOverlayRenderCacheTests, slot_changes_redraw_all) {
+  SHMOverlayRenderCache cache;
+  std::vector<Entry> entries{{0, 10}, {1, 20}, {2, 30}};
+  cache.update(entries);
+
+  // A STALE OVERLAY IS NO LONGER DRAWN, ITS PIXELS MUST BE CLEARED
+  std::vector<Entry> withoutMiddle{{0, 10}, {2, 30}};
+  auto diff = cache.diff(withoutMiddle);
+  EXPECT_TRUE(diff.full);
+  EXPECT_EQ(diff.changed.size(), 2);
+
+  // SAME COUNT, DIFFERENT SLOTS
+  std::vector<Entry> moved{{0, 10}, {1, 20}, {3, 30}};
+  EXPECT_TRUE(cache.diff(moved).full);
+
+  // NO OVERLAYS LEFT STILL CLEARS
+  cache.update(entries);
+  diff = cache.diff({});
+  EXPECT_TRUE(diff.full);
+  EXPECT_FALSE(diff.empty());
+}
+
+TEST_F(SHMOverlayRenderCacheTests, combine_depends_on_order_and_value) {
+  auto key = SHMOverlayRenderCache::Combine(SHMOverlayRenderCache::Combine(0, 1), 2);
+  EXPECT_EQ(key, SHMOverlayRenderCache::Combine(SHMOverlayRenderCache::Combine(0, 1), 2));
+  EXPECT_NE(key, SHMOverlayRenderCache::Combine(SHMOverlayRenderCache::Combine(0, 2), 1));
+  EXPECT_NE(key, SHMOverlayRenderCache::Combine(SHMOverlayRenderCache::Combine(0, 1), 3));
+}
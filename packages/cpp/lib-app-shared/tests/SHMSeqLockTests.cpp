@@ -0,0 +1,210 @@
+#include <chrono>
+#include <thread>
+#include <gtest/gtest.h>
+
+#include <IRacingTools/Shared/Logging/LoggingManager.h>
+#include <IRacingTools/Shared/SHM/SHMSeqLock.h>
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#define IRT_SEQLOCK_TESTS_POSIX 1
+#else
+#define IRT_SEQLOCK_TESTS_POSIX 0
+#endif
+
+using namespace IRacingTools::Shared::Logging;
+using namespace IRacingTools::Shared::SHM;
+
+namespace {
+
+  class SHMSeqLockTests;
+
+  auto L = GetCategoryWithType<SHMSeqLockTests>();
+
+  class SHMSeqLockTests : public testing::Test {
+  protected:
+    SHMSeqLockTests() = default;
+
+    virtual void TearDown() override {
+      L->flush();
+    }
+  };
+
+  /**
+   * @brief Every field derives from `writer` & `sequence`, so a torn copy
+   *   is detectable
+   */
+  struct Payload {
+    std::uint64_t writer;
+    std::uint64_t sequence;
+    std::uint64_t values[61];
+    std::uint32_t tail;
+
+    static Payload Make(std::uint64_t writer, std::uint64_t sequence) {
+      Payload payload{};
+      payload.writer = writer;
+      payload.sequence = sequence;
+      for (std::uint64_t idx = 0; idx < std::size(payload.values); idx++)
+        payload.values[idx] = (writer << 48) ^ (sequence * 0x9e3779b97f4a7c15ull) ^ idx;
+
+      payload.tail = static_cast<std::uint32_t>(writer + sequence);
+      return payload;
+    }
+
+    bool isComplete() const {
+      return *this == Make(writer, sequence);
+    }
+
+    bool operator==(const Payload&) const = default;
+  };
+
+  using PayloadSeqLock = SHMSeqLock<Payload>;
+
+  constexpr std::uint64_t WriterCount = 3;
+
+#ifdef DEBUG
+  constexpr std::uint64_t StoresPerWriter = 20000;
+#else
+  constexpr std::uint64_t StoresPerWriter = 200000;
+#endif
+
+  /**
+   * @brief Read until `finalVersion` was published, checking each read is
+   *   complete & no writer goes back in time
+   * @return reads done
+   */
+  std::uint64_t ReadUntilDone(const PayloadSeqLock& seqLock, std::uint64_t finalVersion) {
+    std::array<std::uint64_t, WriterCount + 1> lastSequence{};
+    std::uint64_t reads = 0;
+    for (;;) {
+      auto payload = seqLock.load();
+      reads++;
+      EXPECT_TRUE(payload.isComplete()) << "writer=" << payload.writer << " sequence=" << payload.sequence;
+      if (!payload.isComplete() || payload.writer > WriterCount)
+        return reads;
+
+      EXPECT_GE(payload.sequence, lastSequence[payload.writer]);
+      lastSequence[payload.writer] = payload.sequence;
+
+      if (seqLock.version() >= finalVersion)
+        return reads;
+    }
+  }
+
+  void WriteAll(PayloadSeqLock& seqLock, std::uint64_t writer) {
+    for (std::uint64_t sequence = 1; sequence <= StoresPerWriter; sequence++)
+      seqLock.store(Payload::Make(writer, sequence));
+  }
+} // namespace
+
+TEST_F(SHMSeqLockTests, zero_filled_memory_is_empty) {
+  alignas(PayloadSeqLock) std::array<std::byte, sizeof(PayloadSeqLock)> memory{};
+  auto seqLock = reinterpret_cast<PayloadSeqLock*>(memory.data());
+
+  Payload payload{};
+  ASSERT_TRUE(seqLock->tryLoad(payload));
+  EXPECT_EQ(payload, Payload{});
+  EXPECT_EQ(seqLock->version(), 0);
+
+  seqLock->store(Payload::Make(1, 1));
+  EXPECT_EQ(seqLock->load(), Payload::Make(1, 1));
+  EXPECT_EQ(seqLock->version(), 1);
+
+  // A WRITER THAT DIED HOLDING THE WRITER LOCK
+  reinterpret_cast<std::uint64_t*>(memory.data())[0] = 1;
+  seqLock->reset(Payload::Make(1, 2));
+  EXPECT_EQ(seqLock->load(), Payload::Make(1, 2));
+}
+
+TEST_F(SHMSeqLockTests, concurrent_threads_never_tear) {
+  auto seqLock = std::make_unique<PayloadSeqLock>();
+  seqLock->reset(Payload::Make(0, 0));
+
+  std::vector<std::jthread> writers;
+  for (std::uint64_t writer = 1; writer <= WriterCount; writer++)
+    writers.emplace_back([&, writer] { WriteAll(*seqLock, writer); });
+
+  std::vector<std::uint64_t> reads(4);
+  {
+    std::vector<std::jthread> readers;
+    for (auto& readCount : reads)
+      readers.emplace_back([&] { readCount = ReadUntilDone(*seqLock, 1 + WriterCount * StoresPerWriter); });
+  }
+
+  EXPECT_EQ(seqLock->load().sequence, StoresPerWriter);
+  for (auto readCount : reads)
+    L->info("reader completed {} reads", readCount);
+}
+
+#if IRT_SEQLOCK_TESTS_POSIX
+TEST_F(SHMSeqLockTests, concurrent_processes_never_tear) {
+  // WRITERS ARE FORKED PROCESSES, READERS ARE THREADS OF THIS ONE, ALL
+  // SHARING A POSIX SHM MAPPING
+  auto name = "/irt-seqlock-test-" + std::to_string(getpid());
+  auto fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  ASSERT_GE(fd, 0);
+  shm_unlink(name.c_str());
+  ASSERT_EQ(ftruncate(fd, sizeof(PayloadSeqLock)), 0);
+
+  auto mapping = mmap(nullptr, sizeof(PayloadSeqLock), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  ASSERT_NE(mapping, MAP_FAILED);
+  auto seqLock = static_cast<PayloadSeqLock*>(mapping);
+
+  std::vector<pid_t> children;
+  for (std::uint64_t writer = 1; writer <= WriterCount; writer++) {
+    auto pid = fork();
+    ASSERT_GE(pid, 0);
+    if (pid == 0) {
+      WriteAll(*seqLock, writer);
+      _exit(0);
+    }
+
+    children.push_back(pid);
+  }
+
+  std::vector<std::uint64_t> reads(2);
+  {
+    std::vector<std::jthread> readers;
+    for (auto& readCount : reads)
+      readers.emplace_back([&] { readCount = ReadUntilDone(*seqLock, WriterCount * StoresPerWriter); });
+  }
+
+  for (auto pid : children) {
+    int status = 0;
+    ASSERT_EQ(waitpid(pid, &status, 0), pid);
+    EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+  }
+
+  EXPECT_EQ(seqLock->version(), WriterCount * StoresPerWriter);
+  munmap(mapping, sizeof(PayloadSeqLock));
+}
+#endif
+
+TEST_F(SHMSeqLockTests, BenchmarkLoadStore) {
+  auto seqLock = std::make_unique<PayloadSeqLock>();
+  seqLock->reset(Payload::Make(0, 0));
+
+#ifdef DEBUG
+  constexpr int Iterations = 100000;
+#else
+  constexpr int Iterations = 1000000;
+#endif
+
+  auto start = std::chrono::steady_clock::now();
+  for (int idx = 0; idx < Iterations; idx++)
+    seqLock->store(Payload::Make(1, idx));
+
+  auto storeNanos = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / Iterations;
+
+  std::uint64_t checksum = 0;
+  start = std::chrono::steady_clock::now();
+  for (int idx = 0; idx < Iterations; idx++)
+    checksum += seqLock->load().sequence;
+
+  auto loadNanos = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / Iterations;
+  L->info("{} byte payload: store {:.1f}ns, uncontended load {:.1f}ns (checksum {})", sizeof(Payload), storeNanos, loadNanos, checksum);
+}
@@ -1,11 +1,13 @@
+#include <chrono>
+#include <mutex>
+#include <thread>
+
 #include <fmt/core.h>
 #include <gtest/gtest.h>
 
 #include <IRacingTools/SDK/Utils/ConsoleHelpers.h>
 #include <IRacingTools/Shared/FileSystemHelpers.h>
 
-#include <IRacingTools/Shared/Services/TelemetryDataService.h>
-// #include <IRacingTools/Shared/TrackMapGeometry.h>
 #include <IRacingTools/Shared/Logging/LoggingManager.h>
 #include <IRacingTools/Shared/Services/ServiceManager.h>
 
@@ -13,32 +15,193 @@ using namespace IRacingTools::Shared::Logging;
 using namespace IRacingTools::SDK;
 using namespace IRacingTools::SDK::Utils;
 using namespace IRacingTools::Shared;
-//
-// using namespace IRacingTools::Shared::Services;
-//
-// namespace fs = std::filesystem;
-//
-// namespace {
-//
-//   class ServiceManagerTests;
-//
-//   auto L = GetCategoryWithType<ServiceManagerTests>();
-//
-//
-//   class ServiceManagerTests : public testing::Test {
-//   protected:
-//     ServiceManagerTests() = default;
-//
-//     virtual void TearDown() override {
-//       L->flush();
-//     }
-//   };
-//
-// }// namespace
-//
-// TEST_F(ServiceManagerTests, create_simple_container) {
-//   using ServiceManagerType = ServiceManager<TelemetryDataService>;
-//   auto manager = std::make_shared<ServiceManagerType>();
-//
-//   EXPECT_EQ(1, ServiceManagerType::ServiceCount);
-// }
+
+using namespace IRacingTools::Shared::Services;
+
+namespace {
+
+  class ServiceManagerTests;
+
+  auto L = GetCategoryWithType<ServiceManagerTests>();
+
+  class ServiceManagerTests : public testing::Test {
+  protected:
+    ServiceManagerTests() = default;
+
+    virtual void TearDown() override {
+      L->flush();
+    }
+  };
+
+  using Clock = std::chrono::steady_clock;
+  constexpr auto PhaseDuration = std::chrono::milliseconds(100);
+
+  /**
+   * @brief Records the order & time window of every `init()`/`start()`
+   */
+  struct PhaseLog {
+    struct Entry {
+      std::string name;
+      Clock::time_point begin;
+      Clock::time_point end;
+    };
+
+    std::mutex mutex{};
+    std::vector<Entry> inits{};
+    std::vector<Entry> starts{};
+
+    std::optional<Entry> find(const std::vector<Entry> &entries, const std::string &name) {
+      std::scoped_lock lock(mutex);
+      for (auto &entry: entries) {
+        if (entry.name == name)
+          return entry;
+      }
+
+      return std::nullopt;
+    }
+  };
+
+  PhaseLog gPhaseLog{};
+
+  /**
+   * @brief A service that takes `PhaseDuration` to `init()`/`start()`,
+   *   like one loading & parsing its jsonl file
+   */
+  template<int Id, bool FailInit = false>
+  class SlowService : public Service {
+  public:
+    explicit SlowService(const std::shared_ptr<ServiceContainer> &serviceContainer) :
+        Service(serviceContainer, fmt::format("SlowService{}", Id)) {
+    }
+
+    virtual ~SlowService() = default;
+
+    std::expected<bool, GeneralError> init() override {
+      auto begin = Clock::now();
+      std::this_thread::sleep_for(PhaseDuration);
+      record(gPhaseLog.inits, begin);
+      if (FailInit) {
+        return std::unexpected(GeneralError(ErrorCode::General, "init failed"));
+      }
+
+      setState(State::Initialized);
+      return true;
+    }
+
+    std::expected<bool, GeneralError> start() override {
+      auto begin = Clock::now();
+      std::this_thread::sleep_for(PhaseDuration);
+      record(gPhaseLog.starts, begin);
+      setState(State::Running);
+      return true;
+    }
+
+  private:
+    void record(std::vector<PhaseLog::Entry> &entries, Clock::time_point begin) {
+      std::scoped_lock lock(gPhaseLog.mutex);
+      entries.push_back({name(), begin, Clock::now()});
+    }
+  };
+
+  using ServiceA = SlowService<1>;
+  using ServiceB = SlowService<2>;
+
+  class ServiceC : public SlowService<3> {
+  public:
+    using Dependencies = std::tuple<ServiceA, ServiceB>;
+
+    using SlowService::SlowService;
+  };
+
+  using FailingService = SlowService<4, true>;
+
+  void ResetPhaseLog() {
+    std::scoped_lock lock(gPhaseLog.mutex);
+    gPhaseLog.inits.clear();
+    gPhaseLog.starts.clear();
+  }
+
+} // namespace
+
+TEST_F(ServiceManagerTests, create_simple_container) {
+  using ServiceManagerType = ServiceManager<ServiceA>;
+  auto manager = std::make_shared<ServiceManagerType>();
+
+  EXPECT_EQ(1, ServiceManagerType::ServiceCount);
+  EXPECT_EQ(0, ServiceManagerType::IndexOf<ServiceA>());
+}
+
+TEST_F(ServiceManagerTests, independent_services_run_concurrently) {
+  ResetPhaseLog();
+  using ServiceManagerType = ServiceManager<ServiceA, ServiceB, ServiceC>;
+  auto manager = std::make_shared<ServiceManagerType>();
+
+  manager->init();
+  manager->start();
+  ASSERT_TRUE(manager->isRunning());
+
+  auto a = gPhaseLog.find(gPhaseLog.inits, "SlowService1");
+  auto b = gPhaseLog.find(gPhaseLog.inits, "SlowService2");
+  auto c = gPhaseLog.find(gPhaseLog.inits, "SlowService3");
+  ASSERT_TRUE(a && b && c);
+
+  // A & B OVERLAP, C WAITS FOR BOTH
+  EXPECT_LT(a->begin, b->end);
+  EXPECT_LT(b->begin, a->end);
+  EXPECT_GE(c->begin, a->end);
+  EXPECT_GE(c->begin, b->end);
+
+  // 2 LEVELS INSTEAD OF 3 SEQUENTIAL SERVICES
+  auto timing = manager->timing();
+  EXPECT_LT(timing.init, PhaseDuration * 3);
+  EXPECT_LT(timing.start, PhaseDuration * 3);
+  for (auto &serviceTiming: manager->serviceTimings()) {
+    EXPECT_GE(serviceTiming.init, PhaseDuration);
+    EXPECT_GE(serviceTiming.start, PhaseDuration);
+  }
+
+  L->info(
+    "init {}ms, start {}ms",
+    std::chrono::duration_cast<std::chrono::milliseconds>(timing.init).count(),
+    std::chrono::duration_cast<std::chrono::milliseconds>(timing.start).count()
+  );
+
+  manager->destroy();
+  EXPECT_EQ(manager->state(), ServiceState::Destroyed);
+}
+
+TEST_F(ServiceManagerTests, runtime_dependencies_are_ordered) {
+  ResetPhaseLog();
+  using ServiceManagerType = ServiceManager<ServiceA, ServiceB>;
+  auto manager = std::make_shared<ServiceManagerType>();
+  manager->addDependency<ServiceA, ServiceB>();
+
+  manager->start();
+  ASSERT_TRUE(manager->isRunning());
+
+  auto a = gPhaseLog.find(gPhaseLog.starts, "SlowService1");
+  auto b = gPhaseLog.find(gPhaseLog.starts, "SlowService2");
+  ASSERT_TRUE(a && b);
+  EXPECT_GE(a->begin, b->end);
+}
+
+TEST_F(ServiceManagerTests, dependency_cycle_fails) {
+  using ServiceManagerType = ServiceManager<ServiceA, ServiceB>;
+  auto manager = std::make_shared<ServiceManagerType>();
+  manager->addDependency<ServiceA, ServiceB>();
+  manager->addDependency<ServiceB, ServiceA>();
+
+  EXPECT_THROW(manager->init(), GeneralError);
+}
+
+TEST_F(ServiceManagerTests, failed_init_throws) {
+  ResetPhaseLog();
+  using ServiceManagerType = ServiceManager<ServiceA, FailingService, ServiceC, ServiceB>;
+  auto manager = std::make_shared<ServiceManagerType>(ServiceManagerType::Options{.threadCount = 1});
+  manager->addDependency<ServiceC, FailingService>();
+
+  EXPECT_THROW(manager->init(), GeneralError);
+
+  // `ServiceC` IS NEVER SUBMITTED ONCE ITS DEPENDENCY FAILS
+  EXPECT_FALSE(gPhaseLog.find(gPhaseLog.inits, "SlowService3"));
+}
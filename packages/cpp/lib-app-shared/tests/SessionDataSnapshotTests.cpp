@@ -0,0 +1,183 @@
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <gtest/gtest.h>
+
+#include <IRacingTools/Shared/Logging/LoggingManager.h>
+#include <IRacingTools/Shared/SessionDataSnapshot.h>
+
+using namespace IRacingTools::Shared::Logging;
+using namespace IRacingTools::Shared;
+using namespace IRacingTools::SDK;
+
+namespace {
+
+  class SessionDataSnapshotTests;
+
+  auto L = GetCategoryWithType<SessionDataSnapshotTests>();
+
+  class SessionDataSnapshotTests : public testing::Test {
+  protected:
+    SessionDataSnapshotTests() = default;
+
+    virtual void TearDown() override {
+      L->flush();
+    }
+  };
+
+  VarDataHeader MakeHeader(const char *name, VarDataType type, int offset, int count) {
+    VarDataHeader header{};
+    std::memset(&header, 0, sizeof(header));
+    header.type = type;
+    header.offset = offset;
+    header.count = count;
+    std::strncpy(header.name, name, sizeof(header.name) - 1);
+    return header;
+  }
+
+  /**
+   * @brief `SessionTick` (int) at 0, `CarIdxLapDistPct` (float[64]) at 4 &
+   *   `SessionTime` (double) at 260, matching the unaligned offsets seen in
+   *   real telemetry
+   */
+  VarHeaders MakeHeaders() {
+    return {
+      MakeHeader("SessionTick", VarDataType::Int32, 0, 1),
+      MakeHeader("CarIdxLapDistPct", VarDataType::Float, 4, 64),
+      MakeHeader("SessionTime", VarDataType::Double, 260, 1)
+    };
+  }
+} // namespace
+
+TEST_F(SessionDataSnapshotTests, layout_from_headers) {
+  SessionDataSnapshot snapshot(MakeHeaders());
+
+  ASSERT_EQ(snapshot.layout().size(), 3);
+  EXPECT_EQ(snapshot.layout()[1].name, "CarIdxLapDistPct");
+  EXPECT_EQ(snapshot.layout()[1].count, 64);
+  EXPECT_EQ(snapshot.layout()[2].offset, 260);
+  EXPECT_EQ(snapshot.rowSize(), 268);
+  EXPECT_EQ(snapshot.slotStride(), 272);
+  EXPECT_EQ(snapshot.byteLength(), SessionDataSnapshot::HeaderSize + 2 * 272);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(snapshot.data()) % 8, 0);
+
+  auto header = reinterpret_cast<const std::uint32_t *>(snapshot.data());
+  EXPECT_EQ(header[SessionDataSnapshot::RowSize], 268);
+  EXPECT_EQ(header[SessionDataSnapshot::Sequence], 2);
+  EXPECT_EQ(header[SessionDataSnapshot::LayoutVersion], 1);
+  EXPECT_EQ(header[SessionDataSnapshot::FrameCount], 0);
+  EXPECT_EQ(SessionDataSnapshot::ByteLength(MakeHeaders()), snapshot.byteLength());
+  EXPECT_TRUE(snapshot.matches(MakeHeaders()));
+
+  auto headers = MakeHeaders();
+  headers[2].offset = 264;
+  EXPECT_FALSE(snapshot.matches(headers));
+  headers.pop_back();
+  EXPECT_FALSE(snapshot.matches(headers));
+}
+
+TEST_F(SessionDataSnapshotTests, write_flips_slots) {
+  SessionDataSnapshot snapshot(MakeHeaders());
+  std::vector<char> row(snapshot.rowSize());
+  std::vector<std::byte> readRow(snapshot.rowSize());
+
+  for (int tick = 1; tick <= 3; tick++) {
+    double sessionTime = tick * 0.5;
+    std::memcpy(row.data(), &tick, sizeof(tick));
+    std::memcpy(row.data() + 260, &sessionTime, sizeof(sessionTime));
+    snapshot.write(row.data(), tick);
+
+    EXPECT_EQ(snapshot.read(readRow), 2 + tick * 2);
+
+    double readTime{0};
+    std::memcpy(&readTime, readRow.data() + 260, sizeof(readTime));
+    EXPECT_EQ(readTime, sessionTime);
+  }
+
+  auto header = reinterpret_cast<const std::uint32_t *>(snapshot.data());
+  EXPECT_EQ(header[SessionDataSnapshot::ActiveSlot], 1);
+  EXPECT_EQ(header[SessionDataSnapshot::FrameCount], 3);
+  EXPECT_EQ(header[SessionDataSnapshot::SessionTick], 3);
+
+  // THE SHARED REGION HOLDS THE ROW IN THE ACTIVE SLOT AS-IS
+  std::int32_t sharedTick{0};
+  std::memcpy(&sharedTick, snapshot.data() + SessionDataSnapshot::HeaderSize + snapshot.slotStride(), sizeof(sharedTick));
+  EXPECT_EQ(sharedTick, 3);
+
+  snapshot.invalidate();
+  snapshot.write(row.data(), 4);
+  EXPECT_EQ(header[SessionDataSnapshot::FrameCount], 3);
+  EXPECT_EQ(header[SessionDataSnapshot::Invalidated], 1);
+}
+
+TEST_F(SessionDataSnapshotTests, reads_are_never_torn) {
+  SessionDataSnapshot snapshot(MakeHeaders());
+  std::atomic_bool reading{false};
+  std::atomic_bool writing{true};
+
+  std::thread writer([&] {
+    while (!reading)
+      std::this_thread::yield();
+
+    std::vector<char> row(snapshot.rowSize());
+    for (int tick = 1; tick <= 50000; tick++) {
+      std::memset(row.data(), tick & 0x7F, row.size());
+      snapshot.write(row.data(), tick);
+    }
+    writing = false;
+  });
+
+  std::vector<std::byte> row(snapshot.rowSize());
+  int reads = 0;
+  reading = true;
+  while (writing) {
+    snapshot.read(row);
+    reads++;
+    ASSERT_TRUE(std::ranges::all_of(row, [&](auto value) { return value == row[0]; }));
+  }
+
+  writer.join();
+  L->info("{} consistent reads", reads);
+  EXPECT_GT(reads, 0);
+}
+
+TEST_F(SessionDataSnapshotTests, region_is_seeded_and_reused) {
+  SessionDataSnapshot source(MakeHeaders());
+  std::vector<char> row(source.rowSize());
+  std::int32_t tick = 42;
+  std::memcpy(row.data(), &tick, sizeof(tick));
+  source.write(row.data(), tick);
+
+  std::vector<std::uint64_t> buffer(4096 / sizeof(std::uint64_t));
+  auto region = std::as_writable_bytes(std::span(buffer));
+  auto header = reinterpret_cast<const std::uint32_t *>(region.data());
+
+  auto snapshot = std::make_unique<SessionDataSnapshot>(source, region);
+  EXPECT_EQ(snapshot->data(), region.data());
+  EXPECT_EQ(snapshot->layout().size(), 3);
+  EXPECT_EQ(header[SessionDataSnapshot::FrameCount], 1);
+  EXPECT_EQ(header[SessionDataSnapshot::SessionTick], 42);
+  EXPECT_EQ(header[SessionDataSnapshot::LayoutVersion], 1);
+
+  std::vector<std::byte> readRow(snapshot->rowSize());
+  snapshot->read(readRow);
+  std::int32_t readTick{0};
+  std::memcpy(&readTick, readRow.data(), sizeof(readTick));
+  EXPECT_EQ(readTick, 42);
+
+  snapshot->write(row.data(), 43);
+  auto sequence = header[SessionDataSnapshot::Sequence];
+  snapshot->invalidate();
+
+  // A NEW LAYOUT IN THE SAME REGION KEEPS COUNTING
+  auto headers = MakeHeaders();
+  headers.push_back(MakeHeader("Lap", VarDataType::Int32, 268, 1));
+  snapshot = std::make_unique<SessionDataSnapshot>(headers, region);
+  EXPECT_EQ(snapshot->rowSize(), 272);
+  EXPECT_EQ(header[SessionDataSnapshot::Sequence], sequence + 2);
+  EXPECT_EQ(header[SessionDataSnapshot::LayoutVersion], 2);
+  EXPECT_EQ(header[SessionDataSnapshot::Invalidated], 0);
+  EXPECT_EQ(header[SessionDataSnapshot::FrameCount], 0);
+  EXPECT_EQ(header[SessionDataSnapshot::RowSize], 272);
+}
@@ -35,8 +35,45 @@ namespace {
     }
   };
 
+  /**
+   * @brief Single threaded `int(int)` queue whose first task blocks until
+   *   `release()` so the following tasks stay queued
+   */
+  struct GatedQueue {
+    std::promise<void> gate{};
+    std::shared_future<void> gateFuture{gate.get_future().share()};
+    std::mutex orderMutex{};
+    std::vector<int> order{};
+    TaskQueue<int, int> queue;
+
+    explicit GatedQueue(std::size_t capacity = 0)
+        : queue(
+              [this](int value) {
+                if (value == 0)
+                  gateFuture.wait();
+
+                std::scoped_lock lock(orderMutex);
+                order.push_back(value);
+                return value * 10;
+              },
+              TaskQueue<int, int>::Options{.threadCount = 1, .capacity = capacity}) {
+    }
+
+    /**
+     * @brief Enqueue the blocking task & wait until it is running
+     */
+    TaskQueue<int, int>::FutureType block() {
+      auto future = queue.enqueue(0);
+      while (queue.metrics().running == 0)
+        std::this_thread::yield();
 
+      return future;
+    }
 
+    void release() {
+      gate.set_value();
+    }
+  };
 
 } // namespace
 
@@ -52,3 +89,139 @@ TEST_F(TaskQueueTests, queue1) {
 
   EXPECT_EQ("Hello Jon, you are 43 years old", greeting);
 }
+
+TEST_F(TaskQueueTests, priority_lanes) {
+  GatedQueue gated{};
+  gated.block();
+
+  auto low = gated.queue.enqueue({.priority = TaskPriority::Low}, 3);
+  auto normal = gated.queue.enqueue(2);
+  auto high = gated.queue.enqueue({.priority = TaskPriority::High}, 1);
+
+  auto metrics = gated.queue.metrics();
+  EXPECT_EQ(metrics.queuedCount(), 3);
+  EXPECT_EQ(metrics.queued[static_cast<std::size_t>(TaskPriority::High)], 1);
+
+  gated.release();
+  EXPECT_EQ(low.get(), 30);
+  EXPECT_EQ(high.get(), 10);
+  EXPECT_EQ(normal.get(), 20);
+  EXPECT_EQ(gated.order, (std::vector<int>{0, 1, 2, 3}));
+}
+
+TEST_F(TaskQueueTests, deduplicates_by_key) {
+  GatedQueue gated{};
+  gated.block();
+
+  auto first = gated.queue.enqueue({.priority = TaskPriority::Low, .key = "file.ibt"}, 1);
+  auto other = gated.queue.enqueue(2);
+  auto second = gated.queue.enqueue({.priority = TaskPriority::High, .key = "file.ibt"}, 5);
+
+  // SAME TASK, LATEST ARGS & HIGHEST PRIORITY
+  EXPECT_EQ(gated.queue.pendingTaskCount(), 2);
+  EXPECT_EQ(gated.queue.metrics().deduplicated, 1);
+
+  gated.release();
+  EXPECT_EQ(first.get(), 50);
+  EXPECT_EQ(second.get(), 50);
+  EXPECT_EQ(other.get(), 20);
+  EXPECT_EQ(gated.order, (std::vector<int>{0, 5, 2}));
+}
+
+TEST_F(TaskQueueTests, cancels_queued_and_running) {
+  GatedQueue gated{};
+  gated.block();
+
+  CancellationToken token{};
+  auto byKey = gated.queue.enqueue({.key = "removed.ibt"}, 1);
+  auto byToken = gated.queue.enqueue({.token = token}, 2);
+  auto kept = gated.queue.enqueue(3);
+
+  EXPECT_TRUE(gated.queue.cancel("removed.ibt"));
+  EXPECT_FALSE(gated.queue.cancel("unknown.ibt"));
+  token.cancel();
+
+  gated.release();
+  EXPECT_THROW(byKey.get(), TaskCancelledError);
+  EXPECT_THROW(byToken.get(), TaskCancelledError);
+  EXPECT_EQ(kept.get(), 30);
+  EXPECT_EQ(gated.order, (std::vector<int>{0, 3}));
+  EXPECT_EQ(gated.queue.metrics().cancelled, 2);
+
+  // RUNNING TASKS ARE CANCELLED COOPERATIVELY
+  std::atomic_bool started{false};
+  TaskQueue<bool> loopQueue([&] {
+    started = true;
+    while (!CancellationToken::IsCancellationRequested())
+      std::this_thread::yield();
+
+    return true;
+  });
+
+  auto loop = loopQueue.enqueue({.key = "loop"});
+  while (!started)
+    std::this_thread::yield();
+
+  EXPECT_TRUE(loopQueue.cancel("loop"));
+  EXPECT_TRUE(loop.get());
+}
+
+TEST_F(TaskQueueTests, destroy_resolves_queued_futures) {
+  GatedQueue gated{};
+  auto blocked = gated.block();
+  auto queued = gated.queue.enqueue(1);
+
+  std::thread releaser([&] {
+    while (gated.queue.pendingTaskCount() > 0)
+      std::this_thread::yield();
+
+    gated.release();
+  });
+
+  gated.queue.destroy();
+  releaser.join();
+
+  EXPECT_EQ(blocked.get(), 0);
+  EXPECT_THROW(queued.get(), TaskCancelledError);
+  EXPECT_FALSE(gated.queue.enqueue(2).valid());
+}
+
+TEST_F(TaskQueueTests, capacity_backpressure) {
+  GatedQueue gated(2);
+  gated.block();
+
+  gated.queue.enqueue(1);
+  gated.queue.enqueue({.key = "full"}, 2);
+  EXPECT_FALSE(gated.queue.tryEnqueue({}, 3).has_value());
+
+  // DEDUPLICATED ENQUEUES DO NOT NEED CAPACITY
+  EXPECT_TRUE(gated.queue.tryEnqueue({.key = "full"}, 4).has_value());
+
+  std::atomic_bool enqueued{false};
+  std::thread producer([&] {
+    gated.queue.enqueue(5);
+    enqueued = true;
+  });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_FALSE(enqueued);
+
+  gated.release();
+  producer.join();
+  EXPECT_TRUE(enqueued);
+
+  while (gated.queue.metrics().completed < 4)
+    std::this_thread::yield();
+
+  auto metrics = gated.queue.metrics();
+  EXPECT_EQ(gated.order, (std::vector<int>{0, 1, 4, 5}));
+  EXPECT_GT(metrics.maxRun.count(), 0);
+  L->info(
+    "completed={} wait(total={}us,max={}us) run(total={}us,max={}us)",
+    metrics.completed,
+    metrics.totalWait.count(),
+    metrics.maxWait.count(),
+    metrics.totalRun.count(),
+    metrics.maxRun.count()
+  );
+}
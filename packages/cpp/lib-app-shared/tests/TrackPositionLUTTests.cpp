@@ -0,0 +1,156 @@
+#include <chrono>
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <gtest/gtest.h>
+
+#include <IRacingTools/Shared/Logging/LoggingManager.h>
+#include <IRacingTools/Shared/Services/TrackPositionLUT.h>
+
+using namespace IRacingTools::Shared;
+using namespace IRacingTools::Shared::Logging;
+using namespace IRacingTools::Shared::Services;
+
+namespace {
+  class TrackPositionLUTTests;
+
+  auto L = GetCategoryWithType<TrackPositionLUTTests>();
+
+  class TrackPositionLUTTests : public testing::Test {
+  protected:
+    TrackPositionLUTTests() = default;
+
+    virtual void TearDown() override {
+      L->flush();
+    }
+  };
+
+  constexpr double CenterLatitude = 45.5;
+  constexpr double CenterLongitude = -73.5;
+  constexpr double RadiusDegrees = 0.009;
+
+  /**
+   * @brief Counter clockwise circle starting east of center, sampled at
+   *   irregular `lap_percent_complete` steps like a recorded lap
+   */
+  IRacingTools::Models::LapTrajectory MakeCircleTrajectory(std::size_t count) {
+    std::mt19937 rng{11};
+    std::uniform_real_distribution<double> jitter(-0.3, 0.3);
+    auto longitudeScale = std::cos(CenterLatitude / 180.0 * std::numbers::pi);
+
+    IRacingTools::Models::LapTrajectory trajectory{};
+    for (std::size_t idx = 0; idx < count; idx++) {
+      auto pct = (static_cast<double>(idx) + (idx ? jitter(rng) : 0.0)) / static_cast<double>(count);
+      auto angle = 2.0 * std::numbers::pi * pct;
+      auto coord = trajectory.add_path();
+      coord->set_lap_percent_complete(static_cast<float>(pct));
+      coord->set_latitude(CenterLatitude + RadiusDegrees * std::sin(angle));
+      coord->set_longitude(CenterLongitude + RadiusDegrees * std::cos(angle) / longitudeScale);
+    }
+
+    return trajectory;
+  }
+
+  /**
+   * @brief Normalized (north up, longest side `1`) position on the circle
+   */
+  std::pair<float, float> ExpectedPosition(float pct) {
+    auto angle = 2.0 * std::numbers::pi * pct;
+    return {static_cast<float>((std::cos(angle) + 1.0) / 2.0), static_cast<float>((1.0 - std::sin(angle)) / 2.0)};
+  }
+} // namespace
+
+TEST_F(TrackPositionLUTTests, interpolates_positions) {
+  auto res = TrackPositionLUT::Create(MakeCircleTrajectory(1500));
+  ASSERT_TRUE(res.has_value()) << res.error().what();
+
+  auto& lut = res.value();
+  EXPECT_EQ(lut.binCount(), TrackPositionLUT::DefaultBinCount);
+  EXPECT_NEAR(lut.width(), 1.0f, 1e-3f);
+  EXPECT_NEAR(lut.height(), 1.0f, 1e-3f);
+
+  std::vector<float> pcts{};
+  for (int idx = 0; idx < 1000; idx++) {
+    pcts.push_back(static_cast<float>(idx) / 1000.0f + 0.00037f);
+  }
+
+  // includes start/finish, past the last path point
+  pcts.push_back(0.0f);
+  pcts.push_back(0.99999f);
+
+  std::vector<float> xs(pcts.size()), ys(pcts.size());
+  ASSERT_EQ(lut.lookup(pcts, xs, ys), pcts.size());
+  for (std::size_t idx = 0; idx < pcts.size(); idx++) {
+    auto [x, y] = ExpectedPosition(pcts[idx]);
+    EXPECT_NEAR(xs[idx], x, 1e-3f) << pcts[idx];
+    EXPECT_NEAR(ys[idx], y, 1e-3f) << pcts[idx];
+  }
+
+  // scaled & offset to pixels
+  auto pixel = lut.lookup(0.25f, 200.0f, 10.0f, 20.0f);
+  EXPECT_NEAR(pixel.x, 10.0f + 100.0f, 0.2f);
+  EXPECT_NEAR(pixel.y, 20.0f, 0.2f);
+}
+
+TEST_F(TrackPositionLUTTests, not_in_world_is_nan) {
+  auto res = TrackPositionLUT::Create(MakeCircleTrajectory(500), 256);
+  ASSERT_TRUE(res.has_value()) << res.error().what();
+
+  std::array<float, 3> pcts{-1.0f, 0.5f, 1.0f};
+  std::array<float, 3> xs{}, ys{};
+  res->lookup(pcts, xs, ys);
+  EXPECT_TRUE(std::isnan(xs[0]) && std::isnan(ys[0]));
+  EXPECT_FALSE(std::isnan(xs[1]));
+
+  // `1.0` is start/finish again
+  auto start = res->lookup(0.0f);
+  EXPECT_FLOAT_EQ(xs[2], start.x);
+  EXPECT_FLOAT_EQ(ys[2], start.y);
+}
+
+TEST_F(TrackPositionLUTTests, round_trips_through_model) {
+  auto trajectory = MakeCircleTrajectory(800);
+  auto res = TrackPositionLUT::Create(trajectory, 1024);
+  ASSERT_TRUE(res.has_value()) << res.error().what();
+  res->toModel(trajectory.mutable_position_lookup_table());
+
+  IRacingTools::Models::LapTrajectory parsed{};
+  ASSERT_TRUE(parsed.ParseFromString(trajectory.SerializeAsString()));
+  ASSERT_TRUE(parsed.has_position_lookup_table());
+
+  auto restored = TrackPositionLUT::FromModel(parsed.position_lookup_table());
+  ASSERT_TRUE(restored.has_value()) << restored.error().what();
+  EXPECT_EQ(restored->binCount(), 1024);
+  for (auto pct : {0.0f, 0.123f, 0.5f, 0.987f}) {
+    EXPECT_EQ(restored->lookup(pct).x, res->lookup(pct).x);
+    EXPECT_EQ(restored->lookup(pct).y, res->lookup(pct).y);
+  }
+
+  parsed.mutable_position_lookup_table()->mutable_x()->RemoveLast();
+  EXPECT_FALSE(TrackPositionLUT::FromModel(parsed.position_lookup_table()).has_value());
+  EXPECT_FALSE(TrackPositionLUT::Create(IRacingTools::Models::LapTrajectory{}).has_value());
+}
+
+TEST_F(TrackPositionLUTTests, benchmark_full_field) {
+  auto res = TrackPositionLUT::Create(MakeCircleTrajectory(2048));
+  ASSERT_TRUE(res.has_value()) << res.error().what();
+
+  constexpr std::size_t Cars = 64;
+  constexpr int Frames = 100000;
+  std::array<float, Cars> pcts{}, xs{}, ys{};
+  for (std::size_t carIdx = 0; carIdx < Cars; carIdx++) {
+    pcts[carIdx] = static_cast<float>(carIdx) / Cars;
+  }
+
+  float checksum = 0.0f;
+  auto start = std::chrono::steady_clock::now();
+  for (int frame = 0; frame < Frames; frame++) {
+    pcts[frame % Cars] = std::fmod(pcts[frame % Cars] + 0.0001f, 1.0f);
+    res->lookup(pcts, xs, ys, 512.0f);
+    checksum += xs[frame % Cars];
+  }
+
+  auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+  L->info("{:.1f}ns per {} car lookup (checksum {})", elapsed / Frames, Cars, checksum);
+  EXPECT_GT(checksum, 0.0f);
+}
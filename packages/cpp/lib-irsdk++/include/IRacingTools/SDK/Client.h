@@ -27,14 +27,18 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
 #include <expected>
 #include <filesystem>
+#include <span>
 
 #include <IRacingTools/SDK/SessionInfo/SessionInfoMessage.h>
 
 #include <IRacingTools/SDK/DataHeader.h>
 #include <IRacingTools/SDK/ErrorTypes.h>
 #include <IRacingTools/SDK/Types.h>
+#include <IRacingTools/SDK/VarArrayConversion.h>
 
 // A C++ wrapper around the irsdk calls that takes care of reading a .ibt file
 namespace IRacingTools::SDK {
@@ -54,6 +58,23 @@ namespace IRacingTools::SDK {
     virtual ClientId getClientId() = 0;
 
     virtual std::shared_ptr<ClientProvider> getProvider() = 0;
+
+    /**
+     * @brief Process wide generation, bumped whenever any client (re)allocates
+     *   its sample buffer or var headers, or the active client changes.
+     *   Cached var bindings (`VarBinding`) re-resolve when it moves.
+     */
+    static std::uint64_t GetBindingGeneration() noexcept;
+    static void BumpBindingGeneration() noexcept;
+
+    /**
+     * @brief Raw buffer holding the current sample (var header offsets are
+     *   relative to it), stable until the binding generation changes
+     *
+     * @return `nullptr` when no sample data is available
+     */
+    virtual const char* getVarDataBuffer() = 0;
+
     /**
      * @brief Is index valid based on total number of vars
      * @param idx
@@ -110,6 +131,43 @@ namespace IRacingTools::SDK {
     virtual std::optional<double> getVarDouble(const std::string_view &name, uint32_t entry = 0) = 0;
     virtual std::optional<double> getVarDouble(KnownVarName name, uint32_t entry = 0);
 
+    /**
+     * @brief Convert the entries of an array var (i.e. `CarIdx*`) in bulk
+     *
+     * @return number of entries written, `min(out.size(), count)`
+     */
+    template <typename T, std::size_t Extent>
+    std::optional<std::size_t> getVarArray(uint32_t idx, std::span<T, Extent> out, VarArrayKernel kernel = VarArrayKernel::Auto) {
+        auto header = getVarHeader(idx);
+        auto buffer = getVarDataBuffer();
+        if (!header || !buffer) {
+            return std::nullopt;
+        }
+
+        auto count = std::min<std::size_t>(out.size(), header.value()->count);
+        ConvertVarArray(header.value()->type, buffer + header.value()->offset, out.first(count), kernel);
+        return count;
+    }
+
+    /**
+     * @brief `getVarArray`, with cars not in world (`trackSurface == -1`) set to `fallback`
+     */
+    template <typename T, std::size_t Extent>
+    std::optional<std::size_t> getVarArrayMasked(
+        uint32_t idx,
+        std::span<T, Extent> out,
+        std::span<const std::int32_t> trackSurface,
+        T fallback = T{},
+        VarArrayKernel kernel = VarArrayKernel::Auto
+    ) {
+        auto count = getVarArray(idx, out, kernel);
+        if (count) {
+            MaskVarArray(out.first(count.value()), trackSurface, fallback, kernel);
+        }
+
+        return count;
+    }
+
 
     virtual Expected<std::string_view> getSessionInfoStr() = 0;
     virtual std::optional<std::int32_t> getSessionTicks() = 0;
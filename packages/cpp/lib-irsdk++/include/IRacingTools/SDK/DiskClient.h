@@ -100,6 +100,8 @@ namespace IRacingTools::SDK {
     std::size_t getFileSize();
 
     virtual bool isAvailable() override;
+
+    virtual const char* getVarDataBuffer() override;
     
     const Extras* extras() const {
       return &extras_;
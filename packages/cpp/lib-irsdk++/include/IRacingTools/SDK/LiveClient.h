@@ -70,6 +70,8 @@ namespace IRacingTools::SDK {
 
     virtual bool isAvailable() override;
 
+    virtual const char* getVarDataBuffer() override;
+
 
     // what is the base type of the data
     // returns VarDataType as int, so we don't depend on IRTypes.h
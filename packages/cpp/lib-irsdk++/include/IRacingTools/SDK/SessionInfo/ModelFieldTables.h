@@ -0,0 +1,458 @@
+//
+// GENERATED BY `scripts/session-info-field-tables-gen.py` FROM `ModelParser.h`
+// DO NOT EDIT BY HAND, RE-RUN THE GENERATOR AFTER CHANGING ANY DECODER
+//
+
+#pragma once
+
+#include "ModelFields.h"
+#include "SessionInfoMessage.h"
+
+namespace IRacingTools::SDK::SessionInfo {
+
+  template<> struct ModelFields<WeekendOptions> {
+    static constexpr std::array Fields{
+      MakeField<&WeekendOptions::numStarters, std::int32_t>("NumStarters", FieldPresence::Optional),
+      MakeField<&WeekendOptions::startingGrid, std::string>("StartingGrid", FieldPresence::Optional),
+      MakeField<&WeekendOptions::qualifyScoring, std::string>("QualifyScoring", FieldPresence::Optional),
+      MakeField<&WeekendOptions::courseCautions, std::string>("CourseCautions", FieldPresence::Optional),
+      MakeField<&WeekendOptions::standingStart, std::int32_t>("StandingStart", FieldPresence::Optional),
+      MakeField<&WeekendOptions::shortParadeLap, std::int32_t>("ShortParadeLap", FieldPresence::Optional),
+      MakeField<&WeekendOptions::restarts, std::string>("Restarts", FieldPresence::Optional),
+      MakeField<&WeekendOptions::weatherType, std::string>("WeatherType", FieldPresence::Optional),
+      MakeField<&WeekendOptions::skies, std::string>("Skies", FieldPresence::Optional),
+      MakeField<&WeekendOptions::windDirection, std::string>("WindDirection", FieldPresence::Optional),
+      MakeField<&WeekendOptions::windSpeed, std::string>("WindSpeed", FieldPresence::Optional),
+      MakeField<&WeekendOptions::weatherTemp, std::string>("WeatherTemp", FieldPresence::Optional),
+      MakeField<&WeekendOptions::relativeHumidity, std::string>("RelativeHumidity", FieldPresence::Optional),
+      MakeField<&WeekendOptions::fogLevel, std::string>("FogLevel", FieldPresence::Optional),
+      MakeField<&WeekendOptions::timeOfDay, std::string>("TimeOfDay", FieldPresence::Optional),
+      MakeField<&WeekendOptions::date, std::string>("Date", FieldPresence::Optional),
+      MakeField<&WeekendOptions::earthRotationSpeedupFactor, std::int32_t>("EarthRotationSpeedupFactor", FieldPresence::Optional),
+      MakeField<&WeekendOptions::unofficial, std::int32_t>("Unofficial", FieldPresence::Optional),
+      MakeField<&WeekendOptions::commercialMode, std::string>("CommercialMode", FieldPresence::Optional),
+      MakeField<&WeekendOptions::nightMode, std::string>("NightMode", FieldPresence::Optional),
+      MakeField<&WeekendOptions::isFixedSetup, std::int32_t>("IsFixedSetup", FieldPresence::Optional),
+      MakeField<&WeekendOptions::strictLapsChecking, std::string>("StrictLapsChecking", FieldPresence::Optional),
+      MakeField<&WeekendOptions::hasOpenRegistration, std::int32_t>("HasOpenRegistration", FieldPresence::Optional),
+      MakeField<&WeekendOptions::hardcoreLevel, std::int32_t>("HardcoreLevel", FieldPresence::Optional),
+      MakeField<&WeekendOptions::numJokerLaps, std::int32_t>("NumJokerLaps", FieldPresence::Optional),
+      MakeField<&WeekendOptions::incidentLimit, std::int32_t>("IncidentLimit", FieldPresence::Optional),
+      MakeField<&WeekendOptions::fastRepairsLimit, std::int32_t>("FastRepairsLimit", FieldPresence::Optional),
+      MakeField<&WeekendOptions::greenWhiteCheckeredLimit, std::int32_t>("GreenWhiteCheckeredLimit", FieldPresence::Optional),
+    };
+  };
+
+  template<> struct ModelFields<TelemetryOptions> {
+    static constexpr std::array Fields{
+      MakeField<&TelemetryOptions::telemetryDiskFile, std::string>("TelemetryDiskFile", FieldPresence::Optional),
+    };
+  };
+
+  template<> struct ModelFields<WeekendInfo> {
+    static constexpr std::array Fields{
+      MakeField<&WeekendInfo::trackName, std::string>("TrackName", FieldPresence::Optional),
+      MakeField<&WeekendInfo::trackID, std::int32_t>("TrackID", FieldPresence::Optional),
+      MakeField<&WeekendInfo::trackLength, std::string>("TrackLength", FieldPresence::Optional),
+      MakeField<&WeekendInfo::trackLengthOfficial, std::string>("TrackLengthOfficial", FieldPresence::Optional),
+      MakeField<&WeekendInfo::trackDisplayName, std::string>("TrackDisplayName", FieldPresence::Optional),
+      MakeField<&WeekendInfo::trackDisplayShortName, std::string>("TrackDisplayShortName", FieldPresence::Optional),
+      MakeField<&WeekendInfo::trackConfigName, std::string>("TrackConfigName", FieldPresence::Optional),
+      MakeField<&WeekendInfo::trackCity, std::string>("TrackCity", FieldPresence::Optional),
+      MakeField<&WeekendInfo::trackCountry, std::string>("TrackCountry", FieldPresence::Optional),
+      MakeField<&WeekendInfo::trackAltitude, std::string>("TrackAltitude", FieldPresence::Optional),
+      MakeField<&WeekendInfo::trackLatitude, std::string>("TrackLatitude", FieldPresence::Optional),
+      MakeField<&WeekendInfo::trackLongitude, std::string>("TrackLongitude", FieldPresence::Optional),
+      MakeField<&WeekendInfo::trackNorthOffset, std::string>("TrackNorthOffset", FieldPresence::Optional),
+      MakeField<&WeekendInfo::trackNumTurns, std::int32_t>("TrackNumTurns", FieldPresence::Optional),
+      MakeField<&WeekendInfo::trackPitSpeedLimit, std::string>("TrackPitSpeedLimit", FieldPresence::Optional),
+      MakeField<&WeekendInfo::trackType, std::string>("TrackType", FieldPresence::Optional),
+      MakeField<&WeekendInfo::trackDirection, std::string>("TrackDirection", FieldPresence::Optional),
+      MakeField<&WeekendInfo::trackWeatherType, std::string>("TrackWeatherType", FieldPresence::Optional),
+      MakeField<&WeekendInfo::trackSkies, std::string>("TrackSkies", FieldPresence::Optional),
+      MakeField<&WeekendInfo::trackSurfaceTemp, std::string>("TrackSurfaceTemp", FieldPresence::Optional),
+      MakeField<&WeekendInfo::trackAirTemp, std::string>("TrackAirTemp", FieldPresence::Optional),
+      MakeField<&WeekendInfo::trackAirPressure, std::string>("TrackAirPressure", FieldPresence::Optional),
+      MakeField<&WeekendInfo::trackWindVel, std::string>("TrackWindVel", FieldPresence::Optional),
+      MakeField<&WeekendInfo::trackWindDir, std::string>("TrackWindDir", FieldPresence::Optional),
+      MakeField<&WeekendInfo::trackRelativeHumidity, std::string>("TrackRelativeHumidity", FieldPresence::Optional),
+      MakeField<&WeekendInfo::trackFogLevel, std::string>("TrackFogLevel", FieldPresence::Optional),
+      MakeField<&WeekendInfo::trackPrecipitation, std::string>("TrackPrecipitation", FieldPresence::Optional),
+      MakeField<&WeekendInfo::trackCleanup, std::int32_t>("TrackCleanup", FieldPresence::Optional),
+      MakeField<&WeekendInfo::trackDynamicTrack, std::int32_t>("TrackDynamicTrack", FieldPresence::Optional),
+      MakeField<&WeekendInfo::trackVersion, std::string>("TrackVersion", FieldPresence::Optional),
+      MakeField<&WeekendInfo::seriesID, std::int32_t>("SeriesID", FieldPresence::Optional),
+      MakeField<&WeekendInfo::seasonID, std::int32_t>("SeasonID", FieldPresence::Optional),
+      MakeField<&WeekendInfo::sessionID, std::int32_t>("SessionID", FieldPresence::Optional),
+      MakeField<&WeekendInfo::subSessionID, std::int32_t>("SubSessionID", FieldPresence::Optional),
+      MakeField<&WeekendInfo::leagueID, std::int32_t>("LeagueID", FieldPresence::Optional),
+      MakeField<&WeekendInfo::official, std::int32_t>("Official", FieldPresence::Optional),
+      MakeField<&WeekendInfo::raceWeek, std::int32_t>("RaceWeek", FieldPresence::Optional),
+      MakeField<&WeekendInfo::eventType, std::string>("EventType", FieldPresence::Optional),
+      MakeField<&WeekendInfo::category, std::string>("Category", FieldPresence::Optional),
+      MakeField<&WeekendInfo::simMode, std::string>("SimMode", FieldPresence::Optional),
+      MakeField<&WeekendInfo::teamRacing, std::int32_t>("TeamRacing", FieldPresence::Optional),
+      MakeField<&WeekendInfo::minDrivers, std::int32_t>("MinDrivers", FieldPresence::Optional),
+      MakeField<&WeekendInfo::maxDrivers, std::int32_t>("MaxDrivers", FieldPresence::Optional),
+      MakeField<&WeekendInfo::dCRuleSet, std::string>("DCRuleSet", FieldPresence::Optional),
+      MakeField<&WeekendInfo::qualifierMustStartRace, std::int32_t>("QualifierMustStartRace", FieldPresence::Optional),
+      MakeField<&WeekendInfo::numCarClasses, std::int32_t>("NumCarClasses", FieldPresence::Optional),
+      MakeField<&WeekendInfo::numCarTypes, std::int32_t>("NumCarTypes", FieldPresence::Optional),
+      MakeField<&WeekendInfo::heatRacing, std::int32_t>("HeatRacing", FieldPresence::Optional),
+      MakeField<&WeekendInfo::buildType, std::string>("BuildType", FieldPresence::Optional),
+      MakeField<&WeekendInfo::buildTarget, std::string>("BuildTarget", FieldPresence::Optional),
+      MakeField<&WeekendInfo::buildVersion, std::string>("BuildVersion", FieldPresence::Optional),
+      MakeField<&WeekendInfo::weekendOptions, WeekendOptions>("WeekendOptions", FieldPresence::Required),
+      MakeField<&WeekendInfo::telemetryOptions, TelemetryOptions>("TelemetryOptions", FieldPresence::Required),
+    };
+  };
+
+  template<> struct ModelFields<Session> {
+    static constexpr std::array Fields{
+      MakeField<&Session::sessionNum, std::int32_t>("SessionNum", FieldPresence::Optional),
+      MakeField<&Session::sessionLaps, std::string>("SessionLaps", FieldPresence::Optional),
+      MakeField<&Session::sessionTime, std::string>("SessionTime", FieldPresence::Optional),
+      MakeField<&Session::sessionNumLapsToAvg, std::int32_t>("SessionNumLapsToAvg", FieldPresence::Optional),
+      MakeField<&Session::sessionType, std::string>("SessionType", FieldPresence::Optional),
+      MakeField<&Session::sessionTrackRubberState, std::string>("SessionTrackRubberState", FieldPresence::Optional),
+      MakeField<&Session::sessionName, std::string>("SessionName", FieldPresence::Optional),
+      MakeField<&Session::sessionSkipped, std::int32_t>("SessionSkipped", FieldPresence::Optional),
+      MakeField<&Session::sessionRunGroupsUsed, std::int32_t>("SessionRunGroupsUsed", FieldPresence::Optional),
+      MakeField<&Session::sessionEnforceTireCompoundChange, std::int32_t>("SessionEnforceTireCompoundChange", FieldPresence::Optional),
+    };
+  };
+
+  template<> struct ModelFields<SessionInfo> {
+    static constexpr std::array Fields{
+      MakeField<&SessionInfo::sessions, std::vector<Session>>("Sessions", FieldPresence::Required),
+    };
+  };
+
+  template<> struct ModelFields<SessionResult> {
+    static constexpr std::array Fields{
+      MakeField<&SessionResult::position, std::int32_t>("Position", FieldPresence::Optional),
+      MakeField<&SessionResult::classPosition, std::int32_t>("ClassPosition", FieldPresence::Optional),
+      MakeField<&SessionResult::carIdx, std::int32_t>("CarIdx", FieldPresence::Optional),
+      MakeField<&SessionResult::fastestLap, std::int32_t>("FastestLap", FieldPresence::Optional),
+      MakeField<&SessionResult::fastestTime, float>("FastestTime", FieldPresence::Required),
+    };
+  };
+
+  template<> struct ModelFields<QualifyResultsInfo> {
+    static constexpr std::array Fields{
+      MakeField<&QualifyResultsInfo::results, std::vector<SessionResult>>("Results", FieldPresence::Required),
+    };
+  };
+
+  template<> struct ModelFields<Camera> {
+    static constexpr std::array Fields{
+      MakeField<&Camera::cameraNum, std::int32_t>("CameraNum", FieldPresence::Optional),
+      MakeField<&Camera::cameraName, std::string>("CameraName", FieldPresence::Optional),
+    };
+  };
+
+  template<> struct ModelFields<Group> {
+    static constexpr std::array Fields{
+      MakeField<&Group::groupNum, std::int32_t>("GroupNum", FieldPresence::Optional),
+      MakeField<&Group::groupName, std::string>("GroupName", FieldPresence::Optional),
+      MakeField<&Group::cameras, std::vector<Camera>>("Cameras", FieldPresence::Required),
+    };
+  };
+
+  template<> struct ModelFields<CameraInfo> {
+    static constexpr std::array Fields{
+      MakeField<&CameraInfo::groups, std::vector<Group>>("Groups", FieldPresence::Required),
+    };
+  };
+
+  template<> struct ModelFields<Frequency> {
+    static constexpr std::array Fields{
+      MakeField<&Frequency::frequencyNum, std::int32_t>("FrequencyNum", FieldPresence::Optional),
+      MakeField<&Frequency::frequencyName, std::string>("FrequencyName", FieldPresence::Optional),
+      MakeField<&Frequency::priority, std::int32_t>("Priority", FieldPresence::Optional),
+      MakeField<&Frequency::carIdx, std::int32_t>("CarIdx", FieldPresence::Optional),
+      MakeField<&Frequency::entryIdx, std::int32_t>("EntryIdx", FieldPresence::Optional),
+      MakeField<&Frequency::clubID, std::int32_t>("ClubID", FieldPresence::Optional),
+      MakeField<&Frequency::canScan, std::int32_t>("CanScan", FieldPresence::Optional),
+      MakeField<&Frequency::canSquawk, std::int32_t>("CanSquawk", FieldPresence::Optional),
+      MakeField<&Frequency::muted, std::int32_t>("Muted", FieldPresence::Optional),
+      MakeField<&Frequency::isMutable, std::int32_t>("IsMutable", FieldPresence::Optional),
+      MakeField<&Frequency::isDeletable, std::int32_t>("IsDeletable", FieldPresence::Optional),
+    };
+  };
+
+  template<> struct ModelFields<Radio> {
+    static constexpr std::array Fields{
+      MakeField<&Radio::radioNum, std::int32_t>("RadioNum", FieldPresence::Optional),
+      MakeField<&Radio::hopCount, std::int32_t>("HopCount", FieldPresence::Optional),
+      MakeField<&Radio::numFrequencies, std::int32_t>("NumFrequencies", FieldPresence::Optional),
+      MakeField<&Radio::tunedToFrequencyNum, std::int32_t>("TunedToFrequencyNum", FieldPresence::Optional),
+      MakeField<&Radio::scanningIsOn, std::int32_t>("ScanningIsOn", FieldPresence::Optional),
+      MakeField<&Radio::frequencies, std::vector<Frequency>>("Frequencies", FieldPresence::Required),
+    };
+  };
+
+  template<> struct ModelFields<RadioInfo> {
+    static constexpr std::array Fields{
+      MakeField<&RadioInfo::selectedRadioNum, std::int32_t>("SelectedRadioNum", FieldPresence::Optional),
+      MakeField<&RadioInfo::radios, std::vector<Radio>>("Radios", FieldPresence::Required),
+    };
+  };
+
+  template<> struct ModelFields<Driver> {
+    static constexpr std::array Fields{
+      MakeField<&Driver::carIdx, std::int32_t>("CarIdx", FieldPresence::Optional),
+      MakeField<&Driver::userName, std::string>("UserName", FieldPresence::Optional),
+      MakeField<&Driver::abbrevName, std::string>("AbbrevName", FieldPresence::Optional),
+      MakeField<&Driver::initials, std::string>("Initials", FieldPresence::Optional),
+      MakeField<&Driver::userID, std::int32_t>("UserID", FieldPresence::Optional),
+      MakeField<&Driver::teamID, std::int32_t>("TeamID", FieldPresence::Optional),
+      MakeField<&Driver::teamName, std::string>("TeamName", FieldPresence::Optional),
+      MakeField<&Driver::carNumber, std::string>("CarNumber", FieldPresence::Optional),
+      MakeField<&Driver::carNumberRaw, std::int32_t>("CarNumberRaw", FieldPresence::Optional),
+      MakeField<&Driver::carPath, std::string>("CarPath", FieldPresence::Optional),
+      MakeField<&Driver::carClassID, std::int32_t>("CarClassID", FieldPresence::Optional),
+      MakeField<&Driver::carID, std::int32_t>("CarID", FieldPresence::Optional),
+      MakeField<&Driver::carIsPaceCar, std::int32_t>("CarIsPaceCar", FieldPresence::Optional),
+      MakeField<&Driver::carIsAI, std::int32_t>("CarIsAI", FieldPresence::Optional),
+      MakeField<&Driver::carIsElectric, std::int32_t>("CarIsElectric", FieldPresence::Optional),
+      MakeField<&Driver::carScreenName, std::string>("CarScreenName", FieldPresence::Optional),
+      MakeField<&Driver::carScreenNameShort, std::string>("CarScreenNameShort", FieldPresence::Optional),
+      MakeField<&Driver::carClassShortName, std::string>("CarClassShortName", FieldPresence::Optional),
+      MakeField<&Driver::carClassRelSpeed, std::int32_t>("CarClassRelSpeed", FieldPresence::Optional),
+      MakeField<&Driver::carClassLicenseLevel, std::int32_t>("CarClassLicenseLevel", FieldPresence::Optional),
+      MakeField<&Driver::carClassMaxFuelPct, std::string>("CarClassMaxFuelPct", FieldPresence::Optional),
+      MakeField<&Driver::carClassWeightPenalty, std::string>("CarClassWeightPenalty", FieldPresence::Optional),
+      MakeField<&Driver::carClassPowerAdjust, std::string>("CarClassPowerAdjust", FieldPresence::Optional),
+      MakeField<&Driver::carClassDryTireSetLimit, std::string>("CarClassDryTireSetLimit", FieldPresence::Optional),
+      MakeField<&Driver::carClassColor, std::string>("CarClassColor", FieldPresence::Optional),
+      MakeField<&Driver::carClassEstLapTime, float>("CarClassEstLapTime", FieldPresence::Required),
+      MakeField<&Driver::iRating, std::int32_t>("IRating", FieldPresence::Optional),
+      MakeField<&Driver::licLevel, std::int32_t>("LicLevel", FieldPresence::Optional),
+      MakeField<&Driver::licSubLevel, std::int32_t>("LicSubLevel", FieldPresence::Optional),
+      MakeField<&Driver::licString, std::string>("LicString", FieldPresence::Optional),
+      MakeField<&Driver::licColor, std::string>("LicColor", FieldPresence::Optional),
+      MakeField<&Driver::isSpectator, std::int32_t>("IsSpectator", FieldPresence::Optional),
+      MakeField<&Driver::carDesignStr, std::string>("CarDesignStr", FieldPresence::Optional),
+      MakeField<&Driver::helmetDesignStr, std::string>("HelmetDesignStr", FieldPresence::Optional),
+      MakeField<&Driver::suitDesignStr, std::string>("SuitDesignStr", FieldPresence::Optional),
+      MakeField<&Driver::bodyType, std::int32_t>("BodyType", FieldPresence::Optional),
+      MakeField<&Driver::faceType, std::int32_t>("FaceType", FieldPresence::Optional),
+      MakeField<&Driver::helmetType, std::int32_t>("HelmetType", FieldPresence::Optional),
+      MakeField<&Driver::carNumberDesignStr, std::string>("CarNumberDesignStr", FieldPresence::Optional),
+      MakeField<&Driver::carSponsor1, std::string>("CarSponsor_1", FieldPresence::Optional),
+      MakeField<&Driver::carSponsor2, std::string>("CarSponsor_2", FieldPresence::Optional),
+      MakeField<&Driver::clubName, std::string>("ClubName", FieldPresence::Optional),
+      MakeField<&Driver::clubID, std::int32_t>("ClubID", FieldPresence::Optional),
+      MakeField<&Driver::divisionName, std::string>("DivisionName", FieldPresence::Optional),
+      MakeField<&Driver::divisionID, std::int32_t>("DivisionID", FieldPresence::Optional),
+      MakeField<&Driver::curDriverIncidentCount, std::int32_t>("CurDriverIncidentCount", FieldPresence::Optional),
+      MakeField<&Driver::teamIncidentCount, std::int32_t>("TeamIncidentCount", FieldPresence::Optional),
+    };
+  };
+
+  template<> struct ModelFields<DriverInfo> {
+    static constexpr std::array Fields{
+      MakeField<&DriverInfo::driverCarIdx, std::int32_t>("DriverCarIdx", FieldPresence::Optional),
+      MakeField<&DriverInfo::driverUserID, std::int32_t>("DriverUserID", FieldPresence::Optional),
+      MakeField<&DriverInfo::paceCarIdx, std::int32_t>("PaceCarIdx", FieldPresence::Optional),
+      MakeField<&DriverInfo::driverHeadPosX, float>("DriverHeadPosX", FieldPresence::Required),
+      MakeField<&DriverInfo::driverHeadPosY, float>("DriverHeadPosY", FieldPresence::Required),
+      MakeField<&DriverInfo::driverHeadPosZ, float>("DriverHeadPosZ", FieldPresence::Required),
+      MakeField<&DriverInfo::driverCarIsElectric, std::int32_t>("DriverCarIsElectric", FieldPresence::Optional),
+      MakeField<&DriverInfo::driverCarIdleRPM, float>("DriverCarIdleRPM", FieldPresence::Required),
+      MakeField<&DriverInfo::driverCarRedLine, float>("DriverCarRedLine", FieldPresence::Required),
+      MakeField<&DriverInfo::driverCarEngCylinderCount, std::int32_t>("DriverCarEngCylinderCount", FieldPresence::Optional),
+      MakeField<&DriverInfo::driverCarFuelKgPerLtr, float>("DriverCarFuelKgPerLtr", FieldPresence::Required),
+      MakeField<&DriverInfo::driverCarFuelMaxLtr, float>("DriverCarFuelMaxLtr", FieldPresence::Required),
+      MakeField<&DriverInfo::driverCarMaxFuelPct, float>("DriverCarMaxFuelPct", FieldPresence::Required),
+      MakeField<&DriverInfo::driverCarGearNumForward, std::int32_t>("DriverCarGearNumForward", FieldPresence::Optional),
+      MakeField<&DriverInfo::driverCarGearNeutral, std::int32_t>("DriverCarGearNeutral", FieldPresence::Optional),
+      MakeField<&DriverInfo::driverCarGearReverse, std::int32_t>("DriverCarGearReverse", FieldPresence::Optional),
+      MakeField<&DriverInfo::driverCarSLFirstRPM, float>("DriverCarSLFirstRPM", FieldPresence::Required),
+      MakeField<&DriverInfo::driverCarSLShiftRPM, float>("DriverCarSLShiftRPM", FieldPresence::Required),
+      MakeField<&DriverInfo::driverCarSLLastRPM, float>("DriverCarSLLastRPM", FieldPresence::Required),
+      MakeField<&DriverInfo::driverCarSLBlinkRPM, float>("DriverCarSLBlinkRPM", FieldPresence::Required),
+      MakeField<&DriverInfo::driverCarVersion, std::string>("DriverCarVersion", FieldPresence::Optional),
+      MakeField<&DriverInfo::driverCarEstLapTime, float>("DriverCarEstLapTime", FieldPresence::Required),
+      MakeField<&DriverInfo::driverSetupName, std::string>("DriverSetupName", FieldPresence::Optional),
+      MakeField<&DriverInfo::driverSetupIsModified, std::int32_t>("DriverSetupIsModified", FieldPresence::Optional),
+      MakeField<&DriverInfo::driverSetupLoadTypeName, std::string>("DriverSetupLoadTypeName", FieldPresence::Optional),
+      MakeField<&DriverInfo::driverSetupPassedTech, std::int32_t>("DriverSetupPassedTech", FieldPresence::Optional),
+      MakeField<&DriverInfo::driverIncidentCount, std::int32_t>("DriverIncidentCount", FieldPresence::Optional),
+      MakeField<&DriverInfo::drivers, std::vector<Driver>>("Drivers", FieldPresence::Required),
+    };
+  };
+
+  template<> struct ModelFields<Sector> {
+    static constexpr std::array Fields{
+      MakeField<&Sector::sectorNum, std::int32_t>("SectorNum", FieldPresence::Optional),
+      MakeField<&Sector::sectorStartPct, float>("SectorStartPct", FieldPresence::Required),
+    };
+  };
+
+  template<> struct ModelFields<SplitTimeInfo> {
+    static constexpr std::array Fields{
+      MakeField<&SplitTimeInfo::sectors, std::vector<Sector>>("Sectors", FieldPresence::Required),
+    };
+  };
+
+  template<> struct ModelFields<SessionInfoMessage> {
+    static constexpr std::array Fields{
+      MakeField<&SessionInfoMessage::weekendInfo, WeekendInfo>("WeekendInfo", FieldPresence::Optional),
+      MakeField<&SessionInfoMessage::sessionInfo, SessionInfo>("SessionInfo", FieldPresence::Optional),
+      MakeField<&SessionInfoMessage::qualifyResultsInfo, QualifyResultsInfo>("QualifyResultsInfo", FieldPresence::Optional),
+      MakeField<&SessionInfoMessage::cameraInfo, CameraInfo>("CameraInfo", FieldPresence::Optional),
+      MakeField<&SessionInfoMessage::radioInfo, RadioInfo>("RadioInfo", FieldPresence::Optional),
+      MakeField<&SessionInfoMessage::driverInfo, DriverInfo>("DriverInfo", FieldPresence::Optional),
+      MakeField<&SessionInfoMessage::splitTimeInfo, SplitTimeInfo>("SplitTimeInfo", FieldPresence::Optional),
+    };
+  };
+
+  template<> struct ModelFields<ResultsPosition> {
+    static constexpr std::array Fields{
+      MakeField<&ResultsPosition::position, std::int32_t>("Position", FieldPresence::Optional),
+      MakeField<&ResultsPosition::classPosition, std::int32_t>("ClassPosition", FieldPresence::Optional),
+      MakeField<&ResultsPosition::carIdx, std::int32_t>("CarIdx", FieldPresence::Optional),
+      MakeField<&ResultsPosition::lap, std::int32_t>("Lap", FieldPresence::Optional),
+      MakeField<&ResultsPosition::time, float>("Time", FieldPresence::Required),
+      MakeField<&ResultsPosition::fastestLap, std::int32_t>("FastestLap", FieldPresence::Optional),
+      MakeField<&ResultsPosition::fastestTime, float>("FastestTime", FieldPresence::Required),
+      MakeField<&ResultsPosition::lastTime, float>("LastTime", FieldPresence::Required),
+      MakeField<&ResultsPosition::lapsLed, std::int32_t>("LapsLed", FieldPresence::Optional),
+      MakeField<&ResultsPosition::lapsComplete, std::int32_t>("LapsComplete", FieldPresence::Optional),
+      MakeField<&ResultsPosition::jokerLapsComplete, std::int32_t>("JokerLapsComplete", FieldPresence::Optional),
+      MakeField<&ResultsPosition::lapsDriven, float>("LapsDriven", FieldPresence::Required),
+      MakeField<&ResultsPosition::incidents, std::int32_t>("Incidents", FieldPresence::Optional),
+      MakeField<&ResultsPosition::reasonOutId, std::int32_t>("ReasonOutId", FieldPresence::Optional),
+      MakeField<&ResultsPosition::reasonOutStr, std::string>("ReasonOutStr", FieldPresence::Optional),
+    };
+  };
+
+  template<> struct ModelFields<ResultsFastestLap> {
+    static constexpr std::array Fields{
+      MakeField<&ResultsFastestLap::carIdx, std::int32_t>("CarIdx", FieldPresence::Optional),
+      MakeField<&ResultsFastestLap::fastestLap, std::int32_t>("FastestLap", FieldPresence::Optional),
+      MakeField<&ResultsFastestLap::fastestTime, float>("FastestTime", FieldPresence::Required),
+    };
+  };
+
+  template<> struct ModelFields<Tire> {
+    static constexpr std::array Fields{
+      MakeField<&Tire::startingPressure, float>("StartingPressure", FieldPresence::Required),
+      MakeField<&Tire::lastHotPressure, float>("LastHotPressure", FieldPresence::Required),
+      MakeField<&Tire::lastTempsOMI, float>("LastTempsOMI", FieldPresence::Required),
+      MakeField<&Tire::treadRemaining, float>("TreadRemaining", FieldPresence::Required),
+    };
+  };
+
+  template<> struct ModelFields<AeroSettings> {
+    static constexpr std::array Fields{
+      MakeField<&AeroSettings::rearWingSetting, std::string>("RearWingSetting", FieldPresence::Optional),
+      MakeField<&AeroSettings::ofDivePlanes, std::int32_t>("OfDivePlanes", FieldPresence::Optional),
+      MakeField<&AeroSettings::wingGurneySetting, bool>("WingGurneySetting", FieldPresence::Required),
+    };
+  };
+
+  template<> struct ModelFields<TiresAero> {
+    static constexpr std::array Fields{
+      MakeField<&TiresAero::leftFrontTire, Tire>("LeftFrontTire", FieldPresence::Required),
+      MakeField<&TiresAero::leftRearTire, Tire>("LeftRearTire", FieldPresence::Required),
+      MakeField<&TiresAero::rightFrontTire, Tire>("RightFrontTire", FieldPresence::Required),
+      MakeField<&TiresAero::rightRearTire, Tire>("RightRearTire", FieldPresence::Required),
+      MakeField<&TiresAero::aeroSettings, AeroSettings>("AeroSettings", FieldPresence::Required),
+    };
+  };
+
+  template<> struct ModelFields<Front> {
+    static constexpr std::array Fields{
+      MakeField<&Front::arbSize, std::string>("ArbSize", FieldPresence::Optional),
+      MakeField<&Front::toeIn, std::string>("ToeIn", FieldPresence::Optional),
+      MakeField<&Front::steeringRatio, float>("SteeringRatio", FieldPresence::Required),
+      MakeField<&Front::displayPage, std::string>("DisplayPage", FieldPresence::Optional),
+    };
+  };
+
+  template<> struct ModelFields<ChassisCorner> {
+    static constexpr std::array Fields{
+      MakeField<&ChassisCorner::cornerWeight, std::string>("CornerWeight", FieldPresence::Optional),
+      MakeField<&ChassisCorner::rideHeight, std::string>("RideHeight", FieldPresence::Optional),
+      MakeField<&ChassisCorner::shockDefl, std::string>("ShockDefl", FieldPresence::Optional),
+      MakeField<&ChassisCorner::springPerchOffset, std::string>("SpringPerchOffset", FieldPresence::Optional),
+      MakeField<&ChassisCorner::springRate, std::string>("SpringRate", FieldPresence::Optional),
+      MakeField<&ChassisCorner::lsCompDamping, std::string>("LsCompDamping", FieldPresence::Optional),
+      MakeField<&ChassisCorner::hsCompDamping, std::string>("HsCompDamping", FieldPresence::Optional),
+      MakeField<&ChassisCorner::hsRbdDamping, std::string>("HsRbdDamping", FieldPresence::Optional),
+      MakeField<&ChassisCorner::camber, std::string>("Camber", FieldPresence::Optional),
+      MakeField<&ChassisCorner::toeIn, std::string>("ToeIn", FieldPresence::Optional),
+    };
+  };
+
+  template<> struct ModelFields<Rear> {
+    static constexpr std::array Fields{
+      MakeField<&Rear::arbSize, std::string>("ArbSize", FieldPresence::Optional),
+      MakeField<&Rear::crossWeight, std::string>("CrossWeight", FieldPresence::Optional),
+    };
+  };
+
+  template<> struct ModelFields<Chassis> {
+    static constexpr std::array Fields{
+      MakeField<&Chassis::front, Front>("Front", FieldPresence::Required),
+      MakeField<&Chassis::leftFront, ChassisCorner>("LeftFront", FieldPresence::Required),
+      MakeField<&Chassis::leftRear, ChassisCorner>("LeftRear", FieldPresence::Required),
+      MakeField<&Chassis::rightFront, ChassisCorner>("RightFront", FieldPresence::Required),
+      MakeField<&Chassis::rightRear, ChassisCorner>("RightRear", FieldPresence::Required),
+      MakeField<&Chassis::rear, Rear>("Rear", FieldPresence::Required),
+    };
+  };
+
+  template<> struct ModelFields<BrakeSpec> {
+    static constexpr std::array Fields{
+      MakeField<&BrakeSpec::padCompound, std::string>("PadCompound", FieldPresence::Optional),
+      MakeField<&BrakeSpec::brakePressureBias, std::string>("BrakePressureBias", FieldPresence::Optional),
+    };
+  };
+
+  template<> struct ModelFields<Fuel> {
+    static constexpr std::array Fields{
+      MakeField<&Fuel::fuelLevel, std::string>("FuelLevel", FieldPresence::Optional),
+    };
+  };
+
+  template<> struct ModelFields<Engine> {
+    static constexpr std::array Fields{
+      MakeField<&Engine::boostLevelCal, std::int32_t>("BoostLevel_Cal", FieldPresence::Optional),
+      MakeField<&Engine::throttleShapeTps, std::int32_t>("ThrottleShape_Tps", FieldPresence::Optional),
+    };
+  };
+
+  template<> struct ModelFields<GearRatio> {
+    static constexpr std::array Fields{
+      MakeField<&GearRatio::gearStack, std::string>("GearStack", FieldPresence::Optional),
+      MakeField<&GearRatio::speedInFirst, std::string>("SpeedInFirst", FieldPresence::Optional),
+      MakeField<&GearRatio::speedInSecond, std::string>("SpeedInSecond", FieldPresence::Optional),
+      MakeField<&GearRatio::speedInThird, std::string>("SpeedInThird", FieldPresence::Optional),
+      MakeField<&GearRatio::speedInFourth, std::string>("SpeedInFourth", FieldPresence::Optional),
+      MakeField<&GearRatio::speedInFifth, std::string>("SpeedInFifth", FieldPresence::Optional),
+      MakeField<&GearRatio::speedInSixth, std::string>("SpeedInSixth", FieldPresence::Optional),
+    };
+  };
+
+  template<> struct ModelFields<BrakesDriveUnit> {
+    static constexpr std::array Fields{
+      MakeField<&BrakesDriveUnit::brakeSpec, BrakeSpec>("BrakeSpec", FieldPresence::Required),
+      MakeField<&BrakesDriveUnit::fuel, Fuel>("Fuel", FieldPresence::Required),
+      MakeField<&BrakesDriveUnit::engine, Engine>("Engine", FieldPresence::Required),
+      MakeField<&BrakesDriveUnit::gearRatios, GearRatio>("GearRatios", FieldPresence::Required),
+    };
+  };
+
+  template<> struct ModelFields<CarSetup> {
+    static constexpr std::array Fields{
+      MakeField<&CarSetup::updateCount, std::int32_t>("UpdateCount", FieldPresence::Optional),
+      MakeField<&CarSetup::tiresAero, TiresAero>("TiresAero", FieldPresence::Required),
+      MakeField<&CarSetup::chassis, Chassis>("Chassis", FieldPresence::Required),
+      MakeField<&CarSetup::brakesDriveUnit, BrakesDriveUnit>("BrakesDriveUnit", FieldPresence::Required),
+    };
+  };
+}
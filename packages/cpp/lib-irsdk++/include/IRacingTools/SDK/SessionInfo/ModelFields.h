@@ -0,0 +1,317 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace IRacingTools::SDK::SessionInfo {
+
+  enum class FieldKind : std::uint8_t {
+    String,
+    Int32,
+    Float,
+    Bool,
+    Object,
+    List
+  };
+
+  /**
+   * @brief Mirrors the decoders in `ModelParser.h`,
+   *   `as<T>(fallback)` is `Optional` & `as<T>()` is `Required`
+   *   (yaml-cpp throws when the key is missing or can not be converted)
+   */
+  enum class FieldPresence : std::uint8_t {
+    Optional,
+    Required
+  };
+
+  struct TypeDescriptor;
+
+  /**
+   * @brief Type erased description of a single model member,
+   *   used by `SessionInfoFastParser` to populate models in place
+   */
+  struct FieldDescriptor {
+    std::string_view key{};
+    FieldKind kind{FieldKind::String};
+    FieldPresence presence{FieldPresence::Optional};
+
+    /**
+     * @brief Convert a scalar & assign it to the member
+     *
+     * @return false if the scalar can not be converted (same rules as yaml-cpp)
+     */
+    bool (*assign)(void* model, std::string_view value){nullptr};
+
+    /**
+     * @brief Assign the decode default (a value initialized member)
+     */
+    void (*reset)(void* model){nullptr};
+
+    /**
+     * @brief `Object`: the nested model, `List`: the element at `index`,
+     *   appending a new element when `index == size()`
+     */
+    void* (*child)(void* model, std::size_t index){nullptr};
+
+    /**
+     * @brief `List`: erase all elements at or after `count`
+     */
+    void (*truncate)(void* model, std::size_t count){nullptr};
+
+    /**
+     * @brief Compare the member (recursively for `Object` & `List`)
+     */
+    bool (*equals)(const void* lhs, const void* rhs){nullptr};
+
+    const TypeDescriptor* childType{nullptr};
+  };
+
+  /**
+   * @brief All fields of a model & a perfect hash over their keys
+   */
+  struct TypeDescriptor {
+    std::span<const FieldDescriptor> fields{};
+
+    /**
+     * @brief perfect hash slot -> field index + 1 (0 == empty)
+     */
+    std::span<const std::uint8_t> slots{};
+
+    std::uint64_t seed{0};
+    std::uint32_t shift{63};
+
+    const FieldDescriptor* find(std::string_view key) const noexcept;
+  };
+
+  /**
+   * @brief Compare only the decoded fields of two models
+   */
+  inline bool ModelsEqual(const TypeDescriptor& type, const void* lhs, const void* rhs) {
+    for (auto& field : type.fields) {
+      if (!field.equals(lhs, rhs)) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  /**
+   * @brief FNV-1a, the key hash fed to the per model perfect hash
+   */
+  constexpr std::uint64_t FieldKeyHash(std::string_view key) noexcept {
+    std::uint64_t hash = 14695981039346656037ull;
+    for (auto c : key) {
+      hash ^= static_cast<std::uint8_t>(c);
+      hash *= 1099511628211ull;
+    }
+
+    return hash;
+  }
+
+  constexpr std::size_t FieldSlot(std::uint64_t keyHash, std::uint64_t seed, std::uint32_t shift) noexcept {
+    return static_cast<std::size_t>((keyHash * seed) >> shift);
+  }
+
+  inline const FieldDescriptor* TypeDescriptor::find(std::string_view key) const noexcept {
+    auto fieldIdx = slots[FieldSlot(FieldKeyHash(key), seed, shift)];
+    if (!fieldIdx) {
+      return nullptr;
+    }
+
+    auto& field = fields[fieldIdx - 1];
+    return field.key == key ? &field : nullptr;
+  }
+
+  template <std::size_t N>
+  struct PerfectHashTable {
+    static_assert(N < 255, "field index must fit in a uint8_t slot");
+
+    static constexpr std::size_t SlotCount = N < 2 ? 2 : std::bit_ceil(N * 4);
+
+    std::array<std::uint8_t, SlotCount> slots{};
+    std::uint64_t seed{0};
+    std::uint32_t shift{63};
+  };
+
+  /**
+   * @brief Search (at compile time) for a multiplicative seed that maps
+   *   every key to a unique slot
+   */
+  template <std::size_t N>
+  constexpr PerfectHashTable<N> MakePerfectHashTable(const std::array<FieldDescriptor, N>& fields) {
+    using Table = PerfectHashTable<N>;
+
+    Table table{};
+    table.shift = 64 - std::countr_zero(Table::SlotCount);
+
+    std::array<std::uint64_t, N> keyHashes{};
+    for (std::size_t idx = 0; idx < N; idx++) {
+      keyHashes[idx] = FieldKeyHash(fields[idx].key);
+    }
+
+    // SplitMix64 seed sequence
+    std::uint64_t state = 0x9E3779B97F4A7C15ull;
+    for (std::size_t attempt = 0; attempt < 100000; attempt++) {
+      state += 0x9E3779B97F4A7C15ull;
+      auto seed = state;
+      seed = (seed ^ (seed >> 30)) * 0xBF58476D1CE4E5B9ull;
+      seed = (seed ^ (seed >> 27)) * 0x94D049BB133111EBull;
+      seed = (seed ^ (seed >> 31)) | 1ull;
+
+      table.slots.fill(0);
+      bool perfect = true;
+      for (std::size_t idx = 0; idx < N && perfect; idx++) {
+        auto& slot = table.slots[FieldSlot(keyHashes[idx], seed, table.shift)];
+        if (slot) {
+          perfect = false;
+        } else {
+          slot = static_cast<std::uint8_t>(idx + 1);
+        }
+      }
+
+      if (perfect) {
+        table.seed = seed;
+        return table;
+      }
+    }
+
+    throw std::logic_error("unable to find a perfect hash seed");
+  }
+
+  template <typename P>
+  struct MemberPointerTraits;
+
+  template <typename M, typename T>
+  struct MemberPointerTraits<T M::*> {
+    using Model = M;
+    using Member = T;
+  };
+
+  template <typename T>
+  struct IsVector : std::false_type {};
+
+  template <typename T, typename A>
+  struct IsVector<std::vector<T, A>> : std::true_type {};
+
+  /**
+   * @brief Scalar conversions matching yaml-cpp's `convert<T>::decode`
+   */
+  bool ConvertScalar(std::string_view value, std::int32_t& out);
+  bool ConvertScalar(std::string_view value, float& out);
+  bool ConvertScalar(std::string_view value, bool& out);
+
+  template <typename T>
+  void ResetFieldValue(T& value) {
+    if constexpr (std::is_same_v<T, std::string> || IsVector<T>::value) {
+      value.clear();
+    } else {
+      value = T{};
+    }
+  }
+
+  /**
+   * @brief Generated specializations (`ModelFieldTables.h`) list every
+   *   decoded field of a model as `static constexpr std::array Fields`
+   */
+  template <typename T>
+  struct ModelFields;
+
+  template <typename T>
+  struct ModelDescriptor {
+    static constexpr auto& Fields = ModelFields<T>::Fields;
+
+    static_assert(Fields.size() <= 64, "field presence is tracked in a 64bit mask");
+
+    static constexpr auto HashTable = MakePerfectHashTable(Fields);
+
+    static constexpr TypeDescriptor Value{Fields, HashTable.slots, HashTable.seed, HashTable.shift};
+  };
+
+  /**
+   * @brief Describe `Member`, decoded as `V` (the `as<V>` type in `ModelParser.h`)
+   */
+  template <auto Member, typename V>
+  constexpr FieldDescriptor MakeField(std::string_view key, FieldPresence presence) {
+    using Model = typename MemberPointerTraits<decltype(Member)>::Model;
+
+    FieldDescriptor field{.key = key, .presence = presence};
+    field.reset = [](void* model) {
+      ResetFieldValue(static_cast<Model*>(model)->*Member);
+    };
+
+    if constexpr (IsVector<V>::value) {
+      field.equals = [](const void* lhs, const void* rhs) {
+        auto& lhsList = static_cast<const Model*>(lhs)->*Member;
+        auto& rhsList = static_cast<const Model*>(rhs)->*Member;
+        return std::ranges::equal(
+          lhsList,
+          rhsList,
+          [](auto& lhsElement, auto& rhsElement) {
+            return ModelsEqual(ModelDescriptor<typename V::value_type>::Value, &lhsElement, &rhsElement);
+          });
+      };
+    } else if constexpr (std::is_class_v<V> && !std::is_same_v<V, std::string>) {
+      field.equals = [](const void* lhs, const void* rhs) {
+        return ModelsEqual(ModelDescriptor<V>::Value, &(static_cast<const Model*>(lhs)->*Member), &(static_cast<const Model*>(rhs)->*Member));
+      };
+    } else {
+      field.equals = [](const void* lhs, const void* rhs) {
+        return static_cast<const Model*>(lhs)->*Member == static_cast<const Model*>(rhs)->*Member;
+      };
+    }
+
+    if constexpr (std::is_same_v<V, std::string>) {
+      field.kind = FieldKind::String;
+      field.assign = [](void* model, std::string_view value) {
+        (static_cast<Model*>(model)->*Member).assign(value);
+        return true;
+      };
+    } else if constexpr (std::is_same_v<V, std::int32_t> || std::is_same_v<V, float> || std::is_same_v<V, bool>) {
+      field.kind = std::is_same_v<V, std::int32_t> ? FieldKind::Int32 : std::is_same_v<V, float> ? FieldKind::Float : FieldKind::Bool;
+      field.assign = [](void* model, std::string_view value) {
+        V converted{};
+        if (!ConvertScalar(value, converted)) {
+          return false;
+        }
+
+        static_cast<Model*>(model)->*Member = converted;
+        return true;
+      };
+    } else if constexpr (IsVector<V>::value) {
+      using Element = typename V::value_type;
+      field.kind = FieldKind::List;
+      field.childType = &ModelDescriptor<Element>::Value;
+      field.child = [](void* model, std::size_t index) -> void* {
+        auto& list = static_cast<Model*>(model)->*Member;
+        if (index >= list.size()) {
+          list.emplace_back();
+        }
+
+        return &list[index];
+      };
+      field.truncate = [](void* model, std::size_t count) {
+        auto& list = static_cast<Model*>(model)->*Member;
+        if (list.size() > count) {
+          list.erase(list.begin() + static_cast<std::ptrdiff_t>(count), list.end());
+        }
+      };
+    } else {
+      field.kind = FieldKind::Object;
+      field.childType = &ModelDescriptor<V>::Value;
+      field.child = [](void* model, std::size_t) -> void* {
+        return &(static_cast<Model*>(model)->*Member);
+      };
+    }
+
+    return field;
+  }
+} // namespace IRacingTools::SDK::SessionInfo
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <string_view>
+
+#include "ModelFields.h"
+#include "SessionInfoMessage.h"
+
+namespace IRacingTools::SDK::SessionInfo {
+
+  /**
+   * @brief Single pass, allocation free (aside from the models' own strings & vectors)
+   *   decoder for the indentation based YAML subset iRacing emits as session info.
+   *
+   * Keys are dispatched via the perfect hashed `ModelFields<T>` tables generated
+   * from `ModelParser.h`, so decoded values (including defaults & required fields)
+   * match `YAML::Load(data).as<SessionInfoMessage>()`.
+   *
+   * `message` is updated in place, existing strings/vectors are reused.
+   *
+   * @return false when the input uses YAML outside of the supported subset
+   *   (flow collections, anchors, escapes, multi-line scalars, etc) or yaml-cpp
+   *   would reject it (missing/invalid required field), `message` is then left
+   *   partially updated & the caller should fall back to yaml-cpp
+   */
+  bool FastDecodeSessionInfoMessage(std::string_view data, SessionInfoMessage& message);
+
+  /**
+   * @brief Same as `FastDecodeSessionInfoMessage`, for any model with a `ModelFields<T>` table
+   */
+  bool FastDecodeModel(std::string_view data, const TypeDescriptor& type, void* model);
+
+  /**
+   * @brief Decode with `FastDecodeSessionInfoMessage`, falling back to yaml-cpp
+   *   (`ModelParser.h`) for unusual inputs.
+   *
+   * @throws YAML::Exception when the yaml-cpp fallback fails, same as
+   *   `YAML::Load(data).as<SessionInfoMessage>()`
+   */
+  void DecodeSessionInfoMessage(std::string_view data, SessionInfoMessage& message);
+} // namespace IRacingTools::SDK::SessionInfo
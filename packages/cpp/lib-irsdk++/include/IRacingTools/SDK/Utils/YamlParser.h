@@ -26,9 +26,14 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 namespace IRacingTools::SDK::Utils {
 // super simple YAML parser
 bool ParseYaml(const char *data, const std::string_view& path, const char **val, int *len);
+
+// same as above, but resolved via a (per thread) path index over `data`,
+// which is only rebuilt when `updateCount` (or `data`) changes
+bool ParseYaml(const char *data, std::int32_t updateCount, const std::string_view& path, const char **val, int *len);
 }
\ No newline at end of file
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace IRacingTools::SDK::Utils {
+
+/**
+ * @brief Structural index over a session info string, resolving the same
+ *   `"DriverInfo:Drivers:CarIdx:{%d}UserName:"` paths as `ParseYaml`
+ *   with a binary search per path segment instead of a full rescan.
+ *
+ * The index references (does not copy) the indexed data, which must
+ * outlive it & remain unchanged until the next `build`.
+ */
+class YamlPathIndex {
+public:
+    YamlPathIndex() = default;
+    explicit YamlPathIndex(std::string_view data);
+
+    /**
+     * @brief Index `data` (up to the first `\0`), replacing any previous index
+     */
+    void build(std::string_view data);
+
+    void clear();
+
+    /**
+     * @brief Same contract as `ParseYaml`, `*val` points into the indexed data
+     *   & is not null terminated
+     */
+    bool find(const std::string_view &path, const char **val, int *len) const;
+
+    std::optional<std::string_view> find(const std::string_view &path) const;
+
+    std::string_view data() const {
+        return data_;
+    }
+
+    std::size_t lineCount() const {
+        return lines_.size();
+    }
+
+private:
+    /**
+     * @brief A line as seen by `ParseYaml`, `depth` counts the leading
+     *   spaces & dashes, `key` includes the trailing `:`
+     */
+    struct Line {
+        std::uint32_t offset{0};
+        std::uint32_t keyOffset{0};
+        std::uint32_t keyLen{0};
+        std::uint32_t valueOffset{0};
+        std::uint32_t valueLen{0};
+        std::uint32_t depth{0};
+
+        /**
+         * @brief First following line with a lower depth, where a path search
+         *   that matched this line gives up
+         */
+        std::uint32_t blockEnd{0};
+    };
+
+    struct HashedLine {
+        std::uint64_t hash{0};
+        std::uint32_t line{0};
+
+        auto operator<=>(const HashedLine &) const = default;
+    };
+
+    std::optional<std::uint32_t> findLine(
+        const std::vector<HashedLine> &hashes,
+        std::uint64_t hash,
+        std::string_view key,
+        const std::optional<std::string_view> &value,
+        std::uint32_t begin,
+        std::uint32_t end
+    ) const;
+
+    bool hasPrefixKey(std::string_view path, std::uint32_t begin, std::uint32_t end) const;
+
+    std::string_view keyOf(const Line &line) const {
+        return data_.substr(line.keyOffset, line.keyLen);
+    }
+
+    std::string_view valueOf(const Line &line) const {
+        return data_.substr(line.valueOffset, line.valueLen);
+    }
+
+    std::string_view data_{};
+    std::vector<Line> lines_{};
+
+    /**
+     * @brief Sorted by `(hash, line)`, keyed on the key & on the key + value
+     *   (for `{value}` filters)
+     */
+    std::vector<HashedLine> keys_{};
+    std::vector<HashedLine> keyValues_{};
+
+    /**
+     * @brief Lines with a key lacking a `:` (i.e. `...`), which `ParseYaml`
+     *   matches as a prefix of the remaining path
+     */
+    std::vector<std::uint32_t> prefixKeyLines_{};
+};
+
+/**
+ * @brief Keeps a `YamlPathIndex` for the current session info,
+ *   rebuilt only when the session info update count (or buffer) changes
+ */
+class YamlPathCache {
+public:
+    const YamlPathIndex &update(const char *data, std::int32_t updateCount);
+
+    bool find(const char *data, std::int32_t updateCount, const std::string_view &path, const char **val, int *len);
+
+    void invalidate();
+
+private:
+    const char *data_{nullptr};
+    std::optional<std::int32_t> updateCount_{};
+    YamlPathIndex index_{};
+};
+
+} // namespace IRacingTools::SDK::Utils
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+#include <IRacingTools/SDK/Types.h>
+
+namespace IRacingTools::SDK {
+  /**
+   * @brief Instruction set used by the bulk array conversions,
+   *   `Auto` picks the widest one supported by the running CPU
+   */
+  enum class VarArrayKernel : int {
+    Auto = 0,
+    Scalar,
+    SSE41,
+    AVX2
+  };
+
+  bool IsVarArrayKernelSupported(VarArrayKernel kernel);
+
+  /**
+   * @brief Resolve `Auto` (or a kernel the CPU lacks) to the kernel actually used
+   */
+  VarArrayKernel GetVarArrayKernel(VarArrayKernel kernel = VarArrayKernel::Auto);
+
+  /**
+   * @brief Convert `out.size()` raw samples of `type` starting at `data`,
+   *   with the same rules as `ConvertVarValue` (truncating float to int,
+   *   floating point values are `true` when `>= 1.0`)
+   */
+  void ConvertVarArray(VarDataType type, const char* data, std::span<bool> out, VarArrayKernel kernel = VarArrayKernel::Auto);
+  void ConvertVarArray(VarDataType type, const char* data, std::span<std::int32_t> out, VarArrayKernel kernel = VarArrayKernel::Auto);
+  void ConvertVarArray(VarDataType type, const char* data, std::span<float> out, VarArrayKernel kernel = VarArrayKernel::Auto);
+  void ConvertVarArray(VarDataType type, const char* data, std::span<double> out, VarArrayKernel kernel = VarArrayKernel::Auto);
+
+  /**
+   * @brief Replace every value whose car is not in world
+   *   (`CarIdxTrackSurface == -1`) with `fallback`
+   *
+   * @param trackSurface must hold at least `values.size()` entries
+   */
+  void MaskVarArray(std::span<bool> values, std::span<const std::int32_t> trackSurface, bool fallback, VarArrayKernel kernel = VarArrayKernel::Auto);
+  void MaskVarArray(std::span<std::int32_t> values, std::span<const std::int32_t> trackSurface, std::int32_t fallback, VarArrayKernel kernel = VarArrayKernel::Auto);
+  void MaskVarArray(std::span<float> values, std::span<const std::int32_t> trackSurface, float fallback, VarArrayKernel kernel = VarArrayKernel::Auto);
+  void MaskVarArray(std::span<double> values, std::span<const std::int32_t> trackSurface, double fallback, VarArrayKernel kernel = VarArrayKernel::Auto);
+
+  /**
+   * @brief `ConvertVarArray` followed by `MaskVarArray`
+   */
+  template <typename T, std::size_t Extent>
+  void ConvertVarArrayMasked(
+    VarDataType type,
+    const char* data,
+    std::span<T, Extent> out,
+    std::span<const std::int32_t> trackSurface,
+    T fallback = T{},
+    VarArrayKernel kernel = VarArrayKernel::Auto
+  ) {
+    ConvertVarArray(type, data, std::span<T>{out}, kernel);
+    MaskVarArray(std::span<T>{out}, trackSurface, fallback, kernel);
+  }
+} // namespace IRacingTools::SDK
@@ -0,0 +1,222 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <type_traits>
+
+#include <IRacingTools/SDK/Client.h>
+#include <IRacingTools/SDK/Types.h>
+#include <IRacingTools/SDK/VarArrayConversion.h>
+
+namespace IRacingTools::SDK {
+  /**
+   * @brief Convert a raw sample value, same rules as `Client::getVar*`
+   *   (floating point values are `true` when `>= 1.0`)
+   */
+  template <typename T, typename S>
+  T ConvertVarValue(const char* data, std::uint32_t entry) {
+    auto value = reinterpret_cast<const S*>(data)[entry];
+    if constexpr (std::is_same_v<T, bool>) {
+      if constexpr (std::is_floating_point_v<S>) {
+        return value >= S{1};
+      } else {
+        return value != 0;
+      }
+    } else {
+      return static_cast<T>(value);
+    }
+  }
+
+  template <typename T>
+  using VarValueConverter = T (*)(const char* data, std::uint32_t entry);
+
+  template <typename T>
+  constexpr VarValueConverter<T> GetVarValueConverter(VarDataType type) {
+    switch (type) {
+      // 1 byte
+      case VarDataType::Char:
+      case VarDataType::Bool:
+        return &ConvertVarValue<T, char>;
+
+      // 4 bytes
+      case VarDataType::Int32:
+      case VarDataType::Bitmask:
+        return &ConvertVarValue<T, std::int32_t>;
+
+      case VarDataType::Float:
+        return &ConvertVarValue<T, float>;
+
+      // 8 bytes
+      case VarDataType::Double:
+        return &ConvertVarValue<T, double>;
+    }
+
+    return nullptr;
+  }
+
+  /**
+   * @brief Variable resolved against a client & cached (sample pointer, type & count)
+   *   until `Client::GetBindingGeneration()` changes.
+   *
+   * Resolution is lazy, the first read (or `isValid()`) binds the variable.
+   * A `ClientProvider` must keep returning the same client, or bump the
+   * binding generation when it switches clients.
+   */
+  class VarBinding {
+  public:
+    VarBinding() = delete;
+    explicit VarBinding(const std::string_view& name, ClientProvider* clientProvider = nullptr);
+    explicit VarBinding(KnownVarName name, ClientProvider* clientProvider = nullptr);
+    virtual ~VarBinding() = default;
+
+    void setVarName(const std::string_view& name);
+
+    const std::string& varName() const;
+    const std::string& description();
+    const std::string& unit();
+
+    bool isValid() {
+      return refresh();
+    }
+
+    /**
+     * @brief Is the variable valid & of `type`
+     */
+    bool is(VarDataType type) {
+      return refresh() && type_ == type;
+    }
+
+    VarDataType type() {
+      return refresh() ? type_ : VarDataType::Char;
+    }
+
+    /**
+     * @brief Number of entries (1 if not an array)
+     */
+    std::uint32_t count() {
+      return refresh() ? count_ : 0;
+    }
+
+    /**
+     * @brief Bulk read of all entries, converted with `ConvertVarArray`
+     *
+     * @return number of entries written, `min(out.size(), count())`
+     */
+    template <typename T, std::size_t Extent>
+    std::size_t getArray(std::span<T, Extent> out, VarArrayKernel kernel = VarArrayKernel::Auto) {
+      if (!refresh()) {
+        return 0;
+      }
+
+      auto entries = std::min<std::size_t>(out.size(), count_);
+      ConvertVarArray(type_, data_, out.first(entries), kernel);
+      return entries;
+    }
+
+    /**
+     * @brief `getArray`, with cars not in world (`trackSurface == -1`) set to `fallback`
+     */
+    template <typename T, std::size_t Extent>
+    std::size_t getArrayMasked(
+      std::span<T, Extent> out,
+      std::span<const std::int32_t> trackSurface,
+      T fallback = T{},
+      VarArrayKernel kernel = VarArrayKernel::Auto
+    ) {
+      auto entries = getArray(out, kernel);
+      MaskVarArray(out.first(entries), trackSurface, fallback, kernel);
+      return entries;
+    }
+
+  protected:
+    /**
+     * @brief Hot path check, only re-resolves when the binding generation moved
+     */
+    bool refresh() {
+      return generation_ == Client::GetBindingGeneration() ? data_ != nullptr : resolve();
+    }
+
+    bool resolve();
+
+    /**
+     * @brief Called after a successful resolution, to cache type specific state
+     */
+    virtual void onResolved() {}
+
+    std::shared_ptr<Client> getClient();
+
+    std::string name_{};
+    ClientProvider* clientProvider_;
+
+    std::uint64_t generation_{0};
+
+    /**
+     * @brief Sample buffer + var offset
+     */
+    const char* data_{nullptr};
+    VarDataType type_{VarDataType::Char};
+    std::uint32_t count_{0};
+
+    std::string unit_{};
+    std::string description_{};
+  };
+
+  /**
+   * @brief Typed variable accessor, a read is a generation compare,
+   *   bounds check & a load (converted when the var type is not `T`)
+   */
+  template <typename T>
+  class TypedVar : public VarBinding {
+  public:
+    using VarBinding::VarBinding;
+
+    /**
+     * @param entry is the array offset, or 0 if not an array element
+     * @return value or `T{}` if unavailable
+     */
+    T get(std::uint32_t entry = 0) {
+      if (!refresh() || entry >= count_) {
+        return T{};
+      }
+
+      if (native_) {
+        return reinterpret_cast<const T*>(data_)[entry];
+      }
+
+      return convert_(data_, entry);
+    }
+
+    std::optional<T> tryGet(std::uint32_t entry = 0) {
+      if (!refresh() || entry >= count_) {
+        return std::nullopt;
+      }
+
+      return get(entry);
+    }
+
+  protected:
+    void onResolved() override {
+      native_ = NativeType() == type_;
+      convert_ = GetVarValueConverter<T>(type_);
+    }
+
+  private:
+    static constexpr std::optional<VarDataType> NativeType() {
+      if constexpr (std::is_same_v<T, std::int32_t>) {
+        return VarDataType::Int32;
+      } else if constexpr (std::is_same_v<T, float>) {
+        return VarDataType::Float;
+      } else if constexpr (std::is_same_v<T, double>) {
+        return VarDataType::Double;
+      } else {
+        return std::nullopt;
+      }
+    }
+
+    bool native_{false};
+    VarValueConverter<T> convert_{nullptr};
+  };
+} // namespace IRacingTools::SDK
@@ -8,6 +8,7 @@
 #include "Resources.h"
 #include "Types.h"
 #include <IRacingTools/SDK/Client.h>
+#include <IRacingTools/SDK/VarBinding.h>
 #include <IRacingTools/SDK/Utils/LUT.h>
 
 namespace IRacingTools::SDK {
@@ -15,14 +16,11 @@ namespace IRacingTools::SDK {
      * @brief helper class to keep track of our variables index
      *
      * Create a global instance of this and it will take care of the details for you.
+     * Resolution is cached (see `VarBinding`), prefer `TypedVar<T>` when the type is known.
      */
-    class VarHolder {
+    class VarHolder : public VarBinding {
     public:
-        VarHolder() = delete;
-        explicit VarHolder(const std::string_view& name, ClientProvider* clientProvider = nullptr);
-        explicit VarHolder(KnownVarName name, ClientProvider* clientProvider = nullptr);
-
-        void setVarName(const std::string_view& name);
+        using VarBinding::VarBinding;
 
         /**
          * @brief Get type
@@ -38,12 +36,6 @@ namespace IRacingTools::SDK {
          */
         [[maybe_unused]] uint32_t getCount();
 
-        std::string varName();
-        std::string description();
-        std::string unit();
-
-        bool isValid();
-
         /**
          * @brief Get boolean value
          *
@@ -56,17 +48,19 @@ namespace IRacingTools::SDK {
         double getDouble(int entry = 0);
 
     protected:
-        bool reset();
-        bool isAvailable();
-        std::shared_ptr<Client> getClient();
+        void onResolved() override;
+
+        template <typename T>
+        T getValue(VarValueConverter<T> convert, int entry) {
+            if (!refresh() || entry < 0 || static_cast<std::uint32_t>(entry) >= count_)
+                return T{};
 
-        std::atomic_bool available_{false};
-        std::string name_{};
-        [[maybe_unused]] std::string unit_{};
-        [[maybe_unused]] std::string description_{};
-        int32_t idx_{0};
-        std::optional<ClientId> clientId_{};
+            return convert(data_, static_cast<std::uint32_t>(entry));
+        }
 
-        ClientProvider* clientProvider_;
+        VarValueConverter<bool> convertBool_{nullptr};
+        VarValueConverter<int> convertInt_{nullptr};
+        VarValueConverter<float> convertFloat_{nullptr};
+        VarValueConverter<double> convertDouble_{nullptr};
     };
 }
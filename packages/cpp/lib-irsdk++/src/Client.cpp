@@ -1,3 +1,4 @@
+#include <atomic>
 #include <cstdio>
 #include <cstring>
 
@@ -10,6 +11,18 @@
 namespace IRacingTools::SDK {
     using namespace Utils;
 
+    namespace {
+        std::atomic_uint64_t gBindingGeneration{1};
+    }
+
+    std::uint64_t Client::GetBindingGeneration() noexcept {
+        return gBindingGeneration.load(std::memory_order_acquire);
+    }
+
+    void Client::BumpBindingGeneration() noexcept {
+        gBindingGeneration.fetch_add(1, std::memory_order_acq_rel);
+    }
+
     Opt<const VarDataHeader*> Client::getVarHeader(KnownVarName name) {
         return getVarHeader(KnownVarNameToStringView(name));
     }
@@ -30,6 +30,7 @@ namespace IRacingTools::SDK {
         setActive(Client::LiveClientId);
       }
       clients_.erase(clientId);
+      Client::BumpBindingGeneration();
       return true;
     }
 
@@ -60,6 +61,7 @@ namespace IRacingTools::SDK {
     }
 
     activeClientId_ = clientId;
+    Client::BumpBindingGeneration();
     return true;
   }
 
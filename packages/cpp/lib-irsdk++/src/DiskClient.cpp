@@ -9,6 +9,7 @@
 #include <IRacingTools/SDK/DiskClient.h>
 #include <IRacingTools/SDK/LogInstance.h>
 #include <IRacingTools/SDK/SessionInfo/ModelParser.h>
+#include <IRacingTools/SDK/SessionInfo/SessionInfoFastParser.h>
 #include <IRacingTools/SDK/Types.h>
 #include <IRacingTools/SDK/Utils/CollectionHelpers.h>
 #include <IRacingTools/SDK/Utils/FileHelpers.h>
@@ -216,6 +217,8 @@ namespace IRacingTools::SDK {
     sampleDataOffset_ = header_.varBuf[0].bufOffset;
 
     varBuf_.resize(sampleDataSize_);
+    BumpBindingGeneration();
+
     if (std::fseek(ibtFile_, sampleDataOffset_, SEEK_SET)) {
         return false;
     }
@@ -334,15 +337,13 @@ namespace IRacingTools::SDK {
     }
 
     try {
-      auto rootNode = YAML::Load(data);
-
       if (!sessionInfo_.second) {
         sessionInfo_.second = std::make_shared<SessionInfo::SessionInfoMessage>();
         sessionInfo_.first = 1;
       }
 
       SessionInfo::SessionInfoMessage* sessionInfo = sessionInfo_.second.get();
-      *sessionInfo = rootNode.as<SessionInfo::SessionInfoMessage>();
+      SessionInfo::DecodeSessionInfoMessage(data, *sessionInfo);
       return true;
     } catch (const YAML::ParserException& ex) {
       auto msg = std::format("ParserException: Failed to parse session info: {}", ex.what());
@@ -413,6 +414,7 @@ namespace IRacingTools::SDK {
     sampleIndex_ = 0;
 
     varHeaders_.clear();
+    BumpBindingGeneration();
   }
 
   bool DiskClient::hasNext() {
@@ -808,6 +810,10 @@ namespace IRacingTools::SDK {
     return isFileOpen();
   }
 
+  const char* DiskClient::getVarDataBuffer() {
+    return isAvailable() ? varBuf_.data() : nullptr;
+  }
+
   Opt<const VarDataHeader*> DiskClient::getVarHeader(uint32_t idx) {
     if (isAvailable() && isVarIndexOk(idx)) {
       auto& headers = getVarHeaders();
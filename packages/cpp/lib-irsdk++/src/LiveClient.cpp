@@ -9,6 +9,7 @@
 #include <IRacingTools/SDK/LiveConnection.h>
 #include <IRacingTools/SDK/LogInstance.h>
 #include <IRacingTools/SDK/SessionInfo/ModelParser.h>
+#include <IRacingTools/SDK/SessionInfo/SessionInfoFastParser.h>
 #include <IRacingTools/SDK/Types.h>
 #include <IRacingTools/SDK/VarData.h>
 
@@ -84,6 +85,9 @@ namespace IRacingTools::SDK {
     sessionId_ = -1;
     sessionSampleCount_ = -1;
     sessionInfoChangedFlag_.clear();
+
+    // the sample buffer was (re)allocated or released
+    BumpBindingGeneration();
   }
 
   bool LiveClient::waitForData(std::int64_t timeoutMillis) {
@@ -133,6 +137,7 @@ namespace IRacingTools::SDK {
 
     delete[] data_;
     data_ = nullptr;
+    BumpBindingGeneration();
 
     // reset session info str status
     sessionInfo_.first = -1;
@@ -342,13 +347,12 @@ namespace IRacingTools::SDK {
         if (data) {          
           sessionInfo_.first = count;
           sessionInfoStr_ = std::make_optional<std::string_view>(data);
-          auto rootNode = YAML::Load(data);
           if (!sessionInfo_.second) {
             sessionInfo_.second = std::make_shared<SessionInfo::SessionInfoMessage>();
           }
 
           SessionInfo::SessionInfoMessage *sessionInfo = sessionInfo_.second.get();
-          *sessionInfo = rootNode.as<SessionInfo::SessionInfoMessage>();
+          SessionInfo::DecodeSessionInfoMessage(data, *sessionInfo);
           sessionId_ = sessionInfo_.second->weekendInfo.sessionID;
           return true;
         }
@@ -480,6 +484,10 @@ namespace IRacingTools::SDK {
   bool LiveClient::isAvailable() {
     return isConnected();
   }
+
+  const char *LiveClient::getVarDataBuffer() {
+    return isConnected() ? data_ : nullptr;
+  }
   Opt<const VarDataHeader *> LiveClient::getVarHeader(const std::string_view &name) {
     auto res = getVarIdx(name);
     return res ? getVarHeader(res.value()) : std::nullopt;
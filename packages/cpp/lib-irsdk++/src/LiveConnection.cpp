@@ -51,6 +51,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <IRacingTools/SDK/DataHeader.h>
 #include <IRacingTools/SDK/LiveConnection.h>
 #include <IRacingTools/SDK/LogInstance.h>
+#include <IRacingTools/SDK/SessionInfo/SessionInfoFastParser.h>
 #include <IRacingTools/SDK/SessionInfo/SessionInfoMessage.h>
 #include <IRacingTools/SDK/Types.h>
 
@@ -325,7 +326,7 @@ namespace IRacingTools::SDK {
    * Retrieves session information as a shared pointer to a SessionInfoMessage object.
    *
    * This method checks if the session information message has been previously initialized.
-   * If not, it fetches the session information string, deserializes it using YAML, and constructs
+   * If not, it fetches the session information string, deserializes it (`DecodeSessionInfoMessage`), and constructs
    * a new SessionInfoMessage object. The constructed object is then cached for future calls.
    * If the session information is successfully retrieved and parsed, it is returned as a shared pointer.
    * In case no session information is available or parsing fails, a null shared pointer is returned.
@@ -338,10 +339,9 @@ namespace IRacingTools::SDK {
       auto sessionInfoData = getSessionInfoStr();
       std::shared_ptr<SessionInfo::SessionInfoMessage> sessionInfoMessage{nullptr};
       if (sessionInfoData) {
-        auto rootNode = YAML::Load(sessionInfoData);
         sessionInfoMessage = std::make_shared<SessionInfo::SessionInfoMessage>();
         if (sessionInfoMessage) {
-          *sessionInfoMessage = rootNode.as<SessionInfo::SessionInfoMessage>();
+          SessionInfo::DecodeSessionInfoMessage(sessionInfoData, *sessionInfoMessage);
           sessionInfoMessage_ = sessionInfoMessage;
         }
       }
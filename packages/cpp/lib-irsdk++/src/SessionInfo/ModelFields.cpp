@@ -0,0 +1,158 @@
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <limits>
+
+#include <IRacingTools/SDK/SessionInfo/ModelFields.h>
+
+namespace IRacingTools::SDK::SessionInfo {
+  namespace {
+    std::string_view TrimTrailingSpace(std::string_view value) {
+      while (!value.empty() && (value.back() == ' ' || value.back() == '\t' || value.back() == '\r' || value.back() == '\n')) {
+        value.remove_suffix(1);
+      }
+
+      return value;
+    }
+
+    /**
+     * @brief yaml-cpp only accepts `lower`, `UPPER` & `Capitalized` spellings
+     */
+    bool IsFlexibleCase(std::string_view value) {
+      if (value.empty()) {
+        return true;
+      }
+
+      auto isLower = [](char c) { return c >= 'a' && c <= 'z'; };
+      auto isUpper = [](char c) { return c >= 'A' && c <= 'Z'; };
+      auto rest = value.substr(1);
+
+      if (std::ranges::all_of(value, [&](char c) { return !isUpper(c); })) {
+        return true;
+      }
+
+      if (std::ranges::all_of(value, [&](char c) { return !isLower(c); })) {
+        return true;
+      }
+
+      return isUpper(value[0]) && std::ranges::all_of(rest, [&](char c) { return !isUpper(c); });
+    }
+
+    bool EqualsIgnoreCase(std::string_view value, std::string_view lowerTarget) {
+      return value.size() == lowerTarget.size() && std::ranges::equal(
+        value,
+        lowerTarget,
+        [](char c, char t) {
+          return (c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c) == t;
+        });
+    }
+  } // namespace
+
+  /**
+   * Matches yaml-cpp, which reads via `std::stringstream` with `unsetf(std::ios::dec)`,
+   * so `0x` prefixed values are hex & `0` prefixed values are octal
+   */
+  bool ConvertScalar(std::string_view value, std::int32_t& out) {
+    value = TrimTrailingSpace(value);
+
+    bool negative = false;
+    if (!value.empty() && (value[0] == '+' || value[0] == '-')) {
+      negative = value[0] == '-';
+      value.remove_prefix(1);
+    }
+
+    int base = 10;
+    if (value.size() > 2 && value[0] == '0' && (value[1] == 'x' || value[1] == 'X')) {
+      base = 16;
+      value.remove_prefix(2);
+    } else if (value.size() > 1 && value[0] == '0') {
+      base = 8;
+      value.remove_prefix(1);
+    }
+
+    if (value.empty()) {
+      return false;
+    }
+
+    std::uint64_t magnitude{0};
+    auto end = value.data() + value.size();
+    auto [ptr, ec] = std::from_chars(value.data(), end, magnitude, base);
+    if (ec != std::errc{} || ptr != end) {
+      return false;
+    }
+
+    constexpr auto MaxPositive = static_cast<std::uint64_t>(std::numeric_limits<std::int32_t>::max());
+    if (magnitude > MaxPositive + (negative ? 1 : 0)) {
+      return false;
+    }
+
+    out = negative
+            ? static_cast<std::int32_t>(-static_cast<std::int64_t>(magnitude))
+            : static_cast<std::int32_t>(magnitude);
+    return true;
+  }
+
+  bool ConvertScalar(std::string_view value, float& out) {
+    value = TrimTrailingSpace(value);
+    if (value.empty()) {
+      return false;
+    }
+
+    // yaml-cpp special values
+    static constexpr std::array<std::string_view, 3> InfValues{".inf", ".Inf", ".INF"};
+    static constexpr std::array<std::string_view, 3> NaNValues{".nan", ".NaN", ".NAN"};
+
+    auto unsignedValue = value[0] == '+' || value[0] == '-' ? value.substr(1) : value;
+    if (std::ranges::find(InfValues, unsignedValue) != InfValues.end()) {
+      out = value[0] == '-' ? -std::numeric_limits<float>::infinity() : std::numeric_limits<float>::infinity();
+      return true;
+    }
+
+    if (std::ranges::find(NaNValues, value) != NaNValues.end()) {
+      out = std::numeric_limits<float>::quiet_NaN();
+      return true;
+    }
+
+    // `from_chars` rejects a leading `+` & accepts `inf`/`nan` words, streams do the opposite
+    if (value[0] == '+') {
+      value.remove_prefix(1);
+      if (value.empty() || value[0] == '-' || value[0] == '+') {
+        return false;
+      }
+    }
+
+    auto digits = value[0] == '-' ? value.substr(1) : value;
+    if (digits.empty() || !(digits[0] == '.' || (digits[0] >= '0' && digits[0] <= '9'))) {
+      return false;
+    }
+
+    auto end = value.data() + value.size();
+    auto [ptr, ec] = std::from_chars(value.data(), end, out, std::chars_format::general);
+    return ec == std::errc{} && ptr == end;
+  }
+
+  bool ConvertScalar(std::string_view value, bool& out) {
+    static constexpr std::array<std::pair<std::string_view, std::string_view>, 4> Names{
+      {{"y", "n"}, {"yes", "no"}, {"true", "false"}, {"on", "off"}}
+    };
+
+    if (!IsFlexibleCase(value)) {
+      return false;
+    }
+
+    for (auto& [trueName, falseName] : Names) {
+      if (EqualsIgnoreCase(value, trueName)) {
+        out = true;
+        return true;
+      }
+
+      if (EqualsIgnoreCase(value, falseName)) {
+        out = false;
+        return true;
+      }
+    }
+
+    return false;
+  }
+} // namespace IRacingTools::SDK::SessionInfo
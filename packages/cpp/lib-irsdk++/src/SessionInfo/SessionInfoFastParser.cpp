@@ -0,0 +1,482 @@
+#include <array>
+#include <cstring>
+#include <optional>
+
+#include <yaml-cpp/yaml.h>
+
+#include <IRacingTools/SDK/SessionInfo/ModelFieldTables.h>
+#include <IRacingTools/SDK/SessionInfo/ModelParser.h>
+#include <IRacingTools/SDK/SessionInfo/SessionInfoFastParser.h>
+
+namespace IRacingTools::SDK::SessionInfo {
+  namespace {
+    constexpr std::size_t MaxDepth = 16;
+
+    constexpr std::string_view NullString = "null";
+
+    enum class FrameKind : std::uint8_t {
+      Map,
+      List,
+      Skip
+    };
+
+    /**
+     * @brief An open mapping, sequence or skipped (unknown key) block
+     */
+    struct Frame {
+      FrameKind kind{FrameKind::Skip};
+
+      /**
+       * @brief Map: the model type, List: the owning model type
+       */
+      const TypeDescriptor* type{nullptr};
+      void* model{nullptr};
+
+      /**
+       * @brief List: the list field of `model`,
+       *   Skip: the scalar field with an empty value (if any)
+       */
+      const FieldDescriptor* field{nullptr};
+
+      /**
+       * @brief Indent of the key that opened this block (-1 for the document root)
+       */
+      int parentIndent{-1};
+
+      /**
+       * @brief Map: column of the keys, List: column of the `-` item indicators,
+       *   -1 until the first line of the block is seen
+       */
+      int indent{-1};
+
+      std::uint64_t seen{0};
+      std::size_t count{0};
+    };
+
+    struct Scalar {
+      std::string_view text{};
+      bool isNull{false};
+    };
+
+    constexpr bool IsLineSpace(char c) {
+      return c == ' ' || c == '\t' || c == '\r';
+    }
+
+    std::string_view TrimSpace(std::string_view value) {
+      while (!value.empty() && IsLineSpace(value.front())) {
+        value.remove_prefix(1);
+      }
+
+      while (!value.empty() && IsLineSpace(value.back())) {
+        value.remove_suffix(1);
+      }
+
+      return value;
+    }
+
+    /**
+     * @brief Resolve a single line, inline value.
+     *
+     * @return `std::nullopt` for anything beyond plain & simple quoted scalars
+     */
+    std::optional<Scalar> ScanScalar(std::string_view value) {
+      if (value.empty()) {
+        return Scalar{.isNull = true};
+      }
+
+      auto first = value.front();
+      if (first == '"' || first == '\'') {
+        auto close = value.find(first, 1);
+        if (close == std::string_view::npos || !TrimSpace(value.substr(close + 1)).empty()) {
+          return std::nullopt;
+        }
+
+        auto text = value.substr(1, close - 1);
+        if (first == '"' && text.find('\\') != std::string_view::npos) {
+          return std::nullopt;
+        }
+
+        return Scalar{.text = text};
+      }
+
+      constexpr std::string_view Indicators = "[]{}&*!|>%@`#,";
+      if (Indicators.find(first) != std::string_view::npos) {
+        return std::nullopt;
+      }
+
+      if ((first == '-' || first == '?' || first == ':') && (value.size() == 1 || value[1] == ' ')) {
+        return std::nullopt;
+      }
+
+      if (value.find(": ") != std::string_view::npos || value.find(" #") != std::string_view::npos || value.back() == ':') {
+        return std::nullopt;
+      }
+
+      if (value == "~" || value == "null" || value == "Null" || value == "NULL") {
+        return Scalar{.isNull = true};
+      }
+
+      return Scalar{.text = value};
+    }
+
+    class Decoder {
+    public:
+      Decoder(const TypeDescriptor& type, void* model) {
+        stack_[0] = Frame{.kind = FrameKind::Map, .type = &type, .model = model};
+        depth_ = 1;
+      }
+
+      bool decode(std::string_view data) {
+        bool started = false;
+        while (!data.empty()) {
+          auto lineEnd = data.find('\n');
+          auto line = data.substr(0, lineEnd);
+          data = lineEnd == std::string_view::npos ? std::string_view{} : data.substr(lineEnd + 1);
+
+          int indent = 0;
+          while (indent < static_cast<int>(line.size()) && line[indent] == ' ') {
+            indent++;
+          }
+
+          auto content = TrimSpace(line.substr(indent));
+          if (content.empty() || content.front() == '#') {
+            continue;
+          }
+
+          // Tabs are not valid YAML indentation
+          if (line[indent] == '\t') {
+            return false;
+          }
+
+          if (indent == 0 && content == "---") {
+            // A second document is beyond the subset
+            if (started) {
+              return false;
+            }
+
+            continue;
+          }
+
+          if (indent == 0 && content == "...") {
+            break;
+          }
+
+          started = true;
+          if (!decodeLine(indent, content)) {
+            return false;
+          }
+        }
+
+        // yaml-cpp can not convert an empty document
+        if (!started) {
+          return false;
+        }
+
+        while (depth_ > 0) {
+          if (!pop()) {
+            return false;
+          }
+        }
+
+        return true;
+      }
+
+    private:
+      bool decodeLine(int indent, std::string_view content) {
+        bool isItem = content.front() == '-' && (content.size() == 1 || content[1] == ' ');
+
+        while (true) {
+          if (depth_ == 0) {
+            return false;
+          }
+
+          auto& top = stack_[depth_ - 1];
+          switch (top.kind) {
+            case FrameKind::Skip: {
+              if (indent > top.parentIndent || (isItem && indent == top.parentIndent)) {
+                // A scalar field with a nested block, yaml-cpp can not convert
+                // a mapping/sequence to a scalar, so the fallback applies
+                if (top.field && top.count++ == 0) {
+                  if (top.field->presence == FieldPresence::Required) {
+                    return false;
+                  }
+
+                  top.field->reset(top.model);
+                }
+
+                return true;
+              }
+
+              break;
+            }
+
+            case FrameKind::Map: {
+              if (top.indent < 0) {
+                if (!isItem && indent > top.parentIndent) {
+                  top.indent = indent;
+                  return decodeKey(top, content);
+                }
+
+                if (isItem && indent >= top.parentIndent) {
+                  return false;
+                }
+
+                break;
+              }
+
+              if (!isItem && indent == top.indent) {
+                return decodeKey(top, content);
+              }
+
+              if (indent >= top.indent) {
+                return false;
+              }
+
+              break;
+            }
+
+            case FrameKind::List: {
+              if (top.indent < 0) {
+                if (isItem && indent >= top.parentIndent) {
+                  top.indent = indent;
+                  return decodeItem(top, indent, content);
+                }
+
+                if (indent > top.parentIndent) {
+                  return false;
+                }
+
+                break;
+              }
+
+              if (isItem && indent == top.indent) {
+                return decodeItem(top, indent, content);
+              }
+
+              if (indent > top.indent) {
+                return false;
+              }
+
+              break;
+            }
+          }
+
+          if (!pop()) {
+            return false;
+          }
+        }
+      }
+
+      bool decodeItem(Frame& list, int indent, std::string_view content) {
+        auto element = list.field->child(list.model, list.count++);
+        auto rest = content.substr(1);
+        auto restIndent = indent + 1;
+        while (!rest.empty() && rest.front() == ' ') {
+          rest.remove_prefix(1);
+          restIndent++;
+        }
+
+        Frame elementFrame{
+          .kind = FrameKind::Map,
+          .type = list.field->childType,
+          .model = element,
+          .parentIndent = list.indent,
+          .indent = rest.empty() ? -1 : restIndent
+        };
+
+        if (!push(elementFrame)) {
+          return false;
+        }
+
+        return rest.empty() || decodeKey(stack_[depth_ - 1], rest);
+      }
+
+      bool decodeKey(Frame& map, std::string_view content) {
+        auto first = content.front();
+        if (first == '"' || first == '\'' || first == '?' || first == '[' || first == '{' || first == '&' || first == '*' || first == '!') {
+          return false;
+        }
+
+        std::size_t colon = 0;
+        while (true) {
+          colon = content.find(':', colon);
+          if (colon == std::string_view::npos) {
+            return false;
+          }
+
+          if (colon + 1 == content.size() || content[colon + 1] == ' ') {
+            break;
+          }
+
+          colon++;
+        }
+
+        auto key = content.substr(0, colon);
+        if (key.empty()) {
+          return false;
+        }
+
+        auto value = TrimSpace(content.substr(colon + 1));
+        auto field = map.type->find(key);
+        std::uint64_t fieldBit = 0;
+        if (field) {
+          fieldBit = 1ull << (field - map.type->fields.data());
+
+          // yaml-cpp resolves duplicate keys to the first occurrence
+          if (map.seen & fieldBit) {
+            field = nullptr;
+          }
+        }
+
+        if (!field) {
+          if (value.empty()) {
+            return push(Frame{.kind = FrameKind::Skip, .parentIndent = map.indent});
+          }
+
+          return ScanScalar(value).has_value();
+        }
+
+        map.seen |= fieldBit;
+
+        switch (field->kind) {
+          case FieldKind::Object: {
+            if (!value.empty()) {
+              return false;
+            }
+
+            return push(
+              Frame{
+                .kind = FrameKind::Map,
+                .type = field->childType,
+                .model = field->child(map.model, 0),
+                .parentIndent = map.indent
+              });
+          }
+
+          case FieldKind::List: {
+            if (!value.empty()) {
+              return false;
+            }
+
+            return push(
+              Frame{
+                .kind = FrameKind::List,
+                .type = map.type,
+                .model = map.model,
+                .field = field,
+                .parentIndent = map.indent
+              });
+          }
+
+          default: {
+            auto scalar = ScanScalar(value);
+            if (!scalar) {
+              return false;
+            }
+
+            if (scalar->isNull) {
+              // yaml-cpp converts a null node to the string "null"
+              if (field->kind == FieldKind::String) {
+                field->assign(map.model, NullString);
+              } else if (field->presence == FieldPresence::Required) {
+                return false;
+              } else {
+                field->reset(map.model);
+              }
+            } else if (!field->assign(map.model, scalar->text)) {
+              if (field->presence == FieldPresence::Required) {
+                return false;
+              }
+
+              field->reset(map.model);
+            }
+
+            // An empty value may still open a nested block, which is resolved
+            // when (if) the skip frame consumes its first line
+            if (value.empty()) {
+              return push(
+                Frame{
+                  .kind = FrameKind::Skip,
+                  .model = map.model,
+                  .field = field,
+                  .parentIndent = map.indent
+                });
+            }
+
+            return true;
+          }
+        }
+      }
+
+      bool push(const Frame& frame) {
+        if (depth_ == MaxDepth) {
+          return false;
+        }
+
+        stack_[depth_++] = frame;
+        return true;
+      }
+
+      /**
+       * @brief Close the top block, applying defaults to any fields never seen
+       *
+       * @return false if a required field or list is missing
+       */
+      bool pop() {
+        auto& top = stack_[--depth_];
+        switch (top.kind) {
+          case FrameKind::Map: {
+            auto& fields = top.type->fields;
+            for (std::size_t idx = 0; idx < fields.size(); idx++) {
+              if (top.seen & (1ull << idx)) {
+                continue;
+              }
+
+              if (fields[idx].presence == FieldPresence::Required) {
+                return false;
+              }
+
+              fields[idx].reset(top.model);
+            }
+
+            return true;
+          }
+
+          case FrameKind::List: {
+            // an empty (null) value can not be converted to a list
+            if (top.indent < 0) {
+              return false;
+            }
+
+            top.field->truncate(top.model, top.count);
+            return true;
+          }
+
+          default:
+            return true;
+        }
+      }
+
+      std::array<Frame, MaxDepth> stack_{};
+      std::size_t depth_{0};
+    };
+  } // namespace
+
+  bool FastDecodeModel(std::string_view data, const TypeDescriptor& type, void* model) {
+    Decoder decoder(type, model);
+    return decoder.decode(data);
+  }
+
+  bool FastDecodeSessionInfoMessage(std::string_view data, SessionInfoMessage& message) {
+    return FastDecodeModel(data, ModelDescriptor<SessionInfoMessage>::Value, &message);
+  }
+
+  void DecodeSessionInfoMessage(std::string_view data, SessionInfoMessage& message) {
+    if (FastDecodeSessionInfoMessage(data, message)) {
+      return;
+    }
+
+    auto rootNode = YAML::Load(std::string(data));
+    message = rootNode.as<SessionInfoMessage>();
+  }
+} // namespace IRacingTools::SDK::SessionInfo
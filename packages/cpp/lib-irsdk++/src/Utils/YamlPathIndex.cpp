@@ -0,0 +1,287 @@
+#include <algorithm>
+#include <string>
+
+#include <IRacingTools/SDK/Utils/YamlParser.h>
+#include <IRacingTools/SDK/Utils/YamlPathIndex.h>
+
+namespace IRacingTools::SDK::Utils {
+namespace {
+    enum class LineState { space, key, keysep, value, newline };
+
+    constexpr std::uint64_t HashBasis = 14695981039346656037ull;
+
+    // FNV-1a
+    constexpr std::uint64_t HashAppend(std::uint64_t hash, std::string_view text) {
+        for (auto c : text) {
+            hash ^= static_cast<std::uint8_t>(c);
+            hash *= 1099511628211ull;
+        }
+
+        return hash;
+    }
+
+    constexpr std::uint64_t KeyHash(std::string_view key) {
+        return HashAppend(HashBasis, key);
+    }
+
+    constexpr std::uint64_t KeyValueHash(std::uint64_t keyHash, std::string_view value) {
+        // keys always end with `:`, so the key/value boundary is unambiguous
+        return HashAppend(keyHash, value);
+    }
+}
+
+YamlPathIndex::YamlPathIndex(std::string_view data) {
+    build(data);
+}
+
+void YamlPathIndex::clear() {
+    data_ = {};
+    lines_.clear();
+    keys_.clear();
+    keyValues_.clear();
+    prefixKeyLines_.clear();
+}
+
+void YamlPathIndex::build(std::string_view data) {
+    clear();
+
+    if (auto terminator = data.find('\0'); terminator != std::string_view::npos)
+        data = data.substr(0, terminator);
+
+    data_ = data;
+
+    // Tokenizes lines exactly as `ParseYaml` does, including its quirks
+    // (dashes count as depth, a line that is never terminated is ignored)
+    auto state = LineState::space;
+    Line line{};
+    auto resetLine = [&](std::uint32_t offset) {
+        line = Line{.offset = offset};
+    };
+
+    for (std::uint32_t idx = 0; idx < data.size(); idx++) {
+        switch (data[idx]) {
+            case ' ':
+            case '-':
+                if (state == LineState::newline)
+                    state = LineState::space;
+                if (state == LineState::space)
+                    line.depth++;
+                else if (state == LineState::key)
+                    line.keyLen++;
+                else if (state == LineState::value)
+                    line.valueLen++;
+                else if (data[idx] == '-') {
+                    state = LineState::value;
+                    line.valueOffset = idx;
+                    line.valueLen = 1;
+                }
+                break;
+            case ':':
+                if (state == LineState::key) {
+                    state = LineState::keysep;
+                    line.keyLen++;
+                } else if (state == LineState::keysep) {
+                    state = LineState::value;
+                    line.valueOffset = idx;
+                } else if (state == LineState::value)
+                    line.valueLen++;
+                break;
+            case '\n':
+            case '\r':
+                if (state != LineState::newline) {
+                    if (state == LineState::key || state == LineState::keysep)
+                        line.valueOffset = line.keyOffset + line.keyLen;
+
+                    lines_.push_back(line);
+                }
+
+                state = LineState::newline;
+                resetLine(idx + 1);
+                break;
+            default:
+                if (state == LineState::space || state == LineState::newline) {
+                    state = LineState::key;
+                    line.keyOffset = idx;
+                } else if (state == LineState::keysep) {
+                    state = LineState::value;
+                    line.valueOffset = idx;
+                }
+                if (state == LineState::key)
+                    line.keyLen++;
+                if (state == LineState::value)
+                    line.valueLen++;
+                break;
+        }
+    }
+
+    auto lineCount = static_cast<std::uint32_t>(lines_.size());
+
+    // Resolve block ends, every line still open when a shallower line
+    // is reached ends there
+    std::vector<std::uint32_t> open{};
+    for (std::uint32_t idx = 0; idx < lineCount; idx++) {
+        while (!open.empty() && lines_[open.back()].depth > lines_[idx].depth) {
+            lines_[open.back()].blockEnd = idx;
+            open.pop_back();
+        }
+
+        open.push_back(idx);
+    }
+
+    for (auto idx : open)
+        lines_[idx].blockEnd = lineCount;
+
+    keys_.reserve(lineCount);
+    keyValues_.reserve(lineCount);
+    for (std::uint32_t idx = 0; idx < lineCount; idx++) {
+        auto &entry = lines_[idx];
+        if (!entry.keyLen)
+            continue;
+
+        auto key = keyOf(entry);
+        if (key.back() != ':') {
+            prefixKeyLines_.push_back(idx);
+            continue;
+        }
+
+        auto keyHash = KeyHash(key);
+        keys_.push_back({keyHash, idx});
+        keyValues_.push_back({KeyValueHash(keyHash, valueOf(entry)), idx});
+    }
+
+    std::ranges::sort(keys_);
+    std::ranges::sort(keyValues_);
+}
+
+std::optional<std::uint32_t> YamlPathIndex::findLine(
+    const std::vector<HashedLine> &hashes,
+    std::uint64_t hash,
+    std::string_view key,
+    const std::optional<std::string_view> &value,
+    std::uint32_t begin,
+    std::uint32_t end
+) const {
+    auto it = std::ranges::lower_bound(hashes, HashedLine{hash, begin});
+    for (; it != hashes.end() && it->hash == hash && it->line < end; ++it) {
+        auto &entry = lines_[it->line];
+        if (keyOf(entry) == key && (!value || valueOf(entry) == *value))
+            return it->line;
+    }
+
+    return std::nullopt;
+}
+
+bool YamlPathIndex::hasPrefixKey(std::string_view path, std::uint32_t begin, std::uint32_t end) const {
+    auto it = std::ranges::lower_bound(prefixKeyLines_, begin);
+    for (; it != prefixKeyLines_.end() && *it < end; ++it) {
+        if (path.starts_with(keyOf(lines_[*it])))
+            return true;
+    }
+
+    return false;
+}
+
+bool YamlPathIndex::find(const std::string_view &path, const char **val, int *len) const {
+    if (!val || !len)
+        return false;
+
+    *val = nullptr;
+    *len = 0;
+
+    auto rest = path.substr(0, path.find('\0'));
+    if (rest.empty())
+        return false;
+
+    // Paths the index does not model (colon-less keys matching the path,
+    // unterminated filters) are resolved by the reference scanner
+    auto scan = [&] {
+        std::string data{data_};
+        std::string pathCopy{path};
+        const char *scanVal = nullptr;
+        if (!ParseYaml(data.c_str(), pathCopy, &scanVal, len))
+            return false;
+
+        *val = scanVal ? data_.data() + (scanVal - data.c_str()) : nullptr;
+        return true;
+    };
+
+    std::uint32_t begin = 0;
+    auto end = static_cast<std::uint32_t>(lines_.size());
+    while (true) {
+        if (hasPrefixKey(rest, begin, end))
+            return scan();
+
+        auto colon = rest.find(':');
+        if (colon == std::string_view::npos)
+            return false;
+
+        auto key = rest.substr(0, colon + 1);
+        rest.remove_prefix(colon + 1);
+
+        std::optional<std::string_view> filter{};
+        if (!rest.empty() && rest.front() == '{') {
+            auto close = rest.find('}');
+            if (close == std::string_view::npos)
+                return scan();
+
+            filter = rest.substr(1, close - 1);
+            rest.remove_prefix(close + 1);
+        }
+
+        auto keyHash = KeyHash(key);
+        auto lineIdx = filter
+            ? findLine(keyValues_, KeyValueHash(keyHash, *filter), key, filter, begin, end)
+            : findLine(keys_, keyHash, key, std::nullopt, begin, end);
+        if (!lineIdx)
+            return false;
+
+        auto &entry = lines_[*lineIdx];
+        if (rest.empty()) {
+            *val = data_.data() + entry.valueOffset;
+            *len = static_cast<int>(entry.valueLen);
+            return true;
+        }
+
+        begin = *lineIdx + 1;
+        end = entry.blockEnd;
+    }
+}
+
+std::optional<std::string_view> YamlPathIndex::find(const std::string_view &path) const {
+    const char *val = nullptr;
+    int len = 0;
+    if (!find(path, &val, &len))
+        return std::nullopt;
+
+    return std::string_view{val, static_cast<std::size_t>(len)};
+}
+
+const YamlPathIndex &YamlPathCache::update(const char *data, std::int32_t updateCount) {
+    if (data != data_ || updateCount_ != updateCount) {
+        index_.build(data ? std::string_view{data} : std::string_view{});
+        data_ = data;
+        updateCount_ = updateCount;
+    }
+
+    return index_;
+}
+
+bool YamlPathCache::find(
+    const char *data,
+    std::int32_t updateCount,
+    const std::string_view &path,
+    const char **val,
+    int *len
+) {
+    if (!data || path.empty() || !val || !len)
+        return false;
+
+    return update(data, updateCount).find(path, val, len);
+}
+
+void YamlPathCache::invalidate() {
+    data_ = nullptr;
+    updateCount_.reset();
+    index_.clear();
+}
+} // namespace IRacingTools::SDK::Utils
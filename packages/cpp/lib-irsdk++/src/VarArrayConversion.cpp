@@ -0,0 +1,498 @@
+#include <algorithm>
+#include <cstring>
+
+#include <IRacingTools/SDK/VarArrayConversion.h>
+#include <IRacingTools/SDK/VarBinding.h>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define IRT_VAR_ARRAY_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#endif
+
+// MSVC accepts any intrinsic without `/arch`, GCC & Clang need the
+// functions using them to opt in to the instruction set
+#if defined(__GNUC__) || defined(__clang__)
+#define IRT_VAR_ARRAY_TARGET(isa) __attribute__((target(isa)))
+#else
+#define IRT_VAR_ARRAY_TARGET(isa)
+#endif
+
+namespace IRacingTools::SDK {
+  namespace {
+    constexpr std::int32_t TrackSurfaceNotInWorld = -1;
+
+    template <typename T>
+    void ConvertScalar(VarDataType type, const char* data, T* out, std::size_t begin, std::size_t count) {
+      auto convert = GetVarValueConverter<T>(type);
+      for (auto i = begin; i < count; i++) {
+        out[i] = convert(data, static_cast<std::uint32_t>(i));
+      }
+    }
+
+    template <typename T>
+    void MaskScalar(T* values, const std::int32_t* trackSurface, T fallback, std::size_t begin, std::size_t count) {
+      for (auto i = begin; i < count; i++) {
+        values[i] = trackSurface[i] == TrackSurfaceNotInWorld ? fallback : values[i];
+      }
+    }
+
+    /**
+     * @brief Same storage type, nothing to convert
+     */
+    template <typename T>
+    bool CopyNative(VarDataType type, const char* data, T* out, std::size_t count) {
+      bool native = false;
+      if constexpr (std::is_same_v<T, std::int32_t>) {
+        native = type == VarDataType::Int32 || type == VarDataType::Bitmask;
+      } else if constexpr (std::is_same_v<T, float>) {
+        native = type == VarDataType::Float;
+      } else if constexpr (std::is_same_v<T, double>) {
+        native = type == VarDataType::Double;
+      }
+
+      if (native) {
+        std::memcpy(out, data, count * sizeof(T));
+      }
+
+      return native;
+    }
+
+#ifdef IRT_VAR_ARRAY_X86
+    template <typename T>
+    T LoadUnaligned(const char* data) {
+      T value;
+      std::memcpy(&value, data, sizeof(T));
+      return value;
+    }
+
+    bool CpuSupports(VarArrayKernel kernel) {
+#if defined(_MSC_VER) && !defined(__clang__)
+      int info[4]{};
+      __cpuid(info, 0);
+      auto maxLeaf = info[0];
+
+      __cpuid(info, 1);
+      auto sse41 = (info[2] & (1 << 19)) != 0;
+      if (kernel == VarArrayKernel::SSE41) {
+        return sse41;
+      }
+
+      // AVX2 also needs the OS to save the YMM registers (OSXSAVE + XCR0)
+      auto osxsave = (info[2] & (1 << 27)) != 0;
+      auto avx = (info[2] & (1 << 28)) != 0;
+      if (maxLeaf < 7 || !osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6) {
+        return false;
+      }
+
+      __cpuidex(info, 7, 0);
+      return (info[1] & (1 << 5)) != 0;
+#else
+      __builtin_cpu_init();
+      return kernel == VarArrayKernel::SSE41 ? __builtin_cpu_supports("sse4.1") : __builtin_cpu_supports("avx2");
+#endif
+    }
+
+    // SSE4.1, 4 x 32bit lanes
+
+    IRT_VAR_ARRAY_TARGET("sse4.1")
+    std::size_t ConvertSSE41(VarDataType type, const char* data, std::int32_t* out, std::size_t count) {
+      std::size_t i = 0;
+      switch (type) {
+        case VarDataType::Char:
+        case VarDataType::Bool:
+          for (; i + 4 <= count; i += 4) {
+            auto bytes = _mm_cvtsi32_si128(LoadUnaligned<std::int32_t>(data + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_cvtepi8_epi32(bytes));
+          }
+          break;
+        case VarDataType::Float: {
+          auto src = reinterpret_cast<const float*>(data);
+          for (; i + 4 <= count; i += 4) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_cvttps_epi32(_mm_loadu_ps(src + i)));
+          }
+          break;
+        }
+        case VarDataType::Double: {
+          auto src = reinterpret_cast<const double*>(data);
+          for (; i + 4 <= count; i += 4) {
+            auto lo = _mm_cvttpd_epi32(_mm_loadu_pd(src + i));
+            auto hi = _mm_cvttpd_epi32(_mm_loadu_pd(src + i + 2));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_unpacklo_epi64(lo, hi));
+          }
+          break;
+        }
+        default:
+          break;
+      }
+
+      return i;
+    }
+
+    IRT_VAR_ARRAY_TARGET("sse4.1")
+    std::size_t ConvertSSE41(VarDataType type, const char* data, float* out, std::size_t count) {
+      std::size_t i = 0;
+      switch (type) {
+        case VarDataType::Char:
+        case VarDataType::Bool:
+          for (; i + 4 <= count; i += 4) {
+            auto bytes = _mm_cvtsi32_si128(LoadUnaligned<std::int32_t>(data + i));
+            _mm_storeu_ps(out + i, _mm_cvtepi32_ps(_mm_cvtepi8_epi32(bytes)));
+          }
+          break;
+        case VarDataType::Int32:
+        case VarDataType::Bitmask:
+          for (; i + 4 <= count; i += 4) {
+            auto values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i * 4));
+            _mm_storeu_ps(out + i, _mm_cvtepi32_ps(values));
+          }
+          break;
+        case VarDataType::Double: {
+          auto src = reinterpret_cast<const double*>(data);
+          for (; i + 4 <= count; i += 4) {
+            auto lo = _mm_cvtpd_ps(_mm_loadu_pd(src + i));
+            auto hi = _mm_cvtpd_ps(_mm_loadu_pd(src + i + 2));
+            _mm_storeu_ps(out + i, _mm_movelh_ps(lo, hi));
+          }
+          break;
+        }
+        default:
+          break;
+      }
+
+      return i;
+    }
+
+    IRT_VAR_ARRAY_TARGET("sse4.1")
+    std::size_t ConvertSSE41(VarDataType type, const char* data, double* out, std::size_t count) {
+      std::size_t i = 0;
+      switch (type) {
+        case VarDataType::Char:
+        case VarDataType::Bool:
+          for (; i + 2 <= count; i += 2) {
+            auto bytes = _mm_cvtsi32_si128(LoadUnaligned<std::int16_t>(data + i));
+            _mm_storeu_pd(out + i, _mm_cvtepi32_pd(_mm_cvtepi8_epi32(bytes)));
+          }
+          break;
+        case VarDataType::Int32:
+        case VarDataType::Bitmask:
+          for (; i + 2 <= count; i += 2) {
+            auto values = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(data + i * 4));
+            _mm_storeu_pd(out + i, _mm_cvtepi32_pd(values));
+          }
+          break;
+        case VarDataType::Float:
+          for (; i + 2 <= count; i += 2) {
+            auto values = _mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(data + i * 4)));
+            _mm_storeu_pd(out + i, _mm_cvtps_pd(values));
+          }
+          break;
+        default:
+          break;
+      }
+
+      return i;
+    }
+
+    IRT_VAR_ARRAY_TARGET("sse4.1")
+    std::size_t Mask32SSE41(void* values, const std::int32_t* trackSurface, __m128i fallback, std::size_t count) {
+      auto dst = reinterpret_cast<__m128i*>(values);
+      auto notInWorld = _mm_set1_epi32(TrackSurfaceNotInWorld);
+      std::size_t i = 0;
+      for (; i + 4 <= count; i += 4) {
+        auto mask = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(trackSurface + i)), notInWorld);
+        _mm_storeu_si128(dst + i / 4, _mm_blendv_epi8(_mm_loadu_si128(dst + i / 4), fallback, mask));
+      }
+
+      return i;
+    }
+
+    IRT_VAR_ARRAY_TARGET("sse4.1")
+    std::size_t MaskSSE41(std::int32_t* values, const std::int32_t* trackSurface, std::int32_t fallback, std::size_t count) {
+      return Mask32SSE41(values, trackSurface, _mm_set1_epi32(fallback), count);
+    }
+
+    IRT_VAR_ARRAY_TARGET("sse4.1")
+    std::size_t MaskSSE41(float* values, const std::int32_t* trackSurface, float fallback, std::size_t count) {
+      return Mask32SSE41(values, trackSurface, _mm_castps_si128(_mm_set1_ps(fallback)), count);
+    }
+
+    IRT_VAR_ARRAY_TARGET("sse4.1")
+    std::size_t MaskSSE41(double* values, const std::int32_t* trackSurface, double fallback, std::size_t count) {
+      auto fallbacks = _mm_set1_pd(fallback);
+      auto notInWorld = _mm_set1_epi32(TrackSurfaceNotInWorld);
+      std::size_t i = 0;
+      for (; i + 2 <= count; i += 2) {
+        auto surfaces = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(trackSurface + i));
+        auto mask = _mm_castsi128_pd(_mm_cvtepi32_epi64(_mm_cmpeq_epi32(surfaces, notInWorld)));
+        _mm_storeu_pd(values + i, _mm_blendv_pd(_mm_loadu_pd(values + i), fallbacks, mask));
+      }
+
+      return i;
+    }
+
+    // AVX2, 8 x 32bit lanes
+
+    IRT_VAR_ARRAY_TARGET("avx2")
+    std::size_t ConvertAVX2(VarDataType type, const char* data, std::int32_t* out, std::size_t count) {
+      std::size_t i = 0;
+      switch (type) {
+        case VarDataType::Char:
+        case VarDataType::Bool:
+          for (; i + 8 <= count; i += 8) {
+            auto bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(data + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_cvtepi8_epi32(bytes));
+          }
+          break;
+        case VarDataType::Float: {
+          auto src = reinterpret_cast<const float*>(data);
+          for (; i + 8 <= count; i += 8) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_cvttps_epi32(_mm256_loadu_ps(src + i)));
+          }
+          break;
+        }
+        case VarDataType::Double: {
+          auto src = reinterpret_cast<const double*>(data);
+          for (; i + 8 <= count; i += 8) {
+            auto lo = _mm256_cvttpd_epi32(_mm256_loadu_pd(src + i));
+            auto hi = _mm256_cvttpd_epi32(_mm256_loadu_pd(src + i + 4));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_set_m128i(hi, lo));
+          }
+          break;
+        }
+        default:
+          break;
+      }
+
+      return i;
+    }
+
+    IRT_VAR_ARRAY_TARGET("avx2")
+    std::size_t ConvertAVX2(VarDataType type, const char* data, float* out, std::size_t count) {
+      std::size_t i = 0;
+      switch (type) {
+        case VarDataType::Char:
+        case VarDataType::Bool:
+          for (; i + 8 <= count; i += 8) {
+            auto bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(data + i));
+            _mm256_storeu_ps(out + i, _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(bytes)));
+          }
+          break;
+        case VarDataType::Int32:
+        case VarDataType::Bitmask:
+          for (; i + 8 <= count; i += 8) {
+            auto values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i * 4));
+            _mm256_storeu_ps(out + i, _mm256_cvtepi32_ps(values));
+          }
+          break;
+        case VarDataType::Double: {
+          auto src = reinterpret_cast<const double*>(data);
+          for (; i + 8 <= count; i += 8) {
+            auto lo = _mm256_cvtpd_ps(_mm256_loadu_pd(src + i));
+            auto hi = _mm256_cvtpd_ps(_mm256_loadu_pd(src + i + 4));
+            _mm256_storeu_ps(out + i, _mm256_set_m128(hi, lo));
+          }
+          break;
+        }
+        default:
+          break;
+      }
+
+      return i;
+    }
+
+    IRT_VAR_ARRAY_TARGET("avx2")
+    std::size_t ConvertAVX2(VarDataType type, const char* data, double* out, std::size_t count) {
+      std::size_t i = 0;
+      switch (type) {
+        case VarDataType::Char:
+        case VarDataType::Bool:
+          for (; i + 4 <= count; i += 4) {
+            auto bytes = _mm_cvtsi32_si128(LoadUnaligned<std::int32_t>(data + i));
+            _mm256_storeu_pd(out + i, _mm256_cvtepi32_pd(_mm_cvtepi8_epi32(bytes)));
+          }
+          break;
+        case VarDataType::Int32:
+        case VarDataType::Bitmask:
+          for (; i + 4 <= count; i += 4) {
+            auto values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i * 4));
+            _mm256_storeu_pd(out + i, _mm256_cvtepi32_pd(values));
+          }
+          break;
+        case VarDataType::Float:
+          for (; i + 4 <= count; i += 4) {
+            auto values = _mm_loadu_ps(reinterpret_cast<const float*>(data) + i);
+            _mm256_storeu_pd(out + i, _mm256_cvtps_pd(values));
+          }
+          break;
+        default:
+          break;
+      }
+
+      return i;
+    }
+
+    IRT_VAR_ARRAY_TARGET("avx2")
+    std::size_t Mask32AVX2(void* values, const std::int32_t* trackSurface, __m256i fallback, std::size_t count) {
+      auto dst = reinterpret_cast<__m256i*>(values);
+      auto notInWorld = _mm256_set1_epi32(TrackSurfaceNotInWorld);
+      std::size_t i = 0;
+      for (; i + 8 <= count; i += 8) {
+        auto mask = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(trackSurface + i)), notInWorld);
+        _mm256_storeu_si256(dst + i / 8, _mm256_blendv_epi8(_mm256_loadu_si256(dst + i / 8), fallback, mask));
+      }
+
+      return i;
+    }
+
+    IRT_VAR_ARRAY_TARGET("avx2")
+    std::size_t MaskAVX2(std::int32_t* values, const std::int32_t* trackSurface, std::int32_t fallback, std::size_t count) {
+      return Mask32AVX2(values, trackSurface, _mm256_set1_epi32(fallback), count);
+    }
+
+    IRT_VAR_ARRAY_TARGET("avx2")
+    std::size_t MaskAVX2(float* values, const std::int32_t* trackSurface, float fallback, std::size_t count) {
+      return Mask32AVX2(values, trackSurface, _mm256_castps_si256(_mm256_set1_ps(fallback)), count);
+    }
+
+    IRT_VAR_ARRAY_TARGET("avx2")
+    std::size_t MaskAVX2(double* values, const std::int32_t* trackSurface, double fallback, std::size_t count) {
+      auto fallbacks = _mm256_set1_pd(fallback);
+      auto notInWorld = _mm_set1_epi32(TrackSurfaceNotInWorld);
+      std::size_t i = 0;
+      for (; i + 4 <= count; i += 4) {
+        auto surfaces = _mm_loadu_si128(reinterpret_cast<const __m128i*>(trackSurface + i));
+        auto mask = _mm256_castsi256_pd(_mm256_cvtepi32_epi64(_mm_cmpeq_epi32(surfaces, notInWorld)));
+        _mm256_storeu_pd(values + i, _mm256_blendv_pd(_mm256_loadu_pd(values + i), fallbacks, mask));
+      }
+
+      return i;
+    }
+#endif
+
+    template <typename T>
+    void ConvertDispatch(VarDataType type, const char* data, std::span<T> out, VarArrayKernel kernel) {
+      if (out.empty() || !data) {
+        return;
+      }
+
+      auto dst = out.data();
+      auto count = out.size();
+      if (CopyNative(type, data, dst, count)) {
+        return;
+      }
+
+      std::size_t done = 0;
+#ifdef IRT_VAR_ARRAY_X86
+      // `bool` outputs are left to the scalar loop (the compiler vectorizes it)
+      if constexpr (!std::is_same_v<T, bool>) {
+        switch (GetVarArrayKernel(kernel)) {
+          case VarArrayKernel::AVX2:
+            done = ConvertAVX2(type, data, dst, count);
+            break;
+          case VarArrayKernel::SSE41:
+            done = ConvertSSE41(type, data, dst, count);
+            break;
+          default:
+            break;
+        }
+      }
+#endif
+
+      ConvertScalar(type, data, dst, done, count);
+    }
+
+    template <typename T>
+    void MaskDispatch(std::span<T> values, std::span<const std::int32_t> trackSurface, T fallback, VarArrayKernel kernel) {
+      auto dst = values.data();
+      auto count = std::min(values.size(), trackSurface.size());
+
+      std::size_t done = 0;
+#ifdef IRT_VAR_ARRAY_X86
+      if constexpr (!std::is_same_v<T, bool>) {
+        switch (GetVarArrayKernel(kernel)) {
+          case VarArrayKernel::AVX2:
+            done = MaskAVX2(dst, trackSurface.data(), fallback, count);
+            break;
+          case VarArrayKernel::SSE41:
+            done = MaskSSE41(dst, trackSurface.data(), fallback, count);
+            break;
+          default:
+            break;
+        }
+      }
+#endif
+
+      MaskScalar(dst, trackSurface.data(), fallback, done, count);
+    }
+  } // namespace
+
+  bool IsVarArrayKernelSupported(VarArrayKernel kernel) {
+    switch (kernel) {
+      case VarArrayKernel::Auto:
+      case VarArrayKernel::Scalar:
+        return true;
+#ifdef IRT_VAR_ARRAY_X86
+      case VarArrayKernel::SSE41: {
+        static const bool supported = CpuSupports(VarArrayKernel::SSE41);
+        return supported;
+      }
+      case VarArrayKernel::AVX2: {
+        static const bool supported = CpuSupports(VarArrayKernel::AVX2);
+        return supported;
+      }
+#endif
+      default:
+        return false;
+    }
+  }
+
+  VarArrayKernel GetVarArrayKernel(VarArrayKernel kernel) {
+    if (kernel != VarArrayKernel::Auto && IsVarArrayKernelSupported(kernel)) {
+      return kernel;
+    }
+
+    // Requested kernel not available (or `Auto`), step down to the widest supported one
+    for (auto candidate : {VarArrayKernel::AVX2, VarArrayKernel::SSE41}) {
+      if ((kernel == VarArrayKernel::Auto || candidate < kernel) && IsVarArrayKernelSupported(candidate)) {
+        return candidate;
+      }
+    }
+
+    return VarArrayKernel::Scalar;
+  }
+
+  void ConvertVarArray(VarDataType type, const char* data, std::span<bool> out, VarArrayKernel kernel) {
+    ConvertDispatch(type, data, out, kernel);
+  }
+
+  void ConvertVarArray(VarDataType type, const char* data, std::span<std::int32_t> out, VarArrayKernel kernel) {
+    ConvertDispatch(type, data, out, kernel);
+  }
+
+  void ConvertVarArray(VarDataType type, const char* data, std::span<float> out, VarArrayKernel kernel) {
+    ConvertDispatch(type, data, out, kernel);
+  }
+
+  void ConvertVarArray(VarDataType type, const char* data, std::span<double> out, VarArrayKernel kernel) {
+    ConvertDispatch(type, data, out, kernel);
+  }
+
+  void MaskVarArray(std::span<bool> values, std::span<const std::int32_t> trackSurface, bool fallback, VarArrayKernel kernel) {
+    MaskDispatch(values, trackSurface, fallback, kernel);
+  }
+
+  void MaskVarArray(std::span<std::int32_t> values, std::span<const std::int32_t> trackSurface, std::int32_t fallback, VarArrayKernel kernel) {
+    MaskDispatch(values, trackSurface, fallback, kernel);
+  }
+
+  void MaskVarArray(std::span<float> values, std::span<const std::int32_t> trackSurface, float fallback, VarArrayKernel kernel) {
+    MaskDispatch(values, trackSurface, fallback, kernel);
+  }
+
+  void MaskVarArray(std::span<double> values, std::span<const std::int32_t> trackSurface, double fallback, VarArrayKernel kernel) {
+    MaskDispatch(values, trackSurface, fallback, kernel);
+  }
+} // namespace IRacingTools::SDK
@@ -0,0 +1,67 @@
+#include <IRacingTools/SDK/ClientManager.h>
+#include <IRacingTools/SDK/VarBinding.h>
+
+namespace IRacingTools::SDK {
+  VarBinding::VarBinding(const std::string_view& name, ClientProvider* clientProvider) : clientProvider_(clientProvider) {
+    setVarName(name);
+  }
+
+  VarBinding::VarBinding(KnownVarName name, ClientProvider* clientProvider) : VarBinding{KnownVarNameToStringView(name), clientProvider} {
+  }
+
+  void VarBinding::setVarName(const std::string_view& name) {
+    name_ = name;
+
+    // force resolution on the next access
+    generation_ = 0;
+    data_ = nullptr;
+    count_ = 0;
+    unit_.clear();
+    description_.clear();
+  }
+
+  const std::string& VarBinding::varName() const {
+    return name_;
+  }
+
+  const std::string& VarBinding::description() {
+    refresh();
+    return description_;
+  }
+
+  const std::string& VarBinding::unit() {
+    refresh();
+    return unit_;
+  }
+
+  bool VarBinding::resolve() {
+    // Read before resolving, a bump while resolving forces another pass
+    auto generation = Client::GetBindingGeneration();
+
+    data_ = nullptr;
+    count_ = 0;
+
+    auto client = getClient();
+    if (client && client->isAvailable()) {
+      auto buffer = client->getVarDataBuffer();
+      auto idx = client->getVarIdx(name_);
+      auto header = buffer && idx && idx.value() != 0xffffffff ? client->getVarHeader(idx.value()) : std::nullopt;
+      if (header) {
+        auto varHeader = header.value();
+        type_ = varHeader->type;
+        count_ = static_cast<std::uint32_t>(varHeader->count);
+        unit_ = client->getVarUnit(idx.value()).value_or("");
+        description_ = client->getVarDesc(idx.value()).value_or("");
+        data_ = buffer + varHeader->offset;
+        onResolved();
+      }
+    }
+
+    generation_ = generation;
+    return data_ != nullptr;
+  }
+
+  std::shared_ptr<Client> VarBinding::getClient() {
+    return !clientProvider_ ? ClientManager::Get().getActive() : clientProvider_->getClient();
+  }
+} // namespace IRacingTools::SDK
@@ -29,123 +29,41 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <magic_enum.hpp>
 
 
-#include <IRacingTools/SDK/ClientManager.h>
 #include <IRacingTools/SDK/Types.h>
-#include <IRacingTools/SDK/Utils/YamlParser.h>
 #include <IRacingTools/SDK/VarHolder.h>
 
 #pragma warning(disable : 4996)
 namespace IRacingTools::SDK {
-  using namespace Utils;
   //----------------------------------
 
-  VarHolder::VarHolder(const std::string_view &name, ClientProvider *clientProvider) : clientProvider_(clientProvider) {
-    setVarName(name);
-  }
-
-  VarHolder::VarHolder(KnownVarName name, ClientProvider* clientProvider) : VarHolder{KnownVarNameToStringView(name), clientProvider} {
-  }
-
-  void VarHolder::setVarName(const std::string_view &name) {
-    reset();
-    name_ = name;
-
-    isAvailable();
-  }
-
-  bool VarHolder::reset() {
-    available_ = false;
-    unit_ = "";
-    description_ = "";
-
-    return true;
-  }
-
-  bool VarHolder::isAvailable() {
-    auto client = getClient();
-    if (!client || !client->isAvailable()) {
-      return false;
-    }
-
-    if (!available_ || !clientId_ || clientId_.value() != client->getClientId()) {
-      clientId_ = client->getClientId();
-
-      auto idx = client->getVarIdx(name_);
-      if (!idx || idx.value() == 0xffffffff) {
-        available_ = false;
-        return false;
-      }
-      idx_ = idx.value();
-
-      unit_ = client->getVarUnit(idx_).value();
-      description_ = client->getVarDesc(idx_).value();
-      available_ = true;
-    }
-
-    return available_;
-  }
-
-  std::string VarHolder::varName() {
-    return name_;
-  }
-
-  std::string VarHolder::description() {
-    return description_;
-  }
-
-  std::string VarHolder::unit() {
-    return unit_;
+  void VarHolder::onResolved() {
+    convertBool_ = GetVarValueConverter<bool>(type_);
+    convertInt_ = GetVarValueConverter<int>(type_);
+    convertFloat_ = GetVarValueConverter<float>(type_);
+    convertDouble_ = GetVarValueConverter<double>(type_);
   }
 
   VarDataType /*VarDataType*/ VarHolder::getType() {
-    if (isAvailable()) {
-      return getClient()->getVarType(idx_).value();
-    }
-    return VarDataType::Char;
+    return type();
   }
 
   uint32_t VarHolder::getCount() {
-    if (isAvailable())
-      return getClient()->getVarCount(idx_).value();
-    return 0;
-  }
-
-  bool VarHolder::isValid() {
-    return isAvailable();
+    return count();
   }
 
-
   bool VarHolder::getBool(int entry) {
-    if (isAvailable())
-      return getClient()->getVarBool(idx_, entry).value();
-    return false;
+    return getValue(convertBool_, entry);
   }
 
   int VarHolder::getInt(int entry) {
-    if (isAvailable())
-      return getClient()->getVarInt(idx_, entry).value();
-    return 0;
+    return getValue(convertInt_, entry);
   }
 
   float VarHolder::getFloat(int entry) {
-    if (isAvailable())
-      return getClient()->getVarFloat(idx_, entry).value();
-    return 0.0f;
+    return getValue(convertFloat_, entry);
   }
 
   double VarHolder::getDouble(int entry) {
-    if (isAvailable())
-      return getClient()->getVarDouble(idx_, entry).value();
-    return 0.0;
+    return getValue(convertDouble_, entry);
   }
-
-  std::shared_ptr<Client> VarHolder::getClient() {
-    return !clientProvider_ ? ClientManager::Get().getActive() : clientProvider_->getClient();
-
-
-  }
-  //void VarHolder::setClientIdProvider(const ClientIdProvider &clientIdProvider) {
-  //    clientIdProvider_ = clientIdProvider;
-  //}
-
 }
@@ -26,6 +26,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <IRacingTools/SDK/Utils/YamlParser.h>
+#include <IRacingTools/SDK/Utils/YamlPathIndex.h>
 #include <cstring>
 #include <string>
 namespace IRacingTools::SDK::Utils {
@@ -150,4 +151,9 @@ bool ParseYaml(const char *data, const std::string_view &path, const char **val,
     }
     return false;
 }
+
+bool ParseYaml(const char *data, std::int32_t updateCount, const std::string_view &path, const char **val, int *len) {
+    thread_local YamlPathCache cache{};
+    return cache.find(data, updateCount, path, val, len);
+}
 } // namespace IRacingTools::SDK::Utils
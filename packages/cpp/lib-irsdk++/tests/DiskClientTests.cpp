@@ -7,6 +7,7 @@
 #include <IRacingTools/SDK/ClientManager.h>
 #include <IRacingTools/SDK/DiskClient.h>
 #include <IRacingTools/SDK/DiskClientDataFrameProcessor.h>
+#include <IRacingTools/SDK/VarBinding.h>
 #include <IRacingTools/SDK/VarHolder.h>
 #include <fmt/core.h>
 #include <gsl/util>
@@ -104,6 +105,37 @@ TEST_F(DiskClientTests, can_open) {
   client->close();
 }
 
+TEST_F(DiskClientTests, typed_var_matches_client) {
+  auto client = CreateDiskClient(IBTTestFile1);
+  auto disposer = gsl::finally(
+    [&client] {
+      client->close();
+    });
+
+  auto provider = client->getProvider();
+  TypedVar<double> sessionTimeVar(KnownVarName::SessionTime, provider.get());
+  TypedVar<float> sessionTimeAsFloatVar(KnownVarName::SessionTime, provider.get());
+  TypedVar<int> lapVar(KnownVarName::Lap, provider.get());
+  TypedVar<double> missingVar("NotARealVariable", provider.get());
+
+  ASSERT_TRUE(sessionTimeVar.isValid());
+  EXPECT_TRUE(sessionTimeVar.is(VarDataType::Double));
+  EXPECT_FALSE(missingVar.isValid());
+  EXPECT_EQ(missingVar.get(), 0.0);
+
+  // Cached bindings keep tracking the sample buffer as the client advances
+  for (int sampleIdx = 0; sampleIdx < 100 && client->next(); sampleIdx++) {
+    EXPECT_EQ(sessionTimeVar.get(), client->getVarDouble(KnownVarName::SessionTime).value());
+    EXPECT_EQ(sessionTimeAsFloatVar.get(), client->getVarFloat(KnownVarName::SessionTime).value());
+    EXPECT_EQ(lapVar.get(), client->getVarInt(KnownVarName::Lap).value());
+  }
+
+  // Closing the client bumps the binding generation
+  client->close();
+  EXPECT_FALSE(sessionTimeVar.isValid());
+  EXPECT_FALSE(sessionTimeVar.tryGet().has_value());
+}
+
 TEST_F(DiskClientTests, aggregate_laps) {
 
   auto file = ToIBTTestFile(IBTTestFile2);
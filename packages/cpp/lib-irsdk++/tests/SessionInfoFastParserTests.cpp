@@ -0,0 +1,228 @@
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include <IRacingTools/SDK/SessionInfo/ModelFieldTables.h>
+#include <IRacingTools/SDK/SessionInfo/ModelParser.h>
+#include <IRacingTools/SDK/SessionInfo/SessionInfoFastParser.h>
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+#include <yaml-cpp/yaml.h>
+
+using namespace IRacingTools::SDK::SessionInfo;
+using namespace spdlog;
+
+namespace fs = std::filesystem;
+
+namespace {
+  std::vector<fs::path> ListRecordedSessionInfoFiles() {
+    std::vector<fs::path> files{};
+    auto recordingsDir = fs::current_path() / "data" / "ibt" / "race-recordings";
+    if (!fs::exists(recordingsDir)) {
+      return files;
+    }
+
+    for (auto& entry : fs::recursive_directory_iterator(recordingsDir)) {
+      if (entry.is_regular_file() && entry.path().extension() == ".yaml") {
+        files.push_back(entry.path());
+      }
+    }
+
+    return files;
+  }
+
+  std::string ReadTextFile(const fs::path& file) {
+    std::ifstream stream(file);
+    std::stringstream buffer;
+    buffer << stream.rdbuf();
+    return buffer.str();
+  }
+
+  bool MessagesEqual(const SessionInfoMessage& lhs, const SessionInfoMessage& rhs) {
+    return ModelsEqual(ModelDescriptor<SessionInfoMessage>::Value, &lhs, &rhs);
+  }
+
+  constexpr auto MinimalSessionInfo = R"(---
+WeekendInfo:
+ TrackName: watkinsglen 2021 fullcourse
+ TrackID: 434
+ TrackConfigName:
+ WeekendOptions:
+  NumStarters: 40
+  Restarts: double file lapped cars behind
+ TelemetryOptions:
+  TelemetryDiskFile: ""
+
+SessionInfo:
+ Sessions:
+ - SessionNum: 0
+   SessionLaps: unlimited
+   SessionTime: 180.0000 sec
+   ResultsPositions:
+   - Position: 1
+     CarIdx: 1
+ - SessionNum: 2
+   SessionType: Race
+
+SplitTimeInfo:
+ Sectors:
+ - SectorNum: 0
+   SectorStartPct: 0.000000
+ - SectorNum: 1
+   SectorStartPct: 0.405623
+
+CarSetup:
+ UpdateCount: 3
+...
+)";
+} // namespace
+
+TEST(SessionInfoFastParserTests, perfect_hash_dispatch) {
+  auto& type = ModelDescriptor<WeekendInfo>::Value;
+  for (auto& field : type.fields) {
+    EXPECT_EQ(type.find(field.key), &field);
+  }
+
+  EXPECT_EQ(type.find("NotAWeekendInfoKey"), nullptr);
+  EXPECT_EQ(type.find(""), nullptr);
+}
+
+TEST(SessionInfoFastParserTests, scalar_conversions_match_yaml_cpp) {
+  for (auto value : {"12", "-7", "+3", "0x1F", "017", "08", "1.5", "unlimited", "", "2147483648", "-2147483648"}) {
+    std::int32_t fastValue{0};
+    auto fastOk = ConvertScalar(value, fastValue);
+    auto yamlValue = YAML::Node(std::string(value)).as<std::int32_t>(0);
+    EXPECT_EQ(fastOk ? fastValue : 0, yamlValue) << "int32: " << value;
+  }
+
+  for (auto value : {"1.5", "-0.25", "+2", ".5", "1e3", "180.0000 sec", "0.000 %", "inf", ".inf", "-.Inf", "1e"}) {
+    float fastValue{0};
+    auto fastOk = ConvertScalar(value, fastValue);
+    auto yamlValue = YAML::Node(std::string(value)).as<float>(0.0f);
+    EXPECT_EQ(fastOk ? fastValue : 0.0f, yamlValue) << "float: " << value;
+  }
+
+  for (auto value : {"true", "False", "YES", "no", "On", "off", "y", "N", "tRue", "1"}) {
+    bool fastValue{false};
+    auto fastOk = ConvertScalar(value, fastValue);
+    bool yamlOk = true;
+    bool yamlValue{false};
+    try {
+      yamlValue = YAML::Node(std::string(value)).as<bool>();
+    } catch (const YAML::Exception&) {
+      yamlOk = false;
+    }
+
+    EXPECT_EQ(fastOk, yamlOk) << "bool: " << value;
+    if (fastOk && yamlOk) {
+      EXPECT_EQ(fastValue, yamlValue) << "bool: " << value;
+    }
+  }
+}
+
+TEST(SessionInfoFastParserTests, decode_minimal) {
+  SessionInfoMessage fastMessage{};
+  ASSERT_TRUE(FastDecodeSessionInfoMessage(MinimalSessionInfo, fastMessage));
+
+  auto yamlMessage = YAML::Load(MinimalSessionInfo).as<SessionInfoMessage>();
+  EXPECT_TRUE(MessagesEqual(fastMessage, yamlMessage));
+
+  EXPECT_EQ(fastMessage.weekendInfo.trackID, 434);
+  EXPECT_EQ(fastMessage.weekendInfo.trackConfigName, "null");
+  EXPECT_EQ(fastMessage.weekendInfo.weekendOptions.restarts, "double file lapped cars behind");
+  ASSERT_EQ(fastMessage.sessionInfo.sessions.size(), 2);
+  EXPECT_EQ(fastMessage.sessionInfo.sessions[0].sessionTime, "180.0000 sec");
+  EXPECT_EQ(fastMessage.sessionInfo.sessions[1].sessionType, "Race");
+  ASSERT_EQ(fastMessage.splitTimeInfo.sectors.size(), 2);
+  EXPECT_FLOAT_EQ(fastMessage.splitTimeInfo.sectors[1].sectorStartPct, 0.405623f);
+}
+
+TEST(SessionInfoFastParserTests, decode_reuses_message) {
+  SessionInfoMessage message{};
+  message.sessionInfo.sessions.resize(5);
+  message.weekendInfo.trackCity = "stale";
+
+  ASSERT_TRUE(FastDecodeSessionInfoMessage(MinimalSessionInfo, message));
+  EXPECT_EQ(message.sessionInfo.sessions.size(), 2);
+  EXPECT_TRUE(message.weekendInfo.trackCity.empty());
+}
+
+TEST(SessionInfoFastParserTests, unsupported_input_falls_back) {
+  constexpr auto AnchoredSessionInfo = R"(---
+WeekendInfo:
+ TrackName: &trackName spa
+ TrackDisplayName: *trackName
+ TrackID: 163
+ WeekendOptions:
+  NumStarters: 20
+ TelemetryOptions:
+  TelemetryDiskFile: ""
+SessionInfo:
+ Sessions:
+ - SessionNum: 0
+SplitTimeInfo:
+ Sectors:
+ - SectorNum: 0
+   SectorStartPct: 0.0
+...
+)";
+
+  SessionInfoMessage fastMessage{};
+  EXPECT_FALSE(FastDecodeSessionInfoMessage(AnchoredSessionInfo, fastMessage));
+
+  SessionInfoMessage message{};
+  DecodeSessionInfoMessage(AnchoredSessionInfo, message);
+  EXPECT_EQ(message.weekendInfo.trackName, "spa");
+  EXPECT_EQ(message.weekendInfo.trackDisplayName, "spa");
+  EXPECT_EQ(message.weekendInfo.trackID, 163);
+}
+
+TEST(SessionInfoFastParserTests, missing_required_field_rejected) {
+  // `SectorStartPct` is decoded with `as<float>()`, so yaml-cpp throws when missing
+  constexpr auto MissingRequired = R"(---
+SessionInfo:
+ Sessions:
+ - SessionNum: 0
+SplitTimeInfo:
+ Sectors:
+ - SectorNum: 0
+...
+)";
+
+  SessionInfoMessage fastMessage{};
+  EXPECT_FALSE(FastDecodeSessionInfoMessage(MissingRequired, fastMessage));
+  EXPECT_ANY_THROW(YAML::Load(MissingRequired).as<SessionInfoMessage>());
+}
+
+TEST(SessionInfoFastParserTests, conformance_recorded_session_files) {
+  auto files = ListRecordedSessionInfoFiles();
+  if (files.empty()) {
+    GTEST_SKIP() << "No recorded session info files found";
+  }
+
+  std::size_t decodedCount = 0;
+  for (auto& file : files) {
+    auto data = ReadTextFile(file);
+
+    SessionInfoMessage yamlMessage{};
+    bool yamlOk = true;
+    try {
+      yamlMessage = YAML::Load(data).as<SessionInfoMessage>();
+    } catch (const YAML::Exception&) {
+      yamlOk = false;
+    }
+
+    SessionInfoMessage fastMessage{};
+    auto fastOk = FastDecodeSessionInfoMessage(data, fastMessage);
+
+    // The fast path may only decline inputs, never disagree with yaml-cpp
+    if (fastOk) {
+      EXPECT_TRUE(yamlOk) << file.string();
+      EXPECT_TRUE(MessagesEqual(fastMessage, yamlMessage)) << file.string();
+      decodedCount++;
+    }
+  }
+
+  info("Fast decoded {} of {} recorded session info files", decodedCount, files.size());
+  EXPECT_GT(decodedCount, 0);
+}
@@ -0,0 +1,161 @@
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include <IRacingTools/SDK/VarArrayConversion.h>
+#include <IRacingTools/SDK/VarBinding.h>
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+
+using namespace IRacingTools::SDK;
+using namespace spdlog;
+
+namespace {
+  // odd on purpose, so every kernel also runs its scalar tail
+  constexpr std::size_t SampleCount = 67;
+
+  constexpr std::array Kernels = {VarArrayKernel::Scalar, VarArrayKernel::SSE41, VarArrayKernel::AVX2};
+
+  constexpr std::array SourceTypes = {
+    VarDataType::Char,
+    VarDataType::Bool,
+    VarDataType::Int32,
+    VarDataType::Bitmask,
+    VarDataType::Float,
+    VarDataType::Double
+  };
+
+  /**
+   * @brief Raw samples of `type`, mixing negatives, fractions & the
+   *   `-1` / `0` / `1` edge values (all within `int32` range)
+   */
+  std::vector<char> MakeSamples(VarDataType type, std::size_t count) {
+    std::vector<char> data(count * VarDataTypeBytes[static_cast<int>(type)]);
+    for (std::size_t i = 0; i < count; i++) {
+      auto value = (static_cast<double>(i) - 20.0) * 1.75;
+      switch (type) {
+        case VarDataType::Char:
+        case VarDataType::Bool:
+          data[i] = static_cast<char>(static_cast<int>(i * 37) - 128);
+          break;
+        case VarDataType::Int32:
+        case VarDataType::Bitmask: {
+          auto sample = static_cast<std::int32_t>(i * 104729) - 3000000;
+          std::memcpy(data.data() + i * 4, &sample, 4);
+          break;
+        }
+        case VarDataType::Float: {
+          auto sample = static_cast<float>(value);
+          std::memcpy(data.data() + i * 4, &sample, 4);
+          break;
+        }
+        case VarDataType::Double:
+          std::memcpy(data.data() + i * 8, &value, 8);
+          break;
+      }
+    }
+
+    return data;
+  }
+
+  template <typename T>
+  void ExpectMatchesScalar(VarDataType type, VarArrayKernel kernel) {
+    auto data = MakeSamples(type, SampleCount);
+    auto convert = GetVarValueConverter<T>(type);
+
+    // `std::vector<bool>` is not contiguous
+    std::unique_ptr<T[]> out(new T[SampleCount]{});
+    ConvertVarArray(type, data.data(), std::span<T>{out.get(), SampleCount}, kernel);
+    for (std::size_t i = 0; i < SampleCount; i++) {
+      ASSERT_EQ(out[i], convert(data.data(), static_cast<std::uint32_t>(i)))
+        << "type=" << static_cast<int>(type) << " kernel=" << static_cast<int>(kernel) << " i=" << i;
+    }
+  }
+} // namespace
+
+TEST(VarArrayConversionTests, kernels_match_scalar) {
+  for (auto kernel : Kernels) {
+    if (!IsVarArrayKernelSupported(kernel)) {
+      info("Kernel {} not supported, skipping", static_cast<int>(kernel));
+      continue;
+    }
+
+    for (auto type : SourceTypes) {
+      ExpectMatchesScalar<bool>(type, kernel);
+      ExpectMatchesScalar<std::int32_t>(type, kernel);
+      ExpectMatchesScalar<float>(type, kernel);
+      ExpectMatchesScalar<double>(type, kernel);
+    }
+  }
+}
+
+TEST(VarArrayConversionTests, masked_skips_not_in_world) {
+  auto data = MakeSamples(VarDataType::Float, SampleCount);
+  std::vector<std::int32_t> trackSurface(SampleCount, 3);
+  for (std::size_t i = 0; i < SampleCount; i += 3) {
+    trackSurface[i] = -1;
+  }
+
+  for (auto kernel : Kernels) {
+    std::vector<float> floats(SampleCount);
+    std::vector<double> doubles(SampleCount);
+    std::vector<std::int32_t> ints(SampleCount);
+    ConvertVarArrayMasked(VarDataType::Float, data.data(), std::span{floats}, std::span<const std::int32_t>{trackSurface}, -1.0f, kernel);
+    ConvertVarArrayMasked(VarDataType::Float, data.data(), std::span{doubles}, std::span<const std::int32_t>{trackSurface}, -1.0, kernel);
+    ConvertVarArrayMasked(VarDataType::Float, data.data(), std::span{ints}, std::span<const std::int32_t>{trackSurface}, -1, kernel);
+
+    for (std::size_t i = 0; i < SampleCount; i++) {
+      auto inWorld = trackSurface[i] != -1;
+      EXPECT_EQ(floats[i], (inWorld ? ConvertVarValue<float, float>(data.data(), i) : -1.0f)) << i;
+      EXPECT_EQ(doubles[i], (inWorld ? ConvertVarValue<double, float>(data.data(), i) : -1.0)) << i;
+      EXPECT_EQ(ints[i], (inWorld ? ConvertVarValue<std::int32_t, float>(data.data(), i) : -1)) << i;
+    }
+  }
+}
+
+TEST(VarArrayConversionTests, unsupported_kernel_steps_down) {
+  EXPECT_NE(GetVarArrayKernel(), VarArrayKernel::Auto);
+  EXPECT_EQ(GetVarArrayKernel(VarArrayKernel::Scalar), VarArrayKernel::Scalar);
+
+  auto kernel = GetVarArrayKernel(VarArrayKernel::AVX2);
+  EXPECT_TRUE(IsVarArrayKernelSupported(kernel));
+  EXPECT_EQ(kernel == VarArrayKernel::AVX2, IsVarArrayKernelSupported(VarArrayKernel::AVX2));
+}
+
+TEST(VarArrayConversionTests, benchmark_kernels) {
+  // One `CarIdx*` array per type, converted the way a 60hz consumer would
+  constexpr std::size_t Cars = 64;
+  constexpr int Iterations = 20000;
+
+  for (auto type : {VarDataType::Int32, VarDataType::Float, VarDataType::Double}) {
+    auto data = MakeSamples(type, Cars);
+    std::array<float, Cars> floats{};
+    std::array<std::int32_t, Cars> trackSurface{};
+    trackSurface[5] = -1;
+
+    for (auto kernel : Kernels) {
+      if (!IsVarArrayKernelSupported(kernel)) {
+        continue;
+      }
+
+      auto start = std::chrono::steady_clock::now();
+      for (int iteration = 0; iteration < Iterations; iteration++) {
+        ConvertVarArrayMasked(type, data.data(), std::span{floats}, std::span<const std::int32_t>{trackSurface}, -1.0f, kernel);
+      }
+
+      auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+      info(
+        "ConvertVarArrayMasked<float> type={} kernel={} {:.1f}ns per {} cars",
+        static_cast<int>(type),
+        static_cast<int>(kernel),
+        elapsed / Iterations,
+        Cars
+      );
+
+      EXPECT_EQ(floats[5], -1.0f);
+    }
+  }
+}
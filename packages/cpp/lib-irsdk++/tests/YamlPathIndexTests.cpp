@@ -0,0 +1,217 @@
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include <IRacingTools/SDK/Utils/YamlParser.h>
+#include <IRacingTools/SDK/Utils/YamlPathIndex.h>
+#include <fmt/core.h>
+#include <gtest/gtest.h>
+
+using namespace IRacingTools::SDK::Utils;
+
+namespace fs = std::filesystem;
+
+namespace {
+  constexpr auto SessionInfoSample = R"(---
+WeekendInfo:
+ TrackName: watkinsglen 2021 fullcourse
+ TrackID: 434
+ TrackConfigName:
+ WeekendOptions:
+  NumStarters: 40
+
+DriverInfo:
+ DriverCarIdx: 1
+ Drivers:
+ - CarIdx: 0
+   UserName: Pace Car
+   CarNumber: "0"
+ - CarIdx: 1
+   UserName: Jonathan Glanz
+   CarNumber: "64"
+   TeamName: Jonathan Glanz
+ - CarIdx: 2
+   CarNumber: "7"
+
+SplitTimeInfo:
+ Sectors:
+ - SectorNum: 0
+   SectorStartPct: 0.000000
+...
+)";
+
+  std::optional<std::string_view> ScanYaml(const char* data, std::string_view path) {
+    const char* val = nullptr;
+    int len = 0;
+    if (!ParseYaml(data, path, &val, &len)) {
+      return std::nullopt;
+    }
+
+    return std::string_view{val, static_cast<std::size_t>(len)};
+  }
+
+  std::vector<fs::path> ListRecordedSessionInfoFiles(std::size_t maxFiles) {
+    std::vector<fs::path> files{};
+    auto recordingsDir = fs::current_path() / "data" / "ibt" / "race-recordings";
+    if (!fs::exists(recordingsDir)) {
+      return files;
+    }
+
+    for (auto& entry : fs::recursive_directory_iterator(recordingsDir)) {
+      if (entry.is_regular_file() && entry.path().extension() == ".yaml") {
+        files.push_back(entry.path());
+      }
+    }
+
+    std::ranges::sort(files);
+    if (files.size() > maxFiles) {
+      files.resize(maxFiles);
+    }
+
+    return files;
+  }
+
+  std::string ReadTextFile(const fs::path& file) {
+    std::ifstream stream(file);
+    std::stringstream buffer;
+    buffer << stream.rdbuf();
+    return buffer.str();
+  }
+
+  /**
+   * @brief Build the path of every keyed line (ancestor keys, with a `{value}`
+   *   filter on list items), plus a few variants that should miss
+   */
+  std::vector<std::string> CollectPaths(const std::string& data) {
+    struct Ancestor {
+      std::size_t depth;
+      std::string segment;
+    };
+
+    std::vector<std::string> paths{};
+    std::vector<Ancestor> ancestors{};
+    std::istringstream stream(data);
+    std::string line;
+    while (std::getline(stream, line)) {
+      auto keyStart = line.find_first_not_of(" -");
+      auto colon = line.find(':');
+      if (keyStart == std::string::npos || colon == std::string::npos || colon < keyStart) {
+        continue;
+      }
+
+      auto isItem = line.find('-') < keyStart;
+      auto key = line.substr(keyStart, colon + 1 - keyStart);
+      auto value = colon + 2 <= line.size() ? line.substr(colon + 2) : std::string{};
+      while (!ancestors.empty() && ancestors.back().depth >= keyStart) {
+        ancestors.pop_back();
+      }
+
+      std::string parentPath{};
+      for (auto& ancestor : ancestors) {
+        parentPath += ancestor.segment;
+      }
+
+      auto segment = isItem ? fmt::format("{}{{{}}}", key, value) : key;
+      paths.push_back(parentPath + key);
+      paths.push_back(parentPath + segment);
+      paths.push_back(parentPath + "Missing" + key);
+      ancestors.push_back({keyStart, segment});
+    }
+
+    return paths;
+  }
+} // namespace
+
+TEST(YamlPathIndexTests, find_paths) {
+  YamlPathIndex index(SessionInfoSample);
+
+  EXPECT_EQ(index.find("WeekendInfo:TrackID:"), "434");
+  EXPECT_EQ(index.find("WeekendInfo:WeekendOptions:NumStarters:"), "40");
+  EXPECT_EQ(index.find("DriverInfo:Drivers:CarIdx:{1}UserName:"), "Jonathan Glanz");
+  EXPECT_EQ(index.find("DriverInfo:Drivers:CarIdx:{1}CarNumber:"), "\"64\"");
+  EXPECT_EQ(index.find("DriverInfo:Drivers:CarIdx:{2}"), "2");
+  EXPECT_EQ(index.find("SplitTimeInfo:Sectors:SectorNum:{0}SectorStartPct:"), "0.000000");
+
+  EXPECT_FALSE(index.find("DriverInfo:Drivers:CarIdx:{5}UserName:"));
+  EXPECT_FALSE(index.find("DriverInfo:TrackID:"));
+  EXPECT_FALSE(index.find("NotAKey:"));
+  EXPECT_FALSE(index.find(""));
+
+  // Empty values resolve to a zero length value
+  auto trackConfigName = index.find("WeekendInfo:TrackConfigName:");
+  ASSERT_TRUE(trackConfigName);
+  EXPECT_TRUE(trackConfigName->empty());
+}
+
+TEST(YamlPathIndexTests, matches_scanner_quirks) {
+  YamlPathIndex index(SessionInfoSample);
+
+  // `ParseYaml` searches forward (not only direct children) until the
+  // block closes, so a later list item can satisfy the path
+  EXPECT_EQ(index.find("DriverInfo:Drivers:CarIdx:{2}TeamName:"), ScanYaml(SessionInfoSample, "DriverInfo:Drivers:CarIdx:{2}TeamName:"));
+  EXPECT_EQ(index.find("DriverInfo:Drivers:CarIdx:{0}TeamName:"), "Jonathan Glanz");
+  EXPECT_EQ(index.find("DriverInfo:Drivers:CarIdx:{2}TeamName:"), std::nullopt);
+
+  // Top level blocks never close (depth can not drop below 0)
+  EXPECT_EQ(index.find("WeekendInfo:DriverCarIdx:"), ScanYaml(SessionInfoSample, "WeekendInfo:DriverCarIdx:"));
+  EXPECT_EQ(index.find("WeekendInfo:DriverCarIdx:"), "1");
+  EXPECT_EQ(index.find("TrackID:"), "434");
+}
+
+TEST(YamlPathIndexTests, cache_rebuilds_on_update_count) {
+  std::string data = SessionInfoSample;
+  YamlPathCache cache{};
+
+  auto& index = cache.update(data.c_str(), 1);
+  EXPECT_EQ(index.find("WeekendInfo:TrackID:"), "434");
+
+  // Same update count, the index is kept & values are read from the live buffer
+  data.replace(data.find("434"), 3, "999");
+  EXPECT_EQ(cache.update(data.c_str(), 1).find("WeekendInfo:TrackID:"), "999");
+  EXPECT_EQ(&cache.update(data.c_str(), 1), &index);
+
+  // ... so keys changed without an update count bump are not seen
+  data.replace(data.find("TrackID"), 7, "TrackId");
+  EXPECT_FALSE(cache.update(data.c_str(), 1).find("WeekendInfo:TrackId:"));
+  EXPECT_EQ(cache.update(data.c_str(), 2).find("WeekendInfo:TrackId:"), "999");
+
+  const char* val = nullptr;
+  int len = 0;
+  ASSERT_TRUE(ParseYaml(data.c_str(), 2, "DriverInfo:DriverCarIdx:", &val, &len));
+  EXPECT_EQ(std::string_view(val, len), "1");
+}
+
+TEST(YamlPathIndexTests, conformance_recorded_session_files) {
+  auto files = ListRecordedSessionInfoFiles(4);
+  if (files.empty()) {
+    GTEST_SKIP() << "No recorded session info files found";
+  }
+
+  for (auto& file : files) {
+    auto data = ReadTextFile(file);
+    YamlPathIndex index(data);
+
+    auto paths = CollectPaths(data);
+    ASSERT_FALSE(paths.empty()) << file.string();
+
+    for (std::size_t idx = 0; idx < paths.size(); idx += 5) {
+      auto& path = paths[idx];
+      const char* scanVal = nullptr;
+      int scanLen = 0;
+      auto scanFound = ParseYaml(data.c_str(), path, &scanVal, &scanLen);
+
+      const char* indexVal = nullptr;
+      int indexLen = 0;
+      auto indexFound = index.find(path, &indexVal, &indexLen);
+
+      ASSERT_EQ(indexFound, scanFound) << file.string() << " " << path;
+      if (scanFound) {
+        EXPECT_EQ(indexLen, scanLen) << file.string() << " " << path;
+        if (scanLen) {
+          EXPECT_EQ(indexVal, scanVal) << file.string() << " " << path;
+        }
+      }
+    }
+  }
+}
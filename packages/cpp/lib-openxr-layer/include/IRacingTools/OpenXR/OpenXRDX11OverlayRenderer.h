@@ -35,6 +35,9 @@ namespace IRacingTools::OpenXR::DX11 {
         // Usually wanted for non-VR as we're rendering on top of the
         // application's swapchain texture
         Overlay,
+        // Only the given (changed) layers are cleared & redrawn over the
+        // previous render, needs `SwapchainResources::composite`
+        Update,
     };
 
 
@@ -49,6 +52,10 @@ namespace IRacingTools::OpenXR::DX11 {
     struct SwapchainResources {
         PixelSize dimensions;
         std::vector<SwapchainBufferResources> bufferResources;
+
+        // Holds the previous render, then copied into the acquired image
+        std::optional<SwapchainBufferResources> composite{};
+        winrt::com_ptr<ID3D11Texture2D> compositeTexture{};
     };
 
     class OpenXRDX11OverlayRenderer {
@@ -65,6 +72,7 @@ namespace IRacingTools::OpenXR::DX11 {
         );
 
     private:
+        winrt::com_ptr<ID3D11DeviceContext1> context_;
         std::unique_ptr<Graphics::SpriteBatch> spriteBatch_;
     };
 }
@@ -22,6 +22,7 @@
 
 
 #include <IRacingTools/Shared/SHM/SHMDX11.h>
+#include <IRacingTools/Shared/SHM/SHMOverlayRenderCache.h>
 #include <IRacingTools/Shared/Timer.h>
 #include <IRacingTools/Shared/UI/ViewerWindowRenderer.h>
 
@@ -97,11 +98,17 @@ namespace IRacingTools::OpenXR {
         // Release any buffers, views, caches etc, but do not destroy the swap chain
         virtual void releaseSwapchainResources(XrSwapchain) = 0;
 
+        /**
+         * @param layers the layers to draw
+         * @param redrawAll clear & draw `layers` only, otherwise `layers`
+         *   are the changed ones & are drawn over the previous render
+         */
         virtual void renderLayers(
             XrSwapchain swapchain,
             uint32_t swapchainTextureIndex,
             const SHM::Snapshot& snapshot,
-            const std::span<SHM::LayerSprite>& layers
+            const std::span<SHM::LayerSprite>& layers,
+            bool redrawAll
         ) = 0;
         virtual SHM::SHMCachedReader* getSHM() = 0;
 
@@ -121,7 +128,7 @@ namespace IRacingTools::OpenXR {
 
         XrSwapchain swapchain_{};
         PixelSize swapchainDimensions_;
-        std::array<uint64_t, MaxViewCount> renderCacheKeys_{};
+        SHM::SHMOverlayRenderCache renderCache_{};
 
         XrSpace localSpace_ = nullptr;
         XrSpace viewSpace_ = nullptr;
@@ -161,7 +168,8 @@ namespace IRacingTools::OpenXR {
                 XrSwapchain swapchain,
                 uint32_t swapchainTextureIndex,
                 const SHM::Snapshot& snapshot,
-                const std::span<SHM::LayerSprite>& layers
+                const std::span<SHM::LayerSprite>& layers,
+                bool redrawAll
             ) override;
 
         private:
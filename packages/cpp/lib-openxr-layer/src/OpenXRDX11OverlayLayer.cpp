@@ -184,9 +184,27 @@ XrSwapchain OpenXRDX11OverlayLayer::createSwapchain(
     buffers.emplace_back(device_.get(), image.texture, formats.renderTargetViewFormat);
   }
 
+  // LAYERS ARE DRAWN INTO A TEXTURE OF OUR OWN & COPIED INTO THE ACQUIRED
+  // IMAGE, SWAPCHAIN IMAGES ARE NOT GUARANTEED TO KEEP THEIR CONTENT, SO
+  // UNCHANGED LAYERS COULD NOT BE SKIPPED OTHERWISE
+  D3D11_TEXTURE2D_DESC compositeDesc {
+    .Width = size.width(),
+    .Height = size.height(),
+    .MipLevels = 1,
+    .ArraySize = 1,
+    .Format = formats.renderTargetViewFormat,
+    .SampleDesc = {1, 0},
+    .BindFlags = D3D11_BIND_RENDER_TARGET,
+  };
+  winrt::com_ptr<ID3D11Texture2D> compositeTexture;
+  check_hresult(device_->CreateTexture2D(&compositeDesc, nullptr, compositeTexture.put()));
+
   swapchainResources_[swapchain] = {
     .dimensions = size,
     .bufferResources = std::move(buffers),
+    .composite = std::make_optional<SwapchainBufferResources>(
+      device_.get(), compositeTexture.get(), formats.renderTargetViewFormat),
+    .compositeTexture = std::move(compositeTexture),
   };
 
   return swapchain;
@@ -202,7 +220,8 @@ void OpenXRDX11OverlayLayer::renderLayers(
   XrSwapchain swapchain,
   uint32_t swapchainTextureIndex,
   const SHM::Snapshot& snapshot,
-  const std::span<SHM::LayerSprite>& layers) {
+  const std::span<SHM::LayerSprite>& layers,
+  bool redrawAll) {
   VRK_TraceLoggingScope("OpenXRDX11Layer::RenderLayers()");
   Graphics::SavedState savedState(immediateContext_);
 
@@ -213,7 +232,7 @@ void OpenXRDX11OverlayLayer::renderLayers(
     swapchainTextureIndex,
     snapshot,
     layers,
-    RenderMode::ClearAndRender);
+    redrawAll ? RenderMode::ClearAndRender : RenderMode::Update);
 }
 
 SHM::SHMCachedReader* OpenXRDX11OverlayLayer::getSHM() {
@@ -28,6 +28,10 @@ namespace IRacingTools::OpenXR::DX11 {
     }
 
     OpenXRDX11OverlayRenderer::OpenXRDX11OverlayRenderer(ID3D11Device* device) {
+        winrt::com_ptr<ID3D11DeviceContext> context;
+        device->GetImmediateContext(context.put());
+        context_ = context.as<ID3D11DeviceContext1>();
+
         spriteBatch_ = std::make_unique<Graphics::SpriteBatch>(device);
     }
 
@@ -44,7 +48,23 @@ namespace IRacingTools::OpenXR::DX11 {
 
         const auto& br = sr.bufferResources.at(swapchainTextureIndex);
 
-        auto dest = br.renderTargetView.get();
+        auto dest = sr.composite ? sr.composite->renderTargetView.get() : br.renderTargetView.get();
+
+        // CHANGED LAYERS ARE DRAWN WITH ALPHA, SO THEIR OLD PIXELS GO FIRST
+        if (renderMode == RenderMode::Update && !layers.empty()) {
+            std::vector<D3D11_RECT> rects;
+            rects.reserve(layers.size());
+            for (const auto& layer: layers) {
+                rects.push_back({
+                    static_cast<LONG>(layer.destRect.left()),
+                    static_cast<LONG>(layer.destRect.top()),
+                    static_cast<LONG>(layer.destRect.right()),
+                    static_cast<LONG>(layer.destRect.bottom()),
+                });
+            }
+
+            context_->ClearView(dest, DirectX::Colors::Transparent, rects.data(), static_cast<UINT>(rects.size()));
+        }
 
         spriteBatch_->begin(dest, sr.dimensions);
 
@@ -64,5 +84,9 @@ namespace IRacingTools::OpenXR::DX11 {
             spriteBatch_->draw(source, layer.sourceRect, layer.destRect, layerTint);
         }
         spriteBatch_->end();
+
+        if (sr.composite) {
+            context_->CopyResource(br.texture, sr.composite->texture);
+        }
     }
 }
\ No newline at end of file
@@ -236,6 +236,7 @@ namespace IRacingTools::OpenXR {
                 this->releaseSwapchainResources(swapchain_);
                 openXR_->xrDestroySwapchain(swapchain_);
                 swapchain_ = {};
+                renderCache_.reset();
             }
         }
 
@@ -287,12 +288,11 @@ namespace IRacingTools::OpenXR {
 
         uint8_t topMost = overlayLayerCount - 1;
 
-        bool needRender = config.vr.quirks.alwaysUpdateSwapchain;
         std::vector<SHM::LayerSprite> layerSprites;
-        std::vector<uint64_t> cacheKeys;
+        std::vector<SHM::SHMOverlayRenderCache::Entry> cacheEntries;
         std::vector<XrCompositionLayerQuad> addedXRLayers;
         layerSprites.reserve(overlayLayerCount);
-        cacheKeys.reserve(overlayLayerCount);
+        cacheEntries.reserve(overlayLayerCount);
         addedXRLayers.reserve(overlayLayerCount);
 
         for (size_t overlayIdx = 0; overlayIdx < overlayLayerCount; ++overlayIdx) {
@@ -302,11 +302,17 @@ namespace IRacingTools::OpenXR {
                 L->debug("Ignoring layer ({}) as it has not been updated in {}ms", overlayIdx, maxFrameMillis - layer->updatedAt);
               continue;
             }
-            cacheKeys.push_back(params.cacheKey);
             PixelRect destRect{
                 Graphics::Spriting::GetOffset(overlayIdx, snapshot.getOverlayCount()),
                 layer->locationOnTexture.size(),
             };
+            cacheEntries.push_back({
+                static_cast<uint32_t>(overlayIdx),
+                SHM::SHMOverlayRenderCache::Combine(
+                    SHM::SHMOverlayRenderCache::Combine(params.cacheKey, destRect.left()),
+                    destRect.top()
+                )
+            });
             // using Upscaling = VRConfig::Quirks::Upscaling;
             // switch (config.vr.quirks.openXR_Upscaling) {
             //   case Upscaling::Automatic:
@@ -330,11 +336,6 @@ namespace IRacingTools::OpenXR {
                 }
             );
 
-            if (params.cacheKey != renderCacheKeys_.at(overlayIdx)) {
-                needRender = true;
-            }
-            // needRender = true;
-
             static_assert(
                 SHM::SHARED_TEXTURE_IS_PREMULTIPLIED,
                 "Use premultiplied alpha in shared texture, or pass " "XR_COMPOSITION_LAYER_UNPREMULTIPLIED_ALPHA_BIT"
@@ -380,7 +381,19 @@ namespace IRacingTools::OpenXR {
             std::swap(addedXRLayers.back(), addedXRLayers.at(topMost));
         }
 
-        if (needRender) {
+        // ONLY OVERLAYS WHOSE CONTENT, PLACEMENT OR OPACITY CHANGED ARE
+        // REDRAWN, A RESUBMIT OF THE SAME CONTENT REDRAWS NOTHING
+        const auto cacheDiff = renderCache_.diff(cacheEntries);
+        const auto redrawAll = cacheDiff.full || config.vr.quirks.alwaysUpdateSwapchain;
+        if (redrawAll || !cacheDiff.empty()) {
+            std::vector<SHM::LayerSprite> changedSprites;
+            if (!redrawAll) {
+                changedSprites.reserve(cacheDiff.changed.size());
+                for (auto idx : cacheDiff.changed) {
+                    changedSprites.push_back(layerSprites.at(idx));
+                }
+            }
+
             uint32_t swapchainTextureIndex;
             {
                 VRK_TraceLoggingScope("AcquireSwapchainImage");
@@ -398,7 +411,13 @@ namespace IRacingTools::OpenXR {
 
             {
                 VRK_TraceLoggingScope("RenderLayers()");
-                this->renderLayers(swapchain_, swapchainTextureIndex, snapshot, layerSprites);
+                this->renderLayers(
+                    swapchain_,
+                    swapchainTextureIndex,
+                    snapshot,
+                    redrawAll ? std::span(layerSprites) : std::span(changedSprites),
+                    redrawAll
+                );
             }
 
             {
@@ -406,9 +425,7 @@ namespace IRacingTools::OpenXR {
                 check_xrresult(openXR_->xrReleaseSwapchainImage(swapchain_, nullptr));
             }
 
-            for (size_t i = 0; i < cacheKeys.size(); ++i) {
-                renderCacheKeys_[i] = cacheKeys.at(i);
-            }
+            renderCache_.update(cacheEntries);
         }
 
         XrFrameEndInfo nextFrameEndInfo{*frameEndInfo};
@@ -466,7 +483,7 @@ namespace IRacingTools::OpenXR {
         // const auto kneeboardPose = this->getKneeboardPose(config.vr, ofc, hmdPose);
         // const auto isLookingAtKneeboard = this->isLookingAtKneeboard(config, ofc, hmdPose, kneeboardPose);
 
-        auto cacheKey = snapshot.getRenderCacheKey();
+        auto cacheKey = snapshot.getOverlayRenderCacheKey(ofc);
         cacheKey &= ~static_cast<size_t>(1);
 
 
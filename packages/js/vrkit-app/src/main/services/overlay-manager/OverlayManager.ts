@@ -640,7 +640,11 @@ export class OverlayManager {
       )
       .getOrNull()
 
-    return (image: NativeImage) => {
+    // `dirty` IS RELATIVE TO THE PREVIOUS PAINT, SO AFTER A DROPPED FRAME
+    // NATIVE HAS TO DIFF AGAINST THE LAST FRAME IT ACTUALLY RECEIVED
+    let droppedFrame = false
+
+    return (image: NativeImage, dirty?: Electron.Rectangle) => {
       const buf = image.getBitmap(),
         nativeImageSize = image.getSize(),
         vrLayout = toJS(win.placement.vrLayout),
@@ -662,6 +666,7 @@ export class OverlayManager {
       }
 
       if (!this.nativeManager_) {
+        droppedFrame = true
         return
       }
 
@@ -677,6 +682,7 @@ export class OverlayManager {
           )
         }
 
+        droppedFrame = true
         return
       }
 
@@ -687,7 +693,8 @@ export class OverlayManager {
         screenRect,
         vrLayout
       )
-      this.nativeManager_.processFrame(win.uniqueId, buf)
+      this.nativeManager_.processFrame(win.uniqueId, buf, droppedFrame ? undefined : dirty)
+      droppedFrame = false
     }
   }
 
@@ -701,16 +708,16 @@ export class OverlayManager {
   createOnPaintHandler(win: OverlayBrowserWindow) {
     const frameProcessor = this.createFrameProcessor(win, "paint")
 
-    return (_ev: Electron.Event, _dirty: Electron.Rectangle, image: NativeImage) => {
-      frameProcessor(image)
+    return (_ev: Electron.Event, dirty: Electron.Rectangle, image: NativeImage) => {
+      frameProcessor(image, dirty)
     }
   }
 
   private createOnFrameHandler(config: DashboardConfig, targetPlacement: OverlayPlacement, win: OverlayBrowserWindow) {
     const frameProcessor = this.createFrameProcessor(win, "frame")
 
-    return (image: NativeImage, _dirty: Electron.Rectangle) => {
-      frameProcessor(image)
+    return (image: NativeImage, dirty: Electron.Rectangle) => {
+      frameProcessor(image, dirty)
     }
   }
 
@@ -372,7 +372,10 @@ export class PluginClientLauncher {
           return this.trackManager.getLapTrajectory(trackLayoutId)
         },
         getTrackMap: (trackLayoutId: string) => {
-          return this.trackManager.getTrackMapFromLapTrajectory(trackLayoutId)
+          // DETAIL MATCHING THE OVERLAY'S SIZE, BOTH SCREEN & VR ARE RENDERED AT IT
+          const size = this.getConfig()?.placement?.screenRect?.size,
+            maxSize = size ? Math.max(size.width, size.height) : undefined
+          return this.trackManager.getTrackMapFromLapTrajectory(trackLayoutId, maxSize > 0 ? maxSize : undefined)
         },
         on: <T extends keyof IPluginClientEventArgs, Fn extends IPluginClientEventArgs[T] = IPluginClientEventArgs[T]>(
           type: T,
@@ -251,9 +251,11 @@ export class TrackManager extends EventEmitter3<TrackManagerEventArgs> {
    * Get a track map from lap trajectory or id
    *
    * @param idOrTrajectory
+   * @param maxSize largest overlay side (pixels) the map is drawn at,
+   *   picks the matching level of detail
    * @returns {Promise<TrackMap>}
    */
-  async getTrackMapFromLapTrajectory(idOrTrajectory: string | LapTrajectory) {
+  async getTrackMapFromLapTrajectory(idOrTrajectory: string | LapTrajectory, maxSize?: number) {
     let trajectory: LapTrajectory
     if (isString(idOrTrajectory)) {
       trajectory = await this.getLapTrajectory(idOrTrajectory)
@@ -262,7 +264,7 @@ export class TrackManager extends EventEmitter3<TrackManagerEventArgs> {
     }
 
     const converter = new LapTrajectoryConverter(20)
-    return converter.toTrackMap(trajectory)
+    return converter.toTrackMap(trajectory, maxSize)
   }
 }
 
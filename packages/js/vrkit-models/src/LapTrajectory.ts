@@ -37,6 +37,16 @@ export interface LapTrajectory {
      * @generated from protobuf field: repeated IRacingTools.Models.LapCoordinate path = 20;
      */
     path: LapCoordinate[];
+    /**
+     * Ordered by descending `max_size`
+     *
+     * @generated from protobuf field: repeated IRacingTools.Models.LapTrajectory.LevelOfDetail levels_of_detail = 21;
+     */
+    levelsOfDetail: LapTrajectory_LevelOfDetail[];
+    /**
+     * @generated from protobuf field: IRacingTools.Models.LapTrajectory.PositionLookupTable position_lookup_table = 22;
+     */
+    positionLookupTable?: LapTrajectory_PositionLookupTable;
 }
 /**
  * @generated from protobuf message IRacingTools.Models.LapTrajectory.Metadata
@@ -59,6 +69,58 @@ export interface LapTrajectory_Metadata {
      */
     valid: boolean;
 }
+/**
+ * Simplified copy of `path`, deviating at most `pixel_tolerance`
+ * pixels from it when the track is drawn `max_size` pixels across
+ *
+ * @generated from protobuf message IRacingTools.Models.LapTrajectory.LevelOfDetail
+ */
+export interface LapTrajectory_LevelOfDetail {
+    /**
+     * @generated from protobuf field: uint32 max_size = 1;
+     */
+    maxSize: number;
+    /**
+     * @generated from protobuf field: float pixel_tolerance = 2;
+     */
+    pixelTolerance: number;
+    /**
+     * @generated from protobuf field: float tolerance_meters = 3;
+     */
+    toleranceMeters: number;
+    /**
+     * @generated from protobuf field: repeated IRacingTools.Models.LapCoordinate path = 10;
+     */
+    path: LapCoordinate[];
+}
+/**
+ * `LapDistPct` -> position at `bin_count` uniform steps (plus a closing
+ * copy of the first), north up & normalized so the longest side is `1`
+ *
+ * @generated from protobuf message IRacingTools.Models.LapTrajectory.PositionLookupTable
+ */
+export interface LapTrajectory_PositionLookupTable {
+    /**
+     * @generated from protobuf field: uint32 bin_count = 1;
+     */
+    binCount: number;
+    /**
+     * @generated from protobuf field: float width = 2;
+     */
+    width: number;
+    /**
+     * @generated from protobuf field: float height = 3;
+     */
+    height: number;
+    /**
+     * @generated from protobuf field: repeated float x = 10;
+     */
+    x: number[];
+    /**
+     * @generated from protobuf field: repeated float y = 11;
+     */
+    y: number[];
+}
 // @generated message type with reflection information, may provide speed optimized methods
 class LapTrajectory$Type extends MessageType<LapTrajectory> {
     constructor() {
@@ -67,13 +129,16 @@ class LapTrajectory$Type extends MessageType<LapTrajectory> {
             { no: 2, name: "track_layout_metadata", kind: "message", T: () => TrackLayoutMetadata },
             { no: 3, name: "file_info", kind: "message", T: () => FileInfo },
             { no: 5, name: "timestamp", kind: "scalar", T: 3 /*ScalarType.INT64*/, L: 0 /*LongType.BIGINT*/ },
-            { no: 20, name: "path", kind: "message", repeat: 1 /*RepeatType.PACKED*/, T: () => LapCoordinate }
+            { no: 20, name: "path", kind: "message", repeat: 1 /*RepeatType.PACKED*/, T: () => LapCoordinate },
+            { no: 21, name: "levels_of_detail", kind: "message", repeat: 1 /*RepeatType.PACKED*/, T: () => LapTrajectory_LevelOfDetail },
+            { no: 22, name: "position_lookup_table", kind: "message", T: () => LapTrajectory_PositionLookupTable }
         ]);
     }
     create(value?: PartialMessage<LapTrajectory>): LapTrajectory {
         const message = globalThis.Object.create((this.messagePrototype!));
         message.timestamp = 0n;
         message.path = [];
+        message.levelsOfDetail = [];
         if (value !== undefined)
             reflectionMergePartial<LapTrajectory>(this, message, value);
         return message;
@@ -98,6 +163,12 @@ class LapTrajectory$Type extends MessageType<LapTrajectory> {
                 case /* repeated IRacingTools.Models.LapCoordinate path */ 20:
                     message.path.push(LapCoordinate.internalBinaryRead(reader, reader.uint32(), options));
                     break;
+                case /* repeated IRacingTools.Models.LapTrajectory.LevelOfDetail levels_of_detail */ 21:
+                    message.levelsOfDetail.push(LapTrajectory_LevelOfDetail.internalBinaryRead(reader, reader.uint32(), options));
+                    break;
+                case /* IRacingTools.Models.LapTrajectory.PositionLookupTable position_lookup_table */ 22:
+                    message.positionLookupTable = LapTrajectory_PositionLookupTable.internalBinaryRead(reader, reader.uint32(), options, message.positionLookupTable);
+                    break;
                 default:
                     let u = options.readUnknownField;
                     if (u === "throw")
@@ -125,6 +196,12 @@ class LapTrajectory$Type extends MessageType<LapTrajectory> {
         /* repeated IRacingTools.Models.LapCoordinate path = 20; */
         for (let i = 0; i < message.path.length; i++)
             LapCoordinate.internalBinaryWrite(message.path[i], writer.tag(20, WireType.LengthDelimited).fork(), options).join();
+        /* repeated IRacingTools.Models.LapTrajectory.LevelOfDetail levels_of_detail = 21; */
+        for (let i = 0; i < message.levelsOfDetail.length; i++)
+            LapTrajectory_LevelOfDetail.internalBinaryWrite(message.levelsOfDetail[i], writer.tag(21, WireType.LengthDelimited).fork(), options).join();
+        /* IRacingTools.Models.LapTrajectory.PositionLookupTable position_lookup_table = 22; */
+        if (message.positionLookupTable)
+            LapTrajectory_PositionLookupTable.internalBinaryWrite(message.positionLookupTable, writer.tag(22, WireType.LengthDelimited).fork(), options).join();
         let u = options.writeUnknownFields;
         if (u !== false)
             (u == true ? UnknownFieldHandler.onWrite : u)(this.typeName, message, writer);
@@ -206,3 +283,169 @@ class LapTrajectory_Metadata$Type extends MessageType<LapTrajectory_Metadata> {
  * @generated MessageType for protobuf message IRacingTools.Models.LapTrajectory.Metadata
  */
 export const LapTrajectory_Metadata = new LapTrajectory_Metadata$Type();
+// @generated message type with reflection information, may provide speed optimized methods
+class LapTrajectory_LevelOfDetail$Type extends MessageType<LapTrajectory_LevelOfDetail> {
+    constructor() {
+        super("IRacingTools.Models.LapTrajectory.LevelOfDetail", [
+            { no: 1, name: "max_size", kind: "scalar", T: 13 /*ScalarType.UINT32*/ },
+            { no: 2, name: "pixel_tolerance", kind: "scalar", T: 2 /*ScalarType.FLOAT*/ },
+            { no: 3, name: "tolerance_meters", kind: "scalar", T: 2 /*ScalarType.FLOAT*/ },
+            { no: 10, name: "path", kind: "message", repeat: 1 /*RepeatType.PACKED*/, T: () => LapCoordinate }
+        ]);
+    }
+    create(value?: PartialMessage<LapTrajectory_LevelOfDetail>): LapTrajectory_LevelOfDetail {
+        const message = globalThis.Object.create((this.messagePrototype!));
+        message.maxSize = 0;
+        message.pixelTolerance = 0;
+        message.toleranceMeters = 0;
+        message.path = [];
+        if (value !== undefined)
+            reflectionMergePartial<LapTrajectory_LevelOfDetail>(this, message, value);
+        return message;
+    }
+    internalBinaryRead(reader: IBinaryReader, length: number, options: BinaryReadOptions, target?: LapTrajectory_LevelOfDetail): LapTrajectory_LevelOfDetail {
+        let message = target ?? this.create(), end = reader.pos + length;
+        while (reader.pos < end) {
+            let [fieldNo, wireType] = reader.tag();
+            switch (fieldNo) {
+                case /* uint32 max_size */ 1:
+                    message.maxSize = reader.uint32();
+                    break;
+                case /* float pixel_tolerance */ 2:
+                    message.pixelTolerance = reader.float();
+                    break;
+                case /* float tolerance_meters */ 3:
+                    message.toleranceMeters = reader.float();
+                    break;
+                case /* repeated IRacingTools.Models.LapCoordinate path */ 10:
+                    message.path.push(LapCoordinate.internalBinaryRead(reader, reader.uint32(), options));
+                    break;
+                default:
+                    let u = options.readUnknownField;
+                    if (u === "throw")
+                        throw new globalThis.Error(`Unknown field ${fieldNo} (wire type ${wireType}) for ${this.typeName}`);
+                    let d = reader.skip(wireType);
+                    if (u !== false)
+                        (u === true ? UnknownFieldHandler.onRead : u)(this.typeName, message, fieldNo, wireType, d);
+            }
+        }
+        return message;
+    }
+    internalBinaryWrite(message: LapTrajectory_LevelOfDetail, writer: IBinaryWriter, options: BinaryWriteOptions): IBinaryWriter {
+        /* uint32 max_size = 1; */
+        if (message.maxSize !== 0)
+            writer.tag(1, WireType.Varint).uint32(message.maxSize);
+        /* float pixel_tolerance = 2; */
+        if (message.pixelTolerance !== 0)
+            writer.tag(2, WireType.Bit32).float(message.pixelTolerance);
+        /* float tolerance_meters = 3; */
+        if (message.toleranceMeters !== 0)
+            writer.tag(3, WireType.Bit32).float(message.toleranceMeters);
+        /* repeated IRacingTools.Models.LapCoordinate path = 10; */
+        for (let i = 0; i < message.path.length; i++)
+            LapCoordinate.internalBinaryWrite(message.path[i], writer.tag(10, WireType.LengthDelimited).fork(), options).join();
+        let u = options.writeUnknownFields;
+        if (u !== false)
+            (u == true ? UnknownFieldHandler.onWrite : u)(this.typeName, message, writer);
+        return writer;
+    }
+}
+/**
+ * @generated MessageType for protobuf message IRacingTools.Models.LapTrajectory.LevelOfDetail
+ */
+export const LapTrajectory_LevelOfDetail = new LapTrajectory_LevelOfDetail$Type();
+// @generated message type with reflection information, may provide speed optimized methods
+class LapTrajectory_PositionLookupTable$Type extends MessageType<LapTrajectory_PositionLookupTable> {
+    constructor() {
+        super("IRacingTools.Models.LapTrajectory.PositionLookupTable", [
+            { no: 1, name: "bin_count", kind: "scalar", T: 13 /*ScalarType.UINT32*/ },
+            { no: 2, name: "width", kind: "scalar", T: 2 /*ScalarType.FLOAT*/ },
+            { no: 3, name: "height", kind: "scalar", T: 2 /*ScalarType.FLOAT*/ },
+            { no: 10, name: "x", kind: "scalar", repeat: 1 /*RepeatType.PACKED*/, T: 2 /*ScalarType.FLOAT*/ },
+            { no: 11, name: "y", kind: "scalar", repeat: 1 /*RepeatType.PACKED*/, T: 2 /*ScalarType.FLOAT*/ }
+        ]);
+    }
+    create(value?: PartialMessage<LapTrajectory_PositionLookupTable>): LapTrajectory_PositionLookupTable {
+        const message = globalThis.Object.create((this.messagePrototype!));
+        message.binCount = 0;
+        message.width = 0;
+        message.height = 0;
+        message.x = [];
+        message.y = [];
+        if (value !== undefined)
+            reflectionMergePartial<LapTrajectory_PositionLookupTable>(this, message, value);
+        return message;
+    }
+    internalBinaryRead(reader: IBinaryReader, length: number, options: BinaryReadOptions, target?: LapTrajectory_PositionLookupTable): LapTrajectory_PositionLookupTable {
+        let message = target ?? this.create(), end = reader.pos + length;
+        while (reader.pos < end) {
+            let [fieldNo, wireType] = reader.tag();
+            switch (fieldNo) {
+                case /* uint32 bin_count */ 1:
+                    message.binCount = reader.uint32();
+                    break;
+                case /* float width */ 2:
+                    message.width = reader.float();
+                    break;
+                case /* float height */ 3:
+                    message.height = reader.float();
+                    break;
+                case /* repeated float x */ 10:
+                    if (wireType === WireType.LengthDelimited)
+                        for (let e = reader.int32() + reader.pos; reader.pos < e;)
+                            message.x.push(reader.float());
+                    else
+                        message.x.push(reader.float());
+                    break;
+                case /* repeated float y */ 11:
+                    if (wireType === WireType.LengthDelimited)
+                        for (let e = reader.int32() + reader.pos; reader.pos < e;)
+                            message.y.push(reader.float());
+                    else
+                        message.y.push(reader.float());
+                    break;
+                default:
+                    let u = options.readUnknownField;
+                    if (u === "throw")
+                        throw new globalThis.Error(`Unknown field ${fieldNo} (wire type ${wireType}) for ${this.typeName}`);
+                    let d = reader.skip(wireType);
+                    if (u !== false)
+                        (u === true ? UnknownFieldHandler.onRead : u)(this.typeName, message, fieldNo, wireType, d);
+            }
+        }
+        return message;
+    }
+    internalBinaryWrite(message: LapTrajectory_PositionLookupTable, writer: IBinaryWriter, options: BinaryWriteOptions): IBinaryWriter {
+        /* uint32 bin_count = 1; */
+        if (message.binCount !== 0)
+            writer.tag(1, WireType.Varint).uint32(message.binCount);
+        /* float width = 2; */
+        if (message.width !== 0)
+            writer.tag(2, WireType.Bit32).float(message.width);
+        /* float height = 3; */
+        if (message.height !== 0)
+            writer.tag(3, WireType.Bit32).float(message.height);
+        /* repeated float x = 10; */
+        if (message.x.length) {
+            writer.tag(10, WireType.LengthDelimited).fork();
+            for (let i = 0; i < message.x.length; i++)
+                writer.float(message.x[i]);
+            writer.join();
+        }
+        /* repeated float y = 11; */
+        if (message.y.length) {
+            writer.tag(11, WireType.LengthDelimited).fork();
+            for (let i = 0; i < message.y.length; i++)
+                writer.float(message.y[i]);
+            writer.join();
+        }
+        let u = options.writeUnknownFields;
+        if (u !== false)
+            (u == true ? UnknownFieldHandler.onWrite : u)(this.typeName, message, writer);
+        return writer;
+    }
+}
+/**
+ * @generated MessageType for protobuf message IRacingTools.Models.LapTrajectory.PositionLookupTable
+ */
+export const LapTrajectory_PositionLookupTable = new LapTrajectory_PositionLookupTable$Type();
@@ -97,11 +97,48 @@ export interface Pipeline_Attempt {
      * @generated from protobuf field: int32 attempt_number = 10;
      */
     attemptNumber: number;
+    /**
+     * @generated from protobuf field: repeated IRacingTools.Models.Pipeline.Attempt.Stage stages = 20;
+     */
+    stages: Pipeline_Attempt_Stage[];
     /**
      * @generated from protobuf field: repeated IRacingTools.Models.PipelineLog logs = 50;
      */
     logs: PipelineLog[];
 }
+/**
+ * @generated from protobuf message IRacingTools.Models.Pipeline.Attempt.Stage
+ */
+export interface Pipeline_Attempt_Stage {
+    /**
+     * @generated from protobuf field: string name = 1;
+     */
+    name: string;
+    /**
+     * @generated from protobuf field: IRacingTools.Models.PipelineStatus status = 2;
+     */
+    status: PipelineStatus;
+    /**
+     * Epoch millis
+     *
+     * @generated from protobuf field: int64 started_at = 3;
+     */
+    startedAt: bigint;
+    /**
+     * @generated from protobuf field: int64 duration_micros = 4;
+     */
+    durationMicros: bigint;
+    /**
+     * @generated from protobuf field: int32 attempt_count = 5;
+     */
+    attemptCount: number;
+    /**
+     * Outputs were restored from a checkpoint, the stage did not run
+     *
+     * @generated from protobuf field: bool from_checkpoint = 6;
+     */
+    fromCheckpoint: boolean;
+}
 /**
  * @generated from protobuf enum IRacingTools.Models.PipelineType
  */
@@ -134,7 +171,11 @@ export enum PipelineStatus {
     /**
      * @generated from protobuf enum value: PIPELINE_STATUS_ERROR = 20;
      */
-    ERROR = 20
+    ERROR = 20,
+    /**
+     * @generated from protobuf enum value: PIPELINE_STATUS_SKIPPED = 30;
+     */
+    SKIPPED = 30
 }
 // @generated message type with reflection information, may provide speed optimized methods
 class PipelineLog$Type extends MessageType<PipelineLog> {
@@ -270,6 +311,7 @@ class Pipeline_Attempt$Type extends MessageType<Pipeline_Attempt> {
             { no: 2, name: "timestamp", kind: "scalar", T: 3 /*ScalarType.INT64*/, L: 0 /*LongType.BIGINT*/ },
             { no: 3, name: "status", kind: "enum", T: () => ["IRacingTools.Models.PipelineStatus", PipelineStatus, "PIPELINE_STATUS_"] },
             { no: 10, name: "attempt_number", kind: "scalar", T: 5 /*ScalarType.INT32*/ },
+            { no: 20, name: "stages", kind: "message", repeat: 1 /*RepeatType.PACKED*/, T: () => Pipeline_Attempt_Stage },
             { no: 50, name: "logs", kind: "message", repeat: 1 /*RepeatType.PACKED*/, T: () => PipelineLog }
         ]);
     }
@@ -279,6 +321,7 @@ class Pipeline_Attempt$Type extends MessageType<Pipeline_Attempt> {
         message.timestamp = 0n;
         message.status = 0;
         message.attemptNumber = 0;
+        message.stages = [];
         message.logs = [];
         if (value !== undefined)
             reflectionMergePartial<Pipeline_Attempt>(this, message, value);
@@ -301,6 +344,9 @@ class Pipeline_Attempt$Type extends MessageType<Pipeline_Attempt> {
                 case /* int32 attempt_number */ 10:
                     message.attemptNumber = reader.int32();
                     break;
+                case /* repeated IRacingTools.Models.Pipeline.Attempt.Stage stages */ 20:
+                    message.stages.push(Pipeline_Attempt_Stage.internalBinaryRead(reader, reader.uint32(), options));
+                    break;
                 case /* repeated IRacingTools.Models.PipelineLog logs */ 50:
                     message.logs.push(PipelineLog.internalBinaryRead(reader, reader.uint32(), options));
                     break;
@@ -328,6 +374,9 @@ class Pipeline_Attempt$Type extends MessageType<Pipeline_Attempt> {
         /* int32 attempt_number = 10; */
         if (message.attemptNumber !== 0)
             writer.tag(10, WireType.Varint).int32(message.attemptNumber);
+        /* repeated IRacingTools.Models.Pipeline.Attempt.Stage stages = 20; */
+        for (let i = 0; i < message.stages.length; i++)
+            Pipeline_Attempt_Stage.internalBinaryWrite(message.stages[i], writer.tag(20, WireType.LengthDelimited).fork(), options).join();
         /* repeated IRacingTools.Models.PipelineLog logs = 50; */
         for (let i = 0; i < message.logs.length; i++)
             PipelineLog.internalBinaryWrite(message.logs[i], writer.tag(50, WireType.LengthDelimited).fork(), options).join();
@@ -341,3 +390,90 @@ class Pipeline_Attempt$Type extends MessageType<Pipeline_Attempt> {
  * @generated MessageType for protobuf message IRacingTools.Models.Pipeline.Attempt
  */
 export const Pipeline_Attempt = new Pipeline_Attempt$Type();
+// @generated message type with reflection information, may provide speed optimized methods
+class Pipeline_Attempt_Stage$Type extends MessageType<Pipeline_Attempt_Stage> {
+    constructor() {
+        super("IRacingTools.Models.Pipeline.Attempt.Stage", [
+            { no: 1, name: "name", kind: "scalar", T: 9 /*ScalarType.STRING*/ },
+            { no: 2, name: "status", kind: "enum", T: () => ["IRacingTools.Models.PipelineStatus", PipelineStatus, "PIPELINE_STATUS_"] },
+            { no: 3, name: "started_at", kind: "scalar", T: 3 /*ScalarType.INT64*/, L: 0 /*LongType.BIGINT*/ },
+            { no: 4, name: "duration_micros", kind: "scalar", T: 3 /*ScalarType.INT64*/, L: 0 /*LongType.BIGINT*/ },
+            { no: 5, name: "attempt_count", kind: "scalar", T: 5 /*ScalarType.INT32*/ },
+            { no: 6, name: "from_checkpoint", kind: "scalar", T: 8 /*ScalarType.BOOL*/ }
+        ]);
+    }
+    create(value?: PartialMessage<Pipeline_Attempt_Stage>): Pipeline_Attempt_Stage {
+        const message = globalThis.Object.create((this.messagePrototype!));
+        message.name = "";
+        message.status = 0;
+        message.startedAt = 0n;
+        message.durationMicros = 0n;
+        message.attemptCount = 0;
+        message.fromCheckpoint = false;
+        if (value !== undefined)
+            reflectionMergePartial<Pipeline_Attempt_Stage>(this, message, value);
+        return message;
+    }
+    internalBinaryRead(reader: IBinaryReader, length: number, options: BinaryReadOptions, target?: Pipeline_Attempt_Stage): Pipeline_Attempt_Stage {
+        let message = target ?? this.create(), end = reader.pos + length;
+        while (reader.pos < end) {
+            let [fieldNo, wireType] = reader.tag();
+            switch (fieldNo) {
+                case /* string name */ 1:
+                    message.name = reader.string();
+                    break;
+                case /* IRacingTools.Models.PipelineStatus status */ 2:
+                    message.status = reader.int32();
+                    break;
+                case /* int64 started_at */ 3:
+                    message.startedAt = reader.int64().toBigInt();
+                    break;
+                case /* int64 duration_micros */ 4:
+                    message.durationMicros = reader.int64().toBigInt();
+                    break;
+                case /* int32 attempt_count */ 5:
+                    message.attemptCount = reader.int32();
+                    break;
+                case /* bool from_checkpoint */ 6:
+                    message.fromCheckpoint = reader.bool();
+                    break;
+                default:
+                    let u = options.readUnknownField;
+                    if (u === "throw")
+                        throw new globalThis.Error(`Unknown field ${fieldNo} (wire type ${wireType}) for ${this.typeName}`);
+                    let d = reader.skip(wireType);
+                    if (u !== false)
+                        (u === true ? UnknownFieldHandler.onRead : u)(this.typeName, message, fieldNo, wireType, d);
+            }
+        }
+        return message;
+    }
+    internalBinaryWrite(message: Pipeline_Attempt_Stage, writer: IBinaryWriter, options: BinaryWriteOptions): IBinaryWriter {
+        /* string name = 1; */
+        if (message.name !== "")
+            writer.tag(1, WireType.LengthDelimited).string(message.name);
+        /* IRacingTools.Models.PipelineStatus status = 2; */
+        if (message.status !== 0)
+            writer.tag(2, WireType.Varint).int32(message.status);
+        /* int64 started_at = 3; */
+        if (message.startedAt !== 0n)
+            writer.tag(3, WireType.Varint).int64(message.startedAt);
+        /* int64 duration_micros = 4; */
+        if (message.durationMicros !== 0n)
+            writer.tag(4, WireType.Varint).int64(message.durationMicros);
+        /* int32 attempt_count = 5; */
+        if (message.attemptCount !== 0)
+            writer.tag(5, WireType.Varint).int32(message.attemptCount);
+        /* bool from_checkpoint = 6; */
+        if (message.fromCheckpoint !== false)
+            writer.tag(6, WireType.Varint).bool(message.fromCheckpoint);
+        let u = options.writeUnknownFields;
+        if (u !== false)
+            (u == true ? UnknownFieldHandler.onWrite : u)(this.typeName, message, writer);
+        return writer;
+    }
+}
+/**
+ * @generated MessageType for protobuf message IRacingTools.Models.Pipeline.Attempt.Stage
+ */
+export const Pipeline_Attempt_Stage = new Pipeline_Attempt_Stage$Type();
@@ -1,5 +1,7 @@
 // ReSharper disable once CppParameterMayBeConstPtrOrRef
 
+#include <atomic>
+
 #include <IRacingTools/Shared/FileSystemHelpers.h>
 #include <IRacingTools/Shared/Common/UUIDHelpers.h>
 
@@ -13,6 +15,12 @@ using namespace Napi;
 namespace IRacingTools::App::Node {
     namespace {
         auto L = GetCategoryWithType<IRacingTools::App::Node::NativeClient>();
+
+        /**
+         * @brief Cleared the first time the runtime rejects an external
+         *   buffer, workers then skip serializing into the exchange
+         */
+        std::atomic_bool ExternalBuffersSupported{true};
     }
 
     /**
@@ -32,6 +40,7 @@ namespace IRacingTools::App::Node {
             "NativeClient",
             {
                 InstanceMethod<&NativeClient::jsExecuteRequest>("executeRequest"),
+                InstanceMethod<&NativeClient::jsGetRequestMetrics>("getRequestMetrics"),
                 InstanceMethod<&NativeClient::jsDestroy>("destroy")
 
 #ifdef DEBUG
@@ -86,6 +95,14 @@ namespace IRacingTools::App::Node {
                 delete ctx;
             }
         );
+
+        // NO JS FUNCTION, THE CALLBACK RESOLVES THE REQUEST PROMISE
+        requestResolver_->fn = NativeResolveRequestFn::New(
+            env,
+            "VRKNativeResolveRequest",
+            0,
+            1
+        );
     }
 
     /**
@@ -117,6 +134,7 @@ namespace IRacingTools::App::Node {
 
 #endif
         jsDefaultEventFn_.Release();
+        requestResolver_->release();
     }
 
     /**
@@ -138,34 +156,160 @@ namespace IRacingTools::App::Node {
     Napi::Value NativeClient::jsExecuteRequest(const Napi::CallbackInfo& info) {
         auto env = info.Env();
 
-        // TODO: implement as async to avoid blocking
         auto deferred = Napi::Promise::Deferred::New(env);
+        if (destroyed_) {
+            deferred.Reject(Napi::Error::New(env, "NativeClient is destroyed").Value());
+            return deferred.Promise();
+        }
 
         auto path = info[0].ToString().Utf8Value();
 
+        // PARSE STRAIGHT FROM THE JS BUFFER INTO THE EXCHANGE ARENA
+        auto server = system_->serviceManager()->getService<RPCServerService>();
+        auto exchange = server->acquireExchange();
         auto requestData = info[1].As<Napi::Uint8Array>();
-        auto requestEnvelope = std::make_shared<RPC::Envelope>();
         VRK_LOG_AND_FATAL_IF(
-            !requestEnvelope->ParseFromArray(requestData.Data(), requestData. ByteLength()),
+            !exchange->request()->ParseFromArray(requestData.Data(), requestData.ByteLength()),
             "failed to parse request envelope: {}",
             requestData.ByteLength()
         );
 
+        // ROUTE & SERIALIZATION RUN ON A WORKER, ONLY RESOLVING IS ON THE JS THREAD
+        auto request = new NativePendingRequest{deferred, exchange};
+        server->executeAsync(
+            exchange,
+            [resolver = requestResolver_, request](const RPCServerService::ExchangePtr& completedExchange) {
+                // WITHOUT EXTERNAL BUFFERS THE RESPONSE IS SERIALIZED ON THE JS THREAD INSTEAD
+                VRK_LOG_AND_FATAL_IF(
+                    ExternalBuffersSupported.load(std::memory_order_relaxed) && !completedExchange->response()->SerializeToString(&completedExchange->responseBytes()),
+                    "failed to serialize response envelope: {}",
+                    completedExchange->request()->request_path()
+                );
+
+                resolver->resolve(request);
+            }
+        );
+
+        return deferred.Promise();
+    }
+
+    Napi::Value NativeClient::jsGetRequestMetrics(const Napi::CallbackInfo& info) {
+        auto env = info.Env();
         auto server = system_->serviceManager()->getService<RPCServerService>();
-        auto responseEnvelope = server->execute(requestEnvelope);
-        auto resSize = responseEnvelope->ByteSizeLong();
+        auto metrics = server->metrics();
+
+        auto latencyToJS = [&env](const LatencyHistogram::Snapshot& latency) {
+            auto latencyObj = Napi::Object::New(env);
+            latencyObj.Set("count", Napi::Number::New(env, static_cast<double>(latency.count)));
+            latencyObj.Set("meanMicros", Napi::Number::New(env, latency.meanMicros()));
+            latencyObj.Set("p50Micros", Napi::Number::New(env, static_cast<double>(latency.percentileMicros(0.5))));
+            latencyObj.Set("p90Micros", Napi::Number::New(env, static_cast<double>(latency.percentileMicros(0.9))));
+            latencyObj.Set("p99Micros", Napi::Number::New(env, static_cast<double>(latency.percentileMicros(0.99))));
+            latencyObj.Set("maxMicros", Napi::Number::New(env, static_cast<double>(latency.maxMicros)));
+            return latencyObj;
+        };
+
+        auto routesObj = Napi::Object::New(env);
+        for (auto& [matchExpression, routeMetrics] : metrics.routes) {
+            auto routeObj = Napi::Object::New(env);
+            routeObj.Set("running", Napi::Number::New(env, static_cast<double>(routeMetrics.running)));
+            routeObj.Set("waiting", Napi::Number::New(env, static_cast<double>(routeMetrics.waiting)));
+            routeObj.Set("latency", latencyToJS(routeMetrics.latency));
+            routesObj.Set(matchExpression, routeObj);
+        }
+
+        auto metricsObj = Napi::Object::New(env);
+        metricsObj.Set("inFlight", Napi::Number::New(env, static_cast<double>(metrics.inFlight)));
+        metricsObj.Set("latency", latencyToJS(metrics.latency));
+        metricsObj.Set("routes", routesObj);
+        return metricsObj;
+    }
+
+    void NativeRequestResolver::resolve(NativePendingRequest* request) {
+        {
+            std::scoped_lock lock(mutex);
+            if (!released && fn.NonBlockingCall(request) == napi_ok)
+                return;
+        }
+
+        L->warn("Dropping response of {}, client destroyed", request->exchange->request()->request_path());
+        delete request;
+    }
+
+    void NativeRequestResolver::release() {
+        std::scoped_lock lock(mutex);
+        if (released)
+            return;
+
+        released = true;
+        fn.Release();
+    }
+
+    void JSResolveRequestCallback(
+        Napi::Env env,
+        Napi::Function,
+        void*,
+        // ReSharper disable once CppParameterMayBeConstPtrOrRef
+        NativePendingRequest* request
+    ) {
+        // ENV IS NULL WHEN THE FUNCTION IS FINALIZED WITH QUEUED REQUESTS
+        if (env) {
+            request->deferred.Resolve(NativeClient::LendResponseBuffer(env, request->exchange));
+        }
+
+        delete request;
+    }
+
+    /**
+     * @brief Wrap the serialized response in an external `ArrayBuffer`, the
+     *   exchange is held until the buffer is garbage collected.
+     *
+     *  > NOTE: when the runtime disallows external buffers (i.e. Electron
+     *  > with the V8 sandbox enabled) the response is serialized straight
+     *  > into a new `Uint8Array` instead
+     */
+    Napi::Uint8Array NativeClient::LendResponseBuffer(
+        Napi::Env env,
+        const RPCServerService::ExchangePtr& exchange
+    ) {
+        auto& responseBytes = exchange->responseBytes();
+        if (ExternalBuffersSupported.load(std::memory_order_relaxed) && !responseBytes.empty()) {
+            auto size = responseBytes.size();
+            auto hint = new RPCServerService::ExchangePtr(exchange);
+            napi_value arrayBuffer{nullptr};
+            auto status = napi_create_external_arraybuffer(
+                env,
+                responseBytes.data(),
+                size,
+                [](napi_env, void*, void* finalizeHint) {
+                    delete static_cast<RPCServerService::ExchangePtr*>(finalizeHint);
+                },
+                hint,
+                &arrayBuffer
+            );
+
+            if (status == napi_ok) {
+                return Napi::Uint8Array::New(env, size, Napi::ArrayBuffer(env, arrayBuffer), 0);
+            }
 
-        auto resTypedArray = Napi::Uint8Array::New(env, resSize);
+            delete hint;
+            if (status == napi_no_external_buffers_allowed) {
+                L->info("External buffers are not allowed, serializing responses on the JS thread");
+                ExternalBuffersSupported.store(false, std::memory_order_relaxed);
+            }
+        }
 
+        auto response = exchange->response();
+        auto resTypedArray = Napi::Uint8Array::New(env, response->ByteSizeLong());
         VRK_LOG_AND_FATAL_IF(
-            !responseEnvelope->SerializeToArray(resTypedArray.Data(), resTypedArray. ByteLength()),
+            !response->SerializeToArray(resTypedArray.Data(), static_cast<int>(resTypedArray.ByteLength())),
             "failed to serialize response envelope: {}",
-            requestData.ByteLength()
+            exchange->request()->request_path()
         );
 
-        deferred.Resolve(resTypedArray);
-        return deferred.Promise();
+        return resTypedArray;
     }
+
 #ifdef DEBUG
     Napi::Value NativeClient::jsTestNativeEventEmit(const Napi::CallbackInfo& info) {
         L->info("jsTestNativeEventEmit() new instance: {}", info.Length());
@@ -61,6 +61,40 @@ namespace IRacingTools::App::Node {
     using NativeDefaultEventFn = Napi::TypedThreadSafeFunction<
         NativeDefaultEventContextType, NativeDefaultEventDataType, JSDefaultEventCallback>;
 
+    /**
+     * @brief An `executeRequest` promise waiting on a worker
+     */
+    struct NativePendingRequest {
+        Napi::Promise::Deferred deferred;
+        RPCServerService::ExchangePtr exchange;
+    };
+
+    void JSResolveRequestCallback(
+        Napi::Env env,
+        Napi::Function callback,
+        void* context,
+        NativePendingRequest* request
+    );
+    using NativeResolveRequestFn = Napi::TypedThreadSafeFunction<void, NativePendingRequest, JSResolveRequestCallback>;
+
+    /**
+     * @brief Guards the resolve function, so completions after `destroy()`
+     *   never call into a released function
+     */
+    struct NativeRequestResolver {
+        std::mutex mutex{};
+        bool released{false};
+        NativeResolveRequestFn fn{};
+
+        /**
+         * @brief Queue `request` to be resolved on the JS thread, it is
+         *   dropped if the client was destroyed
+         */
+        void resolve(NativePendingRequest* request);
+
+        void release();
+    };
+
     
     /**
      * @brief NodeSystem client, which can execute RPC calls & exchange information as needed
@@ -85,8 +119,14 @@ namespace IRacingTools::App::Node {
         virtual void Finalize(Napi::Env) override;
 
         Napi::Value jsExecuteRequest(const Napi::CallbackInfo& info);
+        Napi::Value jsGetRequestMetrics(const Napi::CallbackInfo& info);
         Napi::Value jsDestroy(const Napi::CallbackInfo& info);
 
+        static Napi::Uint8Array LendResponseBuffer(
+            Napi::Env env,
+            const RPCServerService::ExchangePtr& exchange
+        );
+
 #ifdef DEBUG
         Napi::Value jsTestNativeEventEmit(const Napi::CallbackInfo& info);
 #endif
@@ -95,6 +135,7 @@ namespace IRacingTools::App::Node {
         void destroy();
 
         NativeDefaultEventFn jsDefaultEventFn_;
+        std::shared_ptr<NativeRequestResolver> requestResolver_{std::make_shared<NativeRequestResolver>()};
 
         std::shared_ptr<NativeGlobal> system_;
         std::atomic_uint32_t pingCount_{0};
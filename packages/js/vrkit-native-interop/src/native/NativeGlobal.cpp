@@ -25,6 +25,9 @@ namespace IRacingTools::App::Node {
         WindowsSetHighPriorityProcess();
 
         manager_->init();
+
+        // NATIVE CLIENT CALLS ARE ASYNC, RUN THEM ON THE WORKER POOL
+        manager_->getService<RPCServerService>()->setOptions({.useTaskQueue = true});
         manager_->start();
 #if 0
     // Testing only
@@ -54,10 +54,10 @@ namespace IRacingTools::App::Node {
     return idx >= resources_.size() ? nullptr : resources_.at(idx);
   }
 
-  void NativeOverlayManager::onOverlayFrameData(OnFrameData fn) {
+  void NativeOverlayManager::onOverlayFrameData(OnFrameData fn, Graphics::FramePacer::TimePoint wakeAt) {
     {
       std::unique_lock lock(onFrameMutex_);
-      onFrameCondition_.wait(lock);
+      onFrameCondition_.wait_until(lock, wakeAt);
     }
 
     fn();
@@ -74,7 +74,9 @@ namespace IRacingTools::App::Node {
         InstanceMethod<&NativeOverlayManager::jsGetResourceCount>("getResourceCount"),
         InstanceMethod<&NativeOverlayManager::jsCreateOrUpdateResources>("createOrUpdateResources"),
         InstanceMethod<&NativeOverlayManager::jsReleaseResources>("releaseResources"),
-        InstanceMethod<&NativeOverlayManager::jsProcessFrame>("processFrame")
+        InstanceMethod<&NativeOverlayManager::jsProcessFrame>("processFrame"),
+        InstanceMethod<&NativeOverlayManager::jsSetOverlayMaxFPS>("setOverlayMaxFPS"),
+        InstanceMethod<&NativeOverlayManager::jsGetPacingMetrics>("getPacingMetrics")
       }
     );
 
@@ -323,13 +325,76 @@ namespace IRacingTools::App::Node {
   NativeOverlayManager::jsProcessFrame(const Napi::CallbackInfo& info) {
     auto env = info.Env();
     auto throwInvalidArgs = [&] {
-      throw TypeError::New(env, "invalid arguments `processFrame(overlayId: string, buf: Uint8Array): void`");
+      throw TypeError::New(env, "invalid arguments `processFrame(overlayId: string, buf: Uint8Array, damage?: Rectangle | Rectangle[], format?: NativeFrameFormat): void`");
     };
 
-    if (info.Length() != 2 || !info[0].IsString() || !info[1].IsTypedArray()) {
+    if (info.Length() < 2 || info.Length() > 4 || !info[0].IsString() || !info[1].IsTypedArray()) {
       throwInvalidArgs();
     }
 
+    // OPTIONAL DAMAGE, i.e. THE `dirty` RECT OF AN OFFSCREEN PAINT
+    std::optional<std::vector<Graphics::DamageRect>> damage{};
+    if (info.Length() >= 3 && !info[2].IsUndefined() && !info[2].IsNull()) {
+      auto toDamageRect = [&](const Napi::Value& value) -> Graphics::DamageRect {
+        if (!value.IsObject()) {
+          throwInvalidArgs();
+        }
+
+        auto rectObj = value.As<Napi::Object>();
+        auto get = [&](const char* key) {
+          return static_cast<std::uint32_t>(std::max(rectObj.Get(key).ToNumber().Int32Value(), 0));
+        };
+        return {get("x"), get("y"), get("width"), get("height")};
+      };
+
+      damage.emplace();
+      if (info[2].IsArray()) {
+        auto rects = info[2].As<Napi::Array>();
+        for (std::uint32_t idx = 0; idx < rects.Length(); idx++) {
+          damage->push_back(toDamageRect(rects.Get(idx)));
+        }
+      } else {
+        damage->push_back(toDamageRect(info[2]));
+      }
+    }
+
+    // OPTIONAL SOURCE FORMAT, CONVERTED TO PREMULTIPLIED BGRA WHILE COPYING
+    Graphics::PixelConversion conversion{};
+    if (info.Length() == 4 && !info[3].IsUndefined() && !info[3].IsNull()) {
+      if (!info[3].IsObject()) {
+        throwInvalidArgs();
+      }
+
+      auto formatObj = info[3].As<Napi::Object>();
+      if (formatObj.Has("layout")) {
+        auto layout = formatObj.Get("layout").ToString().Utf8Value();
+        if (layout == "RGBA") {
+          conversion.layout = Graphics::PixelLayout::RGBA;
+        } else if (layout == "RGB") {
+          conversion.layout = Graphics::PixelLayout::RGB;
+        } else if (layout != "BGRA") {
+          throwInvalidArgs();
+        }
+      }
+
+      if (formatObj.Has("premultiplied")) {
+        conversion.alpha = formatObj.Get("premultiplied").ToBoolean().Value()
+          ? Graphics::PixelAlpha::Premultiplied
+          : Graphics::PixelAlpha::Straight;
+      }
+
+      if (formatObj.Has("tint")) {
+        auto tint = formatObj.Get("tint");
+        if (!tint.IsArray() || tint.As<Napi::Array>().Length() != 4) {
+          throwInvalidArgs();
+        }
+
+        for (std::uint32_t idx = 0; idx < 4; idx++) {
+          conversion.tint[idx] = tint.As<Napi::Array>().Get(idx).ToNumber().FloatValue();
+        }
+      }
+    }
+
     auto overlayId = info[0].As<Napi::String>().Utf8Value();
     std::shared_ptr<NativeOverlayWindowResources> resource;
     {
@@ -341,7 +406,12 @@ namespace IRacingTools::App::Node {
     }
 
     auto buf = info[1].As<Napi::Uint8Array>();
-    auto res = resource->imageData()->produce(buf.Data(), buf.ByteLength());
+    std::optional<std::span<const Graphics::DamageRect>> damageRects{};
+    if (damage) {
+      damageRects = std::span<const Graphics::DamageRect>(damage.value());
+    }
+
+    auto res = resource->imageData()->produce(buf.Data(), buf.ByteLength(), damageRects, conversion);
     if (res && res.value() > 0) {
       LOCK(onFrameMutex_, lock);
       onFrameCondition_.notify_all();
@@ -353,6 +423,53 @@ namespace IRacingTools::App::Node {
     return env.Undefined();
   }
 
+  Napi::Value NativeOverlayManager::jsSetOverlayMaxFPS(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    if (info.Length() != 2 || !info[0].IsString() || !info[1].IsNumber()) {
+      throw TypeError::New(env, "invalid arguments `setOverlayMaxFPS(overlayId: string, maxFPS: number): void`");
+    }
+
+    auto overlayId = info[0].As<Napi::String>().Utf8Value();
+    std::shared_ptr<NativeOverlayWindowResources> resource;
+    {
+      std::scoped_lock lock(resourcesMutex_);
+      resource = getResourceByOverlayId(overlayId);
+      if (!resource) {
+        throw TypeError::New(env, std::format("resources not found for overlayId: {}", overlayId));
+      }
+    }
+
+    resource->setMaxFPS(info[1].As<Napi::Number>().DoubleValue());
+    return env.Undefined();
+  }
+
+  Napi::Value NativeOverlayManager::jsGetPacingMetrics(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+    auto metrics = ipcDxRenderer_->pacingMetrics();
+
+    // OVERLAYS ARE KEYED BY ID, THE PACER ONLY KNOWS THEIR INDEX
+    auto overlaysObj = Napi::Object::New(env);
+    {
+      std::scoped_lock lock(resourcesMutex_);
+      for (std::size_t idx = 0; idx < std::min(metrics.overlays.size(), resources_.size()); idx++) {
+        auto& overlayMetrics = metrics.overlays[idx];
+        auto overlayObj = Napi::Object::New(env);
+        overlayObj.Set("maxFPS", Napi::Number::New(env, overlayMetrics.maxFPS));
+        overlayObj.Set("fps", Napi::Number::New(env, overlayMetrics.fps));
+        overlayObj.Set("rendered", Napi::Number::New(env, static_cast<double>(overlayMetrics.rendered)));
+        overlayObj.Set("skipped", Napi::Number::New(env, static_cast<double>(overlayMetrics.skipped)));
+        overlaysObj.Set(resources_[idx]->overlayId, overlayObj);
+      }
+    }
+
+    auto metricsObj = Napi::Object::New(env);
+    metricsObj.Set("submitFPS", Napi::Number::New(env, metrics.submitFPS));
+    metricsObj.Set("submitted", Napi::Number::New(env, static_cast<double>(metrics.submitted)));
+    metricsObj.Set("consumerFPS", Napi::Number::New(env, metrics.consumerFPS));
+    metricsObj.Set("overlays", overlaysObj);
+    return metricsObj;
+  }
+
   Napi::Value NativeOverlayManager::jsDestroy(const Napi::CallbackInfo& info) {
     destroy();
     return info.Env().Undefined();
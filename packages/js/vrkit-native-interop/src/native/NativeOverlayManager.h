@@ -54,7 +54,7 @@ namespace IRacingTools::App::Node {
 
     virtual std::shared_ptr<Graphics::IPCOverlayFrameData<Graphics::ImageFormatChannels::RGBA>> getOverlayData(std::size_t idx) override;
 
-    virtual void onOverlayFrameData(OnFrameData fn) override;
+    virtual void onOverlayFrameData(OnFrameData fn, Graphics::FramePacer::TimePoint wakeAt) override;
 
     /**
      * @brief Initialize `node-addon`
@@ -130,12 +130,29 @@ namespace IRacingTools::App::Node {
     /**
      * @brief process new frame for display
      *
-     * @param info `processFrame(overlayWindowId: number, buf: Uint8Array):
-     * void`
+     * @param info `processFrame(overlayId: string, buf: Uint8Array,
+     * damage?: Rectangle | Rectangle[], format?: NativeFrameFormat): void`
      * @return Napi::Void
      */
     Napi::Value jsProcessFrame(const Napi::CallbackInfo &info);
 
+    /**
+     * @brief Limit how often an overlay is re-rendered
+     *
+     * @param info `setOverlayMaxFPS(overlayId: string, maxFPS: number): void`,
+     *   `0` for the default
+     * @return Napi::Void
+     */
+    Napi::Value jsSetOverlayMaxFPS(const Napi::CallbackInfo &info);
+
+    /**
+     * @brief Render & submit rates
+     *
+     * @param info `getPacingMetrics(): NativeOverlayPacingMetrics`
+     * @return `Napi::Object` adhering to `NativeOverlayPacingMetrics`
+     */
+    Napi::Value jsGetPacingMetrics(const Napi::CallbackInfo &info);
+
     /**
      * @brief destroy the manager & release all resources
      *
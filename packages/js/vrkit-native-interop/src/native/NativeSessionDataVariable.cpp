@@ -126,7 +126,7 @@ namespace IRacingTools::App::Node {
     auto env = info.Env();
     int32_t entry = info.Length() != 1 || !info[0].IsNumber() ? 0 : info[0].As<Napi::Number>().Int32Value();
 
-    if (varHolder_->isValid() && varHolder_->getType() == VarDataType::Bool) return Napi::Boolean::New(
+    if (varHolder_->is(VarDataType::Bool)) return Napi::Boolean::New(
       env,
       varHolder_->getBool(entry)
     );
@@ -139,7 +139,7 @@ namespace IRacingTools::App::Node {
     auto env = info.Env();
     int32_t entry = info.Length() != 1 || !info[0].IsNumber() ? 0 : info[0].As<Napi::Number>().Int32Value();
 
-    if (varHolder_->isValid() && varHolder_->getType() == VarDataType::Char) return Napi::Boolean::New(
+    if (varHolder_->is(VarDataType::Char)) return Napi::Boolean::New(
       env,
       varHolder_->getInt(entry)
     );
@@ -152,7 +152,7 @@ namespace IRacingTools::App::Node {
     auto env = info.Env();
     int32_t entry = info.Length() != 1 || !info[0].IsNumber() ? 0 : info[0].As<Napi::Number>().Int32Value();
 
-    if (varHolder_->isValid() && varHolder_->getType() == VarDataType::Bitmask) return Napi::Boolean::New(
+    if (varHolder_->is(VarDataType::Bitmask)) return Napi::Boolean::New(
       env,
       varHolder_->getInt(entry)
     );
@@ -184,7 +184,7 @@ namespace IRacingTools::App::Node {
     auto env = info.Env();
     int32_t entry = info.Length() != 1 || !info[0].IsNumber() ? 0 : info[0].As<Napi::Number>().Int32Value();
 
-    if (varHolder_->isValid() && varHolder_->getType() == VarDataType::Int32) return Napi::Number::New(
+    if (varHolder_->is(VarDataType::Int32)) return Napi::Number::New(
       env,
       varHolder_->getInt(entry)
     );
@@ -196,7 +196,7 @@ namespace IRacingTools::App::Node {
     auto env = info.Env();
     int32_t entry = info.Length() != 1 || !info[0].IsNumber() ? 0 : info[0].As<Napi::Number>().Int32Value();
 
-    if (varHolder_->isValid() && varHolder_->getType() == VarDataType::Float) return Napi::Number::New(
+    if (varHolder_->is(VarDataType::Float)) return Napi::Number::New(
       env,
       varHolder_->getFloat(entry)
     );
@@ -208,9 +208,7 @@ namespace IRacingTools::App::Node {
     auto env = info.Env();
     int32_t entry = info.Length() != 1 || !info[0].IsNumber() ? 0 : info[0].As<Napi::Number>().Int32Value();
 
-    auto isValid = varHolder_->isValid();
-    auto type = varHolder_->getType();
-    if (isValid && type == VarDataType::Double) return Napi::Number::New(env, varHolder_->getDouble(entry));
+    if (varHolder_->is(VarDataType::Double)) return Napi::Number::New(env, varHolder_->getDouble(entry));
 
     return {};
   }
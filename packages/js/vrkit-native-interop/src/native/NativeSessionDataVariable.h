@@ -77,6 +77,9 @@ namespace IRacingTools::App::Node {
 
         std::shared_ptr<SessionDataProvider> dataProvider_{nullptr};
 
+        /**
+         * @brief Resolved lazily & cached until the client binding generation changes
+         */
         std::unique_ptr<VarHolder> varHolder_{nullptr};
 
         std::string varName_;
@@ -24,6 +24,22 @@ namespace IRacingTools::App::Node {
         constexpr auto kCtorArgError =
             "SessionPlayer constructor supports the following signature `(onEvent:((...args)=> void), file?: string = null)`";
         auto L = GetCategoryWithType<IRacingTools::App::Node::NativeSessionPlayer>();
+
+        /**
+         * @brief Smallest data snapshot buffer, rows are a few KB so most
+         *   layouts fit the first buffer allocated
+         */
+        constexpr std::size_t kDataSnapshotMinByteLength = 64 * 1024;
+
+        Shared::Common::EventDelivery SessionEventDelivery(RPC::Events::SessionEventType type) {
+            switch (type) {
+            case RPC::Events::SESSION_EVENT_TYPE_DATA_FRAME:
+            case RPC::Events::SESSION_EVENT_TYPE_TIMING_CHANGED:
+                return Shared::Common::EventDelivery::Latest;
+            default:
+                return Shared::Common::EventDelivery::Every;
+            }
+        }
     }
 
     /**
@@ -55,6 +71,9 @@ namespace IRacingTools::App::Node {
                 InstanceAccessor<&NativeSessionPlayer::jsGetId>("id"),
                 InstanceAccessor<&NativeSessionPlayer::jsIsLive>("isLive"),
                 InstanceAccessor<&NativeSessionPlayer::jsIsAvailable>("isAvailable"),
+                InstanceAccessor<&NativeSessionPlayer::jsGetEventMetrics>("eventMetrics"),
+                InstanceAccessor<&NativeSessionPlayer::jsGetDataSnapshot>("dataSnapshot"),
+                InstanceAccessor<&NativeSessionPlayer::jsGetDataSnapshotLayout>("dataSnapshotLayout"),
                 InstanceAccessor<&NativeSessionPlayer::jsGetFileInfo>("fileInfo"),
                 InstanceAccessor<&NativeSessionPlayer::jsGetSessionInfoYAMLStr>("sessionInfoYAMLStr"),
                 InstanceAccessor<&NativeSessionPlayer::jsGetSessionData>("sessionData"),
@@ -125,15 +144,16 @@ namespace IRacingTools::App::Node {
             sessionData_ = dataProvider_->sessionData();
         }
 
-        auto context = new Reference<Napi::Value>(Persistent(info.This()));
+        eventQueue_ = std::make_shared<NativeSessionPlayerEventQueue>();
+        auto context = new NativeSessionPlayerEventContext{Persistent(info.This()), eventQueue_};
 
         jsSessionPlayerEventFn_ = SessionPlayerEventFn::New(
             env,
             info[0].As<Function>(),
             "SessionPlayerEvent",
             // Resource name
-            0,
-            // Unlimited queue
+            2,
+            // At most one drain is scheduled at a time, plus its re-schedule
             1,
             // Only one thread will use this initially
             context,
@@ -147,10 +167,17 @@ namespace IRacingTools::App::Node {
                 delete ctx;
             }
         );
+        context->eventFn = jsSessionPlayerEventFn_;
 
         dataProvider_->subscribe([&] (auto type, auto data) {
-            jsSessionPlayerEventFn_.NonBlockingCall(new NativeSessionPlayerJSEvent(type, data));
-                //jsSessionPlayerEventFn_.BlockingCall(new NativeSessionPlayerJSEvent(type, data));
+            // WRITTEN BEFORE THE EVENT IS QUEUED, SO JS SEES THE ROW OF THE FRAME IT IS NOTIFIED OF
+            if (type == RPC::Events::SESSION_EVENT_TYPE_DATA_FRAME)
+                writeDataSnapshot();
+
+            if (eventQueue_->push(type, NativeSessionPlayerJSEvent(type, data), SessionEventDelivery(type)) &&
+                jsSessionPlayerEventFn_.NonBlockingCall() != napi_ok) {
+                eventQueue_->unschedule();
+            }
         });
     }
 
@@ -177,6 +204,14 @@ namespace IRacingTools::App::Node {
 
         L->debug("Cleaned up data provider");
 
+        {
+            std::scoped_lock snapshotLock(dataSnapshotMutex_);
+            if (dataSnapshot_)
+                dataSnapshot_->invalidate();
+
+            dataSnapshot_.reset();
+        }
+
         jsSessionPlayerEventFn_.Release();
     }
 
@@ -296,6 +331,113 @@ namespace IRacingTools::App::Node {
         return Napi::Boolean::New(info.Env(), dataProvider_->isAvailable());
     }
 
+    /**
+     * @brief Counters of the event bridge between the data provider & JS
+     */
+    Napi::Value NativeSessionPlayer::jsGetEventMetrics(const Napi::CallbackInfo& info) {
+        auto env = info.Env();
+        auto metrics = eventQueue_->metrics();
+        auto metricsObj = Napi::Object::New(env);
+        metricsObj.Set("pushed", Napi::Number::New(env, static_cast<double>(metrics.pushed)));
+        metricsObj.Set("delivered", Napi::Number::New(env, static_cast<double>(metrics.delivered)));
+        metricsObj.Set("coalesced", Napi::Number::New(env, static_cast<double>(metrics.coalesced)));
+        metricsObj.Set("dropped", Napi::Number::New(env, static_cast<double>(metrics.dropped)));
+        metricsObj.Set("batches", Napi::Number::New(env, static_cast<double>(metrics.batches)));
+        metricsObj.Set("queued", Napi::Number::New(env, static_cast<double>(metrics.queued)));
+        return metricsObj;
+    }
+
+    void NativeSessionPlayer::writeDataSnapshot() {
+        auto client = dataProvider_->clientProvider()->getClient();
+        if (!client)
+            return;
+
+        std::scoped_lock lock(dataSnapshotMutex_);
+
+        // THE GENERATION IS PROCESS WIDE, SO ONLY A CHANGE TO THIS CLIENT'S HEADERS REPLACES THE SNAPSHOT
+        auto generation = Client::GetBindingGeneration();
+        if (dataSnapshot_ && dataSnapshotGeneration_ != generation && !dataSnapshot_->matches(client->getVarHeaders())) {
+            dataSnapshot_->invalidate();
+            dataSnapshot_.reset();
+        }
+
+        dataSnapshotGeneration_ = generation;
+        if (!dataSnapshot_) {
+            auto& headers = client->getVarHeaders();
+
+            // JS KEEPS ITS BUFFER IF THE NEW LAYOUT FITS & PICKS IT UP FROM `LayoutVersion`
+            dataSnapshot_ = dataSnapshotRegion_.size() >= SessionDataSnapshot::ByteLength(headers)
+                ? std::make_unique<SessionDataSnapshot>(headers, dataSnapshotRegion_)
+                : std::make_unique<SessionDataSnapshot>(headers);
+        }
+
+        dataSnapshot_->write(client->getVarDataBuffer(), client->getSessionTicks().value_or(0));
+    }
+
+    SessionDataSnapshot* NativeSessionPlayer::attachDataSnapshot(Napi::Env env) {
+        if (!dataSnapshot_ || dataSnapshot_->data() == dataSnapshotRegion_.data())
+            return dataSnapshot_.get();
+
+        // HEADROOM, SO LATER LAYOUTS REUSE THE SAME BUFFER
+        if (dataSnapshotRegion_.size() < dataSnapshot_->byteLength()) {
+            auto buffer = Napi::ArrayBuffer::New(env, std::max(dataSnapshot_->byteLength() * 2, kDataSnapshotMinByteLength));
+            dataSnapshotBuffer_ = Napi::Persistent(buffer);
+            dataSnapshotRegion_ = {static_cast<std::byte*>(buffer.Data()), buffer.ByteLength()};
+        }
+
+        // SEEDED THROUGH THE SNAPSHOT'S SEQUENCE, NEVER FROM THE CLIENT'S BUFFER
+        dataSnapshot_ = std::make_unique<SessionDataSnapshot>(*dataSnapshot_, dataSnapshotRegion_);
+        return dataSnapshot_.get();
+    }
+
+    /**
+     * @brief Current var row as an `ArrayBuffer` holding the
+     *   `SessionDataSnapshot` region, the same buffer is returned until a
+     *   layout outgrows it (`Invalidated` is set in the old one)
+     *
+     *  > NOTE: the buffer is allocated by JS (external buffers are not
+     *  > allowed with the V8 sandbox) & written in place by the data
+     *  > provider thread
+     */
+    Napi::Value NativeSessionPlayer::jsGetDataSnapshot(const Napi::CallbackInfo& info) {
+        auto env = info.Env();
+        std::scoped_lock lock(dataSnapshotMutex_);
+        if (!attachDataSnapshot(env))
+            return env.Null();
+
+        return dataSnapshotBuffer_.Value();
+    }
+
+    /**
+     * @brief `{ version, vars }` of the snapshot in `dataSnapshot`, where
+     *   `version` matches its `LayoutVersion` header & `vars` lists each
+     *   var's `name`, `type`, `offset` & `count`
+     */
+    Napi::Value NativeSessionPlayer::jsGetDataSnapshotLayout(const Napi::CallbackInfo& info) {
+        auto env = info.Env();
+        std::scoped_lock lock(dataSnapshotMutex_);
+        auto snapshot = attachDataSnapshot(env);
+        if (!snapshot)
+            return env.Null();
+
+        auto& layout = snapshot->layout();
+        auto varsArray = Napi::Array::New(env, layout.size());
+        for (std::uint32_t idx = 0; idx < layout.size(); idx++) {
+            auto& varLayout = layout[idx];
+            auto varObj = Napi::Object::New(env);
+            varObj.Set("name", varLayout.name);
+            varObj.Set("type", magic_enum::enum_underlying(varLayout.type));
+            varObj.Set("offset", varLayout.offset);
+            varObj.Set("count", varLayout.count);
+            varsArray.Set(idx, varObj);
+        }
+
+        auto layoutObj = Napi::Object::New(env);
+        layoutObj.Set("version", snapshot->layoutVersion());
+        layoutObj.Set("vars", varsArray);
+        return layoutObj;
+    }
+
     Napi::Value
     NativeSessionPlayer::jsIsLive(const Napi::CallbackInfo& info) {
         auto env = info.Env();
@@ -345,36 +487,50 @@ namespace IRacingTools::App::Node {
         return {};
     }
 
+    /**
+     * @brief Deliver the next batch of queued events as a single array
+     */
     void JSSessionPlayerEventCallback(
         Napi::Env env,
         Napi::Function callback,
         // ReSharper disable once CppParameterMayBeConstPtrOrRef
         NativeSessionPlayerEventContextType* context,
         // ReSharper disable once CppParameterMayBeConstPtrOrRef
-        NativeSessionPlayerEventDataType* data
+        NativeSessionPlayerEventDataType*
     ) {
-        if (L->should_log(spdlog::level::trace))
-            L->trace("JSSessionPlayerEventCallback() eventType: {}", std::string(magic_enum::enum_name(data->type)));
+        bool hasMore = false;
+        auto events = context->queue->drain(hasMore);
+
+        // RE-SCHEDULE BEFORE CALLING INTO JS, SO A THROWING HANDLER CAN NOT STALL THE QUEUE
+        if (hasMore && (!env || napi_call_threadsafe_function(context->eventFn, nullptr, napi_tsfn_nonblocking) != napi_ok))
+            context->queue->unschedule();
 
+        if (L->should_log(spdlog::level::trace))
+            L->trace("JSSessionPlayerEventCallback() events: {}", events.size());
 
         if (!env || !callback) {
             L->warn("JS env AND/OR callback is nullptr");
-        } else {
-            L->trace("Creating JS object");
+            return;
+        }
+
+        if (events.empty())
+            return;
+
+        auto jsEvents = Napi::Array::New(env, events.size());
+        for (std::uint32_t idx = 0; idx < events.size(); idx++) {
+            auto& event = events[idx];
             auto jsObj = Napi::Object::New(env);
-            jsObj.Set("type", Napi::Number::New(env, data->type));
-            if (data->data) {
-                jsObj.Set("payload", Utils::MessageToUint8Array(env, data->data.get()));
+            jsObj.Set("type", Napi::Number::New(env, event.type));
+            if (event.data) {
+                jsObj.Set("payload", Utils::MessageToUint8Array(env, event.data.get()));
             } else {
                 jsObj.Set("payload", Napi::Value{});
             }
 
-            L->trace("Calling callback");
-            callback.Call(
-                {Napi::Number::New(env, data->type), jsObj}
-            );
+            jsEvents.Set(idx, jsObj);
         }
 
-        delete data;
+        L->trace("Calling callback");
+        callback.Call({jsEvents});
     }
 }
@@ -12,7 +12,9 @@
 
 #include <IRacingTools/SDK/Utils/Singleton.h>
 
+#include <IRacingTools/Shared/Common/CoalescingEventQueue.h>
 #include <IRacingTools/Shared/SessionDataProvider.h>
+#include <IRacingTools/Shared/SessionDataSnapshot.h>
 #include <IRacingTools/Shared/Services/TelemetryDataService.h>
 #include <IRacingTools/Shared/Services/TrackMapService.h>
 
@@ -47,8 +49,25 @@ namespace IRacingTools::App::Node {
         );
     };
 
-    using NativeSessionPlayerEventContextType = Napi::Reference<Napi::Value>;
-    using NativeSessionPlayerEventDataType = NativeSessionPlayerJSEvent;
+    /**
+     * @brief Data frames & timing changes are coalesced to the latest,
+     *   everything else is always delivered
+     */
+    using NativeSessionPlayerEventQueue = Shared::Common::CoalescingEventQueue<
+        RPC::Events::SessionEventType, NativeSessionPlayerJSEvent>;
+
+    /**
+     * @brief ThreadSafeFunction context, the callback drains `queue` in batches
+     *   & re-schedules itself via `eventFn` while events remain
+     */
+    struct NativeSessionPlayerEventContext {
+        Napi::Reference<Napi::Value> player;
+        std::shared_ptr<NativeSessionPlayerEventQueue> queue;
+        napi_threadsafe_function eventFn{nullptr};
+    };
+
+    using NativeSessionPlayerEventContextType = NativeSessionPlayerEventContext;
+    using NativeSessionPlayerEventDataType = void;
     using NativeSessionPlayerEventFinalizerDataType = void;
 
 
@@ -108,6 +127,9 @@ namespace IRacingTools::App::Node {
         Napi::Value jsGetSessionTiming(const Napi::CallbackInfo& info);
 
         Napi::Value jsIsAvailable(const Napi::CallbackInfo& info);
+        Napi::Value jsGetEventMetrics(const Napi::CallbackInfo& info);
+        Napi::Value jsGetDataSnapshot(const Napi::CallbackInfo& info);
+        Napi::Value jsGetDataSnapshotLayout(const Napi::CallbackInfo& info);
         Napi::Value jsIsLive(const Napi::CallbackInfo& info);
 
         Napi::Value jsGetFileInfo(const Napi::CallbackInfo& info);
@@ -126,6 +148,20 @@ namespace IRacingTools::App::Node {
 
         void destroy();
 
+        /**
+         * @brief Copy the current var row into `dataSnapshot_`, called on the
+         *   data provider thread for each data frame
+         */
+        void writeDataSnapshot();
+
+        /**
+         * @brief Move `dataSnapshot_` into `dataSnapshotBuffer_` if it is not
+         *   there yet, JS thread only & `dataSnapshotMutex_` must be held
+         *
+         * @return `nullptr` until the first data frame
+         */
+        SessionDataSnapshot* attachDataSnapshot(Napi::Env env);
+
         std::mutex sessionStateMutex_{};
         std::mutex destroyMutex_{};
         std::optional<std::filesystem::path> filePath_{std::nullopt};
@@ -135,6 +171,23 @@ namespace IRacingTools::App::Node {
         std::atomic_bool destroyed_{false};
 
         std::shared_ptr<NativeGlobal> system_;
+        std::shared_ptr<NativeSessionPlayerEventQueue> eventQueue_{};
+
+        /**
+         * @brief Written on the data provider thread & replaced there when
+         *   this client's var headers change
+         */
+        std::mutex dataSnapshotMutex_{};
+        std::unique_ptr<SessionDataSnapshot> dataSnapshot_{};
+        std::uint64_t dataSnapshotGeneration_{0};
+
+        /**
+         * @brief JS owned buffer the snapshot is written to once JS asked for
+         *   it, allocated on the JS thread & only replaced when a layout
+         *   outgrows it.  `dataSnapshotRegion_` is its backing store.
+         */
+        Napi::Reference<Napi::ArrayBuffer> dataSnapshotBuffer_{};
+        std::span<std::byte> dataSnapshotRegion_{};
         SessionPlayerEventFn jsSessionPlayerEventFn_;
         std::string id_;
 
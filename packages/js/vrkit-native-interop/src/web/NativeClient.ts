@@ -44,6 +44,35 @@ export type NativeClientEventCallback = (
     data: NativeClientEventData
 ) => void
 
+export interface NativeRequestLatency {
+  count: number
+  meanMicros: number
+  
+  /**
+   * Percentiles are bucket upper bounds, within 2x of the exact value
+   */
+  p50Micros: number
+  p90Micros: number
+  p99Micros: number
+  maxMicros: number
+}
+
+export interface NativeRequestRouteMetrics {
+  running: number
+  waiting: number
+  latency: NativeRequestLatency
+}
+
+export interface NativeRequestMetrics {
+  inFlight: number
+  latency: NativeRequestLatency
+  
+  /**
+   * Keyed by route match expression
+   */
+  routes: Record<string, NativeRequestRouteMetrics>
+}
+
 export interface NativeClient {
   /**
    * Destroy the native client instance
@@ -57,6 +86,12 @@ export interface NativeClient {
    * @param requestData
    */
   executeRequest(path: string, requestData: Uint8Array): Promise<Uint8Array>
+
+  /**
+   * Request latency & concurrency, latencies include time spent
+   * waiting on a route's concurrency limit
+   */
+  getRequestMetrics(): NativeRequestMetrics
   
   /**
    * @brief test internal event emitting
@@ -90,6 +125,12 @@ export interface NativeClient {
    */
   executeRequest(path: string, requestData: Uint8Array): Promise<Uint8Array>
 
+  /**
+   * Request latency & concurrency, latencies include time spent
+   * waiting on a route's concurrency limit
+   */
+  getRequestMetrics(): NativeRequestMetrics
+
   /**
    * @brief test internal event emitting
    *
@@ -7,6 +7,65 @@ export interface NativeOverlayWindowResourceInfo {
   size: SizeI
 }
 
+/**
+ * Pixel rect, compatible with `Electron.Rectangle`
+ */
+export interface NativeDamageRect {
+  x: number
+  y: number
+  width: number
+  height: number
+}
+
+/**
+ * Format of the pixels passed to `processFrame`, converted to
+ * premultiplied BGRA while copying
+ */
+export interface NativeFrameFormat {
+  /**
+   * Byte order, `RGB` is opaque (default `BGRA`)
+   */
+  layout?: "BGRA" | "RGBA" | "RGB"
+  
+  /**
+   * Default `true`
+   */
+  premultiplied?: boolean
+  
+  /**
+   * RGBA multiplier, each `0..1`
+   */
+  tint?: [number, number, number, number]
+}
+
+export interface NativeOverlayPacingMetrics {
+  /**
+   * Canvas submits per second, unchanged canvases are only
+   * resubmitted to keep VR consumers from dropping them
+   */
+  submitFPS: number
+  submitted: number
+  
+  /**
+   * `0` until a VR consumer is seen
+   */
+  consumerFPS: number
+  
+  /**
+   * Keyed by overlay id
+   */
+  overlays: Record<string, {
+    maxFPS: number
+    fps: number
+    rendered: number
+    
+    /**
+     * Frames held back by `maxFPS`
+     */
+    skipped: number
+  }>
+}
+
 export interface NativeOverlayManager {
   createOrUpdateResources(overlayId: string, windowId: number, imageSize: SizeI, screenRect: RectI, vrLayout: VRLayout): NativeOverlayWindowResourceInfo
   
@@ -17,7 +76,32 @@ export interface NativeOverlayManager {
   
   releaseResources(...windowOrOverlayIds:Array<string | number>): void
   
-  processFrame(overlayId: string, buf: Uint8Array): void
+  /**
+   * Produce a frame for an overlay
+   *
+   * @param overlayId
+   * @param buf image data, premultiplied BGRA unless `format` says otherwise
+   * @param damage regions changed since the previous frame, when omitted
+   *   the changes are found by diffing against the previous frame
+   * @param format layout of `buf`
+   */
+  processFrame(
+    overlayId: string,
+    buf: Uint8Array,
+    damage?: NativeDamageRect | NativeDamageRect[],
+    format?: NativeFrameFormat
+  ): void
+  
+  /**
+   * Limit how often an overlay is re-rendered, i.e. a standings
+   * overlay needs far fewer frames than a tachometer
+   *
+   * @param overlayId
+   * @param maxFPS `0` for the default (90)
+   */
+  setOverlayMaxFPS(overlayId: string, maxFPS: number): void
+  
+  getPacingMetrics(): NativeOverlayPacingMetrics
   
   destroy(): void
 }
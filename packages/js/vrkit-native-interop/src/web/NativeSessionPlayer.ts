@@ -5,6 +5,7 @@ import {
   SessionData,
   SessionDataVariable,
   SessionDataVariableHeader,
+  SessionDataVariableType,
   SessionEventType,
   SessionTiming
 } from "@vrkit-platform/models"
@@ -24,11 +25,64 @@ export type SessionPlayerId = string | "SESSION_TYPE_LIVE"
 
 export type SessionPlayerEventName = SessionEventType | keyof SessionEventType
 
+/**
+ * Events are delivered in batches, data frames & timing changes are
+ * coalesced to the latest when JS falls behind
+ */
 export type NativeSessionPlayerEventCallback = (
-    type: SessionEventType,
-    data: NativeSessionPlayerEventData
+    events: NativeSessionPlayerEventData[]
 ) => void
 
+/**
+ * Counters of the native event bridge
+ */
+export interface NativeSessionPlayerEventMetrics {
+  pushed: number
+  
+  delivered: number
+  
+  /**
+   * Replaced by a newer event of the same type
+   */
+  coalesced: number
+  
+  /**
+   * Discarded because the native queue was full
+   */
+  dropped: number
+  
+  batches: number
+  
+  queued: number
+}
+
+/**
+ * Position of a var in a `NativeSessionPlayer.dataSnapshot` row
+ */
+export interface NativeSessionDataSnapshotVar {
+  name: string
+  
+  type: SessionDataVariableType
+  
+  offset: number
+  
+  count: number
+}
+
+/**
+ * Layout of the rows in `NativeSessionPlayer.dataSnapshot`
+ *
+ * @see SessionDataSnapshotReader
+ */
+export interface NativeSessionDataSnapshotLayout {
+  /**
+   * Matches the buffer's `LayoutVersion` header while this layout is current
+   */
+  version: number
+  
+  vars: NativeSessionDataSnapshotVar[]
+}
+
 export interface NativeSessionPlayer {
   readonly sessionData: SessionData
   
@@ -42,6 +96,16 @@ export interface NativeSessionPlayer {
   
   readonly isAvailable: boolean
   
+  readonly eventMetrics: NativeSessionPlayerEventMetrics
+  
+  /**
+   * Native double buffered copy of the current var row, written in place,
+   * `null` until the first data frame
+   */
+  readonly dataSnapshot: ArrayBuffer | null
+  
+  readonly dataSnapshotLayout: NativeSessionDataSnapshotLayout | null
+  
   readonly id: string
   
   start(): boolean
@@ -0,0 +1,171 @@
+import { SessionDataVariableType, SessionDataVariableTypeSize } from "@vrkit-platform/models"
+import type { NativeSessionDataSnapshotVar, NativeSessionPlayer } from "./NativeSessionPlayer"
+
+/**
+ * Header word indexes, must match `SessionDataSnapshot::HeaderField`
+ */
+export enum SessionDataSnapshotHeaderField {
+  Sequence = 0,
+  ActiveSlot = 1,
+  RowSize = 2,
+  SlotStride = 3,
+  FrameCount = 4,
+  SessionTick = 5,
+  Invalidated = 6,
+  LayoutVersion = 7
+}
+
+export const SessionDataSnapshotHeaderSize = 64
+
+/**
+ * A consistent view of the current var row, only valid inside
+ * `SessionDataSnapshotReader.read()`
+ */
+export class SessionDataSnapshotFrame {
+  constructor(
+    private readonly view: DataView,
+    private readonly rowOffset: number,
+    private readonly vars: Map<string, NativeSessionDataSnapshotVar>,
+    readonly sessionTick: number
+  ) {}
+
+  has(name: string): boolean {
+    return this.vars.has(name)
+  }
+
+  get(name: string, entry: number = 0): number | boolean | null {
+    const dataVar = this.vars.get(name)
+    if (!dataVar || entry < 0 || entry >= dataVar.count) {
+      return null
+    }
+
+    const offset = this.rowOffset + dataVar.offset + entry * SessionDataVariableTypeSize[dataVar.type]
+    switch (dataVar.type) {
+      case SessionDataVariableType.Char:
+        return this.view.getUint8(offset)
+      case SessionDataVariableType.Bool:
+        return this.view.getUint8(offset) !== 0
+      case SessionDataVariableType.Int32:
+      case SessionDataVariableType.Bitmask:
+        return this.view.getInt32(offset, true)
+      case SessionDataVariableType.Float:
+        return this.view.getFloat32(offset, true)
+      case SessionDataVariableType.Double:
+        return this.view.getFloat64(offset, true)
+      default:
+        return null
+    }
+  }
+
+  getAll(name: string): Array<number | boolean> {
+    const dataVar = this.vars.get(name)
+    return !dataVar ? [] : Array.from({ length: dataVar.count }, (_, entry) => this.get(name, entry))
+  }
+}
+
+/**
+ * Reads vars from the native double buffered snapshot without calling into
+ * native code per var.  The native writer bumps `Sequence` (odd while
+ * flipping `ActiveSlot`), so a read is retried if a flip happened mid-read.
+ *
+ * The buffer is written in place, it is only fetched again once native sets
+ * `Invalidated` & the layout only when `LayoutVersion` moves.
+ */
+export class SessionDataSnapshotReader {
+  private buffer: ArrayBuffer = null
+
+  private header: Int32Array = null
+
+  private view: DataView = null
+
+  private layoutVersion = 0
+
+  private layoutVars: NativeSessionDataSnapshotVar[] = []
+
+  private vars = new Map<string, NativeSessionDataSnapshotVar>()
+
+  constructor(private readonly player: NativeSessionPlayer) {}
+
+  private refreshBuffer(): boolean {
+    if (this.buffer && this.header[SessionDataSnapshotHeaderField.Invalidated] === 0) {
+      return true
+    }
+
+    const buffer = this.player.dataSnapshot
+    if (!buffer) {
+      this.buffer = null
+      return false
+    }
+
+    if (buffer !== this.buffer) {
+      this.buffer = buffer
+      this.header = new Int32Array(buffer, 0, SessionDataSnapshotHeaderSize / 4)
+      this.view = new DataView(buffer)
+      this.layoutVersion = 0
+    }
+
+    return true
+  }
+
+  private refreshLayout(): boolean {
+    const layout = this.player.dataSnapshotLayout
+    if (!layout) {
+      return false
+    }
+
+    this.layoutVersion = layout.version
+    this.layoutVars = layout.vars
+    this.vars = new Map(layout.vars.map(dataVar => [dataVar.name, dataVar]))
+    return true
+  }
+
+  get layout(): NativeSessionDataSnapshotVar[] {
+    return this.read(() => this.layoutVars) ?? []
+  }
+
+  /**
+   * Run `fn` against a consistent frame
+   *
+   * @returns `null` when no snapshot is available
+   */
+  read<T>(fn: (frame: SessionDataSnapshotFrame) => T): T | null {
+    if (!this.refreshBuffer()) {
+      return null
+    }
+
+    while (true) {
+      const { header, view } = this
+      const before = Atomics.load(header, SessionDataSnapshotHeaderField.Sequence)
+      if (before & 1) {
+        continue
+      }
+
+      if (header[SessionDataSnapshotHeaderField.Invalidated] !== 0) {
+        if (!this.refreshBuffer()) {
+          return null
+        }
+
+        continue
+      }
+
+      // CHECKED AGAIN WITH THE NEW LAYOUT, IN CASE IT CHANGED WHILE FETCHING
+      if (header[SessionDataSnapshotHeaderField.LayoutVersion] !== this.layoutVersion) {
+        if (!this.refreshLayout()) {
+          return null
+        }
+
+        continue
+      }
+
+      const stride = header[SessionDataSnapshotHeaderField.SlotStride]
+      const rowOffset = SessionDataSnapshotHeaderSize + header[SessionDataSnapshotHeaderField.ActiveSlot] * stride
+      const result = fn(
+        new SessionDataSnapshotFrame(view, rowOffset, this.vars, header[SessionDataSnapshotHeaderField.SessionTick])
+      )
+
+      if (Atomics.load(header, SessionDataSnapshotHeaderField.Sequence) === before) {
+        return result
+      }
+    }
+  }
+}
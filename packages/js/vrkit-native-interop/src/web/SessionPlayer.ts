@@ -19,6 +19,7 @@ import {
 import { getLogger } from "@3fv/logger-proxy"
 import { MessageTypeFromCtor, objectKeysLowerFirstReviver } from "./utils"
 import { GetNativeExports } from "./NativeBinding"
+import { SessionDataSnapshotReader } from "./SessionDataSnapshot"
 import { flatten, identity, isEmpty, negate, pick, range } from "lodash"
 
 import type { SessionInfoMessage } from "@vrkit-platform/plugin-sdk"
@@ -26,6 +27,7 @@ import {
   NativeSessionPlayer,
   NativeSessionPlayerEventCallback,
   NativeSessionPlayerEventData,
+  NativeSessionPlayerEventMetrics,
   SessionPlayerId
 } from "./NativeSessionPlayer"
 
@@ -93,6 +95,8 @@ export class SessionPlayer extends EventEmitter3<SessionPlayerEventArgs, Session
   
   private nativePlayer:NativeSessionPlayer
   
+  private dataSnapshotReader:SessionDataSnapshotReader = null
+  
   private dataVariableHeaderCount = -1
   
   private dataVariableHeaderMap:{ [name:string]:SessionDataVariableHeader } = {}
@@ -146,9 +150,19 @@ export class SessionPlayer extends EventEmitter3<SessionPlayerEventArgs, Session
   }
   
   /**
-   * Event handler that is passed to the native client
+   * Batch event handler that is passed to the native client
    * on creation
    *
+   * @param events
+   * @private
+   */
+  private onEvents(events:NativeSessionPlayerEventData[]):void {
+    events.forEach(event => this.onEvent(event.type, event))
+  }
+  
+  /**
+   * Handle a single native event
+   *
    * @param type
    * @param nativeData
    * @private
@@ -199,7 +213,7 @@ export class SessionPlayer extends EventEmitter3<SessionPlayerEventArgs, Session
   
   private initialize():boolean {
     this.nativePlayer =
-        CreateNativeSessionPlayer(this.onEvent.bind(this), this.id, this.file)
+        CreateNativeSessionPlayer(this.onEvents.bind(this), this.id, this.file)
     
     return !!this.nativePlayer
   }
@@ -215,6 +229,25 @@ export class SessionPlayer extends EventEmitter3<SessionPlayerEventArgs, Session
     return this.nativePlayer?.isAvailable
   }
   
+  /**
+   * Reads the current var row from native memory, without a native call per
+   * variable like `getDataVariableValueMap()`
+   */
+  get dataSnapshot():SessionDataSnapshotReader {
+    if (!this.dataSnapshotReader && this.nativePlayer) {
+      this.dataSnapshotReader = new SessionDataSnapshotReader(this.nativePlayer)
+    }
+    
+    return this.dataSnapshotReader
+  }
+  
+  /**
+   * Native event bridge counters (dropped, coalesced, etc)
+   */
+  get eventMetrics():NativeSessionPlayerEventMetrics {
+    return this.nativePlayer?.eventMetrics
+  }
+  
   /**
    * Start the player, `Start != Play`
    */
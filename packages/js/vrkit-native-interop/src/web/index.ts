@@ -1,6 +1,7 @@
 
 export {Shutdown, IsNativeOverlaySupported, GetNativeExports} from "./NativeBinding"
 export * from "./NativeSessionPlayer"
+export * from "./SessionDataSnapshot"
 export * from "./SessionPlayer"
 
 export * from "./NativeClient"
@@ -39,8 +39,27 @@ export class LapTrajectoryConverter {
     this.pixelConverter = new CoordinateToPixelConverter(zoomLevel, this.convertToInteger)
   }
   
-  populateXYData(trajectory: LapTrajectory):LapCoordinateData {
-    let path = trajectory.path
+  /**
+   * The smallest level of detail that can be drawn `maxSize` pixels
+   * across, the full path when none is large enough
+   *
+   * @param trajectory
+   * @param maxSize longest side of the overlay in pixels
+   */
+  static selectPath(trajectory: LapTrajectory, maxSize?: number): LapCoordinate[] {
+    if (!maxSize) {
+      return trajectory.path
+    }
+
+    const lod = (trajectory.levelsOfDetail ?? [])
+      .filter(it => it.maxSize >= maxSize && it.path.length > 0)
+      .sort((a, b) => a.maxSize - b.maxSize)[0]
+
+    return lod?.path ?? trajectory.path
+  }
+
+  populateXYData(trajectory: LapTrajectory, maxSize?: number):LapCoordinateData {
+    let path = LapTrajectoryConverter.selectPath(trajectory, maxSize)
     let previousCoord: Coordinate = null
     let totalMeters = 0
     
@@ -130,9 +149,9 @@ export class LapTrajectoryConverter {
     return pathData
   }
   
-  toTrackMap(trajectory: LapTrajectory): TrackMap {
+  toTrackMap(trajectory: LapTrajectory, maxSize?: number): TrackMap {
     
-    const pathData = this.populateXYData(trajectory)
+    const pathData = this.populateXYData(trajectory, maxSize)
 
     return TrackMap.create({
       path: pathData.steps.map(step => LapCoordinate.create(step.coordinate)),
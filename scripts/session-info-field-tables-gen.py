@@ -0,0 +1,142 @@
+"""
+Generates `ModelFieldTables.h` (the `ModelFields<T>` specializations used by
+`SessionInfoFastParser`) from the `YAML::convert<T>::decode` functions in
+`ModelParser.h`, so the fast parser and the yaml-cpp fallback always decode
+the same keys, with the same types & defaults.
+
+Usage: python scripts/session-info-field-tables-gen.py
+"""
+
+import os
+import re
+
+SESSION_INFO_DIR = os.path.join(
+    os.path.dirname(os.path.abspath(__file__)),
+    "..",
+    "packages",
+    "cpp",
+    "lib-irsdk++",
+    "include",
+    "IRacingTools",
+    "SDK",
+    "SessionInfo",
+)
+
+MODEL_PARSER_FILE = os.path.join(SESSION_INFO_DIR, "ModelParser.h")
+OUT_FILE = os.path.join(SESSION_INFO_DIR, "ModelFieldTables.h")
+
+CONVERT_PATTERN = re.compile(r"struct convert<(\w+)>")
+DECODE_PATTERN = re.compile(r"static bool decode\(")
+FIELD_PATTERN = re.compile(
+    r"^\s*rhs\.(\w+)\s*=\s*node\[\"(\w+)\"\]\.as<(.+)>\((.*)\);\s*$"
+)
+
+HEADER = """//
+// GENERATED BY `scripts/session-info-field-tables-gen.py` FROM `ModelParser.h`
+// DO NOT EDIT BY HAND, RE-RUN THE GENERATOR AFTER CHANGING ANY DECODER
+//
+
+#pragma once
+
+#include "ModelFields.h"
+#include "SessionInfoMessage.h"
+
+namespace IRacingTools::SDK::SessionInfo {
+"""
+
+FOOTER = """}
+"""
+
+
+def parse_models(source: str):
+    models = []
+    current = None
+    in_decode = False
+    for line in source.splitlines():
+        convert_match = CONVERT_PATTERN.search(line)
+        if convert_match:
+            current = (convert_match.group(1), [])
+            models.append(current)
+            in_decode = False
+            continue
+
+        if current is None:
+            continue
+
+        if DECODE_PATTERN.search(line):
+            in_decode = True
+            continue
+
+        if not in_decode or line.strip().startswith("//"):
+            continue
+
+        field_match = FIELD_PATTERN.match(line)
+        if field_match:
+            member, key, value_type, default = field_match.groups()
+            current[1].append((member, key, value_type, default.strip() != ""))
+
+    return models
+
+
+def render_model(name: str, fields) -> str:
+    field_lines = []
+    for member, key, value_type, has_default in fields:
+        presence = "FieldPresence::Optional" if has_default else "FieldPresence::Required"
+        field_lines.append(
+            f"      MakeField<&{name}::{member}, {value_type}>(\"{key}\", {presence}),"
+        )
+
+    if not field_lines:
+        return f"""
+  template<> struct ModelFields<{name}> {{
+    static constexpr std::array<FieldDescriptor, 0> Fields{{}};
+  }};
+"""
+
+    fields_code = "\n".join(field_lines)
+    return f"""
+  template<> struct ModelFields<{name}> {{
+    static constexpr std::array Fields{{
+{fields_code}
+    }};
+  }};
+"""
+
+
+def sort_models(models):
+    """
+    Nested models first, so each `ModelFields<T>` specialization is
+    declared before a parent table references it
+    """
+    by_name = dict(models)
+    ordered = []
+    visited = set()
+
+    def visit(name):
+        if name in visited or name not in by_name:
+            return
+        visited.add(name)
+        for _, _, value_type, _ in by_name[name]:
+            child = re.sub(r"^std::vector<(\w+)>$", r"\1", value_type)
+            visit(child)
+        ordered.append((name, by_name[name]))
+
+    for name, _ in models:
+        visit(name)
+
+    return ordered
+
+
+def main():
+    with open(MODEL_PARSER_FILE, "r") as fp:
+        models = sort_models(parse_models(fp.read()))
+
+    code = HEADER + "".join(render_model(name, fields) for name, fields in models) + FOOTER
+
+    print(f"Writing {len(models)} models to {OUT_FILE}")
+    with open(OUT_FILE, "w", newline="\n") as fp:
+        fp.write(code)
+
+
+if __name__ == "__main__":
+    main()